@@ -0,0 +1,917 @@
+/*
+ * MD4C: Markdown parser for C
+ * (http://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2020 Martin Mitas
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <time.h>
+#endif
+
+#include "md4c.h"
+#include "md4c-html.h"
+#include "cmdline.h"
+
+
+
+/* Global options. */
+static size_t doc_size = 1024 * 1024;
+static unsigned n_runs = 10;
+static unsigned seed = 1;
+static const char* corpus_filter = NULL;
+static const char* flags_filter = NULL;
+static const char* mode_filter = NULL;
+static const char* dump_corpus = NULL;
+static const char* baseline_path = NULL;
+static double tolerance = 10.0;
+
+
+/*********************************
+ ***  Simple grow-able buffer  ***
+ *********************************/
+
+struct membuffer {
+    char* data;
+    size_t asize;
+    size_t size;
+};
+
+static void
+membuf_grow(struct membuffer* buf, size_t new_asize)
+{
+    buf->data = realloc(buf->data, new_asize);
+    if(buf->data == NULL) {
+        fprintf(stderr, "membuf_grow: realloc() failed.\n");
+        exit(1);
+    }
+    buf->asize = new_asize;
+}
+
+static void
+membuf_append(struct membuffer* buf, const char* data, size_t size)
+{
+    if(buf->asize < buf->size + size)
+        membuf_grow(buf, buf->size + buf->size / 2 + size + 64);
+    memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void
+membuf_puts(struct membuffer* buf, const char* str)
+{
+    membuf_append(buf, str, strlen(str));
+}
+
+
+/**************************
+ ***  Corpus generator  ***
+ **************************/
+
+/* The generator is deterministic: The same seed and size always produce the
+ * same documents, so results of different builds can be compared. Each kind
+ * of the corpus keeps appending its typical blocks until the document has
+ * the requested size. */
+
+static unsigned long long rng_state;
+
+static unsigned
+rng(unsigned n)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned) ((rng_state >> 11) % n);
+}
+
+static const char* const words[] = {
+    "lorem", "ipsum", "dolor", "sit", "amet", "consectetur", "adipiscing",
+    "elit", "sed", "do", "eiusmod", "tempor", "incididunt", "ut", "labore",
+    "et", "dolore", "magna", "aliqua", "enim", "ad", "minim", "veniam",
+    "quis", "nostrud", "exercitation", "ullamco", "laboris", "nisi", "aliquip"
+};
+#define N_WORDS     (sizeof(words) / sizeof(words[0]))
+
+static void
+gen_word(struct membuffer* buf)
+{
+    membuf_puts(buf, words[rng(N_WORDS)]);
+}
+
+/* A run of words with occasional inline markup. */
+static void
+gen_inline(struct membuffer* buf, unsigned n_words)
+{
+    unsigned i;
+
+    for(i = 0; i < n_words; i++) {
+        if(i > 0)
+            membuf_append(buf, " ", 1);
+
+        switch(rng(24)) {
+            case 0:     membuf_puts(buf, "*"); gen_word(buf); membuf_puts(buf, "*"); break;
+            case 1:     membuf_puts(buf, "**"); gen_word(buf); membuf_puts(buf, "**"); break;
+            case 2:     membuf_puts(buf, "`"); gen_word(buf); membuf_puts(buf, "()`"); break;
+            case 3:     membuf_puts(buf, "_"); gen_word(buf); membuf_puts(buf, "_"); break;
+            case 4:     membuf_puts(buf, "~~"); gen_word(buf); membuf_puts(buf, "~~"); break;
+            case 5:     gen_word(buf); membuf_puts(buf, ","); break;
+            default:    gen_word(buf); break;
+        }
+    }
+}
+
+static void
+gen_paragraph(struct membuffer* buf)
+{
+    unsigned n_lines = 2 + rng(6);
+    unsigned i;
+
+    for(i = 0; i < n_lines; i++) {
+        gen_inline(buf, 6 + rng(8));
+        membuf_puts(buf, (i + 1 < n_lines ? "\n" : ".\n\n"));
+    }
+}
+
+static void
+gen_prose(struct membuffer* buf)
+{
+    if(rng(8) == 0) {
+        membuf_puts(buf, (rng(2) ? "# " : "## "));
+        gen_inline(buf, 2 + rng(4));
+        membuf_puts(buf, "\n\n");
+    }
+    if(rng(10) == 0) {
+        membuf_puts(buf, "> ");
+        gen_inline(buf, 8 + rng(8));
+        membuf_puts(buf, "\n\n");
+    }
+    gen_paragraph(buf);
+}
+
+static void
+gen_list_items(struct membuffer* buf, unsigned depth)
+{
+    unsigned n_items = 2 + rng(5);
+    int ordered = (rng(3) == 0);
+    int loose = (rng(4) == 0);
+    char marker[32];
+    unsigned i, j;
+
+    for(i = 0; i < n_items; i++) {
+        for(j = 0; j < depth; j++)
+            membuf_puts(buf, "    ");
+        if(ordered)
+            sprintf(marker, "%u. ", i + 1);
+        else if(rng(6) == 0)
+            sprintf(marker, "- [%c] ", rng(2) ? 'x' : ' ');
+        else
+            sprintf(marker, "%c ", "-*+"[depth % 3]);
+        membuf_puts(buf, marker);
+        gen_inline(buf, 3 + rng(10));
+        membuf_puts(buf, "\n");
+        if(loose)
+            membuf_puts(buf, "\n");
+        if(depth < 3  &&  rng(4) == 0)
+            gen_list_items(buf, depth + 1);
+    }
+}
+
+static void
+gen_lists(struct membuffer* buf)
+{
+    gen_list_items(buf, 0);
+    membuf_puts(buf, "\n");
+}
+
+static void
+gen_tables(struct membuffer* buf)
+{
+    unsigned n_cols = 2 + rng(5);
+    unsigned n_rows = 3 + rng(20);
+    unsigned i, j;
+
+    for(j = 0; j < n_cols; j++) {
+        membuf_puts(buf, "| ");
+        gen_word(buf);
+        membuf_puts(buf, " ");
+    }
+    membuf_puts(buf, "|\n");
+    for(j = 0; j < n_cols; j++) {
+        static const char* const aligns[] = { "| --- ", "|:--- ", "| ---:", "|:---:" };
+        membuf_puts(buf, aligns[rng(4)]);
+    }
+    membuf_puts(buf, "|\n");
+    for(i = 0; i < n_rows; i++) {
+        for(j = 0; j < n_cols; j++) {
+            membuf_puts(buf, "| ");
+            gen_inline(buf, 1 + rng(4));
+            membuf_puts(buf, " ");
+        }
+        membuf_puts(buf, "|\n");
+    }
+    membuf_puts(buf, "\n");
+}
+
+/* Long tables like the ones exported from a database: many rows of short,
+ * mostly plain cells, some of them with a link or a code span. */
+static void
+gen_data_tables(struct membuffer* buf)
+{
+    char tmp[128];
+    unsigned n_rows = 500 + rng(1500);
+    unsigned i;
+
+    membuf_puts(buf, "| ID | Date | Name | Amount | Status | Note |\n");
+    membuf_puts(buf, "|---:|:----:|------|-------:|--------|------|\n");
+    for(i = 0; i < n_rows; i++) {
+        sprintf(tmp, "| %u | 20%02u-%02u-%02u | %s %s | %u.%02u | ",
+                i + 1, rng(30), 1 + rng(12), 1 + rng(28),
+                words[rng(N_WORDS)], words[rng(N_WORDS)], rng(100000), rng(100));
+        membuf_puts(buf, tmp);
+        switch(rng(10)) {
+            case 0:     sprintf(tmp, "[%s](https://example.com/item/%u)", words[rng(N_WORDS)], i + 1); break;
+            case 1:     sprintf(tmp, "`%s-%u`", words[rng(N_WORDS)], rng(1000)); break;
+            default:    sprintf(tmp, "%s", words[rng(N_WORDS)]); break;
+        }
+        membuf_puts(buf, tmp);
+        membuf_puts(buf, " | ");
+        if(rng(4) == 0)
+            gen_word(buf);
+        membuf_puts(buf, " |\n");
+    }
+    membuf_puts(buf, "\n");
+}
+
+static void
+gen_links(struct membuffer* buf)
+{
+    char tmp[128];
+    unsigned n_lines = 2 + rng(5);
+    unsigned i;
+
+    for(i = 0; i < n_lines; i++) {
+        gen_inline(buf, 2 + rng(4));
+        switch(rng(7)) {
+            case 0:
+                sprintf(tmp, " [%s %u][ref%u]", words[rng(N_WORDS)], rng(100), rng(200));
+                break;
+            case 1:
+                sprintf(tmp, " [ref%u] and [%s][]", rng(200), words[rng(N_WORDS)]);
+                break;
+            case 2:
+                sprintf(tmp, " [%s](https://example.com/%s/%u \"Title %u\")",
+                        words[rng(N_WORDS)], words[rng(N_WORDS)], rng(1000), rng(10));
+                break;
+            case 3:
+                sprintf(tmp, " ![%s](img/%u.png)", words[rng(N_WORDS)], rng(1000));
+                break;
+            case 4:
+                sprintf(tmp, " <https://example.org/%s?id=%u>", words[rng(N_WORDS)], rng(1000));
+                break;
+            case 5:
+                sprintf(tmp, " www.example.net/%s and %s@example.com",
+                        words[rng(N_WORDS)], words[rng(N_WORDS)]);
+                break;
+            default:
+                sprintf(tmp, " [[%s %u]]", words[rng(N_WORDS)], rng(100));
+                break;
+        }
+        membuf_puts(buf, tmp);
+        membuf_puts(buf, "\n");
+    }
+    membuf_puts(buf, "\n");
+
+    /* Reference definitions. Most of them are used, some of them are
+     * defined repeatedly (the first definition wins). */
+    n_lines = rng(4);
+    for(i = 0; i < n_lines; i++) {
+        sprintf(tmp, "[ref%u]: https://example.com/ref/%u \"Reference %u\"\n",
+                rng(200), rng(1000), rng(10));
+        membuf_puts(buf, tmp);
+    }
+    if(n_lines > 0)
+        membuf_puts(buf, "\n");
+}
+
+static void
+gen_code(struct membuffer* buf)
+{
+    static const char* const langs[] = { "c", "python", "sh", "" };
+    unsigned n_lines = 3 + rng(25);
+    unsigned i, j;
+    int indented = (rng(3) == 0);
+
+    if(!indented) {
+        membuf_puts(buf, (rng(4) == 0 ? "~~~" : "```"));
+        membuf_puts(buf, langs[rng(4)]);
+        membuf_puts(buf, "\n");
+    }
+    for(i = 0; i < n_lines; i++) {
+        if(indented)
+            membuf_puts(buf, "    ");
+        for(j = rng(4); j > 0; j--)
+            membuf_puts(buf, "    ");
+        gen_word(buf);
+        membuf_puts(buf, (rng(3) == 0 ? " = " : "("));
+        gen_word(buf);
+        membuf_puts(buf, (rng(2) ? " < 3 && x > 1);\n" : " & \"<tag>\";\n"));
+    }
+    if(!indented)
+        membuf_puts(buf, "```\n");
+    membuf_puts(buf, "\n");
+
+    if(rng(2))
+        gen_paragraph(buf);
+}
+
+static void
+gen_html(struct membuffer* buf)
+{
+    unsigned n_lines = 2 + rng(8);
+    unsigned i;
+
+    switch(rng(4)) {
+        case 0:
+            membuf_puts(buf, "<div class=\"note\">\n");
+            for(i = 0; i < n_lines; i++) {
+                membuf_puts(buf, "<p>");
+                gen_inline(buf, 4 + rng(6));
+                membuf_puts(buf, "</p>\n");
+            }
+            membuf_puts(buf, "</div>\n\n");
+            break;
+
+        case 1:
+            membuf_puts(buf, "<!--\n");
+            for(i = 0; i < n_lines; i++) {
+                gen_inline(buf, 4 + rng(6));
+                membuf_puts(buf, "\n");
+            }
+            membuf_puts(buf, "-->\n\n");
+            break;
+
+        default:
+            for(i = 0; i < n_lines; i++) {
+                gen_inline(buf, 2 + rng(4));
+                membuf_puts(buf, (rng(2) ? " <span class=\"x\">" : " <a href=\"/y\" title='z'>"));
+                gen_word(buf);
+                membuf_puts(buf, (rng(2) ? "</span> &amp; &copy; " : "</a> &#169; &#x3C; "));
+                gen_word(buf);
+                membuf_puts(buf, " <br/>\n");
+            }
+            membuf_puts(buf, "\n");
+            break;
+    }
+}
+
+typedef struct CORPUS {
+    const char* name;
+    void (*gen_block)(struct membuffer*);
+} CORPUS;
+
+static const CORPUS corpora[] = {
+    { "prose",  gen_prose },
+    { "lists",  gen_lists },
+    { "tables", gen_tables },
+    { "data-tables", gen_data_tables },
+    { "links",  gen_links },
+    { "code",   gen_code },
+    { "html",   gen_html }
+};
+#define N_CORPORA   (sizeof(corpora) / sizeof(corpora[0]))
+
+static void
+generate(const CORPUS* corpus, struct membuffer* buf)
+{
+    rng_state = 0x9E3779B97F4A7C15ULL ^ seed;
+    buf->size = 0;
+    while(buf->size < doc_size)
+        corpus->gen_block(buf);
+}
+
+
+/*********************
+ ***  Flag matrix  ***
+ *********************/
+
+typedef struct FLAGS {
+    const char* name;
+    unsigned flags;
+} FLAGS;
+
+static const FLAGS flag_sets[] = {
+    { "commonmark",                 MD_DIALECT_COMMONMARK },
+    { "github",                     MD_DIALECT_GITHUB },
+    { "collapse-whitespace",        MD_FLAG_COLLAPSEWHITESPACE },
+    { "permissive-atx-headers",     MD_FLAG_PERMISSIVEATXHEADERS },
+    { "permissive-url-autolinks",   MD_FLAG_PERMISSIVEURLAUTOLINKS },
+    { "permissive-email-autolinks", MD_FLAG_PERMISSIVEEMAILAUTOLINKS },
+    { "permissive-www-autolinks",   MD_FLAG_PERMISSIVEWWWAUTOLINKS },
+    { "no-indented-code",           MD_FLAG_NOINDENTEDCODEBLOCKS },
+    { "no-html-blocks",             MD_FLAG_NOHTMLBLOCKS },
+    { "no-html-spans",              MD_FLAG_NOHTMLSPANS },
+    { "tables",                     MD_FLAG_TABLES },
+    { "strikethrough",              MD_FLAG_STRIKETHROUGH },
+    { "tasklists",                  MD_FLAG_TASKLISTS },
+    { "latex-math",                 MD_FLAG_LATEXMATHSPANS },
+    { "wiki-links",                 MD_FLAG_WIKILINKS },
+    { "underline",                  MD_FLAG_UNDERLINE },
+    { "header-self-links",          MD_FLAG_HEADERSELFLINKS },
+    { "code-links",                 MD_FLAG_CODELINKS }
+};
+#define N_FLAG_SETS     (sizeof(flag_sets) / sizeof(flag_sets[0]))
+
+/* Check whether name is in the comma-separated list (NULL means all). */
+static int
+is_selected(const char* list, const char* name)
+{
+    size_t len = strlen(name);
+    const char* p = list;
+
+    if(list == NULL)
+        return 1;
+
+    while(p != NULL  &&  *p != '\0') {
+        const char* end = strchr(p, ',');
+        size_t n = (end != NULL ? (size_t) (end - p) : strlen(p));
+
+        if(n == len  &&  strncmp(p, name, len) == 0)
+            return 1;
+        p = (end != NULL ? end + 1 : NULL);
+    }
+
+    return 0;
+}
+
+
+/*******************
+ ***  Measuring  ***
+ *******************/
+
+static double
+wall_clock(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#endif
+}
+
+static int
+null_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) type; (void) detail; (void) userdata;
+    return 0;
+}
+
+static int
+null_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) type; (void) detail; (void) userdata;
+    return 0;
+}
+
+static int
+null_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    (void) type; (void) text; (void) size; (void) userdata;
+    return 0;
+}
+
+/* The HTML goes nowhere. We only count it, so the compiler cannot optimize
+ * anything away. */
+static void
+null_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    (void) text;
+    *(size_t*) userdata += size;
+}
+
+static int
+run_parse(const struct membuffer* doc, unsigned flags)
+{
+    MD_PARSER parser = {0};
+
+    parser.flags = flags;
+    parser.enter_block = null_block;
+    parser.leave_block = null_block;
+    parser.enter_span = null_span;
+    parser.leave_span = null_span;
+    parser.text = null_text;
+
+    return md_parse(doc->data, (MD_SIZE) doc->size, &parser, NULL);
+}
+
+static int
+run_html(const struct membuffer* doc, unsigned flags)
+{
+    MD_HTML_CALLBACKS callbacks = { null_output, NULL, NULL, NULL, NULL, NULL };
+    size_t out_size = 0;
+
+    return md_html(doc->data, (MD_SIZE) doc->size, callbacks, &out_size, flags, 0);
+}
+
+/* Render the document through MD_HTML_CACHE. After the warm-up run, this
+ * measures the cache hits. */
+static int
+run_html_cached(const struct membuffer* doc, unsigned flags)
+{
+    static MD_HTML_CACHE* cache = NULL;
+    static size_t cached_size;
+    static unsigned cached_flags;
+    MD_HTML_CALLBACKS callbacks = { null_output, NULL, NULL, NULL, NULL, NULL };
+    MD_HTML* html;
+    size_t out_size = 0;
+    int ret;
+
+    /* Start with an empty cache for each corpus and flag set. Each shard
+     * (1/16 of the cache) can hold the input and up to three times as much
+     * of HTML. */
+    if(cache == NULL  ||  doc->size != cached_size  ||  flags != cached_flags) {
+        md_html_cache_destroy(cache);
+        cache = md_html_cache_create(16 * 4 * (doc->size + 1024));
+        if(cache == NULL)
+            return -1;
+        cached_size = doc->size;
+        cached_flags = flags;
+    }
+
+    html = md_html_create(callbacks, flags, 0);
+    if(html == NULL)
+        return -1;
+    md_html_set_cache(html, cache);
+    ret = md_html_render(html, doc->data, (MD_SIZE) doc->size, &out_size);
+    md_html_destroy(html);
+    return ret;
+}
+
+static int
+run_tree(const struct membuffer* doc, unsigned flags)
+{
+    MD_PARSER parser = {0};
+    MD_TREE* tree;
+    int ret;
+
+    parser.flags = flags;
+    ret = md_parse_tree(doc->data, (MD_SIZE) doc->size, &parser, &tree);
+    md_tree_destroy(tree);
+    return ret;
+}
+
+typedef struct RESULT {
+    const char* corpus;
+    const char* flags;
+    const char* mode;
+    size_t size;
+    double mb_per_s;    /* From the median. */
+    double ns_per_byte[5];  /* Min, p50, p90, p99, max. */
+} RESULT;
+
+static int
+cmp_double(const void* a, const void* b)
+{
+    double da = *(const double*) a;
+    double db = *(const double*) b;
+    return (da < db ? -1 : (da > db ? +1 : 0));
+}
+
+/* Nearest-rank percentile of the sorted samples. */
+static double
+percentile(const double* sorted, unsigned n, unsigned pct)
+{
+    unsigned rank = (pct * n + 99) / 100;
+    return sorted[rank > 0 ? rank - 1 : 0];
+}
+
+static int
+measure(const struct membuffer* doc, unsigned flags, int (*run)(const struct membuffer*, unsigned),
+        double* samples, RESULT* result)
+{
+    unsigned i;
+    double t0, t1;
+
+    /* One warm-up run. */
+    if(run(doc, flags) != 0)
+        return -1;
+
+    for(i = 0; i < n_runs; i++) {
+        t0 = wall_clock();
+        if(run(doc, flags) != 0)
+            return -1;
+        t1 = wall_clock();
+        samples[i] = (t1 - t0) * 1e9 / (double) doc->size;
+    }
+
+    qsort(samples, n_runs, sizeof(double), cmp_double);
+    result->size = doc->size;
+    result->ns_per_byte[0] = samples[0];
+    result->ns_per_byte[1] = percentile(samples, n_runs, 50);
+    result->ns_per_byte[2] = percentile(samples, n_runs, 90);
+    result->ns_per_byte[3] = percentile(samples, n_runs, 99);
+    result->ns_per_byte[4] = samples[n_runs - 1];
+    result->mb_per_s = (result->ns_per_byte[1] > 0 ? 1e3 / result->ns_per_byte[1] : 0);
+    return 0;
+}
+
+
+/******************
+ ***  Baseline  ***
+ ******************/
+
+/* The baseline is an older output of this program. Every result is on its own
+ * line there, so we do not need any real JSON parser to read it back. */
+
+static int
+json_get_string(const char* line, const char* key, char* value, size_t value_size)
+{
+    char pattern[64];
+    const char* p;
+    size_t n = 0;
+
+    sprintf(pattern, "\"%s\": \"", key);
+    p = strstr(line, pattern);
+    if(p == NULL)
+        return -1;
+    p += strlen(pattern);
+    while(p[n] != '"'  &&  p[n] != '\0'  &&  n + 1 < value_size) {
+        value[n] = p[n];
+        n++;
+    }
+    value[n] = '\0';
+    return 0;
+}
+
+static int
+json_get_number(const char* line, const char* key, double* value)
+{
+    char pattern[64];
+    const char* p;
+
+    sprintf(pattern, "\"%s\": ", key);
+    p = strstr(line, pattern);
+    if(p == NULL)
+        return -1;
+    *value = atof(p + strlen(pattern));
+    return 0;
+}
+
+/* Compare the results with the baseline. Returns count of regressions, i.e.
+ * of results slower than the baseline by more than the tolerance. */
+static int
+compare_baseline(const RESULT* results, unsigned n_results)
+{
+    FILE* f;
+    char line[1024];
+    char corpus[64], flags[64], mode[64];
+    double mb_per_s;
+    unsigned i;
+    int n_regressions = 0;
+    int n_compared = 0;
+
+    f = fopen(baseline_path, "r");
+    if(f == NULL) {
+        fprintf(stderr, "Cannot open %s.\n", baseline_path);
+        return -1;
+    }
+
+    while(fgets(line, sizeof(line), f) != NULL) {
+        if(json_get_string(line, "corpus", corpus, sizeof(corpus)) != 0  ||
+           json_get_string(line, "flags", flags, sizeof(flags)) != 0  ||
+           json_get_string(line, "mode", mode, sizeof(mode)) != 0  ||
+           json_get_number(line, "mb_per_s", &mb_per_s) != 0)
+            continue;
+
+        for(i = 0; i < n_results; i++) {
+            const RESULT* r = &results[i];
+            double change;
+
+            if(strcmp(r->corpus, corpus) != 0  ||  strcmp(r->flags, flags) != 0  ||
+               strcmp(r->mode, mode) != 0  ||  mb_per_s <= 0)
+                continue;
+
+            n_compared++;
+            change = (r->mb_per_s - mb_per_s) * 100.0 / mb_per_s;
+            if(change < -tolerance) {
+                fprintf(stderr, "Regression: %s/%s/%s: %.2f MB/s (baseline %.2f MB/s, %+.1f %%)\n",
+                        corpus, flags, mode, r->mb_per_s, mb_per_s, change);
+                n_regressions++;
+            }
+        }
+    }
+
+    fclose(f);
+    fprintf(stderr, "Compared %d results with the baseline: %d regression(s) over %.1f %%.\n",
+            n_compared, n_regressions, tolerance);
+    return n_regressions;
+}
+
+
+/**********************
+ ***  Main program  ***
+ **********************/
+
+static const CMDLINE_OPTION cmdline_options[] = {
+    { 's', "size",                          's', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'n', "runs",                          'n', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "seed",                          'S', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'c', "corpus",                        'c', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'f', "flags",                         'f', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'm', "mode",                          'm', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'b', "baseline",                      'b', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 't', "tolerance",                     't', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "dump",                          'd', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'h', "help",                          'h', 0 },
+    {  0,  NULL,                             0,  0 }
+};
+
+static void
+usage(void)
+{
+    unsigned i;
+
+    printf(
+        "Usage: md4c-bench [OPTION]...\n"
+        "Measure the throughput of md_parse() and md_html() on generated documents\n"
+        "and print the results in JSON format.\n"
+        "\n"
+        "Options:\n"
+        "  -s, --size=N         Size of each generated document in KB (default 1024)\n"
+        "  -n, --runs=N         Measured runs of each case (default 10)\n"
+        "      --seed=N         Seed of the corpus generator (default 1)\n"
+        "  -c, --corpus=LIST    Comma-separated corpora to use (default all)\n"
+        "  -f, --flags=LIST     Comma-separated flag sets to use (default all)\n"
+        "  -m, --mode=LIST      Comma-separated modes: parse, html, html-cached, tree\n"
+        "                       (default all)\n"
+        "  -b, --baseline=FILE  Compare with an older output; exit with 1 on regressions\n"
+        "  -t, --tolerance=PCT  Slowdown tolerated by --baseline (default 10)\n"
+        "      --dump=CORPUS    Write the generated document to standard output and exit\n"
+        "  -h, --help           Display this help and exit\n"
+        "\n"
+        "Corpora:"
+    );
+    for(i = 0; i < N_CORPORA; i++)
+        printf(" %s", corpora[i].name);
+    printf("\nFlag sets:");
+    for(i = 0; i < N_FLAG_SETS; i++)
+        printf("%s %s", (i > 0  &&  i % 4 == 0 ? "\n          " : ""), flag_sets[i].name);
+    printf("\n");
+}
+
+static int
+cmdline_callback(int opt, char const* value, void* data)
+{
+    (void) data;
+
+    switch(opt) {
+        case 's':   doc_size = (size_t) atol(value) * 1024; break;
+        case 'n':   n_runs = (unsigned) atoi(value); break;
+        case 'S':   seed = (unsigned) atoi(value); break;
+        case 'c':   corpus_filter = value; break;
+        case 'f':   flags_filter = value; break;
+        case 'm':   mode_filter = value; break;
+        case 'b':   baseline_path = value; break;
+        case 't':   tolerance = atof(value); break;
+        case 'd':   dump_corpus = value; break;
+        case 'h':   usage(); exit(0); break;
+
+        default:
+            fprintf(stderr, "Illegal option: %s\n", value);
+            fprintf(stderr, "Use --help for more info.\n");
+            exit(1);
+            break;
+    }
+
+    return 0;
+}
+
+int
+main(int argc, char** argv)
+{
+    static const char* const modes[] = { "parse", "html", "html-cached", "tree" };
+    int (*const mode_funcs[])(const struct membuffer*, unsigned) =
+            { run_parse, run_html, run_html_cached, run_tree };
+#define N_MODES     (sizeof(modes) / sizeof(modes[0]))
+    struct membuffer doc = {0};
+    RESULT* results;
+    unsigned n_results = 0;
+    double* samples;
+    unsigned ci, fi, mi;
+    int ret = 0;
+
+    if(cmdline_read(cmdline_options, argc, argv, cmdline_callback, NULL) != 0) {
+        usage();
+        exit(1);
+    }
+    if(n_runs == 0  ||  doc_size == 0) {
+        fprintf(stderr, "The size and the count of runs must not be zero.\n");
+        exit(1);
+    }
+
+    if(dump_corpus != NULL) {
+        for(ci = 0; ci < N_CORPORA; ci++) {
+            if(strcmp(corpora[ci].name, dump_corpus) == 0) {
+                generate(&corpora[ci], &doc);
+                fwrite(doc.data, 1, doc.size, stdout);
+                free(doc.data);
+                return 0;
+            }
+        }
+        fprintf(stderr, "Unknown corpus %s.\n", dump_corpus);
+        exit(1);
+    }
+
+    results = malloc(N_CORPORA * N_FLAG_SETS * N_MODES * sizeof(RESULT));
+    samples = malloc(n_runs * sizeof(double));
+    if(results == NULL  ||  samples == NULL) {
+        fprintf(stderr, "malloc() failed.\n");
+        exit(1);
+    }
+
+    printf("{\n");
+    printf("  \"version\": \"%d.%d.%d\",\n", MD_VERSION_MAJOR, MD_VERSION_MINOR, MD_VERSION_RELEASE);
+    printf("  \"size\": %lu,\n", (unsigned long) doc_size);
+    printf("  \"runs\": %u,\n", n_runs);
+    printf("  \"seed\": %u,\n", seed);
+    printf("  \"results\": [\n");
+
+    for(ci = 0; ci < N_CORPORA; ci++) {
+        if(!is_selected(corpus_filter, corpora[ci].name))
+            continue;
+        generate(&corpora[ci], &doc);
+
+        for(fi = 0; fi < N_FLAG_SETS; fi++) {
+            if(!is_selected(flags_filter, flag_sets[fi].name))
+                continue;
+
+            for(mi = 0; mi < N_MODES; mi++) {
+                RESULT* r = &results[n_results];
+
+                if(!is_selected(mode_filter, modes[mi]))
+                    continue;
+
+                r->corpus = corpora[ci].name;
+                r->flags = flag_sets[fi].name;
+                r->mode = modes[mi];
+                if(measure(&doc, flag_sets[fi].flags, mode_funcs[mi], samples, r) != 0) {
+                    fprintf(stderr, "Parsing %s/%s/%s failed.\n", r->corpus, r->flags, r->mode);
+                    ret = 1;
+                    continue;
+                }
+
+                printf("%s    {\"corpus\": \"%s\", \"flags\": \"%s\", \"mode\": \"%s\", "
+                       "\"bytes\": %lu, \"mb_per_s\": %.2f, \"ns_per_byte\": "
+                       "{\"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f}}",
+                       (n_results > 0 ? ",\n" : ""), r->corpus, r->flags, r->mode,
+                       (unsigned long) r->size, r->mb_per_s, r->ns_per_byte[0], r->ns_per_byte[1],
+                       r->ns_per_byte[2], r->ns_per_byte[3], r->ns_per_byte[4]);
+                fflush(stdout);
+                n_results++;
+            }
+        }
+    }
+
+    printf("\n  ]\n");
+    printf("}\n");
+
+    if(baseline_path != NULL) {
+        if(compare_baseline(results, n_results) != 0)
+            ret = 1;
+    }
+
+    free(samples);
+    free(results);
+    free(doc.data);
+    return ret;
+}
@@ -27,8 +27,24 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <direct.h>
+    #define make_dir(path)      _mkdir(path)
+#else
+    #include <sys/types.h>
+    #define make_dir(path)      mkdir((path), 0777)
+    #if defined __unix__  ||  defined __APPLE__
+        #include <fcntl.h>
+        #include <unistd.h>
+        #include <sys/mman.h>
+    #endif
+#endif
 
 #include "md4c-html.h"
+#include "thread.h"
 #include "cmdline.h"
 
 
@@ -43,18 +59,20 @@ static unsigned parser_flags = 0;
 static int want_fullhtml = 0;
 static int want_xhtml = 0;
 static int want_stat = 0;
+static int want_tree = 0;
+static int want_tree_blob = 0;          /* Pass the tree through a blob. */
+static unsigned tree_blob_flags = 0;
+static const char* save_tree_path = NULL;
+static const char* load_tree_path = NULL;
+static unsigned n_threads = 0;
+static unsigned n_jobs = 1;
+static const char* output_dir = NULL;
 
 
 /*********************************
  ***  Simple grow-able buffer  ***
  *********************************/
 
-/* We render to a memory buffer instead of directly outputting the rendered
- * documents, as this allows using this utility for evaluating performance
- * of MD4C (--stat option). This allows us to measure just time of the parser,
- * without the I/O.
- */
-
 struct membuffer {
     char* data;
     size_t asize;
@@ -100,6 +118,151 @@ membuf_append(struct membuffer* buf, const char* data, MD_SIZE size)
     buf->size += size;
 }
 
+/* Read the whole file into the buffer (after anything already there). */
+static void
+membuf_read(struct membuffer* buf, FILE* in)
+{
+    size_t n;
+
+    while(1) {
+        if(buf->size >= buf->asize)
+            membuf_grow(buf, buf->asize + buf->asize / 2);
+
+        n = fread(buf->data + buf->size, 1, buf->asize - buf->size, in);
+        if(n == 0)
+            break;
+        buf->size += n;
+    }
+}
+
+
+/**************************
+ ***  Input and output  ***
+ **************************/
+
+/* Regular files are mapped into memory (if the platform allows), so the
+ * input is not copied anywhere and the OS may page it in (and out) as the
+ * parser walks through it. Anything else is read into a buffer. Standard
+ * input is not even read as a whole: it is passed to md_html_feed() in
+ * chunks (see render_stream()).
+ */
+
+#define INPUT_CHUNK_SIZE        (64 * 1024)
+
+static size_t input_chunk_size = INPUT_CHUNK_SIZE;     /* --chunk-size */
+
+/* The renderer buffers its output up to this size, and each full buffer is
+ * then written out directly. Hence the memory needed for the output does not
+ * depend on the size of the document. */
+#define OUTPUT_BUFFER_SIZE      (64 * 1024)
+
+struct input {
+    const char* data;
+    size_t size;
+    struct membuffer buf;   /* Used if the file is not mapped. */
+    void* map;              /* Non-NULL if the file is mapped. */
+#ifdef _WIN32
+    HANDLE mapping;
+#endif
+};
+
+struct output {
+    FILE* file;
+    size_t size;
+};
+
+static void
+input_read(struct input* input, FILE* in)
+{
+    input->buf.size = 0;
+    membuf_read(&input->buf, in);
+    input->data = input->buf.data;
+    input->size = input->buf.size;
+}
+
+/* Open the input file. The caller has to initialize input->buf beforehand.
+ * Returns 0 on success, -1 if the file cannot be opened. */
+static int
+input_open(struct input* input, const char* path)
+{
+    FILE* in;
+
+    input->map = NULL;
+
+#if defined _WIN32
+    {
+        HANDLE file;
+        LARGE_INTEGER size;
+
+        file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                           FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if(file != INVALID_HANDLE_VALUE) {
+            if(GetFileType(file) == FILE_TYPE_DISK  &&  GetFileSizeEx(file, &size)  &&
+               size.QuadPart > 0  &&  (unsigned long long) size.QuadPart <= (size_t) -1)
+            {
+                input->mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+                if(input->mapping != NULL) {
+                    input->map = MapViewOfFile(input->mapping, FILE_MAP_READ, 0, 0, 0);
+                    if(input->map == NULL)
+                        CloseHandle(input->mapping);
+                }
+            }
+            CloseHandle(file);
+            if(input->map != NULL) {
+                input->data = (const char*) input->map;
+                input->size = (size_t) size.QuadPart;
+                return 0;
+            }
+        }
+    }
+#elif defined __unix__  ||  defined __APPLE__
+    {
+        int fd;
+        struct stat st;
+        void* map;
+
+        fd = open(path, O_RDONLY);
+        if(fd >= 0) {
+            if(fstat(fd, &st) == 0  &&  S_ISREG(st.st_mode)  &&  st.st_size > 0  &&
+               (unsigned long long) st.st_size <= (size_t) -1)
+            {
+                map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+                if(map != MAP_FAILED) {
+                    posix_madvise(map, (size_t) st.st_size, POSIX_MADV_SEQUENTIAL);
+                    input->map = map;
+                    input->data = (const char*) map;
+                    input->size = (size_t) st.st_size;
+                }
+            }
+            close(fd);
+            if(input->map != NULL)
+                return 0;
+        }
+    }
+#endif
+
+    in = fopen(path, "rb");
+    if(in == NULL)
+        return -1;
+    input_read(input, in);
+    fclose(in);
+    return 0;
+}
+
+static void
+input_close(struct input* input)
+{
+    if(input->map != NULL) {
+#if defined _WIN32
+        UnmapViewOfFile(input->map);
+        CloseHandle(input->mapping);
+#elif defined __unix__  ||  defined __APPLE__
+        munmap(input->map, input->size);
+#endif
+        input->map = NULL;
+    }
+}
+
 
 /**********************
  ***  Main program  ***
@@ -108,100 +271,746 @@ membuf_append(struct membuffer* buf, const char* data, MD_SIZE size)
 static void
 process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
 {
-    membuf_append((struct membuffer*) userdata, text, size);
+    struct output* output = (struct output*) userdata;
+
+    fwrite(text, 1, size, output->file);
+    output->size += size;
 }
 
+static MD_HTML*
+create_renderer(void)
+{
+    MD_HTML_CALLBACKS callbacks = { process_output, NULL, NULL, NULL, NULL, NULL };
+    MD_HTML* html;
+
+    html = md_html_create(callbacks, parser_flags, renderer_flags);
+    if(html == NULL)
+        return NULL;
+
+    if(md_html_set_flush_threshold(html, OUTPUT_BUFFER_SIZE) != 0  ||
+       (n_threads > 1  &&  md_html_set_threads(html, n_threads) != 0))
+    {
+        md_html_destroy(html);
+        return NULL;
+    }
+
+    return html;
+}
+
+static void
+write_header(FILE* out)
+{
+    if(!want_fullhtml)
+        return;
+
+    if(want_xhtml) {
+        fprintf(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
+        fprintf(out, "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" "
+                        "\"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n");
+        fprintf(out, "<html xmlns=\"http://www.w3.org/1999/xhtml\">\n");
+    } else {
+        fprintf(out, "<!DOCTYPE html>\n");
+        fprintf(out, "<html>\n");
+    }
+    fprintf(out, "<head>\n");
+    fprintf(out, "<title></title>\n");
+    fprintf(out, "<meta name=\"generator\" content=\"md2html\"%s>\n", want_xhtml ? " /" : "");
+    fprintf(out, "</head>\n");
+    fprintf(out, "<body>\n");
+}
+
+static void
+write_footer(FILE* out)
+{
+    if(!want_fullhtml)
+        return;
+
+    fprintf(out, "</body>\n");
+    fprintf(out, "</html>\n");
+}
+
+/* Save the tree into a file (--save-tree). */
 static int
-process_file(FILE* in, FILE* out)
+save_tree(const void* blob, size_t blob_size)
 {
-    size_t n;
-    struct membuffer buf_in = {0};
-    struct membuffer buf_out = {0};
-    int ret = -1;
-    clock_t t0, t1;
+    FILE* f;
+    int ret = 0;
 
-    membuf_init(&buf_in, 32 * 1024);
+    f = fopen(save_tree_path, "wb");
+    if(f == NULL) {
+        fprintf(stderr, "Cannot open %s.\n", save_tree_path);
+        return -1;
+    }
+    if(fwrite(blob, 1, blob_size, f) != blob_size)
+        ret = -1;
+    if(fclose(f) != 0)
+        ret = -1;
+    if(ret != 0)
+        fprintf(stderr, "Cannot write %s.\n", save_tree_path);
+    return ret;
+}
 
-    /* Read the input file into a buffer. */
-    while(1) {
-        if(buf_in.size >= buf_in.asize)
-            membuf_grow(&buf_in, buf_in.asize + buf_in.asize / 2);
+/* Build the document tree first and render the HTML from it (--tree). With
+ * --tree=blob, the tree is saved into a blob with md_tree_save() and the
+ * tree loaded back from it by md_tree_load() is rendered instead. */
+static int
+render_tree(MD_HTML* html, const char* data, MD_SIZE size, struct output* output)
+{
+    MD_PARSER parser;
+    MD_TREE* tree;
+    void* blob = NULL;
+    size_t blob_size;
+    int ret;
 
-        n = fread(buf_in.data + buf_in.size, 1, buf_in.asize - buf_in.size, in);
-        if(n == 0)
+    /* md_html_render_tree() cannot skip the BOM on its own. */
+    if((renderer_flags & MD_HTML_FLAG_SKIP_UTF8_BOM)  &&
+       size >= 3  &&  memcmp(data, "\xef\xbb\xbf", 3) == 0)
+    {
+        data += 3;
+        size -= 3;
+    }
+
+    memset(&parser, 0, sizeof(MD_PARSER));
+    parser.flags = parser_flags;
+    ret = md_parse_tree(data, size, &parser, &tree);
+    if(ret != 0)
+        return ret;
+
+    if(want_tree_blob  ||  save_tree_path != NULL) {
+        blob_size = md_tree_save_size(tree, tree_blob_flags);
+        blob = malloc(blob_size);
+        if(blob == NULL) {
+            fprintf(stderr, "render_tree: malloc() failed.\n");
+            md_tree_destroy(tree);
+            return -1;
+        }
+        md_tree_save(tree, tree_blob_flags, blob);
+        md_tree_destroy(tree);
+
+        if(save_tree_path != NULL  &&  save_tree(blob, blob_size) != 0) {
+            free(blob);
+            return -1;
+        }
+
+        /* With MD_TREE_SAVE_TEXT, the blob does not need the document. */
+        if(tree_blob_flags & MD_TREE_SAVE_TEXT)
+            ret = md_tree_load(blob, blob_size, NULL, 0, NULL, &tree);
+        else
+            ret = md_tree_load(blob, blob_size, data, size, NULL, &tree);
+        if(ret != 0) {
+            fprintf(stderr, "Cannot load the tree from the blob.\n");
+            free(blob);
+            return ret;
+        }
+    }
+
+    ret = md_html_render_tree(html, tree, (void*) output);
+    md_tree_destroy(tree);
+    free(blob);
+    return ret;
+}
+
+/* Render the tree saved by --save-tree into a file (--load-tree). */
+static int
+render_saved_tree(MD_HTML* html, struct output* output, size_t* p_size)
+{
+    struct input in = {0};
+    MD_TREE* tree;
+    int ret;
+
+    membuf_init(&in.buf, 32 * 1024);
+    if(input_open(&in, load_tree_path) != 0) {
+        fprintf(stderr, "Cannot open %s.\n", load_tree_path);
+        membuf_fini(&in.buf);
+        return -1;
+    }
+
+    ret = md_tree_load(in.data, in.size, NULL, 0, NULL, &tree);
+    if(ret == 0) {
+        ret = md_html_render_tree(html, tree, (void*) output);
+        md_tree_destroy(tree);
+    } else {
+        fprintf(stderr, "Cannot load the tree from %s.\n", load_tree_path);
+    }
+    *p_size = in.size;
+
+    input_close(&in);
+    membuf_fini(&in.buf);
+    return ret;
+}
+
+/* Render the (mapped or buffered) input. */
+static int
+render_input(MD_HTML* html, const struct input* input, struct output* output)
+{
+    if(input->size > (MD_SIZE) -1) {
+        fprintf(stderr, "Input is too big.\n");
+        return -1;
+    }
+
+    if(want_tree)
+        return render_tree(html, input->data, (MD_SIZE) input->size, output);
+    return md_html_render(html, input->data, (MD_SIZE) input->size, (void*) output);
+}
+
+/* Render the input from a stream (a pipe, terminal etc.) chunk by chunk. */
+static int
+render_stream(MD_HTML* html, FILE* in, struct output* output, size_t* p_size)
+{
+    char* chunk;
+    size_t n;
+    int ret = 0;
+
+    chunk = malloc(input_chunk_size);
+    if(chunk == NULL) {
+        fprintf(stderr, "render_stream: malloc() failed.\n");
+        exit(1);
+    }
+
+    *p_size = 0;
+    while((n = fread(chunk, 1, input_chunk_size, in)) > 0) {
+        ret = md_html_feed(html, chunk, (MD_SIZE) n, (void*) output);
+        if(ret != 0)
             break;
-        buf_in.size += n;
+        *p_size += n;
     }
+    if(ret == 0)
+        ret = md_html_finish(html, (void*) output);
+
+    free(chunk);
+    return ret;
+}
+
+/* Convert the opened input (or standard input if input is NULL). */
+static int
+process_file(const struct input* input, FILE* out)
+{
+    MD_HTML* html;
+    struct output output = { out, 0 };
+    size_t in_size = 0;
+    int ret;
+    clock_t t0, t1;
 
-    /* Input size is good estimation of output size. Add some more reserve to
-     * deal with the HTML header/footer and tags. */
-    membuf_init(&buf_out, (MD_SIZE)(buf_in.size + buf_in.size/8 + 64));
+    html = create_renderer();
+    if(html == NULL) {
+        fprintf(stderr, "Cannot set up the renderer.\n");
+        return -1;
+    }
 
     /* Parse the document. This shall call our callbacks provided via the
-     * md_renderer_t structure. */
+     * md_renderer_t structure. As the output is written out as it is being
+     * generated, the time measured by --stat is that of the whole conversion,
+     * including the writing. For the same reason, when the parsing fails,
+     * the output already contains the header and whatever has been rendered
+     * so far (but no footer). */
+    write_header(out);
     t0 = clock();
+    if(load_tree_path != NULL) {
+        ret = render_saved_tree(html, &output, &in_size);
+    } else if(input != NULL) {
+        ret = render_input(html, input, &output);
+        in_size = input->size;
+    } else if(want_tree) {
+        /* The tree needs the whole document. */
+        struct input in = {0};
 
-    MD_HTML_CALLBACKS callbacks = { process_output, NULL, NULL, NULL };
-    ret = md_html(buf_in.data, (MD_SIZE)buf_in.size, callbacks, (void*) &buf_out,
-                    parser_flags, renderer_flags);
-
+        membuf_init(&in.buf, 32 * 1024);
+        input_read(&in, stdin);
+        ret = render_input(html, &in, &output);
+        in_size = in.size;
+        membuf_fini(&in.buf);
+    } else {
+        ret = render_stream(html, stdin, &output, &in_size);
+    }
     t1 = clock();
+    md_html_destroy(html);
+
     if(ret != 0) {
         fprintf(stderr, "Parsing failed.\n");
-        goto out;
+        return ret;
+    }
+
+    write_footer(out);
+
+    if(want_stat) {
+        if(t0 != (clock_t)-1  &&  t1 != (clock_t)-1) {
+            double elapsed = (double)(t1 - t0) / CLOCKS_PER_SEC;
+            if (elapsed < 1)
+                fprintf(stderr, "Time spent on conversion: %7.2f ms.\n", elapsed*1e3);
+            else
+                fprintf(stderr, "Time spent on conversion: %6.3f s.\n", elapsed);
+            if(elapsed > 0)
+                fprintf(stderr, "Throughput:               %7.2f MB/s.\n",
+                        (double) in_size / (elapsed * 1e6));
+        }
+    }
+
+    return 0;
+}
+
+/********************
+ ***  Batch mode  ***
+ ********************/
+
+/* With --output-dir, any number of input files is converted, each into its
+ * own output file. The files are handed out to the workers (-j) one by one
+ * from a shared queue, the biggest ones first, so that a worker which gets
+ * stuck on a huge file does not hold back the others: they simply take the
+ * rest of the queue meanwhile. Every worker reuses its renderer and buffers
+ * for all files it converts.
+ */
+
+struct batch_input {
+    const char* path;
+    size_t size;
+    unsigned index;         /* Position on the command line. */
+    char* output_path;
+};
+
+static struct batch_input* inputs = NULL;
+static unsigned n_inputs = 0;
+static unsigned alloc_inputs = 0;
+
+struct batch {
+    unsigned next_input;
+#ifdef MD_THREADS
+    MD_MUTEX mutex;
+#endif
+};
+
+struct batch_worker {
+    struct batch* batch;
+    MD_HTML* html;
+#ifdef MD_THREADS
+    MD_THREAD thread;
+#endif
+    unsigned n_files;
+    unsigned n_failed;
+    size_t in_size;
+    size_t out_size;
+};
+
+static void
+add_input(const char* path)
+{
+    if(n_inputs >= alloc_inputs) {
+        alloc_inputs = (alloc_inputs > 0 ? alloc_inputs * 2 : 16);
+        inputs = realloc(inputs, alloc_inputs * sizeof(struct batch_input));
+        if(inputs == NULL) {
+            fprintf(stderr, "add_input: realloc() failed.\n");
+            exit(1);
+        }
+    }
+
+    inputs[n_inputs].path = path;
+    inputs[n_inputs].size = 0;
+    inputs[n_inputs].index = n_inputs;
+    inputs[n_inputs].output_path = NULL;
+    n_inputs++;
+}
+
+static int
+cmp_input_size(const void* a, const void* b)
+{
+    const struct batch_input* in_a = (const struct batch_input*) a;
+    const struct batch_input* in_b = (const struct batch_input*) b;
+
+    /* Bigger files first. */
+    if(in_a->size != in_b->size)
+        return (in_a->size > in_b->size ? -1 : +1);
+    return strcmp(in_a->path, in_b->path);
+}
+
+/* Wall clock time in seconds. (Unlike clock(), it does not sum the CPU time
+ * of all the workers.) */
+static double
+wall_clock(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER freq, now;
+
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    return (double) now.QuadPart / (double) freq.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+#endif
+}
+
+static int
+is_path_separator(char ch)
+{
+#ifdef _WIN32
+    return (ch == '/'  ||  ch == '\\');
+#else
+    return (ch == '/');
+#endif
+}
+
+/* Build the output path for the given input: The relative path of the input
+ * is kept under the output directory, only with the extension replaced by
+ * ".html". Paths climbing up with ".." are reduced to the bare file name.
+ * Empty and "." components are dropped so that equal paths are built for
+ * different spellings of the same path. */
+static void
+make_output_path(const char* input, struct membuffer* path)
+{
+    const char* name = input;
+    const char* ext = NULL;
+    const char* p;
+    const char* end;
+
+    /* Skip any leading root or "./". */
+#ifdef _WIN32
+    if(name[0] != '\0'  &&  name[1] == ':')
+        name += 2;
+#endif
+    while(1) {
+        if(is_path_separator(name[0]))
+            name++;
+        else if(name[0] == '.'  &&  is_path_separator(name[1]))
+            name += 2;
+        else
+            break;
     }
 
-    /* Write down the document in the HTML format. */
-    if(want_fullhtml) {
-        if(want_xhtml) {
-            fprintf(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");
-            fprintf(out, "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" "
-                            "\"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n");
-            fprintf(out, "<html xmlns=\"http://www.w3.org/1999/xhtml\">\n");
+    for(p = name; *p != '\0'; p++) {
+        if(p[0] == '.'  &&  p[1] == '.'  &&  (p == name || is_path_separator(p[-1]))
+                    &&  (p[2] == '\0' || is_path_separator(p[2])))
+        {
+            name = NULL;
+            break;
+        }
+    }
+    if(name == NULL) {
+        name = input;
+        for(p = input; *p != '\0'; p++) {
+            if(is_path_separator(*p))
+                name = p + 1;
+        }
+    }
+
+    for(p = name; *p != '\0'; p++) {
+        if(is_path_separator(*p))
+            ext = NULL;
+        else if(*p == '.'  &&  p > name  &&  !is_path_separator(p[-1]))
+            ext = p;
+    }
+    if(ext == NULL)
+        ext = p;
+
+    path->size = 0;
+    membuf_append(path, output_dir, (MD_SIZE) strlen(output_dir));
+    for(p = name; p < ext; p = end + 1) {
+        end = p;
+        while(end < ext  &&  !is_path_separator(*end))
+            end++;
+        if(end > p  &&  !(end - p == 1  &&  p[0] == '.')) {
+            membuf_append(path, "/", 1);
+            membuf_append(path, p, (MD_SIZE) (end - p));
+        }
+    }
+    membuf_append(path, ".html", 6);    /* Including the terminator. */
+}
+
+/* Create the directories on the way to the output file. */
+static void
+make_output_dirs(char* path)
+{
+    size_t i;
+
+    for(i = 1; path[i] != '\0'; i++) {
+        if(is_path_separator(path[i])) {
+            char sep = path[i];
+            path[i] = '\0';
+            make_dir(path);     /* It may already exist. */
+            path[i] = sep;
+        }
+    }
+}
+
+/* Compare two output paths. (The file systems on Windows and macOS usually
+ * ignore the case, so we do too.) */
+static int
+cmp_path(const char* a, const char* b)
+{
+    while(1) {
+        int ch_a = (unsigned char) *a++;
+        int ch_b = (unsigned char) *b++;
+
+#if defined _WIN32  ||  defined __APPLE__
+        if('A' <= ch_a  &&  ch_a <= 'Z')
+            ch_a += 'a' - 'A';
+        if('A' <= ch_b  &&  ch_b <= 'Z')
+            ch_b += 'a' - 'A';
+#endif
+        if(ch_a != ch_b  ||  ch_a == '\0')
+            return ch_a - ch_b;
+    }
+}
+
+static int
+cmp_input_output_path(const void* a, const void* b)
+{
+    const struct batch_input* in_a = *(const struct batch_input* const*) a;
+    const struct batch_input* in_b = *(const struct batch_input* const*) b;
+    int cmp;
+
+    cmp = cmp_path(in_a->output_path, in_b->output_path);
+    if(cmp != 0)
+        return cmp;
+    return (in_a->index < in_b->index ? -1 : +1);
+}
+
+/* Build the output paths of all the inputs. Different inputs may map to the
+ * same output file (e.g. "a.md" and "a.markdown", or "../x/a.md" and
+ * "../y/a.md"): Then only the first one on the command line is converted
+ * (two workers must never write the same file) and the others are reported
+ * as failed and dropped from inputs[]. Returns count of the dropped ones. */
+static unsigned
+set_output_paths(void)
+{
+    struct batch_input** sorted;
+    const struct batch_input* first = NULL;
+    struct membuffer path;
+    unsigned n_dropped = 0;
+    unsigned i, n;
+
+    membuf_init(&path, 256);
+    for(i = 0; i < n_inputs; i++) {
+        make_output_path(inputs[i].path, &path);
+        inputs[i].output_path = malloc(path.size);
+        if(inputs[i].output_path == NULL) {
+            fprintf(stderr, "set_output_paths: malloc() failed.\n");
+            exit(1);
+        }
+        memcpy(inputs[i].output_path, path.data, path.size);
+    }
+    membuf_fini(&path);
+
+    sorted = malloc(n_inputs * sizeof(struct batch_input*));
+    if(sorted == NULL) {
+        fprintf(stderr, "set_output_paths: malloc() failed.\n");
+        exit(1);
+    }
+    for(i = 0; i < n_inputs; i++)
+        sorted[i] = &inputs[i];
+    qsort(sorted, n_inputs, sizeof(struct batch_input*), cmp_input_output_path);
+
+    for(i = 0; i < n_inputs; i++) {
+        if(first != NULL  &&  cmp_path(sorted[i]->output_path, first->output_path) == 0) {
+            fprintf(stderr, "Cannot convert %s: Output file %s is already used for %s.\n",
+                    sorted[i]->path, sorted[i]->output_path, first->path);
+            free(sorted[i]->output_path);
+            sorted[i]->output_path = NULL;
+            n_dropped++;
         } else {
-            fprintf(out, "<!DOCTYPE html>\n");
-            fprintf(out, "<html>\n");
+            first = sorted[i];
         }
-        fprintf(out, "<head>\n");
-        fprintf(out, "<title></title>\n");
-        fprintf(out, "<meta name=\"generator\" content=\"md2html\"%s>\n", want_xhtml ? " /" : "");
-        fprintf(out, "</head>\n");
-        fprintf(out, "<body>\n");
     }
+    free(sorted);
 
-    fwrite(buf_out.data, 1, buf_out.size, out);
+    n = 0;
+    for(i = 0; i < n_inputs; i++) {
+        if(inputs[i].output_path != NULL)
+            inputs[n++] = inputs[i];
+    }
+    n_inputs = n;
 
-    if(want_fullhtml) {
-        fprintf(out, "</body>\n");
-        fprintf(out, "</html>\n");
+    return n_dropped;
+}
+
+static const struct batch_input*
+batch_next_input(struct batch* batch)
+{
+    const struct batch_input* input = NULL;
+
+#ifdef MD_THREADS
+    md_mutex_lock(&batch->mutex);
+#endif
+    if(batch->next_input < n_inputs)
+        input = &inputs[batch->next_input++];
+#ifdef MD_THREADS
+    md_mutex_unlock(&batch->mutex);
+#endif
+
+    return input;
+}
+
+static void
+batch_work(struct batch_worker* worker)
+{
+    struct input input = {0};
+    struct output output;
+    const struct batch_input* batch_input;
+    int ret;
+
+    membuf_init(&input.buf, 32 * 1024);
+
+    while((batch_input = batch_next_input(worker->batch)) != NULL) {
+        worker->n_files++;
+
+        if(input_open(&input, batch_input->path) != 0) {
+            fprintf(stderr, "Cannot open %s.\n", batch_input->path);
+            worker->n_failed++;
+            continue;
+        }
+
+        make_output_dirs(batch_input->output_path);
+        output.file = fopen(batch_input->output_path, "wt");
+        output.size = 0;
+        if(output.file == NULL) {
+            fprintf(stderr, "Cannot open %s.\n", batch_input->output_path);
+            input_close(&input);
+            worker->n_failed++;
+            continue;
+        }
+
+        write_header(output.file);
+        ret = render_input(worker->html, &input, &output);
+        if(ret == 0)
+            write_footer(output.file);
+        input_close(&input);
+        if(fclose(output.file) != 0  &&  ret == 0) {
+            fprintf(stderr, "Cannot write %s.\n", batch_input->output_path);
+            ret = -1;
+        } else if(ret != 0) {
+            fprintf(stderr, "Parsing of %s failed.\n", batch_input->path);
+        }
+        if(ret != 0) {
+            /* Do not leave a truncated file behind. */
+            remove(batch_input->output_path);
+            worker->n_failed++;
+            continue;
+        }
+
+        worker->in_size += input.size;
+        worker->out_size += output.size;
     }
 
-    if(want_stat) {
-        if(t0 != (clock_t)-1  &&  t1 != (clock_t)-1) {
-            double elapsed = (double)(t1 - t0) / CLOCKS_PER_SEC;
-            if (elapsed < 1)
-                fprintf(stderr, "Time spent on parsing: %7.2f ms.\n", elapsed*1e3);
-            else
-                fprintf(stderr, "Time spent on parsing: %6.3f s.\n", elapsed);
+    membuf_fini(&input.buf);
+}
+
+#ifdef MD_THREADS
+MD_THREAD_PROC(batch_thread_proc, arg)
+{
+    batch_work((struct batch_worker*) arg);
+    MD_THREAD_PROC_RETURN;
+}
+#endif
+
+static int
+process_batch(void)
+{
+    struct batch batch = {0};
+    struct batch_worker* workers;
+    struct batch_worker total = {0};
+    struct stat st;
+    unsigned n_all = n_inputs;
+    unsigned n_dropped;
+    unsigned n_workers;
+    unsigned n_started = 1;
+    unsigned i;
+    double t0, t1;
+
+    n_dropped = set_output_paths();
+    total.n_files = n_dropped;
+    total.n_failed = n_dropped;
+
+    for(i = 0; i < n_inputs; i++) {
+        if(stat(inputs[i].path, &st) == 0)
+            inputs[i].size = (size_t) st.st_size;
+    }
+    qsort(inputs, n_inputs, sizeof(struct batch_input), cmp_input_size);
+
+#ifdef MD_THREADS
+    n_workers = (n_jobs < n_inputs ? n_jobs : n_inputs);
+#else
+    n_workers = 1;
+#endif
+    if(n_workers == 0)
+        n_workers = 1;
+
+    workers = calloc(n_workers, sizeof(struct batch_worker));
+    if(workers == NULL) {
+        fprintf(stderr, "process_batch: calloc() failed.\n");
+        return -1;
+    }
+
+    /* Set up all the renderers here, before any thread is started. */
+    for(i = 0; i < n_workers; i++) {
+        workers[i].batch = &batch;
+        workers[i].html = create_renderer();
+        if(workers[i].html == NULL) {
+            fprintf(stderr, "Cannot set up the renderer.\n");
+            n_workers = i + 1;
+            goto out;
         }
     }
 
-    /* Success if we have reached here. */
-    ret = 0;
+    t0 = wall_clock();
 
-out:
-    membuf_fini(&buf_in);
-    membuf_fini(&buf_out);
+    /* The main thread is the worker #0. */
+#ifdef MD_THREADS
+    md_mutex_init(&batch.mutex);
+    for(i = 1; i < n_workers; i++) {
+        if(md_thread_create(&workers[i].thread, batch_thread_proc, &workers[i]) != 0)
+            break;
+        n_started++;
+    }
+#endif
+    batch_work(&workers[0]);
+#ifdef MD_THREADS
+    for(i = 1; i < n_started; i++)
+        md_thread_join(workers[i].thread);
+    md_mutex_fini(&batch.mutex);
+#endif
 
-    return ret;
+    t1 = wall_clock();
+
+    for(i = 0; i < n_started; i++) {
+        total.n_files += workers[i].n_files;
+        total.n_failed += workers[i].n_failed;
+        total.in_size += workers[i].in_size;
+        total.out_size += workers[i].out_size;
+    }
+
+    fprintf(stderr, "Converted files:       %7u (%u failed) on %u jobs.\n",
+            n_all - total.n_failed, total.n_failed, n_started);
+    fprintf(stderr, "Input size:            %7.2f MB.\n", (double) total.in_size / 1e6);
+    fprintf(stderr, "Output size:           %7.2f MB.\n", (double) total.out_size / 1e6);
+    fprintf(stderr, "Time spent:            %7.3f s.\n", t1 - t0);
+    if(t1 > t0) {
+        fprintf(stderr, "Throughput:            %7.2f MB/s, %.1f files/s.\n",
+                (double) total.in_size / ((t1 - t0) * 1e6),
+                (double) (n_all - total.n_failed) / (t1 - t0));
+    }
+
+out:
+    for(i = 0; i < n_workers; i++)
+        md_html_destroy(workers[i].html);
+    free(workers);
+    for(i = 0; i < n_inputs; i++)
+        free(inputs[i].output_path);
+    return (total.n_files > 0  &&  total.n_failed == 0 ? 0 : -1);
 }
 
 
 static const CMDLINE_OPTION cmdline_options[] = {
     { 'o', "output",                        'o', CMDLINE_OPTFLAG_REQUIREDARG },
+    { 'd', "output-dir",                    'd', CMDLINE_OPTFLAG_REQUIREDARG },
     { 'f', "full-html",                     'f', 0 },
     { 'x', "xhtml",                         'x', 0 },
     { 's', "stat",                          's', 0 },
+    { 'j', "jobs",                          'j', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "threads",                       't', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "chunk-size",                    'k', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "tree",                          'r', CMDLINE_OPTFLAG_OPTIONALARG },
+    {  0,  "save-tree",                     'y', CMDLINE_OPTFLAG_REQUIREDARG },
+    {  0,  "load-tree",                     'Y', CMDLINE_OPTFLAG_REQUIREDARG },
     { 'h', "help",                          'h', 0 },
     { 'v', "version",                       'v', 0 },
 
@@ -209,6 +1018,7 @@ static const CMDLINE_OPTION cmdline_options[] = {
     {  0,  "github",                        'g', 0 },
 
     {  0,  "fcollapse-whitespace",          'W', 0 },
+    {  0,  "fheader-self-links",            '#', 0 },
     {  0,  "flatex-math",                   'L', 0 },
     {  0,  "fpermissive-atx-headers",       'A', 0 },
     {  0,  "fpermissive-autolinks",         'V', 0 },
@@ -235,13 +1045,25 @@ usage(void)
 {
     printf(
         "Usage: md2html [OPTION]... [FILE]\n"
+        "  or:  md2html [OPTION]... --output-dir=DIR FILE...\n"
         "Convert input FILE (or standard input) in Markdown format to HTML.\n"
         "\n"
         "General options:\n"
         "  -o  --output=FILE    Output file (default is standard output)\n"
+        "  -d  --output-dir=DIR Convert every FILE into DIR/FILE with the extension\n"
+        "                       replaced by .html\n"
+        "  -j  --jobs=N         Convert the files (with --output-dir) on N threads\n"
         "  -f, --full-html      Generate full HTML document, including header\n"
         "  -x, --xhtml          Generate XHTML instead of HTML\n"
-        "  -s, --stat           Measure time of input parsing\n"
+        "  -s, --stat           Measure time of the conversion (including the output)\n"
+        "      --threads=N      Render large documents on N threads\n"
+        "      --chunk-size=N   Read standard input in chunks of N bytes\n"
+        "      --tree           Build the document tree first and render it\n"
+        "      --tree=blob      Also pass the tree through md_tree_save() and\n"
+        "                       md_tree_load() before rendering it\n"
+        "      --tree=blob-text Same, with the document saved in the blob\n"
+        "      --save-tree=FILE Save the document tree (with the document) into FILE\n"
+        "      --load-tree=FILE Render the tree saved in FILE instead of any input\n"
         "  -h, --help           Display this help and exit\n"
         "  -v, --version        Display version and exit\n"
         "\n"
@@ -253,6 +1075,8 @@ usage(void)
         "Markdown extension options:\n"
         "      --fcollapse-whitespace\n"
         "                       Collapse non-trivial whitespace\n"
+        "      --fheader-self-links\n"
+        "                       Make headers links to themselves\n"
         "      --flatex-math    Enable LaTeX style mathematics spans\n"
         "      --fpermissive-atx-headers\n"
         "                       Allow ATX headers without delimiting space\n"
@@ -293,26 +1117,40 @@ version(void)
     printf("%d.%d.%d\n", MD_VERSION_MAJOR, MD_VERSION_MINOR, MD_VERSION_RELEASE);
 }
 
-static const char* input_path = NULL;
 static const char* output_path = NULL;
 
+static void
+set_tree_mode(const char* mode)
+{
+    if(strcmp(mode, "blob") == 0) {
+        want_tree_blob = 1;
+    } else if(strcmp(mode, "blob-text") == 0) {
+        want_tree_blob = 1;
+        tree_blob_flags |= MD_TREE_SAVE_TEXT;
+    } else {
+        fprintf(stderr, "Unknown --tree mode: %s\n", mode);
+        fprintf(stderr, "Use --help for more info.\n");
+        exit(1);
+    }
+}
+
 static int
 cmdline_callback(int opt, char const* value, void* data)
 {
     switch(opt) {
-        case 0:
-            if(input_path) {
-                fprintf(stderr, "Too many arguments. Only one input file can be specified.\n");
-                fprintf(stderr, "Use --help for more info.\n");
-                exit(1);
-            }
-            input_path = value;
-            break;
+        case 0:     add_input(value); break;
 
         case 'o':   output_path = value; break;
+        case 'd':   output_dir = value; break;
         case 'f':   want_fullhtml = 1; break;
         case 'x':   want_xhtml = 1; renderer_flags |= MD_HTML_FLAG_XHTML; break;
         case 's':   want_stat = 1; break;
+        case 'j':   n_jobs = (unsigned) atoi(value); break;
+        case 't':   n_threads = (unsigned) atoi(value); break;
+        case 'k':   input_chunk_size = (atoi(value) > 0 ? (size_t) atoi(value) : INPUT_CHUNK_SIZE); break;
+        case 'r':   want_tree = 1; if(value != NULL) set_tree_mode(value); break;
+        case 'y':   want_tree = 1; save_tree_path = value; tree_blob_flags |= MD_TREE_SAVE_TEXT; break;
+        case 'Y':   load_tree_path = value; break;
         case 'h':   usage(); exit(0); break;
         case 'v':   version(); exit(0); break;
 
@@ -332,6 +1170,7 @@ cmdline_callback(int opt, char const* value, void* data)
         case 'V':   parser_flags |= MD_FLAG_PERMISSIVEAUTOLINKS; break;
         case 'T':   parser_flags |= MD_FLAG_TABLES; break;
         case 'S':   parser_flags |= MD_FLAG_STRIKETHROUGH; break;
+        case '#':   parser_flags |= MD_FLAG_HEADERSELFLINKS; break;
         case 'L':   parser_flags |= MD_FLAG_LATEXMATHSPANS; break;
         case 'K':   parser_flags |= MD_FLAG_WIKILINKS; break;
         case 'X':   parser_flags |= MD_FLAG_TASKLISTS; break;
@@ -350,7 +1189,9 @@ cmdline_callback(int opt, char const* value, void* data)
 int
 main(int argc, char** argv)
 {
-    FILE* in = stdin;
+    const char* input_path = NULL;
+    struct input input = {0};
+    struct input* in = NULL;
     FILE* out = stdout;
     int ret = 0;
 
@@ -359,12 +1200,43 @@ main(int argc, char** argv)
         exit(1);
     }
 
+    if(load_tree_path != NULL  &&  n_inputs > 0) {
+        fprintf(stderr, "Option --load-tree takes no input file.\n");
+        fprintf(stderr, "Use --help for more info.\n");
+        exit(1);
+    }
+
+    if(output_dir != NULL) {
+        if(save_tree_path != NULL  ||  load_tree_path != NULL) {
+            fprintf(stderr, "Options --save-tree and --load-tree need no --output-dir.\n");
+            fprintf(stderr, "Use --help for more info.\n");
+            exit(1);
+        }
+        if(output_path != NULL  ||  n_inputs == 0) {
+            fprintf(stderr, "Option --output-dir needs input files and no --output.\n");
+            fprintf(stderr, "Use --help for more info.\n");
+            exit(1);
+        }
+        ret = process_batch();
+        free(inputs);
+        return ret;
+    }
+
+    if(n_inputs > 1) {
+        fprintf(stderr, "Too many arguments. Only one input file can be specified without --output-dir.\n");
+        fprintf(stderr, "Use --help for more info.\n");
+        exit(1);
+    }
+    if(n_inputs == 1)
+        input_path = inputs[0].path;
+
     if(input_path != NULL && strcmp(input_path, "-") != 0) {
-        in = fopen(input_path, "rb");
-        if(in == NULL) {
+        membuf_init(&input.buf, 32 * 1024);
+        if(input_open(&input, input_path) != 0) {
             fprintf(stderr, "Cannot open %s.\n", input_path);
             exit(1);
         }
+        in = &input;
     }
     if(output_path != NULL && strcmp(output_path, "-") != 0) {
         out = fopen(output_path, "wt");
@@ -375,10 +1247,13 @@ main(int argc, char** argv)
     }
 
     ret = process_file(in, out);
-    if(in != stdin)
-        fclose(in);
+    if(in != NULL) {
+        input_close(in);
+        membuf_fini(&in->buf);
+    }
     if(out != stdout)
         fclose(out);
+    free(inputs);
 
     return ret;
 }
@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+
+# Generates the tables of src/entity.c from entities.json
+# (https://html.spec.whatwg.org/entities.json).
+#
+# The table is a minimal perfect hash built with the "hash and displace"
+# scheme: every entity name (including the leading '&' and the trailing ';')
+# is hashed with 32-bit FNV-1a; the hash selects a bucket in ENTITY_DISP and
+# the displacement stored there, mixed with the hash again, yields the index
+# into ENTITY_TABLE. The hash functions here must match those in entity.c.
+
+import json
+import os
+import sys
+import textwrap
+
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+def fnv1a(name):
+    h = FNV_OFFSET
+    for b in name:
+        h = ((h ^ b) * FNV_PRIME) & 0xffffffff
+    return h
+
+def mix(h):
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & 0xffffffff
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & 0xffffffff
+    h ^= h >> 16
+    return h
+
+def c_string(data):
+    return '"' + "".join("\\x{:02x}".format(b) for b in data) + '"'
+
+
+self_path = os.path.dirname(os.path.realpath(__file__));
+with open(self_path + "/entities.json", "r") as f:
+    entities = json.load(f)
+
+# Only the entities terminated with ';' are recognized by MD4C.
+records = list()
+for name in sorted(entities.keys()):
+    if not name.endswith(";"):
+        continue
+    utf8 = "".join(chr(cp) for cp in entities[name]["codepoints"]).encode("utf-8")
+    records.append((name.encode("ascii"), utf8))
+
+n_entities = len(records)
+n_buckets = (n_entities + 3) // 4
+max_name_size = max(len(name) for name, utf8 in records)
+max_utf8_size = max(len(utf8) for name, utf8 in records)
+
+buckets = [ list() for i in range(n_buckets) ]
+for rec in records:
+    h = fnv1a(rec[0])
+    buckets[h % n_buckets].append((h, rec))
+
+# Place the biggest buckets first while there is still a lot of free slots.
+slots = [ None ] * n_entities
+disp = [ 0 ] * n_buckets
+for bucket_index in sorted(range(n_buckets), key=lambda i: -len(buckets[i])):
+    bucket = buckets[bucket_index]
+    if not bucket:
+        continue
+    d = 0
+    while True:
+        indexes = [ mix(h ^ d) % n_entities for h, rec in bucket ]
+        if len(set(indexes)) == len(indexes) and all(slots[i] is None for i in indexes):
+            break
+        d += 1
+        if d > 0xffff:
+            sys.stderr.write("Failed to build the perfect hash.\n")
+            sys.exit(1)
+    disp[bucket_index] = d
+    for index, (h, rec) in zip(indexes, bucket):
+        slots[index] = rec
+
+sys.stdout.write("#define ENTITY_COUNT           {}\n".format(n_entities))
+sys.stdout.write("#define ENTITY_BUCKET_COUNT    {}\n".format(n_buckets))
+sys.stdout.write("#define ENTITY_MAX_NAME_SIZE   {}\n".format(max_name_size))
+sys.stdout.write("#define ENTITY_MAX_UTF8_SIZE   {}\n\n".format(max_utf8_size))
+
+sys.stdout.write("static const unsigned short ENTITY_DISP[ENTITY_BUCKET_COUNT] = {\n")
+sys.stdout.write("\n".join(textwrap.wrap(", ".join(str(d) for d in disp), 110,
+                    initial_indent = "    ", subsequent_indent="    ")))
+sys.stdout.write("\n};\n\n")
+
+sys.stdout.write("static const struct entity ENTITY_TABLE[ENTITY_COUNT] = {\n")
+sys.stdout.write(",\n".join("    {{ \"{}\", {}, {}, {} }}".format(name.decode("ascii"),
+                    len(name), len(utf8), c_string(utf8)) for name, utf8 in slots))
+sys.stdout.write("\n};\n")
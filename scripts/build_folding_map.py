@@ -118,3 +118,68 @@ for mapping_len in range(1, 4):
 
 
 
+
+
+# The bsearch() maps above are kept for md4c-unicode-bench; md4c.c uses the
+# two-stage table below.
+#
+# Each codepoint is mapped to a record { DELTA, { CP2, CP3 }, N }: It folds to
+# N codepoints, (CODEPOINT + DELTA), CP2, CP3. Record 0 maps a codepoint to
+# itself. STAGE1 maps each block of (1 << shift) codepoints to one of the
+# unique blocks of record indexes stored in STAGE2. We choose the block size
+# which makes the tables smallest.
+record_list = [ (0, 0, 0, 1) ]
+record_index = { record_list[0]: 0 }
+codepoint_records = dict()
+for mapping_len in range(1, 4):
+    for codepoint, mapping in folding_list[mapping_len-1].items():
+        tail = mapping[1:] + [0] * (3 - mapping_len)
+        record = (mapping[0] - codepoint, tail[0], tail[1], mapping_len)
+        if record not in record_index:
+            record_index[record] = len(record_list)
+            record_list.append(record)
+        codepoint_records[codepoint] = record_index[record]
+assert(len(record_list) <= 256)
+
+limit = max(codepoint_records) + 1
+best = None
+for shift in range(4, 11):
+    block_size = 1 << shift
+    n_blocks = (limit + block_size - 1) // block_size
+    blocks = dict()
+    stage1 = list()
+    for block in range(n_blocks):
+        key = tuple(codepoint_records.get(codepoint, 0)
+                    for codepoint in range(block * block_size, (block+1) * block_size))
+        stage1.append(blocks.setdefault(key, len(blocks)))
+    stage1_type = "unsigned char" if len(blocks) <= 256 else "unsigned short"
+    size = len(stage1) * (1 if len(blocks) <= 256 else 2) + len(blocks) * block_size
+    if best is None or size < best[0]:
+        stage2 = [ i for block in blocks for i in block ]
+        best = (size, shift, stage1_type, stage1, stage2)
+size, shift, stage1_type, stage1, stage2 = best
+
+sys.stdout.write("\n")
+sys.stdout.write("#define FOLD_BLOCK_SHIFT   {}\n".format(shift))
+sys.stdout.write("static const struct {\n")
+sys.stdout.write("    int delta;\n")
+sys.stdout.write("    unsigned tail[2];\n")
+sys.stdout.write("    unsigned n_codepoints;\n")
+sys.stdout.write("} FOLD_RECORDS[] = {\n")
+# (Pack whole records on the lines; textwrap would break them.)
+lines = [ "   " ]
+for record in record_list:
+    record_str = " {{ {}, {{ 0x{:04x}, 0x{:04x} }}, {} }},".format(*record)
+    if len(lines[-1]) + len(record_str) > 110:
+        lines.append("   ")
+    lines[-1] += record_str
+sys.stdout.write("\n".join(lines)[:-1])
+sys.stdout.write("\n};\n")
+sys.stdout.write("static const {} FOLD_STAGE1[] = {{\n".format(stage1_type))
+sys.stdout.write("\n".join(textwrap.wrap(", ".join(str(i) for i in stage1), 110,
+                    initial_indent = "    ", subsequent_indent="    ")))
+sys.stdout.write("\n};\n")
+sys.stdout.write("static const unsigned char FOLD_STAGE2[] = {\n")
+sys.stdout.write("\n".join(textwrap.wrap(", ".join(str(i) for i in stage2), 110,
+                    initial_indent = "    ", subsequent_indent="    ")))
+sys.stdout.write("\n};\n")
@@ -39,6 +39,44 @@ for line in f:
 f.close()
 
 
+# Two-stage lookup table: The codepoint space (up to the last codepoint in the
+# set) is split into blocks of (1 << shift) codepoints. STAGE1 maps each block
+# to one of the unique bitmaps stored in STAGE2. We choose the block size which
+# makes the tables smallest.
+def two_stage_bitmap(codepoint_set):
+    limit = max(codepoint_set) + 1
+    best = None
+    for shift in range(4, 11):
+        block_size = 1 << shift
+        n_blocks = (limit + block_size - 1) // block_size
+        bitmaps = dict()
+        stage1 = list()
+        for block in range(n_blocks):
+            bitmap = [ 0 ] * (block_size // 8)
+            for codepoint in range(block * block_size, (block+1) * block_size):
+                if codepoint in codepoint_set:
+                    bitmap[(codepoint % block_size) // 8] |= 1 << (codepoint % 8)
+            stage1.append(bitmaps.setdefault(tuple(bitmap), len(bitmaps)))
+        stage1_type = "unsigned char" if len(bitmaps) <= 256 else "unsigned short"
+        size = len(stage1) * (1 if len(bitmaps) <= 256 else 2) + len(bitmaps) * block_size // 8
+        if best is None or size < best[0]:
+            stage2 = [ b for bitmap in bitmaps for b in bitmap ]
+            best = (size, shift, stage1_type, stage1, stage2)
+    return best[1:]
+
+def write_two_stage_bitmap(name, codepoint_set):
+    shift, stage1_type, stage1, stage2 = two_stage_bitmap(codepoint_set)
+    sys.stdout.write("#define {}_BLOCK_SHIFT   {}\n".format(name, shift))
+    sys.stdout.write("static const {} {}_STAGE1[] = {{\n".format(stage1_type, name))
+    sys.stdout.write("\n".join(textwrap.wrap(", ".join(str(i) for i in stage1), 110,
+                        initial_indent = "    ", subsequent_indent="    ")))
+    sys.stdout.write("\n};\n")
+    sys.stdout.write("static const unsigned char {}_STAGE2[] = {{\n".format(name))
+    sys.stdout.write("\n".join(textwrap.wrap(", ".join("0x{:02x}".format(b) for b in stage2), 110,
+                        initial_indent = "    ", subsequent_indent="    ")))
+    sys.stdout.write("\n};\n\n")
+
+
 codepoint_list.sort()
 
 
@@ -64,3 +102,6 @@ sys.stdout.write("static const unsigned PUNCT_MAP[] = {\n")
 sys.stdout.write("\n".join(textwrap.wrap(", ".join(records), 110,
                     initial_indent = "    ", subsequent_indent="    ")))
 sys.stdout.write("\n};\n\n")
+
+# The bsearch() map above is kept for md4c-unicode-bench; md4c.c uses this:
+write_two_stage_bitmap("PUNCT", set(codepoint_list))
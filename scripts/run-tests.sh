@@ -15,6 +15,7 @@ if [ ! -x "$PROGRAM" ]; then
     echo "You have to run this script from the build directory." >&2
     exit 1
 fi
+API_TESTS="test/api_tests"
 
 if which py >>/dev/null 2>&1; then
     PYTHON=py
@@ -66,6 +67,10 @@ echo
 echo "Wiki links extension:"
 $PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/wiki-links.txt" -p "$PROGRAM --fwiki-links --ftables"
 
+echo
+echo "Header self links extension:"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/header-self-links.txt" -p "$PROGRAM --fheader-self-links"
+
 echo
 echo "Underline extension:"
 $PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/underline.txt" -p "$PROGRAM --funderline"
@@ -73,3 +78,68 @@ $PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/underline.txt" -p "$PROGRAM --fu
 echo
 echo "Pathological input:"
 $PYTHON "$TEST_DIR/pathological_tests.py" -p "$PROGRAM"
+
+echo
+echo "Reused parser context (md_parser_create()):"
+$API_TESTS reuse "$TEST_DIR"
+
+echo
+echo "Memory allocator (MD_ALLOCATOR):"
+$API_TESTS allocator "$TEST_DIR"
+
+echo
+echo "Streaming input (md_html_feed() + md_html_finish()):"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/spec.txt" -p "$PROGRAM --chunk-size=7"
+$PYTHON "$TEST_DIR/streaming_tests.py" -p "$PROGRAM"
+
+echo
+echo "Incremental re-parse (md_html_load() + md_html_edit()):"
+$API_TESTS edit "$TEST_DIR"
+
+echo
+echo "Parallel processing (md2html --threads=4):"
+$PYTHON "$TEST_DIR/parallel_tests.py" -p "$PROGRAM"
+
+echo
+echo "Batch mode (md2html --output-dir):"
+$PYTHON "$TEST_DIR/output_dir_tests.py" -p "$PROGRAM"
+
+echo
+echo "Document tree (md_parse_tree() + md_html_render_tree()):"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/spec.txt" -p "$PROGRAM --tree"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/coverage.txt" -p "$PROGRAM --tree"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/tasklists.txt" -p "$PROGRAM --tree --ftasklists"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/wiki-links.txt" -p "$PROGRAM --tree --fwiki-links --ftables"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/header-self-links.txt" -p "$PROGRAM --tree --fheader-self-links"
+
+echo
+echo "Saved document tree (md_tree_save() + md_tree_load()):"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/spec.txt" -p "$PROGRAM --tree=blob"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/spec.txt" -p "$PROGRAM --tree=blob-text"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/tables.txt" -p "$PROGRAM --tree=blob --ftables"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/tasklists.txt" -p "$PROGRAM --tree=blob-text --ftasklists"
+$PYTHON "$TEST_DIR/spec_tests.py" -s "$TEST_DIR/wiki-links.txt" -p "$PROGRAM --tree=blob --fwiki-links --ftables"
+$PYTHON "$TEST_DIR/tree_blob_tests.py" -p "$PROGRAM"
+
+echo
+echo "Render cache (MD_HTML_CACHE):"
+$API_TESTS cache "$TEST_DIR"
+
+echo
+echo "Link memo (MD_HTML_LINK_MEMO):"
+$API_TESTS memo "$TEST_DIR"
+
+echo
+echo "Scatter-gather output (process_output_iov()):"
+$API_TESTS iov "$TEST_DIR"
+
+echo
+echo "Output into buffer (md_html_to_buffer() etc.):"
+$API_TESTS buffer "$TEST_DIR"
+
+# Needs md2html built with MD4C_LARGE_DOCUMENTS, ~5 GiB of disk and minutes.
+if [ -n "$MD4C_LARGE_DOCUMENTS_TEST" ]; then
+    echo
+    echo "Large document (> 4 GiB):"
+    $PYTHON "$TEST_DIR/large_document_tests.py" -p "$PROGRAM"
+fi
@@ -27,2164 +27,2209 @@
 #include <string.h>
 
 
-/* The table is generated from https://html.spec.whatwg.org/entities.json */
-static const struct entity entity_table[] = {
-    { "&AElig;", { 198, 0 } },
-    { "&AMP;", { 38, 0 } },
-    { "&Aacute;", { 193, 0 } },
-    { "&Abreve;", { 258, 0 } },
-    { "&Acirc;", { 194, 0 } },
-    { "&Acy;", { 1040, 0 } },
-    { "&Afr;", { 120068, 0 } },
-    { "&Agrave;", { 192, 0 } },
-    { "&Alpha;", { 913, 0 } },
-    { "&Amacr;", { 256, 0 } },
-    { "&And;", { 10835, 0 } },
-    { "&Aogon;", { 260, 0 } },
-    { "&Aopf;", { 120120, 0 } },
-    { "&ApplyFunction;", { 8289, 0 } },
-    { "&Aring;", { 197, 0 } },
-    { "&Ascr;", { 119964, 0 } },
-    { "&Assign;", { 8788, 0 } },
-    { "&Atilde;", { 195, 0 } },
-    { "&Auml;", { 196, 0 } },
-    { "&Backslash;", { 8726, 0 } },
-    { "&Barv;", { 10983, 0 } },
-    { "&Barwed;", { 8966, 0 } },
-    { "&Bcy;", { 1041, 0 } },
-    { "&Because;", { 8757, 0 } },
-    { "&Bernoullis;", { 8492, 0 } },
-    { "&Beta;", { 914, 0 } },
-    { "&Bfr;", { 120069, 0 } },
-    { "&Bopf;", { 120121, 0 } },
-    { "&Breve;", { 728, 0 } },
-    { "&Bscr;", { 8492, 0 } },
-    { "&Bumpeq;", { 8782, 0 } },
-    { "&CHcy;", { 1063, 0 } },
-    { "&COPY;", { 169, 0 } },
-    { "&Cacute;", { 262, 0 } },
-    { "&Cap;", { 8914, 0 } },
-    { "&CapitalDifferentialD;", { 8517, 0 } },
-    { "&Cayleys;", { 8493, 0 } },
-    { "&Ccaron;", { 268, 0 } },
-    { "&Ccedil;", { 199, 0 } },
-    { "&Ccirc;", { 264, 0 } },
-    { "&Cconint;", { 8752, 0 } },
-    { "&Cdot;", { 266, 0 } },
-    { "&Cedilla;", { 184, 0 } },
-    { "&CenterDot;", { 183, 0 } },
-    { "&Cfr;", { 8493, 0 } },
-    { "&Chi;", { 935, 0 } },
-    { "&CircleDot;", { 8857, 0 } },
-    { "&CircleMinus;", { 8854, 0 } },
-    { "&CirclePlus;", { 8853, 0 } },
-    { "&CircleTimes;", { 8855, 0 } },
-    { "&ClockwiseContourIntegral;", { 8754, 0 } },
-    { "&CloseCurlyDoubleQuote;", { 8221, 0 } },
-    { "&CloseCurlyQuote;", { 8217, 0 } },
-    { "&Colon;", { 8759, 0 } },
-    { "&Colone;", { 10868, 0 } },
-    { "&Congruent;", { 8801, 0 } },
-    { "&Conint;", { 8751, 0 } },
-    { "&ContourIntegral;", { 8750, 0 } },
-    { "&Copf;", { 8450, 0 } },
-    { "&Coproduct;", { 8720, 0 } },
-    { "&CounterClockwiseContourIntegral;", { 8755, 0 } },
-    { "&Cross;", { 10799, 0 } },
-    { "&Cscr;", { 119966, 0 } },
-    { "&Cup;", { 8915, 0 } },
-    { "&CupCap;", { 8781, 0 } },
-    { "&DD;", { 8517, 0 } },
-    { "&DDotrahd;", { 10513, 0 } },
-    { "&DJcy;", { 1026, 0 } },
-    { "&DScy;", { 1029, 0 } },
-    { "&DZcy;", { 1039, 0 } },
-    { "&Dagger;", { 8225, 0 } },
-    { "&Darr;", { 8609, 0 } },
-    { "&Dashv;", { 10980, 0 } },
-    { "&Dcaron;", { 270, 0 } },
-    { "&Dcy;", { 1044, 0 } },
-    { "&Del;", { 8711, 0 } },
-    { "&Delta;", { 916, 0 } },
-    { "&Dfr;", { 120071, 0 } },
-    { "&DiacriticalAcute;", { 180, 0 } },
-    { "&DiacriticalDot;", { 729, 0 } },
-    { "&DiacriticalDoubleAcute;", { 733, 0 } },
-    { "&DiacriticalGrave;", { 96, 0 } },
-    { "&DiacriticalTilde;", { 732, 0 } },
-    { "&Diamond;", { 8900, 0 } },
-    { "&DifferentialD;", { 8518, 0 } },
-    { "&Dopf;", { 120123, 0 } },
-    { "&Dot;", { 168, 0 } },
-    { "&DotDot;", { 8412, 0 } },
-    { "&DotEqual;", { 8784, 0 } },
-    { "&DoubleContourIntegral;", { 8751, 0 } },
-    { "&DoubleDot;", { 168, 0 } },
-    { "&DoubleDownArrow;", { 8659, 0 } },
-    { "&DoubleLeftArrow;", { 8656, 0 } },
-    { "&DoubleLeftRightArrow;", { 8660, 0 } },
-    { "&DoubleLeftTee;", { 10980, 0 } },
-    { "&DoubleLongLeftArrow;", { 10232, 0 } },
-    { "&DoubleLongLeftRightArrow;", { 10234, 0 } },
-    { "&DoubleLongRightArrow;", { 10233, 0 } },
-    { "&DoubleRightArrow;", { 8658, 0 } },
-    { "&DoubleRightTee;", { 8872, 0 } },
-    { "&DoubleUpArrow;", { 8657, 0 } },
-    { "&DoubleUpDownArrow;", { 8661, 0 } },
-    { "&DoubleVerticalBar;", { 8741, 0 } },
-    { "&DownArrow;", { 8595, 0 } },
-    { "&DownArrowBar;", { 10515, 0 } },
-    { "&DownArrowUpArrow;", { 8693, 0 } },
-    { "&DownBreve;", { 785, 0 } },
-    { "&DownLeftRightVector;", { 10576, 0 } },
-    { "&DownLeftTeeVector;", { 10590, 0 } },
-    { "&DownLeftVector;", { 8637, 0 } },
-    { "&DownLeftVectorBar;", { 10582, 0 } },
-    { "&DownRightTeeVector;", { 10591, 0 } },
-    { "&DownRightVector;", { 8641, 0 } },
-    { "&DownRightVectorBar;", { 10583, 0 } },
-    { "&DownTee;", { 8868, 0 } },
-    { "&DownTeeArrow;", { 8615, 0 } },
-    { "&Downarrow;", { 8659, 0 } },
-    { "&Dscr;", { 119967, 0 } },
-    { "&Dstrok;", { 272, 0 } },
-    { "&ENG;", { 330, 0 } },
-    { "&ETH;", { 208, 0 } },
-    { "&Eacute;", { 201, 0 } },
-    { "&Ecaron;", { 282, 0 } },
-    { "&Ecirc;", { 202, 0 } },
-    { "&Ecy;", { 1069, 0 } },
-    { "&Edot;", { 278, 0 } },
-    { "&Efr;", { 120072, 0 } },
-    { "&Egrave;", { 200, 0 } },
-    { "&Element;", { 8712, 0 } },
-    { "&Emacr;", { 274, 0 } },
-    { "&EmptySmallSquare;", { 9723, 0 } },
-    { "&EmptyVerySmallSquare;", { 9643, 0 } },
-    { "&Eogon;", { 280, 0 } },
-    { "&Eopf;", { 120124, 0 } },
-    { "&Epsilon;", { 917, 0 } },
-    { "&Equal;", { 10869, 0 } },
-    { "&EqualTilde;", { 8770, 0 } },
-    { "&Equilibrium;", { 8652, 0 } },
-    { "&Escr;", { 8496, 0 } },
-    { "&Esim;", { 10867, 0 } },
-    { "&Eta;", { 919, 0 } },
-    { "&Euml;", { 203, 0 } },
-    { "&Exists;", { 8707, 0 } },
-    { "&ExponentialE;", { 8519, 0 } },
-    { "&Fcy;", { 1060, 0 } },
-    { "&Ffr;", { 120073, 0 } },
-    { "&FilledSmallSquare;", { 9724, 0 } },
-    { "&FilledVerySmallSquare;", { 9642, 0 } },
-    { "&Fopf;", { 120125, 0 } },
-    { "&ForAll;", { 8704, 0 } },
-    { "&Fouriertrf;", { 8497, 0 } },
-    { "&Fscr;", { 8497, 0 } },
-    { "&GJcy;", { 1027, 0 } },
-    { "&GT;", { 62, 0 } },
-    { "&Gamma;", { 915, 0 } },
-    { "&Gammad;", { 988, 0 } },
-    { "&Gbreve;", { 286, 0 } },
-    { "&Gcedil;", { 290, 0 } },
-    { "&Gcirc;", { 284, 0 } },
-    { "&Gcy;", { 1043, 0 } },
-    { "&Gdot;", { 288, 0 } },
-    { "&Gfr;", { 120074, 0 } },
-    { "&Gg;", { 8921, 0 } },
-    { "&Gopf;", { 120126, 0 } },
-    { "&GreaterEqual;", { 8805, 0 } },
-    { "&GreaterEqualLess;", { 8923, 0 } },
-    { "&GreaterFullEqual;", { 8807, 0 } },
-    { "&GreaterGreater;", { 10914, 0 } },
-    { "&GreaterLess;", { 8823, 0 } },
-    { "&GreaterSlantEqual;", { 10878, 0 } },
-    { "&GreaterTilde;", { 8819, 0 } },
-    { "&Gscr;", { 119970, 0 } },
-    { "&Gt;", { 8811, 0 } },
-    { "&HARDcy;", { 1066, 0 } },
-    { "&Hacek;", { 711, 0 } },
-    { "&Hat;", { 94, 0 } },
-    { "&Hcirc;", { 292, 0 } },
-    { "&Hfr;", { 8460, 0 } },
-    { "&HilbertSpace;", { 8459, 0 } },
-    { "&Hopf;", { 8461, 0 } },
-    { "&HorizontalLine;", { 9472, 0 } },
-    { "&Hscr;", { 8459, 0 } },
-    { "&Hstrok;", { 294, 0 } },
-    { "&HumpDownHump;", { 8782, 0 } },
-    { "&HumpEqual;", { 8783, 0 } },
-    { "&IEcy;", { 1045, 0 } },
-    { "&IJlig;", { 306, 0 } },
-    { "&IOcy;", { 1025, 0 } },
-    { "&Iacute;", { 205, 0 } },
-    { "&Icirc;", { 206, 0 } },
-    { "&Icy;", { 1048, 0 } },
-    { "&Idot;", { 304, 0 } },
-    { "&Ifr;", { 8465, 0 } },
-    { "&Igrave;", { 204, 0 } },
-    { "&Im;", { 8465, 0 } },
-    { "&Imacr;", { 298, 0 } },
-    { "&ImaginaryI;", { 8520, 0 } },
-    { "&Implies;", { 8658, 0 } },
-    { "&Int;", { 8748, 0 } },
-    { "&Integral;", { 8747, 0 } },
-    { "&Intersection;", { 8898, 0 } },
-    { "&InvisibleComma;", { 8291, 0 } },
-    { "&InvisibleTimes;", { 8290, 0 } },
-    { "&Iogon;", { 302, 0 } },
-    { "&Iopf;", { 120128, 0 } },
-    { "&Iota;", { 921, 0 } },
-    { "&Iscr;", { 8464, 0 } },
-    { "&Itilde;", { 296, 0 } },
-    { "&Iukcy;", { 1030, 0 } },
-    { "&Iuml;", { 207, 0 } },
-    { "&Jcirc;", { 308, 0 } },
-    { "&Jcy;", { 1049, 0 } },
-    { "&Jfr;", { 120077, 0 } },
-    { "&Jopf;", { 120129, 0 } },
-    { "&Jscr;", { 119973, 0 } },
-    { "&Jsercy;", { 1032, 0 } },
-    { "&Jukcy;", { 1028, 0 } },
-    { "&KHcy;", { 1061, 0 } },
-    { "&KJcy;", { 1036, 0 } },
-    { "&Kappa;", { 922, 0 } },
-    { "&Kcedil;", { 310, 0 } },
-    { "&Kcy;", { 1050, 0 } },
-    { "&Kfr;", { 120078, 0 } },
-    { "&Kopf;", { 120130, 0 } },
-    { "&Kscr;", { 119974, 0 } },
-    { "&LJcy;", { 1033, 0 } },
-    { "&LT;", { 60, 0 } },
-    { "&Lacute;", { 313, 0 } },
-    { "&Lambda;", { 923, 0 } },
-    { "&Lang;", { 10218, 0 } },
-    { "&Laplacetrf;", { 8466, 0 } },
-    { "&Larr;", { 8606, 0 } },
-    { "&Lcaron;", { 317, 0 } },
-    { "&Lcedil;", { 315, 0 } },
-    { "&Lcy;", { 1051, 0 } },
-    { "&LeftAngleBracket;", { 10216, 0 } },
-    { "&LeftArrow;", { 8592, 0 } },
-    { "&LeftArrowBar;", { 8676, 0 } },
-    { "&LeftArrowRightArrow;", { 8646, 0 } },
-    { "&LeftCeiling;", { 8968, 0 } },
-    { "&LeftDoubleBracket;", { 10214, 0 } },
-    { "&LeftDownTeeVector;", { 10593, 0 } },
-    { "&LeftDownVector;", { 8643, 0 } },
-    { "&LeftDownVectorBar;", { 10585, 0 } },
-    { "&LeftFloor;", { 8970, 0 } },
-    { "&LeftRightArrow;", { 8596, 0 } },
-    { "&LeftRightVector;", { 10574, 0 } },
-    { "&LeftTee;", { 8867, 0 } },
-    { "&LeftTeeArrow;", { 8612, 0 } },
-    { "&LeftTeeVector;", { 10586, 0 } },
-    { "&LeftTriangle;", { 8882, 0 } },
-    { "&LeftTriangleBar;", { 10703, 0 } },
-    { "&LeftTriangleEqual;", { 8884, 0 } },
-    { "&LeftUpDownVector;", { 10577, 0 } },
-    { "&LeftUpTeeVector;", { 10592, 0 } },
-    { "&LeftUpVector;", { 8639, 0 } },
-    { "&LeftUpVectorBar;", { 10584, 0 } },
-    { "&LeftVector;", { 8636, 0 } },
-    { "&LeftVectorBar;", { 10578, 0 } },
-    { "&Leftarrow;", { 8656, 0 } },
-    { "&Leftrightarrow;", { 8660, 0 } },
-    { "&LessEqualGreater;", { 8922, 0 } },
-    { "&LessFullEqual;", { 8806, 0 } },
-    { "&LessGreater;", { 8822, 0 } },
-    { "&LessLess;", { 10913, 0 } },
-    { "&LessSlantEqual;", { 10877, 0 } },
-    { "&LessTilde;", { 8818, 0 } },
-    { "&Lfr;", { 120079, 0 } },
-    { "&Ll;", { 8920, 0 } },
-    { "&Lleftarrow;", { 8666, 0 } },
-    { "&Lmidot;", { 319, 0 } },
-    { "&LongLeftArrow;", { 10229, 0 } },
-    { "&LongLeftRightArrow;", { 10231, 0 } },
-    { "&LongRightArrow;", { 10230, 0 } },
-    { "&Longleftarrow;", { 10232, 0 } },
-    { "&Longleftrightarrow;", { 10234, 0 } },
-    { "&Longrightarrow;", { 10233, 0 } },
-    { "&Lopf;", { 120131, 0 } },
-    { "&LowerLeftArrow;", { 8601, 0 } },
-    { "&LowerRightArrow;", { 8600, 0 } },
-    { "&Lscr;", { 8466, 0 } },
-    { "&Lsh;", { 8624, 0 } },
-    { "&Lstrok;", { 321, 0 } },
-    { "&Lt;", { 8810, 0 } },
-    { "&Map;", { 10501, 0 } },
-    { "&Mcy;", { 1052, 0 } },
-    { "&MediumSpace;", { 8287, 0 } },
-    { "&Mellintrf;", { 8499, 0 } },
-    { "&Mfr;", { 120080, 0 } },
-    { "&MinusPlus;", { 8723, 0 } },
-    { "&Mopf;", { 120132, 0 } },
-    { "&Mscr;", { 8499, 0 } },
-    { "&Mu;", { 924, 0 } },
-    { "&NJcy;", { 1034, 0 } },
-    { "&Nacute;", { 323, 0 } },
-    { "&Ncaron;", { 327, 0 } },
-    { "&Ncedil;", { 325, 0 } },
-    { "&Ncy;", { 1053, 0 } },
-    { "&NegativeMediumSpace;", { 8203, 0 } },
-    { "&NegativeThickSpace;", { 8203, 0 } },
-    { "&NegativeThinSpace;", { 8203, 0 } },
-    { "&NegativeVeryThinSpace;", { 8203, 0 } },
-    { "&NestedGreaterGreater;", { 8811, 0 } },
-    { "&NestedLessLess;", { 8810, 0 } },
-    { "&NewLine;", { 10, 0 } },
-    { "&Nfr;", { 120081, 0 } },
-    { "&NoBreak;", { 8288, 0 } },
-    { "&NonBreakingSpace;", { 160, 0 } },
-    { "&Nopf;", { 8469, 0 } },
-    { "&Not;", { 10988, 0 } },
-    { "&NotCongruent;", { 8802, 0 } },
-    { "&NotCupCap;", { 8813, 0 } },
-    { "&NotDoubleVerticalBar;", { 8742, 0 } },
-    { "&NotElement;", { 8713, 0 } },
-    { "&NotEqual;", { 8800, 0 } },
-    { "&NotEqualTilde;", { 8770, 824 } },
-    { "&NotExists;", { 8708, 0 } },
-    { "&NotGreater;", { 8815, 0 } },
-    { "&NotGreaterEqual;", { 8817, 0 } },
-    { "&NotGreaterFullEqual;", { 8807, 824 } },
-    { "&NotGreaterGreater;", { 8811, 824 } },
-    { "&NotGreaterLess;", { 8825, 0 } },
-    { "&NotGreaterSlantEqual;", { 10878, 824 } },
-    { "&NotGreaterTilde;", { 8821, 0 } },
-    { "&NotHumpDownHump;", { 8782, 824 } },
-    { "&NotHumpEqual;", { 8783, 824 } },
-    { "&NotLeftTriangle;", { 8938, 0 } },
-    { "&NotLeftTriangleBar;", { 10703, 824 } },
-    { "&NotLeftTriangleEqual;", { 8940, 0 } },
-    { "&NotLess;", { 8814, 0 } },
-    { "&NotLessEqual;", { 8816, 0 } },
-    { "&NotLessGreater;", { 8824, 0 } },
-    { "&NotLessLess;", { 8810, 824 } },
-    { "&NotLessSlantEqual;", { 10877, 824 } },
-    { "&NotLessTilde;", { 8820, 0 } },
-    { "&NotNestedGreaterGreater;", { 10914, 824 } },
-    { "&NotNestedLessLess;", { 10913, 824 } },
-    { "&NotPrecedes;", { 8832, 0 } },
-    { "&NotPrecedesEqual;", { 10927, 824 } },
-    { "&NotPrecedesSlantEqual;", { 8928, 0 } },
-    { "&NotReverseElement;", { 8716, 0 } },
-    { "&NotRightTriangle;", { 8939, 0 } },
-    { "&NotRightTriangleBar;", { 10704, 824 } },
-    { "&NotRightTriangleEqual;", { 8941, 0 } },
-    { "&NotSquareSubset;", { 8847, 824 } },
-    { "&NotSquareSubsetEqual;", { 8930, 0 } },
-    { "&NotSquareSuperset;", { 8848, 824 } },
-    { "&NotSquareSupersetEqual;", { 8931, 0 } },
-    { "&NotSubset;", { 8834, 8402 } },
-    { "&NotSubsetEqual;", { 8840, 0 } },
-    { "&NotSucceeds;", { 8833, 0 } },
-    { "&NotSucceedsEqual;", { 10928, 824 } },
-    { "&NotSucceedsSlantEqual;", { 8929, 0 } },
-    { "&NotSucceedsTilde;", { 8831, 824 } },
-    { "&NotSuperset;", { 8835, 8402 } },
-    { "&NotSupersetEqual;", { 8841, 0 } },
-    { "&NotTilde;", { 8769, 0 } },
-    { "&NotTildeEqual;", { 8772, 0 } },
-    { "&NotTildeFullEqual;", { 8775, 0 } },
-    { "&NotTildeTilde;", { 8777, 0 } },
-    { "&NotVerticalBar;", { 8740, 0 } },
-    { "&Nscr;", { 119977, 0 } },
-    { "&Ntilde;", { 209, 0 } },
-    { "&Nu;", { 925, 0 } },
-    { "&OElig;", { 338, 0 } },
-    { "&Oacute;", { 211, 0 } },
-    { "&Ocirc;", { 212, 0 } },
-    { "&Ocy;", { 1054, 0 } },
-    { "&Odblac;", { 336, 0 } },
-    { "&Ofr;", { 120082, 0 } },
-    { "&Ograve;", { 210, 0 } },
-    { "&Omacr;", { 332, 0 } },
-    { "&Omega;", { 937, 0 } },
-    { "&Omicron;", { 927, 0 } },
-    { "&Oopf;", { 120134, 0 } },
-    { "&OpenCurlyDoubleQuote;", { 8220, 0 } },
-    { "&OpenCurlyQuote;", { 8216, 0 } },
-    { "&Or;", { 10836, 0 } },
-    { "&Oscr;", { 119978, 0 } },
-    { "&Oslash;", { 216, 0 } },
-    { "&Otilde;", { 213, 0 } },
-    { "&Otimes;", { 10807, 0 } },
-    { "&Ouml;", { 214, 0 } },
-    { "&OverBar;", { 8254, 0 } },
-    { "&OverBrace;", { 9182, 0 } },
-    { "&OverBracket;", { 9140, 0 } },
-    { "&OverParenthesis;", { 9180, 0 } },
-    { "&PartialD;", { 8706, 0 } },
-    { "&Pcy;", { 1055, 0 } },
-    { "&Pfr;", { 120083, 0 } },
-    { "&Phi;", { 934, 0 } },
-    { "&Pi;", { 928, 0 } },
-    { "&PlusMinus;", { 177, 0 } },
-    { "&Poincareplane;", { 8460, 0 } },
-    { "&Popf;", { 8473, 0 } },
-    { "&Pr;", { 10939, 0 } },
-    { "&Precedes;", { 8826, 0 } },
-    { "&PrecedesEqual;", { 10927, 0 } },
-    { "&PrecedesSlantEqual;", { 8828, 0 } },
-    { "&PrecedesTilde;", { 8830, 0 } },
-    { "&Prime;", { 8243, 0 } },
-    { "&Product;", { 8719, 0 } },
-    { "&Proportion;", { 8759, 0 } },
-    { "&Proportional;", { 8733, 0 } },
-    { "&Pscr;", { 119979, 0 } },
-    { "&Psi;", { 936, 0 } },
-    { "&QUOT;", { 34, 0 } },
-    { "&Qfr;", { 120084, 0 } },
-    { "&Qopf;", { 8474, 0 } },
-    { "&Qscr;", { 119980, 0 } },
-    { "&RBarr;", { 10512, 0 } },
-    { "&REG;", { 174, 0 } },
-    { "&Racute;", { 340, 0 } },
-    { "&Rang;", { 10219, 0 } },
-    { "&Rarr;", { 8608, 0 } },
-    { "&Rarrtl;", { 10518, 0 } },
-    { "&Rcaron;", { 344, 0 } },
-    { "&Rcedil;", { 342, 0 } },
-    { "&Rcy;", { 1056, 0 } },
-    { "&Re;", { 8476, 0 } },
-    { "&ReverseElement;", { 8715, 0 } },
-    { "&ReverseEquilibrium;", { 8651, 0 } },
-    { "&ReverseUpEquilibrium;", { 10607, 0 } },
-    { "&Rfr;", { 8476, 0 } },
-    { "&Rho;", { 929, 0 } },
-    { "&RightAngleBracket;", { 10217, 0 } },
-    { "&RightArrow;", { 8594, 0 } },
-    { "&RightArrowBar;", { 8677, 0 } },
-    { "&RightArrowLeftArrow;", { 8644, 0 } },
-    { "&RightCeiling;", { 8969, 0 } },
-    { "&RightDoubleBracket;", { 10215, 0 } },
-    { "&RightDownTeeVector;", { 10589, 0 } },
-    { "&RightDownVector;", { 8642, 0 } },
-    { "&RightDownVectorBar;", { 10581, 0 } },
-    { "&RightFloor;", { 8971, 0 } },
-    { "&RightTee;", { 8866, 0 } },
-    { "&RightTeeArrow;", { 8614, 0 } },
-    { "&RightTeeVector;", { 10587, 0 } },
-    { "&RightTriangle;", { 8883, 0 } },
-    { "&RightTriangleBar;", { 10704, 0 } },
-    { "&RightTriangleEqual;", { 8885, 0 } },
-    { "&RightUpDownVector;", { 10575, 0 } },
-    { "&RightUpTeeVector;", { 10588, 0 } },
-    { "&RightUpVector;", { 8638, 0 } },
-    { "&RightUpVectorBar;", { 10580, 0 } },
-    { "&RightVector;", { 8640, 0 } },
-    { "&RightVectorBar;", { 10579, 0 } },
-    { "&Rightarrow;", { 8658, 0 } },
-    { "&Ropf;", { 8477, 0 } },
-    { "&RoundImplies;", { 10608, 0 } },
-    { "&Rrightarrow;", { 8667, 0 } },
-    { "&Rscr;", { 8475, 0 } },
-    { "&Rsh;", { 8625, 0 } },
-    { "&RuleDelayed;", { 10740, 0 } },
-    { "&SHCHcy;", { 1065, 0 } },
-    { "&SHcy;", { 1064, 0 } },
-    { "&SOFTcy;", { 1068, 0 } },
-    { "&Sacute;", { 346, 0 } },
-    { "&Sc;", { 10940, 0 } },
-    { "&Scaron;", { 352, 0 } },
-    { "&Scedil;", { 350, 0 } },
-    { "&Scirc;", { 348, 0 } },
-    { "&Scy;", { 1057, 0 } },
-    { "&Sfr;", { 120086, 0 } },
-    { "&ShortDownArrow;", { 8595, 0 } },
-    { "&ShortLeftArrow;", { 8592, 0 } },
-    { "&ShortRightArrow;", { 8594, 0 } },
-    { "&ShortUpArrow;", { 8593, 0 } },
-    { "&Sigma;", { 931, 0 } },
-    { "&SmallCircle;", { 8728, 0 } },
-    { "&Sopf;", { 120138, 0 } },
-    { "&Sqrt;", { 8730, 0 } },
-    { "&Square;", { 9633, 0 } },
-    { "&SquareIntersection;", { 8851, 0 } },
-    { "&SquareSubset;", { 8847, 0 } },
-    { "&SquareSubsetEqual;", { 8849, 0 } },
-    { "&SquareSuperset;", { 8848, 0 } },
-    { "&SquareSupersetEqual;", { 8850, 0 } },
-    { "&SquareUnion;", { 8852, 0 } },
-    { "&Sscr;", { 119982, 0 } },
-    { "&Star;", { 8902, 0 } },
-    { "&Sub;", { 8912, 0 } },
-    { "&Subset;", { 8912, 0 } },
-    { "&SubsetEqual;", { 8838, 0 } },
-    { "&Succeeds;", { 8827, 0 } },
-    { "&SucceedsEqual;", { 10928, 0 } },
-    { "&SucceedsSlantEqual;", { 8829, 0 } },
-    { "&SucceedsTilde;", { 8831, 0 } },
-    { "&SuchThat;", { 8715, 0 } },
-    { "&Sum;", { 8721, 0 } },
-    { "&Sup;", { 8913, 0 } },
-    { "&Superset;", { 8835, 0 } },
-    { "&SupersetEqual;", { 8839, 0 } },
-    { "&Supset;", { 8913, 0 } },
-    { "&THORN;", { 222, 0 } },
-    { "&TRADE;", { 8482, 0 } },
-    { "&TSHcy;", { 1035, 0 } },
-    { "&TScy;", { 1062, 0 } },
-    { "&Tab;", { 9, 0 } },
-    { "&Tau;", { 932, 0 } },
-    { "&Tcaron;", { 356, 0 } },
-    { "&Tcedil;", { 354, 0 } },
-    { "&Tcy;", { 1058, 0 } },
-    { "&Tfr;", { 120087, 0 } },
-    { "&Therefore;", { 8756, 0 } },
-    { "&Theta;", { 920, 0 } },
-    { "&ThickSpace;", { 8287, 8202 } },
-    { "&ThinSpace;", { 8201, 0 } },
-    { "&Tilde;", { 8764, 0 } },
-    { "&TildeEqual;", { 8771, 0 } },
-    { "&TildeFullEqual;", { 8773, 0 } },
-    { "&TildeTilde;", { 8776, 0 } },
-    { "&Topf;", { 120139, 0 } },
-    { "&TripleDot;", { 8411, 0 } },
-    { "&Tscr;", { 119983, 0 } },
-    { "&Tstrok;", { 358, 0 } },
-    { "&Uacute;", { 218, 0 } },
-    { "&Uarr;", { 8607, 0 } },
-    { "&Uarrocir;", { 10569, 0 } },
-    { "&Ubrcy;", { 1038, 0 } },
-    { "&Ubreve;", { 364, 0 } },
-    { "&Ucirc;", { 219, 0 } },
-    { "&Ucy;", { 1059, 0 } },
-    { "&Udblac;", { 368, 0 } },
-    { "&Ufr;", { 120088, 0 } },
-    { "&Ugrave;", { 217, 0 } },
-    { "&Umacr;", { 362, 0 } },
-    { "&UnderBar;", { 95, 0 } },
-    { "&UnderBrace;", { 9183, 0 } },
-    { "&UnderBracket;", { 9141, 0 } },
-    { "&UnderParenthesis;", { 9181, 0 } },
-    { "&Union;", { 8899, 0 } },
-    { "&UnionPlus;", { 8846, 0 } },
-    { "&Uogon;", { 370, 0 } },
-    { "&Uopf;", { 120140, 0 } },
-    { "&UpArrow;", { 8593, 0 } },
-    { "&UpArrowBar;", { 10514, 0 } },
-    { "&UpArrowDownArrow;", { 8645, 0 } },
-    { "&UpDownArrow;", { 8597, 0 } },
-    { "&UpEquilibrium;", { 10606, 0 } },
-    { "&UpTee;", { 8869, 0 } },
-    { "&UpTeeArrow;", { 8613, 0 } },
-    { "&Uparrow;", { 8657, 0 } },
-    { "&Updownarrow;", { 8661, 0 } },
-    { "&UpperLeftArrow;", { 8598, 0 } },
-    { "&UpperRightArrow;", { 8599, 0 } },
-    { "&Upsi;", { 978, 0 } },
-    { "&Upsilon;", { 933, 0 } },
-    { "&Uring;", { 366, 0 } },
-    { "&Uscr;", { 119984, 0 } },
-    { "&Utilde;", { 360, 0 } },
-    { "&Uuml;", { 220, 0 } },
-    { "&VDash;", { 8875, 0 } },
-    { "&Vbar;", { 10987, 0 } },
-    { "&Vcy;", { 1042, 0 } },
-    { "&Vdash;", { 8873, 0 } },
-    { "&Vdashl;", { 10982, 0 } },
-    { "&Vee;", { 8897, 0 } },
-    { "&Verbar;", { 8214, 0 } },
-    { "&Vert;", { 8214, 0 } },
-    { "&VerticalBar;", { 8739, 0 } },
-    { "&VerticalLine;", { 124, 0 } },
-    { "&VerticalSeparator;", { 10072, 0 } },
-    { "&VerticalTilde;", { 8768, 0 } },
-    { "&VeryThinSpace;", { 8202, 0 } },
-    { "&Vfr;", { 120089, 0 } },
-    { "&Vopf;", { 120141, 0 } },
-    { "&Vscr;", { 119985, 0 } },
-    { "&Vvdash;", { 8874, 0 } },
-    { "&Wcirc;", { 372, 0 } },
-    { "&Wedge;", { 8896, 0 } },
-    { "&Wfr;", { 120090, 0 } },
-    { "&Wopf;", { 120142, 0 } },
-    { "&Wscr;", { 119986, 0 } },
-    { "&Xfr;", { 120091, 0 } },
-    { "&Xi;", { 926, 0 } },
-    { "&Xopf;", { 120143, 0 } },
-    { "&Xscr;", { 119987, 0 } },
-    { "&YAcy;", { 1071, 0 } },
-    { "&YIcy;", { 1031, 0 } },
-    { "&YUcy;", { 1070, 0 } },
-    { "&Yacute;", { 221, 0 } },
-    { "&Ycirc;", { 374, 0 } },
-    { "&Ycy;", { 1067, 0 } },
-    { "&Yfr;", { 120092, 0 } },
-    { "&Yopf;", { 120144, 0 } },
-    { "&Yscr;", { 119988, 0 } },
-    { "&Yuml;", { 376, 0 } },
-    { "&ZHcy;", { 1046, 0 } },
-    { "&Zacute;", { 377, 0 } },
-    { "&Zcaron;", { 381, 0 } },
-    { "&Zcy;", { 1047, 0 } },
-    { "&Zdot;", { 379, 0 } },
-    { "&ZeroWidthSpace;", { 8203, 0 } },
-    { "&Zeta;", { 918, 0 } },
-    { "&Zfr;", { 8488, 0 } },
-    { "&Zopf;", { 8484, 0 } },
-    { "&Zscr;", { 119989, 0 } },
-    { "&aacute;", { 225, 0 } },
-    { "&abreve;", { 259, 0 } },
-    { "&ac;", { 8766, 0 } },
-    { "&acE;", { 8766, 819 } },
-    { "&acd;", { 8767, 0 } },
-    { "&acirc;", { 226, 0 } },
-    { "&acute;", { 180, 0 } },
-    { "&acy;", { 1072, 0 } },
-    { "&aelig;", { 230, 0 } },
-    { "&af;", { 8289, 0 } },
-    { "&afr;", { 120094, 0 } },
-    { "&agrave;", { 224, 0 } },
-    { "&alefsym;", { 8501, 0 } },
-    { "&aleph;", { 8501, 0 } },
-    { "&alpha;", { 945, 0 } },
-    { "&amacr;", { 257, 0 } },
-    { "&amalg;", { 10815, 0 } },
-    { "&amp;", { 38, 0 } },
-    { "&and;", { 8743, 0 } },
-    { "&andand;", { 10837, 0 } },
-    { "&andd;", { 10844, 0 } },
-    { "&andslope;", { 10840, 0 } },
-    { "&andv;", { 10842, 0 } },
-    { "&ang;", { 8736, 0 } },
-    { "&ange;", { 10660, 0 } },
-    { "&angle;", { 8736, 0 } },
-    { "&angmsd;", { 8737, 0 } },
-    { "&angmsdaa;", { 10664, 0 } },
-    { "&angmsdab;", { 10665, 0 } },
-    { "&angmsdac;", { 10666, 0 } },
-    { "&angmsdad;", { 10667, 0 } },
-    { "&angmsdae;", { 10668, 0 } },
-    { "&angmsdaf;", { 10669, 0 } },
-    { "&angmsdag;", { 10670, 0 } },
-    { "&angmsdah;", { 10671, 0 } },
-    { "&angrt;", { 8735, 0 } },
-    { "&angrtvb;", { 8894, 0 } },
-    { "&angrtvbd;", { 10653, 0 } },
-    { "&angsph;", { 8738, 0 } },
-    { "&angst;", { 197, 0 } },
-    { "&angzarr;", { 9084, 0 } },
-    { "&aogon;", { 261, 0 } },
-    { "&aopf;", { 120146, 0 } },
-    { "&ap;", { 8776, 0 } },
-    { "&apE;", { 10864, 0 } },
-    { "&apacir;", { 10863, 0 } },
-    { "&ape;", { 8778, 0 } },
-    { "&apid;", { 8779, 0 } },
-    { "&apos;", { 39, 0 } },
-    { "&approx;", { 8776, 0 } },
-    { "&approxeq;", { 8778, 0 } },
-    { "&aring;", { 229, 0 } },
-    { "&ascr;", { 119990, 0 } },
-    { "&ast;", { 42, 0 } },
-    { "&asymp;", { 8776, 0 } },
-    { "&asympeq;", { 8781, 0 } },
-    { "&atilde;", { 227, 0 } },
-    { "&auml;", { 228, 0 } },
-    { "&awconint;", { 8755, 0 } },
-    { "&awint;", { 10769, 0 } },
-    { "&bNot;", { 10989, 0 } },
-    { "&backcong;", { 8780, 0 } },
-    { "&backepsilon;", { 1014, 0 } },
-    { "&backprime;", { 8245, 0 } },
-    { "&backsim;", { 8765, 0 } },
-    { "&backsimeq;", { 8909, 0 } },
-    { "&barvee;", { 8893, 0 } },
-    { "&barwed;", { 8965, 0 } },
-    { "&barwedge;", { 8965, 0 } },
-    { "&bbrk;", { 9141, 0 } },
-    { "&bbrktbrk;", { 9142, 0 } },
-    { "&bcong;", { 8780, 0 } },
-    { "&bcy;", { 1073, 0 } },
-    { "&bdquo;", { 8222, 0 } },
-    { "&becaus;", { 8757, 0 } },
-    { "&because;", { 8757, 0 } },
-    { "&bemptyv;", { 10672, 0 } },
-    { "&bepsi;", { 1014, 0 } },
-    { "&bernou;", { 8492, 0 } },
-    { "&beta;", { 946, 0 } },
-    { "&beth;", { 8502, 0 } },
-    { "&between;", { 8812, 0 } },
-    { "&bfr;", { 120095, 0 } },
-    { "&bigcap;", { 8898, 0 } },
-    { "&bigcirc;", { 9711, 0 } },
-    { "&bigcup;", { 8899, 0 } },
-    { "&bigodot;", { 10752, 0 } },
-    { "&bigoplus;", { 10753, 0 } },
-    { "&bigotimes;", { 10754, 0 } },
-    { "&bigsqcup;", { 10758, 0 } },
-    { "&bigstar;", { 9733, 0 } },
-    { "&bigtriangledown;", { 9661, 0 } },
-    { "&bigtriangleup;", { 9651, 0 } },
-    { "&biguplus;", { 10756, 0 } },
-    { "&bigvee;", { 8897, 0 } },
-    { "&bigwedge;", { 8896, 0 } },
-    { "&bkarow;", { 10509, 0 } },
-    { "&blacklozenge;", { 10731, 0 } },
-    { "&blacksquare;", { 9642, 0 } },
-    { "&blacktriangle;", { 9652, 0 } },
-    { "&blacktriangledown;", { 9662, 0 } },
-    { "&blacktriangleleft;", { 9666, 0 } },
-    { "&blacktriangleright;", { 9656, 0 } },
-    { "&blank;", { 9251, 0 } },
-    { "&blk12;", { 9618, 0 } },
-    { "&blk14;", { 9617, 0 } },
-    { "&blk34;", { 9619, 0 } },
-    { "&block;", { 9608, 0 } },
-    { "&bne;", { 61, 8421 } },
-    { "&bnequiv;", { 8801, 8421 } },
-    { "&bnot;", { 8976, 0 } },
-    { "&bopf;", { 120147, 0 } },
-    { "&bot;", { 8869, 0 } },
-    { "&bottom;", { 8869, 0 } },
-    { "&bowtie;", { 8904, 0 } },
-    { "&boxDL;", { 9559, 0 } },
-    { "&boxDR;", { 9556, 0 } },
-    { "&boxDl;", { 9558, 0 } },
-    { "&boxDr;", { 9555, 0 } },
-    { "&boxH;", { 9552, 0 } },
-    { "&boxHD;", { 9574, 0 } },
-    { "&boxHU;", { 9577, 0 } },
-    { "&boxHd;", { 9572, 0 } },
-    { "&boxHu;", { 9575, 0 } },
-    { "&boxUL;", { 9565, 0 } },
-    { "&boxUR;", { 9562, 0 } },
-    { "&boxUl;", { 9564, 0 } },
-    { "&boxUr;", { 9561, 0 } },
-    { "&boxV;", { 9553, 0 } },
-    { "&boxVH;", { 9580, 0 } },
-    { "&boxVL;", { 9571, 0 } },
-    { "&boxVR;", { 9568, 0 } },
-    { "&boxVh;", { 9579, 0 } },
-    { "&boxVl;", { 9570, 0 } },
-    { "&boxVr;", { 9567, 0 } },
-    { "&boxbox;", { 10697, 0 } },
-    { "&boxdL;", { 9557, 0 } },
-    { "&boxdR;", { 9554, 0 } },
-    { "&boxdl;", { 9488, 0 } },
-    { "&boxdr;", { 9484, 0 } },
-    { "&boxh;", { 9472, 0 } },
-    { "&boxhD;", { 9573, 0 } },
-    { "&boxhU;", { 9576, 0 } },
-    { "&boxhd;", { 9516, 0 } },
-    { "&boxhu;", { 9524, 0 } },
-    { "&boxminus;", { 8863, 0 } },
-    { "&boxplus;", { 8862, 0 } },
-    { "&boxtimes;", { 8864, 0 } },
-    { "&boxuL;", { 9563, 0 } },
-    { "&boxuR;", { 9560, 0 } },
-    { "&boxul;", { 9496, 0 } },
-    { "&boxur;", { 9492, 0 } },
-    { "&boxv;", { 9474, 0 } },
-    { "&boxvH;", { 9578, 0 } },
-    { "&boxvL;", { 9569, 0 } },
-    { "&boxvR;", { 9566, 0 } },
-    { "&boxvh;", { 9532, 0 } },
-    { "&boxvl;", { 9508, 0 } },
-    { "&boxvr;", { 9500, 0 } },
-    { "&bprime;", { 8245, 0 } },
-    { "&breve;", { 728, 0 } },
-    { "&brvbar;", { 166, 0 } },
-    { "&bscr;", { 119991, 0 } },
-    { "&bsemi;", { 8271, 0 } },
-    { "&bsim;", { 8765, 0 } },
-    { "&bsime;", { 8909, 0 } },
-    { "&bsol;", { 92, 0 } },
-    { "&bsolb;", { 10693, 0 } },
-    { "&bsolhsub;", { 10184, 0 } },
-    { "&bull;", { 8226, 0 } },
-    { "&bullet;", { 8226, 0 } },
-    { "&bump;", { 8782, 0 } },
-    { "&bumpE;", { 10926, 0 } },
-    { "&bumpe;", { 8783, 0 } },
-    { "&bumpeq;", { 8783, 0 } },
-    { "&cacute;", { 263, 0 } },
-    { "&cap;", { 8745, 0 } },
-    { "&capand;", { 10820, 0 } },
-    { "&capbrcup;", { 10825, 0 } },
-    { "&capcap;", { 10827, 0 } },
-    { "&capcup;", { 10823, 0 } },
-    { "&capdot;", { 10816, 0 } },
-    { "&caps;", { 8745, 65024 } },
-    { "&caret;", { 8257, 0 } },
-    { "&caron;", { 711, 0 } },
-    { "&ccaps;", { 10829, 0 } },
-    { "&ccaron;", { 269, 0 } },
-    { "&ccedil;", { 231, 0 } },
-    { "&ccirc;", { 265, 0 } },
-    { "&ccups;", { 10828, 0 } },
-    { "&ccupssm;", { 10832, 0 } },
-    { "&cdot;", { 267, 0 } },
-    { "&cedil;", { 184, 0 } },
-    { "&cemptyv;", { 10674, 0 } },
-    { "&cent;", { 162, 0 } },
-    { "&centerdot;", { 183, 0 } },
-    { "&cfr;", { 120096, 0 } },
-    { "&chcy;", { 1095, 0 } },
-    { "&check;", { 10003, 0 } },
-    { "&checkmark;", { 10003, 0 } },
-    { "&chi;", { 967, 0 } },
-    { "&cir;", { 9675, 0 } },
-    { "&cirE;", { 10691, 0 } },
-    { "&circ;", { 710, 0 } },
-    { "&circeq;", { 8791, 0 } },
-    { "&circlearrowleft;", { 8634, 0 } },
-    { "&circlearrowright;", { 8635, 0 } },
-    { "&circledR;", { 174, 0 } },
-    { "&circledS;", { 9416, 0 } },
-    { "&circledast;", { 8859, 0 } },
-    { "&circledcirc;", { 8858, 0 } },
-    { "&circleddash;", { 8861, 0 } },
-    { "&cire;", { 8791, 0 } },
-    { "&cirfnint;", { 10768, 0 } },
-    { "&cirmid;", { 10991, 0 } },
-    { "&cirscir;", { 10690, 0 } },
-    { "&clubs;", { 9827, 0 } },
-    { "&clubsuit;", { 9827, 0 } },
-    { "&colon;", { 58, 0 } },
-    { "&colone;", { 8788, 0 } },
-    { "&coloneq;", { 8788, 0 } },
-    { "&comma;", { 44, 0 } },
-    { "&commat;", { 64, 0 } },
-    { "&comp;", { 8705, 0 } },
-    { "&compfn;", { 8728, 0 } },
-    { "&complement;", { 8705, 0 } },
-    { "&complexes;", { 8450, 0 } },
-    { "&cong;", { 8773, 0 } },
-    { "&congdot;", { 10861, 0 } },
-    { "&conint;", { 8750, 0 } },
-    { "&copf;", { 120148, 0 } },
-    { "&coprod;", { 8720, 0 } },
-    { "&copy;", { 169, 0 } },
-    { "&copysr;", { 8471, 0 } },
-    { "&crarr;", { 8629, 0 } },
-    { "&cross;", { 10007, 0 } },
-    { "&cscr;", { 119992, 0 } },
-    { "&csub;", { 10959, 0 } },
-    { "&csube;", { 10961, 0 } },
-    { "&csup;", { 10960, 0 } },
-    { "&csupe;", { 10962, 0 } },
-    { "&ctdot;", { 8943, 0 } },
-    { "&cudarrl;", { 10552, 0 } },
-    { "&cudarrr;", { 10549, 0 } },
-    { "&cuepr;", { 8926, 0 } },
-    { "&cuesc;", { 8927, 0 } },
-    { "&cularr;", { 8630, 0 } },
-    { "&cularrp;", { 10557, 0 } },
-    { "&cup;", { 8746, 0 } },
-    { "&cupbrcap;", { 10824, 0 } },
-    { "&cupcap;", { 10822, 0 } },
-    { "&cupcup;", { 10826, 0 } },
-    { "&cupdot;", { 8845, 0 } },
-    { "&cupor;", { 10821, 0 } },
-    { "&cups;", { 8746, 65024 } },
-    { "&curarr;", { 8631, 0 } },
-    { "&curarrm;", { 10556, 0 } },
-    { "&curlyeqprec;", { 8926, 0 } },
-    { "&curlyeqsucc;", { 8927, 0 } },
-    { "&curlyvee;", { 8910, 0 } },
-    { "&curlywedge;", { 8911, 0 } },
-    { "&curren;", { 164, 0 } },
-    { "&curvearrowleft;", { 8630, 0 } },
-    { "&curvearrowright;", { 8631, 0 } },
-    { "&cuvee;", { 8910, 0 } },
-    { "&cuwed;", { 8911, 0 } },
-    { "&cwconint;", { 8754, 0 } },
-    { "&cwint;", { 8753, 0 } },
-    { "&cylcty;", { 9005, 0 } },
-    { "&dArr;", { 8659, 0 } },
-    { "&dHar;", { 10597, 0 } },
-    { "&dagger;", { 8224, 0 } },
-    { "&daleth;", { 8504, 0 } },
-    { "&darr;", { 8595, 0 } },
-    { "&dash;", { 8208, 0 } },
-    { "&dashv;", { 8867, 0 } },
-    { "&dbkarow;", { 10511, 0 } },
-    { "&dblac;", { 733, 0 } },
-    { "&dcaron;", { 271, 0 } },
-    { "&dcy;", { 1076, 0 } },
-    { "&dd;", { 8518, 0 } },
-    { "&ddagger;", { 8225, 0 } },
-    { "&ddarr;", { 8650, 0 } },
-    { "&ddotseq;", { 10871, 0 } },
-    { "&deg;", { 176, 0 } },
-    { "&delta;", { 948, 0 } },
-    { "&demptyv;", { 10673, 0 } },
-    { "&dfisht;", { 10623, 0 } },
-    { "&dfr;", { 120097, 0 } },
-    { "&dharl;", { 8643, 0 } },
-    { "&dharr;", { 8642, 0 } },
-    { "&diam;", { 8900, 0 } },
-    { "&diamond;", { 8900, 0 } },
-    { "&diamondsuit;", { 9830, 0 } },
-    { "&diams;", { 9830, 0 } },
-    { "&die;", { 168, 0 } },
-    { "&digamma;", { 989, 0 } },
-    { "&disin;", { 8946, 0 } },
-    { "&div;", { 247, 0 } },
-    { "&divide;", { 247, 0 } },
-    { "&divideontimes;", { 8903, 0 } },
-    { "&divonx;", { 8903, 0 } },
-    { "&djcy;", { 1106, 0 } },
-    { "&dlcorn;", { 8990, 0 } },
-    { "&dlcrop;", { 8973, 0 } },
-    { "&dollar;", { 36, 0 } },
-    { "&dopf;", { 120149, 0 } },
-    { "&dot;", { 729, 0 } },
-    { "&doteq;", { 8784, 0 } },
-    { "&doteqdot;", { 8785, 0 } },
-    { "&dotminus;", { 8760, 0 } },
-    { "&dotplus;", { 8724, 0 } },
-    { "&dotsquare;", { 8865, 0 } },
-    { "&doublebarwedge;", { 8966, 0 } },
-    { "&downarrow;", { 8595, 0 } },
-    { "&downdownarrows;", { 8650, 0 } },
-    { "&downharpoonleft;", { 8643, 0 } },
-    { "&downharpoonright;", { 8642, 0 } },
-    { "&drbkarow;", { 10512, 0 } },
-    { "&drcorn;", { 8991, 0 } },
-    { "&drcrop;", { 8972, 0 } },
-    { "&dscr;", { 119993, 0 } },
-    { "&dscy;", { 1109, 0 } },
-    { "&dsol;", { 10742, 0 } },
-    { "&dstrok;", { 273, 0 } },
-    { "&dtdot;", { 8945, 0 } },
-    { "&dtri;", { 9663, 0 } },
-    { "&dtrif;", { 9662, 0 } },
-    { "&duarr;", { 8693, 0 } },
-    { "&duhar;", { 10607, 0 } },
-    { "&dwangle;", { 10662, 0 } },
-    { "&dzcy;", { 1119, 0 } },
-    { "&dzigrarr;", { 10239, 0 } },
-    { "&eDDot;", { 10871, 0 } },
-    { "&eDot;", { 8785, 0 } },
-    { "&eacute;", { 233, 0 } },
-    { "&easter;", { 10862, 0 } },
-    { "&ecaron;", { 283, 0 } },
-    { "&ecir;", { 8790, 0 } },
-    { "&ecirc;", { 234, 0 } },
-    { "&ecolon;", { 8789, 0 } },
-    { "&ecy;", { 1101, 0 } },
-    { "&edot;", { 279, 0 } },
-    { "&ee;", { 8519, 0 } },
-    { "&efDot;", { 8786, 0 } },
-    { "&efr;", { 120098, 0 } },
-    { "&eg;", { 10906, 0 } },
-    { "&egrave;", { 232, 0 } },
-    { "&egs;", { 10902, 0 } },
-    { "&egsdot;", { 10904, 0 } },
-    { "&el;", { 10905, 0 } },
-    { "&elinters;", { 9191, 0 } },
-    { "&ell;", { 8467, 0 } },
-    { "&els;", { 10901, 0 } },
-    { "&elsdot;", { 10903, 0 } },
-    { "&emacr;", { 275, 0 } },
-    { "&empty;", { 8709, 0 } },
-    { "&emptyset;", { 8709, 0 } },
-    { "&emptyv;", { 8709, 0 } },
-    { "&emsp13;", { 8196, 0 } },
-    { "&emsp14;", { 8197, 0 } },
-    { "&emsp;", { 8195, 0 } },
-    { "&eng;", { 331, 0 } },
-    { "&ensp;", { 8194, 0 } },
-    { "&eogon;", { 281, 0 } },
-    { "&eopf;", { 120150, 0 } },
-    { "&epar;", { 8917, 0 } },
-    { "&eparsl;", { 10723, 0 } },
-    { "&eplus;", { 10865, 0 } },
-    { "&epsi;", { 949, 0 } },
-    { "&epsilon;", { 949, 0 } },
-    { "&epsiv;", { 1013, 0 } },
-    { "&eqcirc;", { 8790, 0 } },
-    { "&eqcolon;", { 8789, 0 } },
-    { "&eqsim;", { 8770, 0 } },
-    { "&eqslantgtr;", { 10902, 0 } },
-    { "&eqslantless;", { 10901, 0 } },
-    { "&equals;", { 61, 0 } },
-    { "&equest;", { 8799, 0 } },
-    { "&equiv;", { 8801, 0 } },
-    { "&equivDD;", { 10872, 0 } },
-    { "&eqvparsl;", { 10725, 0 } },
-    { "&erDot;", { 8787, 0 } },
-    { "&erarr;", { 10609, 0 } },
-    { "&escr;", { 8495, 0 } },
-    { "&esdot;", { 8784, 0 } },
-    { "&esim;", { 8770, 0 } },
-    { "&eta;", { 951, 0 } },
-    { "&eth;", { 240, 0 } },
-    { "&euml;", { 235, 0 } },
-    { "&euro;", { 8364, 0 } },
-    { "&excl;", { 33, 0 } },
-    { "&exist;", { 8707, 0 } },
-    { "&expectation;", { 8496, 0 } },
-    { "&exponentiale;", { 8519, 0 } },
-    { "&fallingdotseq;", { 8786, 0 } },
-    { "&fcy;", { 1092, 0 } },
-    { "&female;", { 9792, 0 } },
-    { "&ffilig;", { 64259, 0 } },
-    { "&fflig;", { 64256, 0 } },
-    { "&ffllig;", { 64260, 0 } },
-    { "&ffr;", { 120099, 0 } },
-    { "&filig;", { 64257, 0 } },
-    { "&fjlig;", { 102, 106 } },
-    { "&flat;", { 9837, 0 } },
-    { "&fllig;", { 64258, 0 } },
-    { "&fltns;", { 9649, 0 } },
-    { "&fnof;", { 402, 0 } },
-    { "&fopf;", { 120151, 0 } },
-    { "&forall;", { 8704, 0 } },
-    { "&fork;", { 8916, 0 } },
-    { "&forkv;", { 10969, 0 } },
-    { "&fpartint;", { 10765, 0 } },
-    { "&frac12", { 189, 0 } },
-    { "&frac12;", { 189, 0 } },
-    { "&frac13;", { 8531, 0 } },
-    { "&frac14", { 188, 0 } },
-    { "&frac14;", { 188, 0 } },
-    { "&frac15;", { 8533, 0 } },
-    { "&frac16;", { 8537, 0 } },
-    { "&frac18;", { 8539, 0 } },
-    { "&frac23;", { 8532, 0 } },
-    { "&frac25;", { 8534, 0 } },
-    { "&frac34", { 190, 0 } },
-    { "&frac34;", { 190, 0 } },
-    { "&frac35;", { 8535, 0 } },
-    { "&frac38;", { 8540, 0 } },
-    { "&frac45;", { 8536, 0 } },
-    { "&frac56;", { 8538, 0 } },
-    { "&frac58;", { 8541, 0 } },
-    { "&frac78;", { 8542, 0 } },
-    { "&frasl;", { 8260, 0 } },
-    { "&frown;", { 8994, 0 } },
-    { "&fscr;", { 119995, 0 } },
-    { "&gE;", { 8807, 0 } },
-    { "&gEl;", { 10892, 0 } },
-    { "&gacute;", { 501, 0 } },
-    { "&gamma;", { 947, 0 } },
-    { "&gammad;", { 989, 0 } },
-    { "&gap;", { 10886, 0 } },
-    { "&gbreve;", { 287, 0 } },
-    { "&gcirc;", { 285, 0 } },
-    { "&gcy;", { 1075, 0 } },
-    { "&gdot;", { 289, 0 } },
-    { "&ge;", { 8805, 0 } },
-    { "&gel;", { 8923, 0 } },
-    { "&geq;", { 8805, 0 } },
-    { "&geqq;", { 8807, 0 } },
-    { "&geqslant;", { 10878, 0 } },
-    { "&ges;", { 10878, 0 } },
-    { "&gescc;", { 10921, 0 } },
-    { "&gesdot;", { 10880, 0 } },
-    { "&gesdoto;", { 10882, 0 } },
-    { "&gesdotol;", { 10884, 0 } },
-    { "&gesl;", { 8923, 65024 } },
-    { "&gesles;", { 10900, 0 } },
-    { "&gfr;", { 120100, 0 } },
-    { "&gg;", { 8811, 0 } },
-    { "&ggg;", { 8921, 0 } },
-    { "&gimel;", { 8503, 0 } },
-    { "&gjcy;", { 1107, 0 } },
-    { "&gl;", { 8823, 0 } },
-    { "&glE;", { 10898, 0 } },
-    { "&gla;", { 10917, 0 } },
-    { "&glj;", { 10916, 0 } },
-    { "&gnE;", { 8809, 0 } },
-    { "&gnap;", { 10890, 0 } },
-    { "&gnapprox;", { 10890, 0 } },
-    { "&gne;", { 10888, 0 } },
-    { "&gneq;", { 10888, 0 } },
-    { "&gneqq;", { 8809, 0 } },
-    { "&gnsim;", { 8935, 0 } },
-    { "&gopf;", { 120152, 0 } },
-    { "&grave;", { 96, 0 } },
-    { "&gscr;", { 8458, 0 } },
-    { "&gsim;", { 8819, 0 } },
-    { "&gsime;", { 10894, 0 } },
-    { "&gsiml;", { 10896, 0 } },
-    { "&gt;", { 62, 0 } },
-    { "&gtcc;", { 10919, 0 } },
-    { "&gtcir;", { 10874, 0 } },
-    { "&gtdot;", { 8919, 0 } },
-    { "&gtlPar;", { 10645, 0 } },
-    { "&gtquest;", { 10876, 0 } },
-    { "&gtrapprox;", { 10886, 0 } },
-    { "&gtrarr;", { 10616, 0 } },
-    { "&gtrdot;", { 8919, 0 } },
-    { "&gtreqless;", { 8923, 0 } },
-    { "&gtreqqless;", { 10892, 0 } },
-    { "&gtrless;", { 8823, 0 } },
-    { "&gtrsim;", { 8819, 0 } },
-    { "&gvertneqq;", { 8809, 65024 } },
-    { "&gvnE;", { 8809, 65024 } },
-    { "&hArr;", { 8660, 0 } },
-    { "&hairsp;", { 8202, 0 } },
-    { "&half;", { 189, 0 } },
-    { "&hamilt;", { 8459, 0 } },
-    { "&hardcy;", { 1098, 0 } },
-    { "&harr;", { 8596, 0 } },
-    { "&harrcir;", { 10568, 0 } },
-    { "&harrw;", { 8621, 0 } },
-    { "&hbar;", { 8463, 0 } },
-    { "&hcirc;", { 293, 0 } },
-    { "&hearts;", { 9829, 0 } },
-    { "&heartsuit;", { 9829, 0 } },
-    { "&hellip;", { 8230, 0 } },
-    { "&hercon;", { 8889, 0 } },
-    { "&hfr;", { 120101, 0 } },
-    { "&hksearow;", { 10533, 0 } },
-    { "&hkswarow;", { 10534, 0 } },
-    { "&hoarr;", { 8703, 0 } },
-    { "&homtht;", { 8763, 0 } },
-    { "&hookleftarrow;", { 8617, 0 } },
-    { "&hookrightarrow;", { 8618, 0 } },
-    { "&hopf;", { 120153, 0 } },
-    { "&horbar;", { 8213, 0 } },
-    { "&hscr;", { 119997, 0 } },
-    { "&hslash;", { 8463, 0 } },
-    { "&hstrok;", { 295, 0 } },
-    { "&hybull;", { 8259, 0 } },
-    { "&hyphen;", { 8208, 0 } },
-    { "&iacute;", { 237, 0 } },
-    { "&ic;", { 8291, 0 } },
-    { "&icirc;", { 238, 0 } },
-    { "&icy;", { 1080, 0 } },
-    { "&iecy;", { 1077, 0 } },
-    { "&iexcl;", { 161, 0 } },
-    { "&iff;", { 8660, 0 } },
-    { "&ifr;", { 120102, 0 } },
-    { "&igrave;", { 236, 0 } },
-    { "&ii;", { 8520, 0 } },
-    { "&iiiint;", { 10764, 0 } },
-    { "&iiint;", { 8749, 0 } },
-    { "&iinfin;", { 10716, 0 } },
-    { "&iiota;", { 8489, 0 } },
-    { "&ijlig;", { 307, 0 } },
-    { "&imacr;", { 299, 0 } },
-    { "&image;", { 8465, 0 } },
-    { "&imagline;", { 8464, 0 } },
-    { "&imagpart;", { 8465, 0 } },
-    { "&imath;", { 305, 0 } },
-    { "&imof;", { 8887, 0 } },
-    { "&imped;", { 437, 0 } },
-    { "&in;", { 8712, 0 } },
-    { "&incare;", { 8453, 0 } },
-    { "&infin;", { 8734, 0 } },
-    { "&infintie;", { 10717, 0 } },
-    { "&inodot;", { 305, 0 } },
-    { "&int;", { 8747, 0 } },
-    { "&intcal;", { 8890, 0 } },
-    { "&integers;", { 8484, 0 } },
-    { "&intercal;", { 8890, 0 } },
-    { "&intlarhk;", { 10775, 0 } },
-    { "&intprod;", { 10812, 0 } },
-    { "&iocy;", { 1105, 0 } },
-    { "&iogon;", { 303, 0 } },
-    { "&iopf;", { 120154, 0 } },
-    { "&iota;", { 953, 0 } },
-    { "&iprod;", { 10812, 0 } },
-    { "&iquest;", { 191, 0 } },
-    { "&iscr;", { 119998, 0 } },
-    { "&isin;", { 8712, 0 } },
-    { "&isinE;", { 8953, 0 } },
-    { "&isindot;", { 8949, 0 } },
-    { "&isins;", { 8948, 0 } },
-    { "&isinsv;", { 8947, 0 } },
-    { "&isinv;", { 8712, 0 } },
-    { "&it;", { 8290, 0 } },
-    { "&itilde;", { 297, 0 } },
-    { "&iukcy;", { 1110, 0 } },
-    { "&iuml;", { 239, 0 } },
-    { "&jcirc;", { 309, 0 } },
-    { "&jcy;", { 1081, 0 } },
-    { "&jfr;", { 120103, 0 } },
-    { "&jmath;", { 567, 0 } },
-    { "&jopf;", { 120155, 0 } },
-    { "&jscr;", { 119999, 0 } },
-    { "&jsercy;", { 1112, 0 } },
-    { "&jukcy;", { 1108, 0 } },
-    { "&kappa;", { 954, 0 } },
-    { "&kappav;", { 1008, 0 } },
-    { "&kcedil;", { 311, 0 } },
-    { "&kcy;", { 1082, 0 } },
-    { "&kfr;", { 120104, 0 } },
-    { "&kgreen;", { 312, 0 } },
-    { "&khcy;", { 1093, 0 } },
-    { "&kjcy;", { 1116, 0 } },
-    { "&kopf;", { 120156, 0 } },
-    { "&kscr;", { 120000, 0 } },
-    { "&lAarr;", { 8666, 0 } },
-    { "&lArr;", { 8656, 0 } },
-    { "&lAtail;", { 10523, 0 } },
-    { "&lBarr;", { 10510, 0 } },
-    { "&lE;", { 8806, 0 } },
-    { "&lEg;", { 10891, 0 } },
-    { "&lHar;", { 10594, 0 } },
-    { "&lacute;", { 314, 0 } },
-    { "&laemptyv;", { 10676, 0 } },
-    { "&lagran;", { 8466, 0 } },
-    { "&lambda;", { 955, 0 } },
-    { "&lang;", { 10216, 0 } },
-    { "&langd;", { 10641, 0 } },
-    { "&langle;", { 10216, 0 } },
-    { "&lap;", { 10885, 0 } },
-    { "&laquo;", { 171, 0 } },
-    { "&larr;", { 8592, 0 } },
-    { "&larrb;", { 8676, 0 } },
-    { "&larrbfs;", { 10527, 0 } },
-    { "&larrfs;", { 10525, 0 } },
-    { "&larrhk;", { 8617, 0 } },
-    { "&larrlp;", { 8619, 0 } },
-    { "&larrpl;", { 10553, 0 } },
-    { "&larrsim;", { 10611, 0 } },
-    { "&larrtl;", { 8610, 0 } },
-    { "&lat;", { 10923, 0 } },
-    { "&latail;", { 10521, 0 } },
-    { "&late;", { 10925, 0 } },
-    { "&lates;", { 10925, 65024 } },
-    { "&lbarr;", { 10508, 0 } },
-    { "&lbbrk;", { 10098, 0 } },
-    { "&lbrace;", { 123, 0 } },
-    { "&lbrack;", { 91, 0 } },
-    { "&lbrke;", { 10635, 0 } },
-    { "&lbrksld;", { 10639, 0 } },
-    { "&lbrkslu;", { 10637, 0 } },
-    { "&lcaron;", { 318, 0 } },
-    { "&lcedil;", { 316, 0 } },
-    { "&lceil;", { 8968, 0 } },
-    { "&lcub;", { 123, 0 } },
-    { "&lcy;", { 1083, 0 } },
-    { "&ldca;", { 10550, 0 } },
-    { "&ldquo;", { 8220, 0 } },
-    { "&ldquor;", { 8222, 0 } },
-    { "&ldrdhar;", { 10599, 0 } },
-    { "&ldrushar;", { 10571, 0 } },
-    { "&ldsh;", { 8626, 0 } },
-    { "&le;", { 8804, 0 } },
-    { "&leftarrow;", { 8592, 0 } },
-    { "&leftarrowtail;", { 8610, 0 } },
-    { "&leftharpoondown;", { 8637, 0 } },
-    { "&leftharpoonup;", { 8636, 0 } },
-    { "&leftleftarrows;", { 8647, 0 } },
-    { "&leftrightarrow;", { 8596, 0 } },
-    { "&leftrightarrows;", { 8646, 0 } },
-    { "&leftrightharpoons;", { 8651, 0 } },
-    { "&leftrightsquigarrow;", { 8621, 0 } },
-    { "&leftthreetimes;", { 8907, 0 } },
-    { "&leg;", { 8922, 0 } },
-    { "&leq;", { 8804, 0 } },
-    { "&leqq;", { 8806, 0 } },
-    { "&leqslant;", { 10877, 0 } },
-    { "&les;", { 10877, 0 } },
-    { "&lescc;", { 10920, 0 } },
-    { "&lesdot;", { 10879, 0 } },
-    { "&lesdoto;", { 10881, 0 } },
-    { "&lesdotor;", { 10883, 0 } },
-    { "&lesg;", { 8922, 65024 } },
-    { "&lesges;", { 10899, 0 } },
-    { "&lessapprox;", { 10885, 0 } },
-    { "&lessdot;", { 8918, 0 } },
-    { "&lesseqgtr;", { 8922, 0 } },
-    { "&lesseqqgtr;", { 10891, 0 } },
-    { "&lessgtr;", { 8822, 0 } },
-    { "&lesssim;", { 8818, 0 } },
-    { "&lfisht;", { 10620, 0 } },
-    { "&lfloor;", { 8970, 0 } },
-    { "&lfr;", { 120105, 0 } },
-    { "&lg;", { 8822, 0 } },
-    { "&lgE;", { 10897, 0 } },
-    { "&lhard;", { 8637, 0 } },
-    { "&lharu;", { 8636, 0 } },
-    { "&lharul;", { 10602, 0 } },
-    { "&lhblk;", { 9604, 0 } },
-    { "&ljcy;", { 1113, 0 } },
-    { "&ll;", { 8810, 0 } },
-    { "&llarr;", { 8647, 0 } },
-    { "&llcorner;", { 8990, 0 } },
-    { "&llhard;", { 10603, 0 } },
-    { "&lltri;", { 9722, 0 } },
-    { "&lmidot;", { 320, 0 } },
-    { "&lmoust;", { 9136, 0 } },
-    { "&lmoustache;", { 9136, 0 } },
-    { "&lnE;", { 8808, 0 } },
-    { "&lnap;", { 10889, 0 } },
-    { "&lnapprox;", { 10889, 0 } },
-    { "&lne;", { 10887, 0 } },
-    { "&lneq;", { 10887, 0 } },
-    { "&lneqq;", { 8808, 0 } },
-    { "&lnsim;", { 8934, 0 } },
-    { "&loang;", { 10220, 0 } },
-    { "&loarr;", { 8701, 0 } },
-    { "&lobrk;", { 10214, 0 } },
-    { "&longleftarrow;", { 10229, 0 } },
-    { "&longleftrightarrow;", { 10231, 0 } },
-    { "&longmapsto;", { 10236, 0 } },
-    { "&longrightarrow;", { 10230, 0 } },
-    { "&looparrowleft;", { 8619, 0 } },
-    { "&looparrowright;", { 8620, 0 } },
-    { "&lopar;", { 10629, 0 } },
-    { "&lopf;", { 120157, 0 } },
-    { "&loplus;", { 10797, 0 } },
-    { "&lotimes;", { 10804, 0 } },
-    { "&lowast;", { 8727, 0 } },
-    { "&lowbar;", { 95, 0 } },
-    { "&loz;", { 9674, 0 } },
-    { "&lozenge;", { 9674, 0 } },
-    { "&lozf;", { 10731, 0 } },
-    { "&lpar;", { 40, 0 } },
-    { "&lparlt;", { 10643, 0 } },
-    { "&lrarr;", { 8646, 0 } },
-    { "&lrcorner;", { 8991, 0 } },
-    { "&lrhar;", { 8651, 0 } },
-    { "&lrhard;", { 10605, 0 } },
-    { "&lrm;", { 8206, 0 } },
-    { "&lrtri;", { 8895, 0 } },
-    { "&lsaquo;", { 8249, 0 } },
-    { "&lscr;", { 120001, 0 } },
-    { "&lsh;", { 8624, 0 } },
-    { "&lsim;", { 8818, 0 } },
-    { "&lsime;", { 10893, 0 } },
-    { "&lsimg;", { 10895, 0 } },
-    { "&lsqb;", { 91, 0 } },
-    { "&lsquo;", { 8216, 0 } },
-    { "&lsquor;", { 8218, 0 } },
-    { "&lstrok;", { 322, 0 } },
-    { "&lt;", { 60, 0 } },
-    { "&ltcc;", { 10918, 0 } },
-    { "&ltcir;", { 10873, 0 } },
-    { "&ltdot;", { 8918, 0 } },
-    { "&lthree;", { 8907, 0 } },
-    { "&ltimes;", { 8905, 0 } },
-    { "&ltlarr;", { 10614, 0 } },
-    { "&ltquest;", { 10875, 0 } },
-    { "&ltrPar;", { 10646, 0 } },
-    { "&ltri;", { 9667, 0 } },
-    { "&ltrie;", { 8884, 0 } },
-    { "&ltrif;", { 9666, 0 } },
-    { "&lurdshar;", { 10570, 0 } },
-    { "&luruhar;", { 10598, 0 } },
-    { "&lvertneqq;", { 8808, 65024 } },
-    { "&lvnE;", { 8808, 65024 } },
-    { "&mDDot;", { 8762, 0 } },
-    { "&macr;", { 175, 0 } },
-    { "&male;", { 9794, 0 } },
-    { "&malt;", { 10016, 0 } },
-    { "&maltese;", { 10016, 0 } },
-    { "&map;", { 8614, 0 } },
-    { "&mapsto;", { 8614, 0 } },
-    { "&mapstodown;", { 8615, 0 } },
-    { "&mapstoleft;", { 8612, 0 } },
-    { "&mapstoup;", { 8613, 0 } },
-    { "&marker;", { 9646, 0 } },
-    { "&mcomma;", { 10793, 0 } },
-    { "&mcy;", { 1084, 0 } },
-    { "&mdash;", { 8212, 0 } },
-    { "&measuredangle;", { 8737, 0 } },
-    { "&mfr;", { 120106, 0 } },
-    { "&mho;", { 8487, 0 } },
-    { "&micro;", { 181, 0 } },
-    { "&mid;", { 8739, 0 } },
-    { "&midast;", { 42, 0 } },
-    { "&midcir;", { 10992, 0 } },
-    { "&middot;", { 183, 0 } },
-    { "&minus;", { 8722, 0 } },
-    { "&minusb;", { 8863, 0 } },
-    { "&minusd;", { 8760, 0 } },
-    { "&minusdu;", { 10794, 0 } },
-    { "&mlcp;", { 10971, 0 } },
-    { "&mldr;", { 8230, 0 } },
-    { "&mnplus;", { 8723, 0 } },
-    { "&models;", { 8871, 0 } },
-    { "&mopf;", { 120158, 0 } },
-    { "&mp;", { 8723, 0 } },
-    { "&mscr;", { 120002, 0 } },
-    { "&mstpos;", { 8766, 0 } },
-    { "&mu;", { 956, 0 } },
-    { "&multimap;", { 8888, 0 } },
-    { "&mumap;", { 8888, 0 } },
-    { "&nGg;", { 8921, 824 } },
-    { "&nGt;", { 8811, 8402 } },
-    { "&nGtv;", { 8811, 824 } },
-    { "&nLeftarrow;", { 8653, 0 } },
-    { "&nLeftrightarrow;", { 8654, 0 } },
-    { "&nLl;", { 8920, 824 } },
-    { "&nLt;", { 8810, 8402 } },
-    { "&nLtv;", { 8810, 824 } },
-    { "&nRightarrow;", { 8655, 0 } },
-    { "&nVDash;", { 8879, 0 } },
-    { "&nVdash;", { 8878, 0 } },
-    { "&nabla;", { 8711, 0 } },
-    { "&nacute;", { 324, 0 } },
-    { "&nang;", { 8736, 8402 } },
-    { "&nap;", { 8777, 0 } },
-    { "&napE;", { 10864, 824 } },
-    { "&napid;", { 8779, 824 } },
-    { "&napos;", { 329, 0 } },
-    { "&napprox;", { 8777, 0 } },
-    { "&natur;", { 9838, 0 } },
-    { "&natural;", { 9838, 0 } },
-    { "&naturals;", { 8469, 0 } },
-    { "&nbsp;", { 160, 0 } },
-    { "&nbump;", { 8782, 824 } },
-    { "&nbumpe;", { 8783, 824 } },
-    { "&ncap;", { 10819, 0 } },
-    { "&ncaron;", { 328, 0 } },
-    { "&ncedil;", { 326, 0 } },
-    { "&ncong;", { 8775, 0 } },
-    { "&ncongdot;", { 10861, 824 } },
-    { "&ncup;", { 10818, 0 } },
-    { "&ncy;", { 1085, 0 } },
-    { "&ndash;", { 8211, 0 } },
-    { "&ne;", { 8800, 0 } },
-    { "&neArr;", { 8663, 0 } },
-    { "&nearhk;", { 10532, 0 } },
-    { "&nearr;", { 8599, 0 } },
-    { "&nearrow;", { 8599, 0 } },
-    { "&nedot;", { 8784, 824 } },
-    { "&nequiv;", { 8802, 0 } },
-    { "&nesear;", { 10536, 0 } },
-    { "&nesim;", { 8770, 824 } },
-    { "&nexist;", { 8708, 0 } },
-    { "&nexists;", { 8708, 0 } },
-    { "&nfr;", { 120107, 0 } },
-    { "&ngE;", { 8807, 824 } },
-    { "&nge;", { 8817, 0 } },
-    { "&ngeq;", { 8817, 0 } },
-    { "&ngeqq;", { 8807, 824 } },
-    { "&ngeqslant;", { 10878, 824 } },
-    { "&nges;", { 10878, 824 } },
-    { "&ngsim;", { 8821, 0 } },
-    { "&ngt;", { 8815, 0 } },
-    { "&ngtr;", { 8815, 0 } },
-    { "&nhArr;", { 8654, 0 } },
-    { "&nharr;", { 8622, 0 } },
-    { "&nhpar;", { 10994, 0 } },
-    { "&ni;", { 8715, 0 } },
-    { "&nis;", { 8956, 0 } },
-    { "&nisd;", { 8954, 0 } },
-    { "&niv;", { 8715, 0 } },
-    { "&njcy;", { 1114, 0 } },
-    { "&nlArr;", { 8653, 0 } },
-    { "&nlE;", { 8806, 824 } },
-    { "&nlarr;", { 8602, 0 } },
-    { "&nldr;", { 8229, 0 } },
-    { "&nle;", { 8816, 0 } },
-    { "&nleftarrow;", { 8602, 0 } },
-    { "&nleftrightarrow;", { 8622, 0 } },
-    { "&nleq;", { 8816, 0 } },
-    { "&nleqq;", { 8806, 824 } },
-    { "&nleqslant;", { 10877, 824 } },
-    { "&nles;", { 10877, 824 } },
-    { "&nless;", { 8814, 0 } },
-    { "&nlsim;", { 8820, 0 } },
-    { "&nlt;", { 8814, 0 } },
-    { "&nltri;", { 8938, 0 } },
-    { "&nltrie;", { 8940, 0 } },
-    { "&nmid;", { 8740, 0 } },
-    { "&nopf;", { 120159, 0 } },
-    { "&not;", { 172, 0 } },
-    { "&notin;", { 8713, 0 } },
-    { "&notinE;", { 8953, 824 } },
-    { "&notindot;", { 8949, 824 } },
-    { "&notinva;", { 8713, 0 } },
-    { "&notinvb;", { 8951, 0 } },
-    { "&notinvc;", { 8950, 0 } },
-    { "&notni;", { 8716, 0 } },
-    { "&notniva;", { 8716, 0 } },
-    { "&notnivb;", { 8958, 0 } },
-    { "&notnivc;", { 8957, 0 } },
-    { "&npar;", { 8742, 0 } },
-    { "&nparallel;", { 8742, 0 } },
-    { "&nparsl;", { 11005, 8421 } },
-    { "&npart;", { 8706, 824 } },
-    { "&npolint;", { 10772, 0 } },
-    { "&npr;", { 8832, 0 } },
-    { "&nprcue;", { 8928, 0 } },
-    { "&npre;", { 10927, 824 } },
-    { "&nprec;", { 8832, 0 } },
-    { "&npreceq;", { 10927, 824 } },
-    { "&nrArr;", { 8655, 0 } },
-    { "&nrarr;", { 8603, 0 } },
-    { "&nrarrc;", { 10547, 824 } },
-    { "&nrarrw;", { 8605, 824 } },
-    { "&nrightarrow;", { 8603, 0 } },
-    { "&nrtri;", { 8939, 0 } },
-    { "&nrtrie;", { 8941, 0 } },
-    { "&nsc;", { 8833, 0 } },
-    { "&nsccue;", { 8929, 0 } },
-    { "&nsce;", { 10928, 824 } },
-    { "&nscr;", { 120003, 0 } },
-    { "&nshortmid;", { 8740, 0 } },
-    { "&nshortparallel;", { 8742, 0 } },
-    { "&nsim;", { 8769, 0 } },
-    { "&nsime;", { 8772, 0 } },
-    { "&nsimeq;", { 8772, 0 } },
-    { "&nsmid;", { 8740, 0 } },
-    { "&nspar;", { 8742, 0 } },
-    { "&nsqsube;", { 8930, 0 } },
-    { "&nsqsupe;", { 8931, 0 } },
-    { "&nsub;", { 8836, 0 } },
-    { "&nsubE;", { 10949, 824 } },
-    { "&nsube;", { 8840, 0 } },
-    { "&nsubset;", { 8834, 8402 } },
-    { "&nsubseteq;", { 8840, 0 } },
-    { "&nsubseteqq;", { 10949, 824 } },
-    { "&nsucc;", { 8833, 0 } },
-    { "&nsucceq;", { 10928, 824 } },
-    { "&nsup;", { 8837, 0 } },
-    { "&nsupE;", { 10950, 824 } },
-    { "&nsupe;", { 8841, 0 } },
-    { "&nsupset;", { 8835, 8402 } },
-    { "&nsupseteq;", { 8841, 0 } },
-    { "&nsupseteqq;", { 10950, 824 } },
-    { "&ntgl;", { 8825, 0 } },
-    { "&ntilde;", { 241, 0 } },
-    { "&ntlg;", { 8824, 0 } },
-    { "&ntriangleleft;", { 8938, 0 } },
-    { "&ntrianglelefteq;", { 8940, 0 } },
-    { "&ntriangleright;", { 8939, 0 } },
-    { "&ntrianglerighteq;", { 8941, 0 } },
-    { "&nu;", { 957, 0 } },
-    { "&num;", { 35, 0 } },
-    { "&numero;", { 8470, 0 } },
-    { "&numsp;", { 8199, 0 } },
-    { "&nvDash;", { 8877, 0 } },
-    { "&nvHarr;", { 10500, 0 } },
-    { "&nvap;", { 8781, 8402 } },
-    { "&nvdash;", { 8876, 0 } },
-    { "&nvge;", { 8805, 8402 } },
-    { "&nvgt;", { 62, 8402 } },
-    { "&nvinfin;", { 10718, 0 } },
-    { "&nvlArr;", { 10498, 0 } },
-    { "&nvle;", { 8804, 8402 } },
-    { "&nvlt;", { 60, 8402 } },
-    { "&nvltrie;", { 8884, 8402 } },
-    { "&nvrArr;", { 10499, 0 } },
-    { "&nvrtrie;", { 8885, 8402 } },
-    { "&nvsim;", { 8764, 8402 } },
-    { "&nwArr;", { 8662, 0 } },
-    { "&nwarhk;", { 10531, 0 } },
-    { "&nwarr;", { 8598, 0 } },
-    { "&nwarrow;", { 8598, 0 } },
-    { "&nwnear;", { 10535, 0 } },
-    { "&oS;", { 9416, 0 } },
-    { "&oacute;", { 243, 0 } },
-    { "&oast;", { 8859, 0 } },
-    { "&ocir;", { 8858, 0 } },
-    { "&ocirc;", { 244, 0 } },
-    { "&ocy;", { 1086, 0 } },
-    { "&odash;", { 8861, 0 } },
-    { "&odblac;", { 337, 0 } },
-    { "&odiv;", { 10808, 0 } },
-    { "&odot;", { 8857, 0 } },
-    { "&odsold;", { 10684, 0 } },
-    { "&oelig;", { 339, 0 } },
-    { "&ofcir;", { 10687, 0 } },
-    { "&ofr;", { 120108, 0 } },
-    { "&ogon;", { 731, 0 } },
-    { "&ograve;", { 242, 0 } },
-    { "&ogt;", { 10689, 0 } },
-    { "&ohbar;", { 10677, 0 } },
-    { "&ohm;", { 937, 0 } },
-    { "&oint;", { 8750, 0 } },
-    { "&olarr;", { 8634, 0 } },
-    { "&olcir;", { 10686, 0 } },
-    { "&olcross;", { 10683, 0 } },
-    { "&oline;", { 8254, 0 } },
-    { "&olt;", { 10688, 0 } },
-    { "&omacr;", { 333, 0 } },
-    { "&omega;", { 969, 0 } },
-    { "&omicron;", { 959, 0 } },
-    { "&omid;", { 10678, 0 } },
-    { "&ominus;", { 8854, 0 } },
-    { "&oopf;", { 120160, 0 } },
-    { "&opar;", { 10679, 0 } },
-    { "&operp;", { 10681, 0 } },
-    { "&oplus;", { 8853, 0 } },
-    { "&or;", { 8744, 0 } },
-    { "&orarr;", { 8635, 0 } },
-    { "&ord;", { 10845, 0 } },
-    { "&order;", { 8500, 0 } },
-    { "&orderof;", { 8500, 0 } },
-    { "&ordf;", { 170, 0 } },
-    { "&ordm;", { 186, 0 } },
-    { "&origof;", { 8886, 0 } },
-    { "&oror;", { 10838, 0 } },
-    { "&orslope;", { 10839, 0 } },
-    { "&orv;", { 10843, 0 } },
-    { "&oscr;", { 8500, 0 } },
-    { "&oslash;", { 248, 0 } },
-    { "&osol;", { 8856, 0 } },
-    { "&otilde;", { 245, 0 } },
-    { "&otimes;", { 8855, 0 } },
-    { "&otimesas;", { 10806, 0 } },
-    { "&ouml;", { 246, 0 } },
-    { "&ovbar;", { 9021, 0 } },
-    { "&par;", { 8741, 0 } },
-    { "&para;", { 182, 0 } },
-    { "&parallel;", { 8741, 0 } },
-    { "&parsim;", { 10995, 0 } },
-    { "&parsl;", { 11005, 0 } },
-    { "&part;", { 8706, 0 } },
-    { "&pcy;", { 1087, 0 } },
-    { "&percnt;", { 37, 0 } },
-    { "&period;", { 46, 0 } },
-    { "&permil;", { 8240, 0 } },
-    { "&perp;", { 8869, 0 } },
-    { "&pertenk;", { 8241, 0 } },
-    { "&pfr;", { 120109, 0 } },
-    { "&phi;", { 966, 0 } },
-    { "&phiv;", { 981, 0 } },
-    { "&phmmat;", { 8499, 0 } },
-    { "&phone;", { 9742, 0 } },
-    { "&pi;", { 960, 0 } },
-    { "&pitchfork;", { 8916, 0 } },
-    { "&piv;", { 982, 0 } },
-    { "&planck;", { 8463, 0 } },
-    { "&planckh;", { 8462, 0 } },
-    { "&plankv;", { 8463, 0 } },
-    { "&plus;", { 43, 0 } },
-    { "&plusacir;", { 10787, 0 } },
-    { "&plusb;", { 8862, 0 } },
-    { "&pluscir;", { 10786, 0 } },
-    { "&plusdo;", { 8724, 0 } },
-    { "&plusdu;", { 10789, 0 } },
-    { "&pluse;", { 10866, 0 } },
-    { "&plusmn;", { 177, 0 } },
-    { "&plussim;", { 10790, 0 } },
-    { "&plustwo;", { 10791, 0 } },
-    { "&pm;", { 177, 0 } },
-    { "&pointint;", { 10773, 0 } },
-    { "&popf;", { 120161, 0 } },
-    { "&pound;", { 163, 0 } },
-    { "&pr;", { 8826, 0 } },
-    { "&prE;", { 10931, 0 } },
-    { "&prap;", { 10935, 0 } },
-    { "&prcue;", { 8828, 0 } },
-    { "&pre;", { 10927, 0 } },
-    { "&prec;", { 8826, 0 } },
-    { "&precapprox;", { 10935, 0 } },
-    { "&preccurlyeq;", { 8828, 0 } },
-    { "&preceq;", { 10927, 0 } },
-    { "&precnapprox;", { 10937, 0 } },
-    { "&precneqq;", { 10933, 0 } },
-    { "&precnsim;", { 8936, 0 } },
-    { "&precsim;", { 8830, 0 } },
-    { "&prime;", { 8242, 0 } },
-    { "&primes;", { 8473, 0 } },
-    { "&prnE;", { 10933, 0 } },
-    { "&prnap;", { 10937, 0 } },
-    { "&prnsim;", { 8936, 0 } },
-    { "&prod;", { 8719, 0 } },
-    { "&profalar;", { 9006, 0 } },
-    { "&profline;", { 8978, 0 } },
-    { "&profsurf;", { 8979, 0 } },
-    { "&prop;", { 8733, 0 } },
-    { "&propto;", { 8733, 0 } },
-    { "&prsim;", { 8830, 0 } },
-    { "&prurel;", { 8880, 0 } },
-    { "&pscr;", { 120005, 0 } },
-    { "&psi;", { 968, 0 } },
-    { "&puncsp;", { 8200, 0 } },
-    { "&qfr;", { 120110, 0 } },
-    { "&qint;", { 10764, 0 } },
-    { "&qopf;", { 120162, 0 } },
-    { "&qprime;", { 8279, 0 } },
-    { "&qscr;", { 120006, 0 } },
-    { "&quaternions;", { 8461, 0 } },
-    { "&quatint;", { 10774, 0 } },
-    { "&quest;", { 63, 0 } },
-    { "&questeq;", { 8799, 0 } },
-    { "&quot;", { 34, 0 } },
-    { "&rAarr;", { 8667, 0 } },
-    { "&rArr;", { 8658, 0 } },
-    { "&rAtail;", { 10524, 0 } },
-    { "&rBarr;", { 10511, 0 } },
-    { "&rHar;", { 10596, 0 } },
-    { "&race;", { 8765, 817 } },
-    { "&racute;", { 341, 0 } },
-    { "&radic;", { 8730, 0 } },
-    { "&raemptyv;", { 10675, 0 } },
-    { "&rang;", { 10217, 0 } },
-    { "&rangd;", { 10642, 0 } },
-    { "&range;", { 10661, 0 } },
-    { "&rangle;", { 10217, 0 } },
-    { "&raquo;", { 187, 0 } },
-    { "&rarr;", { 8594, 0 } },
-    { "&rarrap;", { 10613, 0 } },
-    { "&rarrb;", { 8677, 0 } },
-    { "&rarrbfs;", { 10528, 0 } },
-    { "&rarrc;", { 10547, 0 } },
-    { "&rarrfs;", { 10526, 0 } },
-    { "&rarrhk;", { 8618, 0 } },
-    { "&rarrlp;", { 8620, 0 } },
-    { "&rarrpl;", { 10565, 0 } },
-    { "&rarrsim;", { 10612, 0 } },
-    { "&rarrtl;", { 8611, 0 } },
-    { "&rarrw;", { 8605, 0 } },
-    { "&ratail;", { 10522, 0 } },
-    { "&ratio;", { 8758, 0 } },
-    { "&rationals;", { 8474, 0 } },
-    { "&rbarr;", { 10509, 0 } },
-    { "&rbbrk;", { 10099, 0 } },
-    { "&rbrace;", { 125, 0 } },
-    { "&rbrack;", { 93, 0 } },
-    { "&rbrke;", { 10636, 0 } },
-    { "&rbrksld;", { 10638, 0 } },
-    { "&rbrkslu;", { 10640, 0 } },
-    { "&rcaron;", { 345, 0 } },
-    { "&rcedil;", { 343, 0 } },
-    { "&rceil;", { 8969, 0 } },
-    { "&rcub;", { 125, 0 } },
-    { "&rcy;", { 1088, 0 } },
-    { "&rdca;", { 10551, 0 } },
-    { "&rdldhar;", { 10601, 0 } },
-    { "&rdquo;", { 8221, 0 } },
-    { "&rdquor;", { 8221, 0 } },
-    { "&rdsh;", { 8627, 0 } },
-    { "&real;", { 8476, 0 } },
-    { "&realine;", { 8475, 0 } },
-    { "&realpart;", { 8476, 0 } },
-    { "&reals;", { 8477, 0 } },
-    { "&rect;", { 9645, 0 } },
-    { "&reg;", { 174, 0 } },
-    { "&rfisht;", { 10621, 0 } },
-    { "&rfloor;", { 8971, 0 } },
-    { "&rfr;", { 120111, 0 } },
-    { "&rhard;", { 8641, 0 } },
-    { "&rharu;", { 8640, 0 } },
-    { "&rharul;", { 10604, 0 } },
-    { "&rho;", { 961, 0 } },
-    { "&rhov;", { 1009, 0 } },
-    { "&rightarrow;", { 8594, 0 } },
-    { "&rightarrowtail;", { 8611, 0 } },
-    { "&rightharpoondown;", { 8641, 0 } },
-    { "&rightharpoonup;", { 8640, 0 } },
-    { "&rightleftarrows;", { 8644, 0 } },
-    { "&rightleftharpoons;", { 8652, 0 } },
-    { "&rightrightarrows;", { 8649, 0 } },
-    { "&rightsquigarrow;", { 8605, 0 } },
-    { "&rightthreetimes;", { 8908, 0 } },
-    { "&ring;", { 730, 0 } },
-    { "&risingdotseq;", { 8787, 0 } },
-    { "&rlarr;", { 8644, 0 } },
-    { "&rlhar;", { 8652, 0 } },
-    { "&rlm;", { 8207, 0 } },
-    { "&rmoust;", { 9137, 0 } },
-    { "&rmoustache;", { 9137, 0 } },
-    { "&rnmid;", { 10990, 0 } },
-    { "&roang;", { 10221, 0 } },
-    { "&roarr;", { 8702, 0 } },
-    { "&robrk;", { 10215, 0 } },
-    { "&ropar;", { 10630, 0 } },
-    { "&ropf;", { 120163, 0 } },
-    { "&roplus;", { 10798, 0 } },
-    { "&rotimes;", { 10805, 0 } },
-    { "&rpar;", { 41, 0 } },
-    { "&rpargt;", { 10644, 0 } },
-    { "&rppolint;", { 10770, 0 } },
-    { "&rrarr;", { 8649, 0 } },
-    { "&rsaquo;", { 8250, 0 } },
-    { "&rscr;", { 120007, 0 } },
-    { "&rsh;", { 8625, 0 } },
-    { "&rsqb;", { 93, 0 } },
-    { "&rsquo;", { 8217, 0 } },
-    { "&rsquor;", { 8217, 0 } },
-    { "&rthree;", { 8908, 0 } },
-    { "&rtimes;", { 8906, 0 } },
-    { "&rtri;", { 9657, 0 } },
-    { "&rtrie;", { 8885, 0 } },
-    { "&rtrif;", { 9656, 0 } },
-    { "&rtriltri;", { 10702, 0 } },
-    { "&ruluhar;", { 10600, 0 } },
-    { "&rx;", { 8478, 0 } },
-    { "&sacute;", { 347, 0 } },
-    { "&sbquo;", { 8218, 0 } },
-    { "&sc;", { 8827, 0 } },
-    { "&scE;", { 10932, 0 } },
-    { "&scap;", { 10936, 0 } },
-    { "&scaron;", { 353, 0 } },
-    { "&sccue;", { 8829, 0 } },
-    { "&sce;", { 10928, 0 } },
-    { "&scedil;", { 351, 0 } },
-    { "&scirc;", { 349, 0 } },
-    { "&scnE;", { 10934, 0 } },
-    { "&scnap;", { 10938, 0 } },
-    { "&scnsim;", { 8937, 0 } },
-    { "&scpolint;", { 10771, 0 } },
-    { "&scsim;", { 8831, 0 } },
-    { "&scy;", { 1089, 0 } },
-    { "&sdot;", { 8901, 0 } },
-    { "&sdotb;", { 8865, 0 } },
-    { "&sdote;", { 10854, 0 } },
-    { "&seArr;", { 8664, 0 } },
-    { "&searhk;", { 10533, 0 } },
-    { "&searr;", { 8600, 0 } },
-    { "&searrow;", { 8600, 0 } },
-    { "&sect;", { 167, 0 } },
-    { "&semi;", { 59, 0 } },
-    { "&seswar;", { 10537, 0 } },
-    { "&setminus;", { 8726, 0 } },
-    { "&setmn;", { 8726, 0 } },
-    { "&sext;", { 10038, 0 } },
-    { "&sfr;", { 120112, 0 } },
-    { "&sfrown;", { 8994, 0 } },
-    { "&sharp;", { 9839, 0 } },
-    { "&shchcy;", { 1097, 0 } },
-    { "&shcy;", { 1096, 0 } },
-    { "&shortmid;", { 8739, 0 } },
-    { "&shortparallel;", { 8741, 0 } },
-    { "&shy;", { 173, 0 } },
-    { "&sigma;", { 963, 0 } },
-    { "&sigmaf;", { 962, 0 } },
-    { "&sigmav;", { 962, 0 } },
-    { "&sim;", { 8764, 0 } },
-    { "&simdot;", { 10858, 0 } },
-    { "&sime;", { 8771, 0 } },
-    { "&simeq;", { 8771, 0 } },
-    { "&simg;", { 10910, 0 } },
-    { "&simgE;", { 10912, 0 } },
-    { "&siml;", { 10909, 0 } },
-    { "&simlE;", { 10911, 0 } },
-    { "&simne;", { 8774, 0 } },
-    { "&simplus;", { 10788, 0 } },
-    { "&simrarr;", { 10610, 0 } },
-    { "&slarr;", { 8592, 0 } },
-    { "&smallsetminus;", { 8726, 0 } },
-    { "&smashp;", { 10803, 0 } },
-    { "&smeparsl;", { 10724, 0 } },
-    { "&smid;", { 8739, 0 } },
-    { "&smile;", { 8995, 0 } },
-    { "&smt;", { 10922, 0 } },
-    { "&smte;", { 10924, 0 } },
-    { "&smtes;", { 10924, 65024 } },
-    { "&softcy;", { 1100, 0 } },
-    { "&sol;", { 47, 0 } },
-    { "&solb;", { 10692, 0 } },
-    { "&solbar;", { 9023, 0 } },
-    { "&sopf;", { 120164, 0 } },
-    { "&spades;", { 9824, 0 } },
-    { "&spadesuit;", { 9824, 0 } },
-    { "&spar;", { 8741, 0 } },
-    { "&sqcap;", { 8851, 0 } },
-    { "&sqcaps;", { 8851, 65024 } },
-    { "&sqcup;", { 8852, 0 } },
-    { "&sqcups;", { 8852, 65024 } },
-    { "&sqsub;", { 8847, 0 } },
-    { "&sqsube;", { 8849, 0 } },
-    { "&sqsubset;", { 8847, 0 } },
-    { "&sqsubseteq;", { 8849, 0 } },
-    { "&sqsup;", { 8848, 0 } },
-    { "&sqsupe;", { 8850, 0 } },
-    { "&sqsupset;", { 8848, 0 } },
-    { "&sqsupseteq;", { 8850, 0 } },
-    { "&squ;", { 9633, 0 } },
-    { "&square;", { 9633, 0 } },
-    { "&squarf;", { 9642, 0 } },
-    { "&squf;", { 9642, 0 } },
-    { "&srarr;", { 8594, 0 } },
-    { "&sscr;", { 120008, 0 } },
-    { "&ssetmn;", { 8726, 0 } },
-    { "&ssmile;", { 8995, 0 } },
-    { "&sstarf;", { 8902, 0 } },
-    { "&star;", { 9734, 0 } },
-    { "&starf;", { 9733, 0 } },
-    { "&straightepsilon;", { 1013, 0 } },
-    { "&straightphi;", { 981, 0 } },
-    { "&strns;", { 175, 0 } },
-    { "&sub;", { 8834, 0 } },
-    { "&subE;", { 10949, 0 } },
-    { "&subdot;", { 10941, 0 } },
-    { "&sube;", { 8838, 0 } },
-    { "&subedot;", { 10947, 0 } },
-    { "&submult;", { 10945, 0 } },
-    { "&subnE;", { 10955, 0 } },
-    { "&subne;", { 8842, 0 } },
-    { "&subplus;", { 10943, 0 } },
-    { "&subrarr;", { 10617, 0 } },
-    { "&subset;", { 8834, 0 } },
-    { "&subseteq;", { 8838, 0 } },
-    { "&subseteqq;", { 10949, 0 } },
-    { "&subsetneq;", { 8842, 0 } },
-    { "&subsetneqq;", { 10955, 0 } },
-    { "&subsim;", { 10951, 0 } },
-    { "&subsub;", { 10965, 0 } },
-    { "&subsup;", { 10963, 0 } },
-    { "&succ;", { 8827, 0 } },
-    { "&succapprox;", { 10936, 0 } },
-    { "&succcurlyeq;", { 8829, 0 } },
-    { "&succeq;", { 10928, 0 } },
-    { "&succnapprox;", { 10938, 0 } },
-    { "&succneqq;", { 10934, 0 } },
-    { "&succnsim;", { 8937, 0 } },
-    { "&succsim;", { 8831, 0 } },
-    { "&sum;", { 8721, 0 } },
-    { "&sung;", { 9834, 0 } },
-    { "&sup1", { 185, 0 } },
-    { "&sup1;", { 185, 0 } },
-    { "&sup2", { 178, 0 } },
-    { "&sup2;", { 178, 0 } },
-    { "&sup3", { 179, 0 } },
-    { "&sup3;", { 179, 0 } },
-    { "&sup;", { 8835, 0 } },
-    { "&supE;", { 10950, 0 } },
-    { "&supdot;", { 10942, 0 } },
-    { "&supdsub;", { 10968, 0 } },
-    { "&supe;", { 8839, 0 } },
-    { "&supedot;", { 10948, 0 } },
-    { "&suphsol;", { 10185, 0 } },
-    { "&suphsub;", { 10967, 0 } },
-    { "&suplarr;", { 10619, 0 } },
-    { "&supmult;", { 10946, 0 } },
-    { "&supnE;", { 10956, 0 } },
-    { "&supne;", { 8843, 0 } },
-    { "&supplus;", { 10944, 0 } },
-    { "&supset;", { 8835, 0 } },
-    { "&supseteq;", { 8839, 0 } },
-    { "&supseteqq;", { 10950, 0 } },
-    { "&supsetneq;", { 8843, 0 } },
-    { "&supsetneqq;", { 10956, 0 } },
-    { "&supsim;", { 10952, 0 } },
-    { "&supsub;", { 10964, 0 } },
-    { "&supsup;", { 10966, 0 } },
-    { "&swArr;", { 8665, 0 } },
-    { "&swarhk;", { 10534, 0 } },
-    { "&swarr;", { 8601, 0 } },
-    { "&swarrow;", { 8601, 0 } },
-    { "&swnwar;", { 10538, 0 } },
-    { "&szlig;", { 223, 0 } },
-    { "&target;", { 8982, 0 } },
-    { "&tau;", { 964, 0 } },
-    { "&tbrk;", { 9140, 0 } },
-    { "&tcaron;", { 357, 0 } },
-    { "&tcedil;", { 355, 0 } },
-    { "&tcy;", { 1090, 0 } },
-    { "&tdot;", { 8411, 0 } },
-    { "&telrec;", { 8981, 0 } },
-    { "&tfr;", { 120113, 0 } },
-    { "&there4;", { 8756, 0 } },
-    { "&therefore;", { 8756, 0 } },
-    { "&theta;", { 952, 0 } },
-    { "&thetasym;", { 977, 0 } },
-    { "&thetav;", { 977, 0 } },
-    { "&thickapprox;", { 8776, 0 } },
-    { "&thicksim;", { 8764, 0 } },
-    { "&thinsp;", { 8201, 0 } },
-    { "&thkap;", { 8776, 0 } },
-    { "&thksim;", { 8764, 0 } },
-    { "&thorn;", { 254, 0 } },
-    { "&tilde;", { 732, 0 } },
-    { "&times;", { 215, 0 } },
-    { "&timesb;", { 8864, 0 } },
-    { "&timesbar;", { 10801, 0 } },
-    { "&timesd;", { 10800, 0 } },
-    { "&tint;", { 8749, 0 } },
-    { "&toea;", { 10536, 0 } },
-    { "&top;", { 8868, 0 } },
-    { "&topbot;", { 9014, 0 } },
-    { "&topcir;", { 10993, 0 } },
-    { "&topf;", { 120165, 0 } },
-    { "&topfork;", { 10970, 0 } },
-    { "&tosa;", { 10537, 0 } },
-    { "&tprime;", { 8244, 0 } },
-    { "&trade;", { 8482, 0 } },
-    { "&triangle;", { 9653, 0 } },
-    { "&triangledown;", { 9663, 0 } },
-    { "&triangleleft;", { 9667, 0 } },
-    { "&trianglelefteq;", { 8884, 0 } },
-    { "&triangleq;", { 8796, 0 } },
-    { "&triangleright;", { 9657, 0 } },
-    { "&trianglerighteq;", { 8885, 0 } },
-    { "&tridot;", { 9708, 0 } },
-    { "&trie;", { 8796, 0 } },
-    { "&triminus;", { 10810, 0 } },
-    { "&triplus;", { 10809, 0 } },
-    { "&trisb;", { 10701, 0 } },
-    { "&tritime;", { 10811, 0 } },
-    { "&trpezium;", { 9186, 0 } },
-    { "&tscr;", { 120009, 0 } },
-    { "&tscy;", { 1094, 0 } },
-    { "&tshcy;", { 1115, 0 } },
-    { "&tstrok;", { 359, 0 } },
-    { "&twixt;", { 8812, 0 } },
-    { "&twoheadleftarrow;", { 8606, 0 } },
-    { "&twoheadrightarrow;", { 8608, 0 } },
-    { "&uArr;", { 8657, 0 } },
-    { "&uHar;", { 10595, 0 } },
-    { "&uacute;", { 250, 0 } },
-    { "&uarr;", { 8593, 0 } },
-    { "&ubrcy;", { 1118, 0 } },
-    { "&ubreve;", { 365, 0 } },
-    { "&ucirc;", { 251, 0 } },
-    { "&ucy;", { 1091, 0 } },
-    { "&udarr;", { 8645, 0 } },
-    { "&udblac;", { 369, 0 } },
-    { "&udhar;", { 10606, 0 } },
-    { "&ufisht;", { 10622, 0 } },
-    { "&ufr;", { 120114, 0 } },
-    { "&ugrave;", { 249, 0 } },
-    { "&uharl;", { 8639, 0 } },
-    { "&uharr;", { 8638, 0 } },
-    { "&uhblk;", { 9600, 0 } },
-    { "&ulcorn;", { 8988, 0 } },
-    { "&ulcorner;", { 8988, 0 } },
-    { "&ulcrop;", { 8975, 0 } },
-    { "&ultri;", { 9720, 0 } },
-    { "&umacr;", { 363, 0 } },
-    { "&uml;", { 168, 0 } },
-    { "&uogon;", { 371, 0 } },
-    { "&uopf;", { 120166, 0 } },
-    { "&uparrow;", { 8593, 0 } },
-    { "&updownarrow;", { 8597, 0 } },
-    { "&upharpoonleft;", { 8639, 0 } },
-    { "&upharpoonright;", { 8638, 0 } },
-    { "&uplus;", { 8846, 0 } },
-    { "&upsi;", { 965, 0 } },
-    { "&upsih;", { 978, 0 } },
-    { "&upsilon;", { 965, 0 } },
-    { "&upuparrows;", { 8648, 0 } },
-    { "&urcorn;", { 8989, 0 } },
-    { "&urcorner;", { 8989, 0 } },
-    { "&urcrop;", { 8974, 0 } },
-    { "&uring;", { 367, 0 } },
-    { "&urtri;", { 9721, 0 } },
-    { "&uscr;", { 120010, 0 } },
-    { "&utdot;", { 8944, 0 } },
-    { "&utilde;", { 361, 0 } },
-    { "&utri;", { 9653, 0 } },
-    { "&utrif;", { 9652, 0 } },
-    { "&uuarr;", { 8648, 0 } },
-    { "&uuml;", { 252, 0 } },
-    { "&uwangle;", { 10663, 0 } },
-    { "&vArr;", { 8661, 0 } },
-    { "&vBar;", { 10984, 0 } },
-    { "&vBarv;", { 10985, 0 } },
-    { "&vDash;", { 8872, 0 } },
-    { "&vangrt;", { 10652, 0 } },
-    { "&varepsilon;", { 1013, 0 } },
-    { "&varkappa;", { 1008, 0 } },
-    { "&varnothing;", { 8709, 0 } },
-    { "&varphi;", { 981, 0 } },
-    { "&varpi;", { 982, 0 } },
-    { "&varpropto;", { 8733, 0 } },
-    { "&varr;", { 8597, 0 } },
-    { "&varrho;", { 1009, 0 } },
-    { "&varsigma;", { 962, 0 } },
-    { "&varsubsetneq;", { 8842, 65024 } },
-    { "&varsubsetneqq;", { 10955, 65024 } },
-    { "&varsupsetneq;", { 8843, 65024 } },
-    { "&varsupsetneqq;", { 10956, 65024 } },
-    { "&vartheta;", { 977, 0 } },
-    { "&vartriangleleft;", { 8882, 0 } },
-    { "&vartriangleright;", { 8883, 0 } },
-    { "&vcy;", { 1074, 0 } },
-    { "&vdash;", { 8866, 0 } },
-    { "&vee;", { 8744, 0 } },
-    { "&veebar;", { 8891, 0 } },
-    { "&veeeq;", { 8794, 0 } },
-    { "&vellip;", { 8942, 0 } },
-    { "&verbar;", { 124, 0 } },
-    { "&vert;", { 124, 0 } },
-    { "&vfr;", { 120115, 0 } },
-    { "&vltri;", { 8882, 0 } },
-    { "&vnsub;", { 8834, 8402 } },
-    { "&vnsup;", { 8835, 8402 } },
-    { "&vopf;", { 120167, 0 } },
-    { "&vprop;", { 8733, 0 } },
-    { "&vrtri;", { 8883, 0 } },
-    { "&vscr;", { 120011, 0 } },
-    { "&vsubnE;", { 10955, 65024 } },
-    { "&vsubne;", { 8842, 65024 } },
-    { "&vsupnE;", { 10956, 65024 } },
-    { "&vsupne;", { 8843, 65024 } },
-    { "&vzigzag;", { 10650, 0 } },
-    { "&wcirc;", { 373, 0 } },
-    { "&wedbar;", { 10847, 0 } },
-    { "&wedge;", { 8743, 0 } },
-    { "&wedgeq;", { 8793, 0 } },
-    { "&weierp;", { 8472, 0 } },
-    { "&wfr;", { 120116, 0 } },
-    { "&wopf;", { 120168, 0 } },
-    { "&wp;", { 8472, 0 } },
-    { "&wr;", { 8768, 0 } },
-    { "&wreath;", { 8768, 0 } },
-    { "&wscr;", { 120012, 0 } },
-    { "&xcap;", { 8898, 0 } },
-    { "&xcirc;", { 9711, 0 } },
-    { "&xcup;", { 8899, 0 } },
-    { "&xdtri;", { 9661, 0 } },
-    { "&xfr;", { 120117, 0 } },
-    { "&xhArr;", { 10234, 0 } },
-    { "&xharr;", { 10231, 0 } },
-    { "&xi;", { 958, 0 } },
-    { "&xlArr;", { 10232, 0 } },
-    { "&xlarr;", { 10229, 0 } },
-    { "&xmap;", { 10236, 0 } },
-    { "&xnis;", { 8955, 0 } },
-    { "&xodot;", { 10752, 0 } },
-    { "&xopf;", { 120169, 0 } },
-    { "&xoplus;", { 10753, 0 } },
-    { "&xotime;", { 10754, 0 } },
-    { "&xrArr;", { 10233, 0 } },
-    { "&xrarr;", { 10230, 0 } },
-    { "&xscr;", { 120013, 0 } },
-    { "&xsqcup;", { 10758, 0 } },
-    { "&xuplus;", { 10756, 0 } },
-    { "&xutri;", { 9651, 0 } },
-    { "&xvee;", { 8897, 0 } },
-    { "&xwedge;", { 8896, 0 } },
-    { "&yacute;", { 253, 0 } },
-    { "&yacy;", { 1103, 0 } },
-    { "&ycirc;", { 375, 0 } },
-    { "&ycy;", { 1099, 0 } },
-    { "&yen;", { 165, 0 } },
-    { "&yfr;", { 120118, 0 } },
-    { "&yicy;", { 1111, 0 } },
-    { "&yopf;", { 120170, 0 } },
-    { "&yscr;", { 120014, 0 } },
-    { "&yucy;", { 1102, 0 } },
-    { "&yuml;", { 255, 0 } },
-    { "&zacute;", { 378, 0 } },
-    { "&zcaron;", { 382, 0 } },
-    { "&zcy;", { 1079, 0 } },
-    { "&zdot;", { 380, 0 } },
-    { "&zeetrf;", { 8488, 0 } },
-    { "&zeta;", { 950, 0 } },
-    { "&zfr;", { 120119, 0 } },
-    { "&zhcy;", { 1078, 0 } },
-    { "&zigrarr;", { 8669, 0 } },
-    { "&zopf;", { 120171, 0 } },
-    { "&zscr;", { 120015, 0 } },
-    { "&zwj;", { 8205, 0 } },
-    { "&zwnj;", { 8204, 0 } }
-};
+/* The tables are generated by scripts/build_entity_map.py from
+ * https://html.spec.whatwg.org/entities.json
+ *
+ * ENTITY_TABLE is a minimal perfect hash: The hash of the entity name selects
+ * a displacement in ENTITY_DISP and the displacement mixed with the hash
+ * gives the index into ENTITY_TABLE. */
+#define ENTITY_COUNT           2125
+#define ENTITY_BUCKET_COUNT    532
+#define ENTITY_MAX_NAME_SIZE   33
+#define ENTITY_MAX_UTF8_SIZE   6
 
+static const unsigned short ENTITY_DISP[ENTITY_BUCKET_COUNT] = {
+    18, 7, 108, 3, 1, 116, 8, 37, 59, 15, 63, 60, 6, 5, 0, 1, 8, 8, 0, 23, 2, 3, 25, 421, 0, 9, 28, 11, 0, 16,
+    35, 182, 54, 16, 7, 15, 0, 111, 22, 14, 5, 3, 54, 108, 98, 13, 87, 0, 1, 91, 15, 1, 37, 314, 35, 116, 2,
+    468, 1, 0, 33, 0, 6, 30, 4, 0, 70, 21, 8, 13, 94, 12, 64, 172, 5, 77, 23, 38, 118, 3, 0, 17, 56, 13, 125,
+    5, 169, 2, 12, 11, 4, 0, 296, 58, 8, 152, 74, 285, 18, 188, 43, 45, 32, 169, 3, 64, 384, 216, 12, 1, 60,
+    143, 9, 0, 6, 1, 0, 4, 28, 134, 9, 203, 0, 4, 3, 33, 12, 125, 0, 34, 9, 89, 7, 32, 28, 203, 211, 8, 1, 49,
+    18, 17, 6, 153, 19, 43, 12, 33, 3, 7, 23, 3, 0, 11, 39, 57, 98, 7, 36, 1, 151, 1, 66, 1, 31, 139, 3, 3,
+    53, 0, 2, 34, 1286, 17, 39, 24, 134, 109, 37, 23, 1, 23, 35, 110, 27, 0, 0, 18, 123, 124, 57, 40, 4, 39,
+    0, 1, 130, 68, 19, 532, 0, 23, 0, 14, 0, 0, 69, 319, 0, 52, 96, 4, 77, 1, 2, 45, 88, 4, 364, 3, 3, 6, 2,
+    22, 429, 225, 58, 59, 43, 178, 15, 38, 49, 59, 9, 467, 60, 1, 3, 17, 41, 299, 35, 1654, 311, 1, 33, 128,
+    73, 34, 55, 3, 177, 0, 141, 33, 28, 4, 42, 10, 196, 4, 45, 14, 32, 446, 54, 12, 175, 17, 134, 231, 34, 0,
+    79, 15, 51, 273, 134, 110, 1, 2, 13, 5, 17, 136, 18, 70, 15, 8, 183, 18, 29, 1169, 5, 309, 1, 1, 1, 35,
+    155, 7, 80, 43, 115, 5, 381, 268, 46, 166, 33, 50, 6, 817, 34, 23, 44, 148, 28, 11, 16, 1136, 4, 1, 1, 21,
+    500, 217, 0, 22, 3, 267, 44, 182, 48, 476, 1, 239, 5, 7, 102, 5, 7, 309, 14, 48, 1, 196, 301, 10, 1495,
+    26, 199, 19, 22, 101, 63, 157, 48, 44, 0, 1, 141, 0, 93, 288, 667, 3, 0, 0, 158, 300, 28, 31, 8, 115, 52,
+    99, 196, 141, 1296, 0, 87, 199, 35, 7, 94, 3, 12, 114, 29, 166, 99, 139, 485, 9, 196, 156, 655, 36, 0,
+    771, 182, 577, 7, 11, 145, 0, 95, 252, 16, 78, 65, 19, 962, 1, 2337, 11, 22, 0, 734, 225, 273, 266, 328,
+    3, 213, 4, 205, 1143, 15, 198, 15, 179, 0, 41, 85, 25, 129, 200, 6, 551, 5, 859, 282, 1095, 49, 5, 565,
+    14, 2, 0, 184, 89, 228, 176, 0, 1322, 781, 34, 78, 245, 16, 3, 60, 78, 231, 48, 4, 3, 287, 2962, 18, 542,
+    28, 2, 367, 265, 583, 2, 491, 35, 317, 447, 43, 2737, 148, 0, 650, 0, 107, 72, 51, 658, 949, 50, 11, 1537,
+    18, 1170, 3, 3522, 9, 55, 586, 472, 1711, 3, 0, 37, 0, 1044, 1, 3, 1345, 0, 99, 630, 21, 294, 6123, 875,
+    298, 257, 12, 4900, 3655, 5683, 8, 939, 10, 940
+};
 
-struct entity_key {
-    const char* name;
-    size_t name_size;
+static const struct entity ENTITY_TABLE[ENTITY_COUNT] = {
+    { "&prime;", 7, 3, "\xe2\x80\xb2" },
+    { "&subseteq;", 10, 3, "\xe2\x8a\x86" },
+    { "&LowerLeftArrow;", 16, 3, "\xe2\x86\x99" },
+    { "&boxur;", 7, 3, "\xe2\x94\x94" },
+    { "&DownLeftRightVector;", 21, 3, "\xe2\xa5\x90" },
+    { "&Star;", 6, 3, "\xe2\x8b\x86" },
+    { "&Yscr;", 6, 4, "\xf0\x9d\x92\xb4" },
+    { "&ffr;", 5, 4, "\xf0\x9d\x94\xa3" },
+    { "&gneqq;", 7, 3, "\xe2\x89\xa9" },
+    { "&Pscr;", 6, 4, "\xf0\x9d\x92\xab" },
+    { "&precnsim;", 10, 3, "\xe2\x8b\xa8" },
+    { "&gamma;", 7, 2, "\xce\xb3" },
+    { "&Wopf;", 6, 4, "\xf0\x9d\x95\x8e" },
+    { "&wscr;", 6, 4, "\xf0\x9d\x93\x8c" },
+    { "&boxdl;", 7, 3, "\xe2\x94\x90" },
+    { "&empty;", 7, 3, "\xe2\x88\x85" },
+    { "&LessSlantEqual;", 16, 3, "\xe2\xa9\xbd" },
+    { "&not;", 5, 2, "\xc2\xac" },
+    { "&Gg;", 4, 3, "\xe2\x8b\x99" },
+    { "&GreaterTilde;", 14, 3, "\xe2\x89\xb3" },
+    { "&otilde;", 8, 2, "\xc3\xb5" },
+    { "&bepsi;", 7, 2, "\xcf\xb6" },
+    { "&RightTeeVector;", 16, 3, "\xe2\xa5\x9b" },
+    { "&lesseqgtr;", 11, 3, "\xe2\x8b\x9a" },
+    { "&suphsub;", 9, 3, "\xe2\xab\x97" },
+    { "&Uuml;", 6, 2, "\xc3\x9c" },
+    { "&downarrow;", 11, 3, "\xe2\x86\x93" },
+    { "&nsupset;", 9, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&simrarr;", 9, 3, "\xe2\xa5\xb2" },
+    { "&rightarrowtail;", 16, 3, "\xe2\x86\xa3" },
+    { "&OElig;", 7, 2, "\xc5\x92" },
+    { "&varsigma;", 10, 2, "\xcf\x82" },
+    { "&asymp;", 7, 3, "\xe2\x89\x88" },
+    { "&Vdash;", 7, 3, "\xe2\x8a\xa9" },
+    { "&lnapprox;", 10, 3, "\xe2\xaa\x89" },
+    { "&topcir;", 8, 3, "\xe2\xab\xb1" },
+    { "&sup;", 5, 3, "\xe2\x8a\x83" },
+    { "&SupersetEqual;", 15, 3, "\xe2\x8a\x87" },
+    { "&bsime;", 7, 3, "\xe2\x8b\x8d" },
+    { "&DZcy;", 6, 2, "\xd0\x8f" },
+    { "&nearrow;", 9, 3, "\xe2\x86\x97" },
+    { "&subne;", 7, 3, "\xe2\x8a\x8a" },
+    { "&ffilig;", 8, 3, "\xef\xac\x83" },
+    { "&times;", 7, 2, "\xc3\x97" },
+    { "&brvbar;", 8, 2, "\xc2\xa6" },
+    { "&Sc;", 4, 3, "\xe2\xaa\xbc" },
+    { "&sube;", 6, 3, "\xe2\x8a\x86" },
+    { "&andv;", 6, 3, "\xe2\xa9\x9a" },
+    { "&boxhd;", 7, 3, "\xe2\x94\xac" },
+    { "&ensp;", 6, 3, "\xe2\x80\x82" },
+    { "&rightrightarrows;", 18, 3, "\xe2\x87\x89" },
+    { "&nltrie;", 8, 3, "\xe2\x8b\xac" },
+    { "&NotGreaterFullEqual;", 21, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&roplus;", 8, 3, "\xe2\xa8\xae" },
+    { "&quaternions;", 13, 3, "\xe2\x84\x8d" },
+    { "&xcup;", 6, 3, "\xe2\x8b\x83" },
+    { "&Racute;", 8, 2, "\xc5\x94" },
+    { "&yuml;", 6, 2, "\xc3\xbf" },
+    { "&rsquor;", 8, 3, "\xe2\x80\x99" },
+    { "&Nu;", 4, 2, "\xce\x9d" },
+    { "&bumpe;", 7, 3, "\xe2\x89\x8f" },
+    { "&NestedLessLess;", 16, 3, "\xe2\x89\xaa" },
+    { "&theta;", 7, 2, "\xce\xb8" },
+    { "&jcirc;", 7, 2, "\xc4\xb5" },
+    { "&utri;", 6, 3, "\xe2\x96\xb5" },
+    { "&OpenCurlyQuote;", 16, 3, "\xe2\x80\x98" },
+    { "&NotPrecedes;", 13, 3, "\xe2\x8a\x80" },
+    { "&leftleftarrows;", 16, 3, "\xe2\x87\x87" },
+    { "&prod;", 6, 3, "\xe2\x88\x8f" },
+    { "&straightepsilon;", 17, 2, "\xcf\xb5" },
+    { "&dharr;", 7, 3, "\xe2\x87\x82" },
+    { "&Eta;", 5, 2, "\xce\x97" },
+    { "&notnivb;", 9, 3, "\xe2\x8b\xbe" },
+    { "&shy;", 5, 2, "\xc2\xad" },
+    { "&breve;", 7, 2, "\xcb\x98" },
+    { "&nsupseteq;", 11, 3, "\xe2\x8a\x89" },
+    { "&DoubleContourIntegral;", 23, 3, "\xe2\x88\xaf" },
+    { "&acE;", 5, 5, "\xe2\x88\xbe\xcc\xb3" },
+    { "&sdotb;", 7, 3, "\xe2\x8a\xa1" },
+    { "&lhblk;", 7, 3, "\xe2\x96\x84" },
+    { "&fcy;", 5, 2, "\xd1\x84" },
+    { "&duarr;", 7, 3, "\xe2\x87\xb5" },
+    { "&frac16;", 8, 3, "\xe2\x85\x99" },
+    { "&lfisht;", 8, 3, "\xe2\xa5\xbc" },
+    { "&boxVL;", 7, 3, "\xe2\x95\xa3" },
+    { "&forkv;", 7, 3, "\xe2\xab\x99" },
+    { "&raquo;", 7, 2, "\xc2\xbb" },
+    { "&odash;", 7, 3, "\xe2\x8a\x9d" },
+    { "&nsupE;", 7, 5, "\xe2\xab\x86\xcc\xb8" },
+    { "&erarr;", 7, 3, "\xe2\xa5\xb1" },
+    { "&scirc;", 7, 2, "\xc5\x9d" },
+    { "&setminus;", 10, 3, "\xe2\x88\x96" },
+    { "&DDotrahd;", 10, 3, "\xe2\xa4\x91" },
+    { "&lhard;", 7, 3, "\xe2\x86\xbd" },
+    { "&lsaquo;", 8, 3, "\xe2\x80\xb9" },
+    { "&bsolb;", 7, 3, "\xe2\xa7\x85" },
+    { "&smid;", 6, 3, "\xe2\x88\xa3" },
+    { "&diam;", 6, 3, "\xe2\x8b\x84" },
+    { "&Rrightarrow;", 13, 3, "\xe2\x87\x9b" },
+    { "&colon;", 7, 1, "\x3a" },
+    { "&ngtr;", 6, 3, "\xe2\x89\xaf" },
+    { "&PrecedesSlantEqual;", 20, 3, "\xe2\x89\xbc" },
+    { "&yucy;", 6, 2, "\xd1\x8e" },
+    { "&race;", 6, 5, "\xe2\x88\xbd\xcc\xb1" },
+    { "&dagger;", 8, 3, "\xe2\x80\xa0" },
+    { "&dzcy;", 6, 2, "\xd1\x9f" },
+    { "&lfloor;", 8, 3, "\xe2\x8c\x8a" },
+    { "&larrfs;", 8, 3, "\xe2\xa4\x9d" },
+    { "&rightharpoonup;", 16, 3, "\xe2\x87\x80" },
+    { "&bigcup;", 8, 3, "\xe2\x8b\x83" },
+    { "&harr;", 6, 3, "\xe2\x86\x94" },
+    { "&gesdotol;", 10, 3, "\xe2\xaa\x84" },
+    { "&minus;", 7, 3, "\xe2\x88\x92" },
+    { "&half;", 6, 2, "\xc2\xbd" },
+    { "&twixt;", 7, 3, "\xe2\x89\xac" },
+    { "&capdot;", 8, 3, "\xe2\xa9\x80" },
+    { "&DoubleDownArrow;", 17, 3, "\xe2\x87\x93" },
+    { "&vartheta;", 10, 2, "\xcf\x91" },
+    { "&mid;", 5, 3, "\xe2\x88\xa3" },
+    { "&angmsdah;", 10, 3, "\xe2\xa6\xaf" },
+    { "&setmn;", 7, 3, "\xe2\x88\x96" },
+    { "&coprod;", 8, 3, "\xe2\x88\x90" },
+    { "&oopf;", 6, 4, "\xf0\x9d\x95\xa0" },
+    { "&orv;", 5, 3, "\xe2\xa9\x9b" },
+    { "&spadesuit;", 11, 3, "\xe2\x99\xa0" },
+    { "&leftrightarrows;", 17, 3, "\xe2\x87\x86" },
+    { "&bigodot;", 9, 3, "\xe2\xa8\x80" },
+    { "&bscr;", 6, 4, "\xf0\x9d\x92\xb7" },
+    { "&ccaps;", 7, 3, "\xe2\xa9\x8d" },
+    { "&sub;", 5, 3, "\xe2\x8a\x82" },
+    { "&UnionPlus;", 11, 3, "\xe2\x8a\x8e" },
+    { "&nprcue;", 8, 3, "\xe2\x8b\xa0" },
+    { "&DoubleLongRightArrow;", 22, 3, "\xe2\x9f\xb9" },
+    { "&pound;", 7, 2, "\xc2\xa3" },
+    { "&agrave;", 8, 2, "\xc3\xa0" },
+    { "&nvsim;", 7, 6, "\xe2\x88\xbc\xe2\x83\x92" },
+    { "&epsiv;", 7, 2, "\xcf\xb5" },
+    { "&amalg;", 7, 3, "\xe2\xa8\xbf" },
+    { "&Map;", 5, 3, "\xe2\xa4\x85" },
+    { "&Vvdash;", 8, 3, "\xe2\x8a\xaa" },
+    { "&xrarr;", 7, 3, "\xe2\x9f\xb6" },
+    { "&nap;", 5, 3, "\xe2\x89\x89" },
+    { "&ldquor;", 8, 3, "\xe2\x80\x9e" },
+    { "&NotHumpEqual;", 14, 5, "\xe2\x89\x8f\xcc\xb8" },
+    { "&vsupnE;", 8, 6, "\xe2\xab\x8c\xef\xb8\x80" },
+    { "&nsub;", 6, 3, "\xe2\x8a\x84" },
+    { "&bNot;", 6, 3, "\xe2\xab\xad" },
+    { "&quot;", 6, 1, "\x22" },
+    { "&rthree;", 8, 3, "\xe2\x8b\x8c" },
+    { "&uopf;", 6, 4, "\xf0\x9d\x95\xa6" },
+    { "&circledR;", 10, 2, "\xc2\xae" },
+    { "&curlyvee;", 10, 3, "\xe2\x8b\x8e" },
+    { "&NotSupersetEqual;", 18, 3, "\xe2\x8a\x89" },
+    { "&Ufr;", 5, 4, "\xf0\x9d\x94\x98" },
+    { "&Uarr;", 6, 3, "\xe2\x86\x9f" },
+    { "&lthree;", 8, 3, "\xe2\x8b\x8b" },
+    { "&nprec;", 7, 3, "\xe2\x8a\x80" },
+    { "&Alpha;", 7, 2, "\xce\x91" },
+    { "&upharpoonleft;", 15, 3, "\xe2\x86\xbf" },
+    { "&vartriangleright;", 18, 3, "\xe2\x8a\xb3" },
+    { "&wreath;", 8, 3, "\xe2\x89\x80" },
+    { "&backepsilon;", 13, 2, "\xcf\xb6" },
+    { "&Dstrok;", 8, 2, "\xc4\x90" },
+    { "&lbrkslu;", 9, 3, "\xe2\xa6\x8d" },
+    { "&OverBar;", 9, 3, "\xe2\x80\xbe" },
+    { "&NotSquareSubset;", 17, 5, "\xe2\x8a\x8f\xcc\xb8" },
+    { "&RightVectorBar;", 16, 3, "\xe2\xa5\x93" },
+    { "&SquareSuperset;", 16, 3, "\xe2\x8a\x90" },
+    { "&loarr;", 7, 3, "\xe2\x87\xbd" },
+    { "&tbrk;", 6, 3, "\xe2\x8e\xb4" },
+    { "&nparsl;", 8, 6, "\xe2\xab\xbd\xe2\x83\xa5" },
+    { "&frac15;", 8, 3, "\xe2\x85\x95" },
+    { "&boxUR;", 7, 3, "\xe2\x95\x9a" },
+    { "&seArr;", 7, 3, "\xe2\x87\x98" },
+    { "&Rang;", 6, 3, "\xe2\x9f\xab" },
+    { "&frac13;", 8, 3, "\xe2\x85\x93" },
+    { "&searhk;", 8, 3, "\xe2\xa4\xa5" },
+    { "&tcedil;", 8, 2, "\xc5\xa3" },
+    { "&luruhar;", 9, 3, "\xe2\xa5\xa6" },
+    { "&NotSucceeds;", 13, 3, "\xe2\x8a\x81" },
+    { "&sol;", 5, 1, "\x2f" },
+    { "&circleddash;", 13, 3, "\xe2\x8a\x9d" },
+    { "&uArr;", 6, 3, "\xe2\x87\x91" },
+    { "&ulcrop;", 8, 3, "\xe2\x8c\x8f" },
+    { "&HilbertSpace;", 14, 3, "\xe2\x84\x8b" },
+    { "&Iukcy;", 7, 2, "\xd0\x86" },
+    { "&LongLeftRightArrow;", 20, 3, "\xe2\x9f\xb7" },
+    { "&Ycy;", 5, 2, "\xd0\xab" },
+    { "&glE;", 5, 3, "\xe2\xaa\x92" },
+    { "&DiacriticalAcute;", 18, 2, "\xc2\xb4" },
+    { "&bprime;", 8, 3, "\xe2\x80\xb5" },
+    { "&ApplyFunction;", 15, 3, "\xe2\x81\xa1" },
+    { "&precapprox;", 12, 3, "\xe2\xaa\xb7" },
+    { "&varrho;", 8, 2, "\xcf\xb1" },
+    { "&diamond;", 9, 3, "\xe2\x8b\x84" },
+    { "&midast;", 8, 1, "\x2a" },
+    { "&oint;", 6, 3, "\xe2\x88\xae" },
+    { "&notinvc;", 9, 3, "\xe2\x8b\xb6" },
+    { "&nlt;", 5, 3, "\xe2\x89\xae" },
+    { "&scnsim;", 8, 3, "\xe2\x8b\xa9" },
+    { "&RightTriangleBar;", 18, 3, "\xe2\xa7\x90" },
+    { "&Vee;", 5, 3, "\xe2\x8b\x81" },
+    { "&looparrowleft;", 15, 3, "\xe2\x86\xab" },
+    { "&cent;", 6, 2, "\xc2\xa2" },
+    { "&trianglerighteq;", 17, 3, "\xe2\x8a\xb5" },
+    { "&els;", 5, 3, "\xe2\xaa\x95" },
+    { "&Oacute;", 8, 2, "\xc3\x93" },
+    { "&excl;", 6, 1, "\x21" },
+    { "&supseteqq;", 11, 3, "\xe2\xab\x86" },
+    { "&NotHumpDownHump;", 17, 5, "\xe2\x89\x8e\xcc\xb8" },
+    { "&lat;", 5, 3, "\xe2\xaa\xab" },
+    { "&supE;", 6, 3, "\xe2\xab\x86" },
+    { "&curarr;", 8, 3, "\xe2\x86\xb7" },
+    { "&blacktriangle;", 15, 3, "\xe2\x96\xb4" },
+    { "&circeq;", 8, 3, "\xe2\x89\x97" },
+    { "&Ubreve;", 8, 2, "\xc5\xac" },
+    { "&lacute;", 8, 2, "\xc4\xba" },
+    { "&boxdL;", 7, 3, "\xe2\x95\x95" },
+    { "&UpArrowDownArrow;", 18, 3, "\xe2\x87\x85" },
+    { "&ecir;", 6, 3, "\xe2\x89\x96" },
+    { "&laemptyv;", 10, 3, "\xe2\xa6\xb4" },
+    { "&Uacute;", 8, 2, "\xc3\x9a" },
+    { "&NoBreak;", 9, 3, "\xe2\x81\xa0" },
+    { "&loang;", 7, 3, "\xe2\x9f\xac" },
+    { "&racute;", 8, 2, "\xc5\x95" },
+    { "&CapitalDifferentialD;", 22, 3, "\xe2\x85\x85" },
+    { "&period;", 8, 1, "\x2e" },
+    { "&bigsqcup;", 10, 3, "\xe2\xa8\x86" },
+    { "&nrArr;", 7, 3, "\xe2\x87\x8f" },
+    { "&gE;", 4, 3, "\xe2\x89\xa7" },
+    { "&bnot;", 6, 3, "\xe2\x8c\x90" },
+    { "&RightUpDownVector;", 19, 3, "\xe2\xa5\x8f" },
+    { "&cedil;", 7, 2, "\xc2\xb8" },
+    { "&nVDash;", 8, 3, "\xe2\x8a\xaf" },
+    { "&xvee;", 6, 3, "\xe2\x8b\x81" },
+    { "&prop;", 6, 3, "\xe2\x88\x9d" },
+    { "&zopf;", 6, 4, "\xf0\x9d\x95\xab" },
+    { "&subedot;", 9, 3, "\xe2\xab\x83" },
+    { "&rx;", 4, 3, "\xe2\x84\x9e" },
+    { "&qopf;", 6, 4, "\xf0\x9d\x95\xa2" },
+    { "&boxHd;", 7, 3, "\xe2\x95\xa4" },
+    { "&NotNestedLessLess;", 19, 5, "\xe2\xaa\xa1\xcc\xb8" },
+    { "&Bernoullis;", 12, 3, "\xe2\x84\xac" },
+    { "&leftrightharpoons;", 19, 3, "\xe2\x87\x8b" },
+    { "&opar;", 6, 3, "\xe2\xa6\xb7" },
+    { "&lmoust;", 8, 3, "\xe2\x8e\xb0" },
+    { "&straightphi;", 13, 2, "\xcf\x95" },
+    { "&mopf;", 6, 4, "\xf0\x9d\x95\x9e" },
+    { "&Cup;", 5, 3, "\xe2\x8b\x93" },
+    { "&Equilibrium;", 13, 3, "\xe2\x87\x8c" },
+    { "&NotExists;", 11, 3, "\xe2\x88\x84" },
+    { "&ntriangleleft;", 15, 3, "\xe2\x8b\xaa" },
+    { "&CircleMinus;", 13, 3, "\xe2\x8a\x96" },
+    { "&boxminus;", 10, 3, "\xe2\x8a\x9f" },
+    { "&Succeeds;", 10, 3, "\xe2\x89\xbb" },
+    { "&tilde;", 7, 2, "\xcb\x9c" },
+    { "&nsmid;", 7, 3, "\xe2\x88\xa4" },
+    { "&solbar;", 8, 3, "\xe2\x8c\xbf" },
+    { "&GT;", 4, 1, "\x3e" },
+    { "&GreaterLess;", 13, 3, "\xe2\x89\xb7" },
+    { "&comma;", 7, 1, "\x2c" },
+    { "&nabla;", 7, 3, "\xe2\x88\x87" },
+    { "&ngeqq;", 7, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&NewLine;", 9, 1, "\x0a" },
+    { "&easter;", 8, 3, "\xe2\xa9\xae" },
+    { "&sqsupe;", 8, 3, "\xe2\x8a\x92" },
+    { "&npre;", 6, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&AMP;", 5, 1, "\x26" },
+    { "&bemptyv;", 9, 3, "\xe2\xa6\xb0" },
+    { "&softcy;", 8, 2, "\xd1\x8c" },
+    { "&angmsdaa;", 10, 3, "\xe2\xa6\xa8" },
+    { "&cdot;", 6, 2, "\xc4\x8b" },
+    { "&rpar;", 6, 1, "\x29" },
+    { "&ee;", 4, 3, "\xe2\x85\x87" },
+    { "&Kappa;", 7, 2, "\xce\x9a" },
+    { "&Oslash;", 8, 2, "\xc3\x98" },
+    { "&Cap;", 5, 3, "\xe2\x8b\x92" },
+    { "&nrightarrow;", 13, 3, "\xe2\x86\x9b" },
+    { "&nsubseteq;", 11, 3, "\xe2\x8a\x88" },
+    { "&Tfr;", 5, 4, "\xf0\x9d\x94\x97" },
+    { "&square;", 8, 3, "\xe2\x96\xa1" },
+    { "&dcaron;", 8, 2, "\xc4\x8f" },
+    { "&DoubleLongLeftArrow;", 21, 3, "\xe2\x9f\xb8" },
+    { "&asympeq;", 9, 3, "\xe2\x89\x8d" },
+    { "&Gt;", 4, 3, "\xe2\x89\xab" },
+    { "&UpDownArrow;", 13, 3, "\xe2\x86\x95" },
+    { "&topbot;", 8, 3, "\xe2\x8c\xb6" },
+    { "&Vdashl;", 8, 3, "\xe2\xab\xa6" },
+    { "&DotDot;", 8, 3, "\xe2\x83\x9c" },
+    { "&ang;", 5, 3, "\xe2\x88\xa0" },
+    { "&leftrightarrow;", 16, 3, "\xe2\x86\x94" },
+    { "&DownArrowUpArrow;", 18, 3, "\xe2\x87\xb5" },
+    { "&Dagger;", 8, 3, "\xe2\x80\xa1" },
+    { "&lvnE;", 6, 6, "\xe2\x89\xa8\xef\xb8\x80" },
+    { "&Nacute;", 8, 2, "\xc5\x83" },
+    { "&harrw;", 7, 3, "\xe2\x86\xad" },
+    { "&gesl;", 6, 6, "\xe2\x8b\x9b\xef\xb8\x80" },
+    { "&angrtvb;", 9, 3, "\xe2\x8a\xbe" },
+    { "&ENG;", 5, 2, "\xc5\x8a" },
+    { "&swArr;", 7, 3, "\xe2\x87\x99" },
+    { "&lrhar;", 7, 3, "\xe2\x87\x8b" },
+    { "&iinfin;", 8, 3, "\xe2\xa7\x9c" },
+    { "&ssetmn;", 8, 3, "\xe2\x88\x96" },
+    { "&nsubE;", 7, 5, "\xe2\xab\x85\xcc\xb8" },
+    { "&awint;", 7, 3, "\xe2\xa8\x91" },
+    { "&rdquor;", 8, 3, "\xe2\x80\x9d" },
+    { "&eplus;", 7, 3, "\xe2\xa9\xb1" },
+    { "&in;", 4, 3, "\xe2\x88\x88" },
+    { "&boxVl;", 7, 3, "\xe2\x95\xa2" },
+    { "&varsupsetneqq;", 15, 6, "\xe2\xab\x8c\xef\xb8\x80" },
+    { "&UnderBracket;", 14, 3, "\xe2\x8e\xb5" },
+    { "&subsetneqq;", 12, 3, "\xe2\xab\x8b" },
+    { "&UpperRightArrow;", 17, 3, "\xe2\x86\x97" },
+    { "&lharul;", 8, 3, "\xe2\xa5\xaa" },
+    { "&ntilde;", 8, 2, "\xc3\xb1" },
+    { "&Nfr;", 5, 4, "\xf0\x9d\x94\x91" },
+    { "&Ccedil;", 8, 2, "\xc3\x87" },
+    { "&rscr;", 6, 4, "\xf0\x9d\x93\x87" },
+    { "&upuparrows;", 12, 3, "\xe2\x87\x88" },
+    { "&sup2;", 6, 2, "\xc2\xb2" },
+    { "&ifr;", 5, 4, "\xf0\x9d\x94\xa6" },
+    { "&sqcup;", 7, 3, "\xe2\x8a\x94" },
+    { "&dblac;", 7, 2, "\xcb\x9d" },
+    { "&NotDoubleVerticalBar;", 22, 3, "\xe2\x88\xa6" },
+    { "&Product;", 9, 3, "\xe2\x88\x8f" },
+    { "&nldr;", 6, 3, "\xe2\x80\xa5" },
+    { "&rangle;", 8, 3, "\xe2\x9f\xa9" },
+    { "&Iscr;", 6, 3, "\xe2\x84\x90" },
+    { "&part;", 6, 3, "\xe2\x88\x82" },
+    { "&rarrtl;", 8, 3, "\xe2\x86\xa3" },
+    { "&Dfr;", 5, 4, "\xf0\x9d\x94\x87" },
+    { "&Cedilla;", 9, 2, "\xc2\xb8" },
+    { "&frac25;", 8, 3, "\xe2\x85\x96" },
+    { "&Qfr;", 5, 4, "\xf0\x9d\x94\x94" },
+    { "&lAtail;", 8, 3, "\xe2\xa4\x9b" },
+    { "&angst;", 7, 2, "\xc3\x85" },
+    { "&Ascr;", 6, 4, "\xf0\x9d\x92\x9c" },
+    { "&rharu;", 7, 3, "\xe2\x87\x80" },
+    { "&ImaginaryI;", 12, 3, "\xe2\x85\x88" },
+    { "&profalar;", 10, 3, "\xe2\x8c\xae" },
+    { "&lesges;", 8, 3, "\xe2\xaa\x93" },
+    { "&boxhD;", 7, 3, "\xe2\x95\xa5" },
+    { "&prcue;", 7, 3, "\xe2\x89\xbc" },
+    { "&NotLess;", 9, 3, "\xe2\x89\xae" },
+    { "&smeparsl;", 10, 3, "\xe2\xa7\xa4" },
+    { "&yopf;", 6, 4, "\xf0\x9d\x95\xaa" },
+    { "&tshcy;", 7, 2, "\xd1\x9b" },
+    { "&LeftVectorBar;", 15, 3, "\xe2\xa5\x92" },
+    { "&ldca;", 6, 3, "\xe2\xa4\xb6" },
+    { "&nbump;", 7, 5, "\xe2\x89\x8e\xcc\xb8" },
+    { "&crarr;", 7, 3, "\xe2\x86\xb5" },
+    { "&rpargt;", 8, 3, "\xe2\xa6\x94" },
+    { "&Gammad;", 8, 2, "\xcf\x9c" },
+    { "&mumap;", 7, 3, "\xe2\x8a\xb8" },
+    { "&DownRightTeeVector;", 20, 3, "\xe2\xa5\x9f" },
+    { "&ecy;", 5, 2, "\xd1\x8d" },
+    { "&perp;", 6, 3, "\xe2\x8a\xa5" },
+    { "&fallingdotseq;", 15, 3, "\xe2\x89\x92" },
+    { "&Idot;", 6, 2, "\xc4\xb0" },
+    { "&les;", 5, 3, "\xe2\xa9\xbd" },
+    { "&copy;", 6, 2, "\xc2\xa9" },
+    { "&utrif;", 7, 3, "\xe2\x96\xb4" },
+    { "&Igrave;", 8, 2, "\xc3\x8c" },
+    { "&urcorner;", 10, 3, "\xe2\x8c\x9d" },
+    { "&vartriangleleft;", 17, 3, "\xe2\x8a\xb2" },
+    { "&rarrfs;", 8, 3, "\xe2\xa4\x9e" },
+    { "&rcy;", 5, 2, "\xd1\x80" },
+    { "&conint;", 8, 3, "\xe2\x88\xae" },
+    { "&pfr;", 5, 4, "\xf0\x9d\x94\xad" },
+    { "&lneqq;", 7, 3, "\xe2\x89\xa8" },
+    { "&Lsh;", 5, 3, "\xe2\x86\xb0" },
+    { "&xhArr;", 7, 3, "\xe2\x9f\xba" },
+    { "&gtcir;", 7, 3, "\xe2\xa9\xba" },
+    { "&Gscr;", 6, 4, "\xf0\x9d\x92\xa2" },
+    { "&NotTildeTilde;", 15, 3, "\xe2\x89\x89" },
+    { "&divideontimes;", 15, 3, "\xe2\x8b\x87" },
+    { "&frac45;", 8, 3, "\xe2\x85\x98" },
+    { "&centerdot;", 11, 2, "\xc2\xb7" },
+    { "&GreaterGreater;", 16, 3, "\xe2\xaa\xa2" },
+    { "&Odblac;", 8, 2, "\xc5\x90" },
+    { "&boxDL;", 7, 3, "\xe2\x95\x97" },
+    { "&nwArr;", 7, 3, "\xe2\x87\x96" },
+    { "&equiv;", 7, 3, "\xe2\x89\xa1" },
+    { "&DiacriticalGrave;", 18, 1, "\x60" },
+    { "&notinE;", 8, 5, "\xe2\x8b\xb9\xcc\xb8" },
+    { "&mlcp;", 6, 3, "\xe2\xab\x9b" },
+    { "&RightArrowBar;", 15, 3, "\xe2\x87\xa5" },
+    { "&Scedil;", 8, 2, "\xc5\x9e" },
+    { "&mho;", 5, 3, "\xe2\x84\xa7" },
+    { "&there4;", 8, 3, "\xe2\x88\xb4" },
+    { "&rAtail;", 8, 3, "\xe2\xa4\x9c" },
+    { "&intercal;", 10, 3, "\xe2\x8a\xba" },
+    { "&sqcap;", 7, 3, "\xe2\x8a\x93" },
+    { "&curren;", 8, 2, "\xc2\xa4" },
+    { "&Int;", 5, 3, "\xe2\x88\xac" },
+    { "&Pi;", 4, 2, "\xce\xa0" },
+    { "&gbreve;", 8, 2, "\xc4\x9f" },
+    { "&Intersection;", 14, 3, "\xe2\x8b\x82" },
+    { "&cupor;", 7, 3, "\xe2\xa9\x85" },
+    { "&xcap;", 6, 3, "\xe2\x8b\x82" },
+    { "&thicksim;", 10, 3, "\xe2\x88\xbc" },
+    { "&vee;", 5, 3, "\xe2\x88\xa8" },
+    { "&cuvee;", 7, 3, "\xe2\x8b\x8e" },
+    { "&zeta;", 6, 2, "\xce\xb6" },
+    { "&simg;", 6, 3, "\xe2\xaa\x9e" },
+    { "&angzarr;", 9, 3, "\xe2\x8d\xbc" },
+    { "&hkswarow;", 10, 3, "\xe2\xa4\xa6" },
+    { "&HumpEqual;", 11, 3, "\xe2\x89\x8f" },
+    { "&hbar;", 6, 3, "\xe2\x84\x8f" },
+    { "&spar;", 6, 3, "\xe2\x88\xa5" },
+    { "&boxdR;", 7, 3, "\xe2\x95\x92" },
+    { "&Zcy;", 5, 2, "\xd0\x97" },
+    { "&precneqq;", 10, 3, "\xe2\xaa\xb5" },
+    { "&andand;", 8, 3, "\xe2\xa9\x95" },
+    { "&angle;", 7, 3, "\xe2\x88\xa0" },
+    { "&circledS;", 10, 3, "\xe2\x93\x88" },
+    { "&preceq;", 8, 3, "\xe2\xaa\xaf" },
+    { "&lobrk;", 7, 3, "\xe2\x9f\xa6" },
+    { "&DiacriticalDoubleAcute;", 24, 2, "\xcb\x9d" },
+    { "&lpar;", 6, 1, "\x28" },
+    { "&Precedes;", 10, 3, "\xe2\x89\xba" },
+    { "&Lleftarrow;", 12, 3, "\xe2\x87\x9a" },
+    { "&Bopf;", 6, 4, "\xf0\x9d\x94\xb9" },
+    { "&ThinSpace;", 11, 3, "\xe2\x80\x89" },
+    { "&backsim;", 9, 3, "\xe2\x88\xbd" },
+    { "&gfr;", 5, 4, "\xf0\x9d\x94\xa4" },
+    { "&die;", 5, 2, "\xc2\xa8" },
+    { "&Longrightarrow;", 16, 3, "\xe2\x9f\xb9" },
+    { "&nless;", 7, 3, "\xe2\x89\xae" },
+    { "&HARDcy;", 8, 2, "\xd0\xaa" },
+    { "&supsetneq;", 11, 3, "\xe2\x8a\x8b" },
+    { "&bigotimes;", 11, 3, "\xe2\xa8\x82" },
+    { "&lozf;", 6, 3, "\xe2\xa7\xab" },
+    { "&Aogon;", 7, 2, "\xc4\x84" },
+    { "&emsp;", 6, 3, "\xe2\x80\x83" },
+    { "&bdquo;", 7, 3, "\xe2\x80\x9e" },
+    { "&bigwedge;", 10, 3, "\xe2\x8b\x80" },
+    { "&cacute;", 8, 2, "\xc4\x87" },
+    { "&capand;", 8, 3, "\xe2\xa9\x84" },
+    { "&xuplus;", 8, 3, "\xe2\xa8\x84" },
+    { "&lne;", 5, 3, "\xe2\xaa\x87" },
+    { "&zeetrf;", 8, 3, "\xe2\x84\xa8" },
+    { "&ltimes;", 8, 3, "\xe2\x8b\x89" },
+    { "&efDot;", 7, 3, "\xe2\x89\x92" },
+    { "&euml;", 6, 2, "\xc3\xab" },
+    { "&parallel;", 10, 3, "\xe2\x88\xa5" },
+    { "&DownArrow;", 11, 3, "\xe2\x86\x93" },
+    { "&SHCHcy;", 8, 2, "\xd0\xa9" },
+    { "&RoundImplies;", 14, 3, "\xe2\xa5\xb0" },
+    { "&imagpart;", 10, 3, "\xe2\x84\x91" },
+    { "&biguplus;", 10, 3, "\xe2\xa8\x84" },
+    { "&Assign;", 8, 3, "\xe2\x89\x94" },
+    { "&Qopf;", 6, 3, "\xe2\x84\x9a" },
+    { "&LeftTriangleEqual;", 19, 3, "\xe2\x8a\xb4" },
+    { "&thinsp;", 8, 3, "\xe2\x80\x89" },
+    { "&oror;", 6, 3, "\xe2\xa9\x96" },
+    { "&RightDownVector;", 17, 3, "\xe2\x87\x82" },
+    { "&fllig;", 7, 3, "\xef\xac\x82" },
+    { "&Nopf;", 6, 3, "\xe2\x84\x95" },
+    { "&Euml;", 6, 2, "\xc3\x8b" },
+    { "&jcy;", 5, 2, "\xd0\xb9" },
+    { "&bcy;", 5, 2, "\xd0\xb1" },
+    { "&lowast;", 8, 3, "\xe2\x88\x97" },
+    { "&supplus;", 9, 3, "\xe2\xab\x80" },
+    { "&veebar;", 8, 3, "\xe2\x8a\xbb" },
+    { "&mscr;", 6, 4, "\xf0\x9d\x93\x82" },
+    { "&Copf;", 6, 3, "\xe2\x84\x82" },
+    { "&rfisht;", 8, 3, "\xe2\xa5\xbd" },
+    { "&Sopf;", 6, 4, "\xf0\x9d\x95\x8a" },
+    { "&awconint;", 10, 3, "\xe2\x88\xb3" },
+    { "&sfr;", 5, 4, "\xf0\x9d\x94\xb0" },
+    { "&mcomma;", 8, 3, "\xe2\xa8\xa9" },
+    { "&checkmark;", 11, 3, "\xe2\x9c\x93" },
+    { "&lharu;", 7, 3, "\xe2\x86\xbc" },
+    { "&equals;", 8, 1, "\x3d" },
+    { "&para;", 6, 2, "\xc2\xb6" },
+    { "&lAarr;", 7, 3, "\xe2\x87\x9a" },
+    { "&ograve;", 8, 2, "\xc3\xb2" },
+    { "&ccups;", 7, 3, "\xe2\xa9\x8c" },
+    { "&tfr;", 5, 4, "\xf0\x9d\x94\xb1" },
+    { "&SquareUnion;", 13, 3, "\xe2\x8a\x94" },
+    { "&ccirc;", 7, 2, "\xc4\x89" },
+    { "&caret;", 7, 3, "\xe2\x81\x81" },
+    { "&iquest;", 8, 2, "\xc2\xbf" },
+    { "&risingdotseq;", 14, 3, "\xe2\x89\x93" },
+    { "&succeq;", 8, 3, "\xe2\xaa\xb0" },
+    { "&dfisht;", 8, 3, "\xe2\xa5\xbf" },
+    { "&lnap;", 6, 3, "\xe2\xaa\x89" },
+    { "&UnderBar;", 10, 1, "\x5f" },
+    { "&DownRightVectorBar;", 20, 3, "\xe2\xa5\x97" },
+    { "&cap;", 5, 3, "\xe2\x88\xa9" },
+    { "&barwedge;", 10, 3, "\xe2\x8c\x85" },
+    { "&YIcy;", 6, 2, "\xd0\x87" },
+    { "&hellip;", 8, 3, "\xe2\x80\xa6" },
+    { "&female;", 8, 3, "\xe2\x99\x80" },
+    { "&ntriangleright;", 16, 3, "\xe2\x8b\xab" },
+    { "&Sup;", 5, 3, "\xe2\x8b\x91" },
+    { "&rtri;", 6, 3, "\xe2\x96\xb9" },
+    { "&sigmav;", 8, 2, "\xcf\x82" },
+    { "&dollar;", 8, 1, "\x24" },
+    { "&Rho;", 5, 2, "\xce\xa1" },
+    { "&Mcy;", 5, 2, "\xd0\x9c" },
+    { "&angmsdac;", 10, 3, "\xe2\xa6\xaa" },
+    { "&tridot;", 8, 3, "\xe2\x97\xac" },
+    { "&supmult;", 9, 3, "\xe2\xab\x82" },
+    { "&GreaterEqualLess;", 18, 3, "\xe2\x8b\x9b" },
+    { "&leftharpoonup;", 15, 3, "\xe2\x86\xbc" },
+    { "&hopf;", 6, 4, "\xf0\x9d\x95\x99" },
+    { "&Rsh;", 5, 3, "\xe2\x86\xb1" },
+    { "&Supset;", 8, 3, "\xe2\x8b\x91" },
+    { "&ljcy;", 6, 2, "\xd1\x99" },
+    { "&hoarr;", 7, 3, "\xe2\x87\xbf" },
+    { "&eg;", 4, 3, "\xe2\xaa\x9a" },
+    { "&puncsp;", 8, 3, "\xe2\x80\x88" },
+    { "&ngE;", 5, 5, "\xe2\x89\xa7\xcc\xb8" },
+    { "&sce;", 5, 3, "\xe2\xaa\xb0" },
+    { "&minusb;", 8, 3, "\xe2\x8a\x9f" },
+    { "&cross;", 7, 3, "\xe2\x9c\x97" },
+    { "&Lcy;", 5, 2, "\xd0\x9b" },
+    { "&sccue;", 7, 3, "\xe2\x89\xbd" },
+    { "&gopf;", 6, 4, "\xf0\x9d\x95\x98" },
+    { "&LeftTriangleBar;", 17, 3, "\xe2\xa7\x8f" },
+    { "&sim;", 5, 3, "\xe2\x88\xbc" },
+    { "&ThickSpace;", 12, 6, "\xe2\x81\x9f\xe2\x80\x8a" },
+    { "&Wcirc;", 7, 2, "\xc5\xb4" },
+    { "&NotRightTriangleBar;", 21, 5, "\xe2\xa7\x90\xcc\xb8" },
+    { "&ominus;", 8, 3, "\xe2\x8a\x96" },
+    { "&cwconint;", 10, 3, "\xe2\x88\xb2" },
+    { "&rmoust;", 8, 3, "\xe2\x8e\xb1" },
+    { "&af;", 4, 3, "\xe2\x81\xa1" },
+    { "&Cacute;", 8, 2, "\xc4\x86" },
+    { "&thetav;", 8, 2, "\xcf\x91" },
+    { "&NegativeThickSpace;", 20, 3, "\xe2\x80\x8b" },
+    { "&rcedil;", 8, 2, "\xc5\x97" },
+    { "&nGt;", 5, 6, "\xe2\x89\xab\xe2\x83\x92" },
+    { "&topf;", 6, 4, "\xf0\x9d\x95\xa5" },
+    { "&sqsube;", 8, 3, "\xe2\x8a\x91" },
+    { "&Beta;", 6, 2, "\xce\x92" },
+    { "&therefore;", 11, 3, "\xe2\x88\xb4" },
+    { "&lgE;", 5, 3, "\xe2\xaa\x91" },
+    { "&NotVerticalBar;", 16, 3, "\xe2\x88\xa4" },
+    { "&TSHcy;", 7, 2, "\xd0\x8b" },
+    { "&acute;", 7, 2, "\xc2\xb4" },
+    { "&SOFTcy;", 8, 2, "\xd0\xac" },
+    { "&UpperLeftArrow;", 16, 3, "\xe2\x86\x96" },
+    { "&trisb;", 7, 3, "\xe2\xa7\x8d" },
+    { "&boxtimes;", 10, 3, "\xe2\x8a\xa0" },
+    { "&KHcy;", 6, 2, "\xd0\xa5" },
+    { "&supsub;", 8, 3, "\xe2\xab\x94" },
+    { "&rAarr;", 7, 3, "\xe2\x87\x9b" },
+    { "&Ccaron;", 8, 2, "\xc4\x8c" },
+    { "&Qscr;", 6, 4, "\xf0\x9d\x92\xac" },
+    { "&LeftDownVectorBar;", 19, 3, "\xe2\xa5\x99" },
+    { "&afr;", 5, 4, "\xf0\x9d\x94\x9e" },
+    { "&xrArr;", 7, 3, "\xe2\x9f\xb9" },
+    { "&NotGreaterLess;", 16, 3, "\xe2\x89\xb9" },
+    { "&kcedil;", 8, 2, "\xc4\xb7" },
+    { "&nsimeq;", 8, 3, "\xe2\x89\x84" },
+    { "&multimap;", 10, 3, "\xe2\x8a\xb8" },
+    { "&Iacute;", 8, 2, "\xc3\x8d" },
+    { "&bnequiv;", 9, 6, "\xe2\x89\xa1\xe2\x83\xa5" },
+    { "&Zfr;", 5, 3, "\xe2\x84\xa8" },
+    { "&lesseqqgtr;", 12, 3, "\xe2\xaa\x8b" },
+    { "&pm;", 4, 2, "\xc2\xb1" },
+    { "&urcorn;", 8, 3, "\xe2\x8c\x9d" },
+    { "&nvrtrie;", 9, 6, "\xe2\x8a\xb5\xe2\x83\x92" },
+    { "&ntrianglelefteq;", 17, 3, "\xe2\x8b\xac" },
+    { "&demptyv;", 9, 3, "\xe2\xa6\xb1" },
+    { "&succcurlyeq;", 13, 3, "\xe2\x89\xbd" },
+    { "&yfr;", 5, 4, "\xf0\x9d\x94\xb6" },
+    { "&Equal;", 7, 3, "\xe2\xa9\xb5" },
+    { "&deg;", 5, 2, "\xc2\xb0" },
+    { "&qint;", 6, 3, "\xe2\xa8\x8c" },
+    { "&sext;", 6, 3, "\xe2\x9c\xb6" },
+    { "&zdot;", 6, 2, "\xc5\xbc" },
+    { "&RightArrowLeftArrow;", 21, 3, "\xe2\x87\x84" },
+    { "&boxVh;", 7, 3, "\xe2\x95\xab" },
+    { "&szlig;", 7, 2, "\xc3\x9f" },
+    { "&thkap;", 7, 3, "\xe2\x89\x88" },
+    { "&lsquo;", 7, 3, "\xe2\x80\x98" },
+    { "&Acy;", 5, 2, "\xd0\x90" },
+    { "&telrec;", 8, 3, "\xe2\x8c\x95" },
+    { "&Square;", 8, 3, "\xe2\x96\xa1" },
+    { "&plusdu;", 8, 3, "\xe2\xa8\xa5" },
+    { "&hcirc;", 7, 2, "\xc4\xa5" },
+    { "&varphi;", 8, 2, "\xcf\x95" },
+    { "&Eopf;", 6, 4, "\xf0\x9d\x94\xbc" },
+    { "&Wfr;", 5, 4, "\xf0\x9d\x94\x9a" },
+    { "&Ccirc;", 7, 2, "\xc4\x88" },
+    { "&darr;", 6, 3, "\xe2\x86\x93" },
+    { "&DownTeeArrow;", 14, 3, "\xe2\x86\xa7" },
+    { "&THORN;", 7, 2, "\xc3\x9e" },
+    { "&larr;", 6, 3, "\xe2\x86\x90" },
+    { "&boxDR;", 7, 3, "\xe2\x95\x94" },
+    { "&rtriltri;", 10, 3, "\xe2\xa7\x8e" },
+    { "&elinters;", 10, 3, "\xe2\x8f\xa7" },
+    { "&Integral;", 10, 3, "\xe2\x88\xab" },
+    { "&UpEquilibrium;", 15, 3, "\xe2\xa5\xae" },
+    { "&Oopf;", 6, 4, "\xf0\x9d\x95\x86" },
+    { "&Ll;", 4, 3, "\xe2\x8b\x98" },
+    { "&varsubsetneq;", 14, 6, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "&prec;", 6, 3, "\xe2\x89\xba" },
+    { "&rbarr;", 7, 3, "\xe2\xa4\x8d" },
+    { "&rbrke;", 7, 3, "\xe2\xa6\x8c" },
+    { "&measuredangle;", 15, 3, "\xe2\x88\xa1" },
+    { "&ubrcy;", 7, 2, "\xd1\x9e" },
+    { "&rlm;", 5, 3, "\xe2\x80\x8f" },
+    { "&Kscr;", 6, 4, "\xf0\x9d\x92\xa6" },
+    { "&RightDownVectorBar;", 20, 3, "\xe2\xa5\x95" },
+    { "&Tilde;", 7, 3, "\xe2\x88\xbc" },
+    { "&ncongdot;", 10, 5, "\xe2\xa9\xad\xcc\xb8" },
+    { "&shcy;", 6, 2, "\xd1\x88" },
+    { "&nwnear;", 8, 3, "\xe2\xa4\xa7" },
+    { "&lbrke;", 7, 3, "\xe2\xa6\x8b" },
+    { "&Zeta;", 6, 2, "\xce\x96" },
+    { "&rsquo;", 7, 3, "\xe2\x80\x99" },
+    { "&ldquo;", 7, 3, "\xe2\x80\x9c" },
+    { "&lEg;", 5, 3, "\xe2\xaa\x8b" },
+    { "&natural;", 9, 3, "\xe2\x99\xae" },
+    { "&origof;", 8, 3, "\xe2\x8a\xb6" },
+    { "&cudarrr;", 9, 3, "\xe2\xa4\xb5" },
+    { "&NotGreaterTilde;", 17, 3, "\xe2\x89\xb5" },
+    { "&NotLeftTriangleEqual;", 22, 3, "\xe2\x8b\xac" },
+    { "&lbrack;", 8, 1, "\x5b" },
+    { "&sum;", 5, 3, "\xe2\x88\x91" },
+    { "&boxvr;", 7, 3, "\xe2\x94\x9c" },
+    { "&vellip;", 8, 3, "\xe2\x8b\xae" },
+    { "&rarrw;", 7, 3, "\xe2\x86\x9d" },
+    { "&bigstar;", 9, 3, "\xe2\x98\x85" },
+    { "&gg;", 4, 3, "\xe2\x89\xab" },
+    { "&Mellintrf;", 11, 3, "\xe2\x84\xb3" },
+    { "&bigtriangledown;", 17, 3, "\xe2\x96\xbd" },
+    { "&GJcy;", 6, 2, "\xd0\x83" },
+    { "&odot;", 6, 3, "\xe2\x8a\x99" },
+    { "&dtrif;", 7, 3, "\xe2\x96\xbe" },
+    { "&dcy;", 5, 2, "\xd0\xb4" },
+    { "&gsim;", 6, 3, "\xe2\x89\xb3" },
+    { "&apos;", 6, 1, "\x27" },
+    { "&NotEqual;", 10, 3, "\xe2\x89\xa0" },
+    { "&lltri;", 7, 3, "\xe2\x97\xba" },
+    { "&bernou;", 8, 3, "\xe2\x84\xac" },
+    { "&Leftarrow;", 11, 3, "\xe2\x87\x90" },
+    { "&lrarr;", 7, 3, "\xe2\x87\x86" },
+    { "&ZeroWidthSpace;", 16, 3, "\xe2\x80\x8b" },
+    { "&erDot;", 7, 3, "\xe2\x89\x93" },
+    { "&triangleright;", 15, 3, "\xe2\x96\xb9" },
+    { "&HumpDownHump;", 14, 3, "\xe2\x89\x8e" },
+    { "&mapsto;", 8, 3, "\xe2\x86\xa6" },
+    { "&numsp;", 7, 3, "\xe2\x80\x87" },
+    { "&jsercy;", 8, 2, "\xd1\x98" },
+    { "&nvlArr;", 8, 3, "\xe2\xa4\x82" },
+    { "&Ofr;", 5, 4, "\xf0\x9d\x94\x92" },
+    { "&gvertneqq;", 11, 6, "\xe2\x89\xa9\xef\xb8\x80" },
+    { "&jmath;", 7, 2, "\xc8\xb7" },
+    { "&Hfr;", 5, 3, "\xe2\x84\x8c" },
+    { "&disin;", 7, 3, "\xe2\x8b\xb2" },
+    { "&mstpos;", 8, 3, "\xe2\x88\xbe" },
+    { "&egsdot;", 8, 3, "\xe2\xaa\x98" },
+    { "&iiota;", 7, 3, "\xe2\x84\xa9" },
+    { "&iiiint;", 8, 3, "\xe2\xa8\x8c" },
+    { "&nsime;", 7, 3, "\xe2\x89\x84" },
+    { "&ctdot;", 7, 3, "\xe2\x8b\xaf" },
+    { "&cirscir;", 9, 3, "\xe2\xa7\x82" },
+    { "&Chi;", 5, 2, "\xce\xa7" },
+    { "&num;", 5, 1, "\x23" },
+    { "&hyphen;", 8, 3, "\xe2\x80\x90" },
+    { "&emsp13;", 8, 3, "\xe2\x80\x84" },
+    { "&vzigzag;", 9, 3, "\xe2\xa6\x9a" },
+    { "&lnsim;", 7, 3, "\xe2\x8b\xa6" },
+    { "&rect;", 6, 3, "\xe2\x96\xad" },
+    { "&DJcy;", 6, 2, "\xd0\x82" },
+    { "&RightTriangleEqual;", 20, 3, "\xe2\x8a\xb5" },
+    { "&edot;", 6, 2, "\xc4\x97" },
+    { "&propto;", 8, 3, "\xe2\x88\x9d" },
+    { "&Amacr;", 7, 2, "\xc4\x80" },
+    { "&reals;", 7, 3, "\xe2\x84\x9d" },
+    { "&Lang;", 6, 3, "\xe2\x9f\xaa" },
+    { "&Wscr;", 6, 4, "\xf0\x9d\x92\xb2" },
+    { "&robrk;", 7, 3, "\xe2\x9f\xa7" },
+    { "&Yopf;", 6, 4, "\xf0\x9d\x95\x90" },
+    { "&Hacek;", 7, 2, "\xcb\x87" },
+    { "&rightarrow;", 12, 3, "\xe2\x86\x92" },
+    { "&nleqslant;", 11, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&fltns;", 7, 3, "\xe2\x96\xb1" },
+    { "&Pr;", 4, 3, "\xe2\xaa\xbb" },
+    { "&blk34;", 7, 3, "\xe2\x96\x93" },
+    { "&nscr;", 6, 4, "\xf0\x9d\x93\x83" },
+    { "&SquareIntersection;", 20, 3, "\xe2\x8a\x93" },
+    { "&isin;", 6, 3, "\xe2\x88\x88" },
+    { "&hybull;", 8, 3, "\xe2\x81\x83" },
+    { "&frasl;", 7, 3, "\xe2\x81\x84" },
+    { "&NotNestedGreaterGreater;", 25, 5, "\xe2\xaa\xa2\xcc\xb8" },
+    { "&siml;", 6, 3, "\xe2\xaa\x9d" },
+    { "&yen;", 5, 2, "\xc2\xa5" },
+    { "&wedbar;", 8, 3, "\xe2\xa9\x9f" },
+    { "&tau;", 5, 2, "\xcf\x84" },
+    { "&eparsl;", 8, 3, "\xe2\xa7\xa3" },
+    { "&rsaquo;", 8, 3, "\xe2\x80\xba" },
+    { "&OverBrace;", 11, 3, "\xe2\x8f\x9e" },
+    { "&sime;", 6, 3, "\xe2\x89\x83" },
+    { "&Lacute;", 8, 2, "\xc4\xb9" },
+    { "&lesdotor;", 10, 3, "\xe2\xaa\x83" },
+    { "&EmptyVerySmallSquare;", 22, 3, "\xe2\x96\xab" },
+    { "&Colon;", 7, 3, "\xe2\x88\xb7" },
+    { "&dotminus;", 10, 3, "\xe2\x88\xb8" },
+    { "&wr;", 4, 3, "\xe2\x89\x80" },
+    { "&precsim;", 9, 3, "\xe2\x89\xbe" },
+    { "&oslash;", 8, 2, "\xc3\xb8" },
+    { "&eqvparsl;", 10, 3, "\xe2\xa7\xa5" },
+    { "&rdldhar;", 9, 3, "\xe2\xa5\xa9" },
+    { "&ldrdhar;", 9, 3, "\xe2\xa5\xa7" },
+    { "&Not;", 5, 3, "\xe2\xab\xac" },
+    { "&nleqq;", 7, 5, "\xe2\x89\xa6\xcc\xb8" },
+    { "&scnE;", 6, 3, "\xe2\xaa\xb6" },
+    { "&verbar;", 8, 1, "\x7c" },
+    { "&RightAngleBracket;", 19, 3, "\xe2\x9f\xa9" },
+    { "&dopf;", 6, 4, "\xf0\x9d\x95\x95" },
+    { "&Xopf;", 6, 4, "\xf0\x9d\x95\x8f" },
+    { "&Barwed;", 8, 3, "\xe2\x8c\x86" },
+    { "&ShortLeftArrow;", 16, 3, "\xe2\x86\x90" },
+    { "&kgreen;", 8, 2, "\xc4\xb8" },
+    { "&NegativeMediumSpace;", 21, 3, "\xe2\x80\x8b" },
+    { "&Hscr;", 6, 3, "\xe2\x84\x8b" },
+    { "&gtrless;", 9, 3, "\xe2\x89\xb7" },
+    { "&uhblk;", 7, 3, "\xe2\x96\x80" },
+    { "&succnapprox;", 13, 3, "\xe2\xaa\xba" },
+    { "&varpropto;", 11, 3, "\xe2\x88\x9d" },
+    { "&ubreve;", 8, 2, "\xc5\xad" },
+    { "&alpha;", 7, 2, "\xce\xb1" },
+    { "&RightUpTeeVector;", 18, 3, "\xe2\xa5\x9c" },
+    { "&sc;", 4, 3, "\xe2\x89\xbb" },
+    { "&Dopf;", 6, 4, "\xf0\x9d\x94\xbb" },
+    { "&primes;", 8, 3, "\xe2\x84\x99" },
+    { "&frac35;", 8, 3, "\xe2\x85\x97" },
+    { "&subnE;", 7, 3, "\xe2\xab\x8b" },
+    { "&LessGreater;", 13, 3, "\xe2\x89\xb6" },
+    { "&lotimes;", 9, 3, "\xe2\xa8\xb4" },
+    { "&NotSquareSuperset;", 19, 5, "\xe2\x8a\x90\xcc\xb8" },
+    { "&Fopf;", 6, 4, "\xf0\x9d\x94\xbd" },
+    { "&simdot;", 8, 3, "\xe2\xa9\xaa" },
+    { "&clubs;", 7, 3, "\xe2\x99\xa3" },
+    { "&bbrk;", 6, 3, "\xe2\x8e\xb5" },
+    { "&ruluhar;", 9, 3, "\xe2\xa5\xa8" },
+    { "&Ugrave;", 8, 2, "\xc3\x99" },
+    { "&lcaron;", 8, 2, "\xc4\xbe" },
+    { "&mapstoup;", 10, 3, "\xe2\x86\xa5" },
+    { "&complexes;", 11, 3, "\xe2\x84\x82" },
+    { "&oast;", 6, 3, "\xe2\x8a\x9b" },
+    { "&nsccue;", 8, 3, "\xe2\x8b\xa1" },
+    { "&vprop;", 7, 3, "\xe2\x88\x9d" },
+    { "&blk14;", 7, 3, "\xe2\x96\x91" },
+    { "&rightleftarrows;", 17, 3, "\xe2\x87\x84" },
+    { "&rarrpl;", 8, 3, "\xe2\xa5\x85" },
+    { "&Rcy;", 5, 2, "\xd0\xa0" },
+    { "&twoheadleftarrow;", 18, 3, "\xe2\x86\x9e" },
+    { "&quatint;", 9, 3, "\xe2\xa8\x96" },
+    { "&horbar;", 8, 3, "\xe2\x80\x95" },
+    { "&complement;", 12, 3, "\xe2\x88\x81" },
+    { "&Union;", 7, 3, "\xe2\x8b\x83" },
+    { "&isinE;", 7, 3, "\xe2\x8b\xb9" },
+    { "&geq;", 5, 3, "\xe2\x89\xa5" },
+    { "&subdot;", 8, 3, "\xe2\xaa\xbd" },
+    { "&notin;", 7, 3, "\xe2\x88\x89" },
+    { "&nrtrie;", 8, 3, "\xe2\x8b\xad" },
+    { "&pluse;", 7, 3, "\xe2\xa9\xb2" },
+    { "&expectation;", 13, 3, "\xe2\x84\xb0" },
+    { "&Tcaron;", 8, 2, "\xc5\xa4" },
+    { "&latail;", 8, 3, "\xe2\xa4\x99" },
+    { "&dfr;", 5, 4, "\xf0\x9d\x94\xa1" },
+    { "&simlE;", 7, 3, "\xe2\xaa\x9f" },
+    { "&Psi;", 5, 2, "\xce\xa8" },
+    { "&apid;", 6, 3, "\xe2\x89\x8b" },
+    { "&lmidot;", 8, 2, "\xc5\x80" },
+    { "&downdownarrows;", 16, 3, "\xe2\x87\x8a" },
+    { "&Yfr;", 5, 4, "\xf0\x9d\x94\x9c" },
+    { "&dash;", 6, 3, "\xe2\x80\x90" },
+    { "&LeftTeeVector;", 15, 3, "\xe2\xa5\x9a" },
+    { "&div;", 5, 2, "\xc3\xb7" },
+    { "&TildeTilde;", 12, 3, "\xe2\x89\x88" },
+    { "&timesb;", 8, 3, "\xe2\x8a\xa0" },
+    { "&LeftRightArrow;", 16, 3, "\xe2\x86\x94" },
+    { "&comp;", 6, 3, "\xe2\x88\x81" },
+    { "&ncup;", 6, 3, "\xe2\xa9\x82" },
+    { "&uogon;", 7, 2, "\xc5\xb3" },
+    { "&lurdshar;", 10, 3, "\xe2\xa5\x8a" },
+    { "&bumpE;", 7, 3, "\xe2\xaa\xae" },
+    { "&supdot;", 8, 3, "\xe2\xaa\xbe" },
+    { "&CircleDot;", 11, 3, "\xe2\x8a\x99" },
+    { "&PartialD;", 10, 3, "\xe2\x88\x82" },
+    { "&mnplus;", 8, 3, "\xe2\x88\x93" },
+    { "&parsim;", 8, 3, "\xe2\xab\xb3" },
+    { "&imath;", 7, 2, "\xc4\xb1" },
+    { "&subrarr;", 9, 3, "\xe2\xa5\xb9" },
+    { "&Jcirc;", 7, 2, "\xc4\xb4" },
+    { "&TildeEqual;", 12, 3, "\xe2\x89\x83" },
+    { "&le;", 4, 3, "\xe2\x89\xa4" },
+    { "&DoubleDot;", 11, 2, "\xc2\xa8" },
+    { "&cuepr;", 7, 3, "\xe2\x8b\x9e" },
+    { "&GreaterFullEqual;", 18, 3, "\xe2\x89\xa7" },
+    { "&notindot;", 10, 5, "\xe2\x8b\xb5\xcc\xb8" },
+    { "&scpolint;", 10, 3, "\xe2\xa8\x93" },
+    { "&nge;", 5, 3, "\xe2\x89\xb1" },
+    { "&smashp;", 8, 3, "\xe2\xa8\xb3" },
+    { "&tprime;", 8, 3, "\xe2\x80\xb4" },
+    { "&bigvee;", 8, 3, "\xe2\x8b\x81" },
+    { "&SmallCircle;", 13, 3, "\xe2\x88\x98" },
+    { "&prurel;", 8, 3, "\xe2\x8a\xb0" },
+    { "&tcy;", 5, 2, "\xd1\x82" },
+    { "&LeftAngleBracket;", 18, 3, "\xe2\x9f\xa8" },
+    { "&boxplus;", 9, 3, "\xe2\x8a\x9e" },
+    { "&dArr;", 6, 3, "\xe2\x87\x93" },
+    { "&nleq;", 6, 3, "\xe2\x89\xb0" },
+    { "&simplus;", 9, 3, "\xe2\xa8\xa4" },
+    { "&el;", 4, 3, "\xe2\xaa\x99" },
+    { "&star;", 6, 3, "\xe2\x98\x86" },
+    { "&YAcy;", 6, 2, "\xd0\xaf" },
+    { "&lparlt;", 8, 3, "\xe2\xa6\x93" },
+    { "&sacute;", 8, 2, "\xc5\x9b" },
+    { "&strns;", 7, 2, "\xc2\xaf" },
+    { "&boxUl;", 7, 3, "\xe2\x95\x9c" },
+    { "&lambda;", 8, 2, "\xce\xbb" },
+    { "&NegativeThinSpace;", 19, 3, "\xe2\x80\x8b" },
+    { "&larrhk;", 8, 3, "\xe2\x86\xa9" },
+    { "&utilde;", 8, 2, "\xc5\xa9" },
+    { "&lbrace;", 8, 1, "\x7b" },
+    { "&eqslantgtr;", 12, 3, "\xe2\xaa\x96" },
+    { "&Dscr;", 6, 4, "\xf0\x9d\x92\x9f" },
+    { "&rdsh;", 6, 3, "\xe2\x86\xb3" },
+    { "&Hopf;", 6, 3, "\xe2\x84\x8d" },
+    { "&EmptySmallSquare;", 18, 3, "\xe2\x97\xbb" },
+    { "&xnis;", 6, 3, "\xe2\x8b\xbb" },
+    { "&plusdo;", 8, 3, "\xe2\x88\x94" },
+    { "&rarrhk;", 8, 3, "\xe2\x86\xaa" },
+    { "&Mscr;", 6, 3, "\xe2\x84\xb3" },
+    { "&shortmid;", 10, 3, "\xe2\x88\xa3" },
+    { "&nequiv;", 8, 3, "\xe2\x89\xa2" },
+    { "&njcy;", 6, 2, "\xd1\x9a" },
+    { "&rsh;", 5, 3, "\xe2\x86\xb1" },
+    { "&varnothing;", 12, 3, "\xe2\x88\x85" },
+    { "&piv;", 5, 2, "\xcf\x96" },
+    { "&NotLeftTriangleBar;", 20, 5, "\xe2\xa7\x8f\xcc\xb8" },
+    { "&mdash;", 7, 3, "\xe2\x80\x94" },
+    { "&pr;", 4, 3, "\xe2\x89\xba" },
+    { "&Implies;", 9, 3, "\xe2\x87\x92" },
+    { "&ges;", 5, 3, "\xe2\xa9\xbe" },
+    { "&because;", 9, 3, "\xe2\x88\xb5" },
+    { "&drcrop;", 8, 3, "\xe2\x8c\x8c" },
+    { "&DownArrowBar;", 14, 3, "\xe2\xa4\x93" },
+    { "&lE;", 4, 3, "\xe2\x89\xa6" },
+    { "&gnE;", 5, 3, "\xe2\x89\xa9" },
+    { "&boxHU;", 7, 3, "\xe2\x95\xa9" },
+    { "&apE;", 5, 3, "\xe2\xa9\xb0" },
+    { "&frac12;", 8, 2, "\xc2\xbd" },
+    { "&lang;", 6, 3, "\xe2\x9f\xa8" },
+    { "&nRightarrow;", 13, 3, "\xe2\x87\x8f" },
+    { "&subsub;", 8, 3, "\xe2\xab\x95" },
+    { "&bfr;", 5, 4, "\xf0\x9d\x94\x9f" },
+    { "&leftharpoondown;", 17, 3, "\xe2\x86\xbd" },
+    { "&cirmid;", 8, 3, "\xe2\xab\xaf" },
+    { "&rmoustache;", 12, 3, "\xe2\x8e\xb1" },
+    { "&nvgt;", 6, 4, "\x3e\xe2\x83\x92" },
+    { "&plusmn;", 8, 2, "\xc2\xb1" },
+    { "&FilledSmallSquare;", 19, 3, "\xe2\x97\xbc" },
+    { "&Zcaron;", 8, 2, "\xc5\xbd" },
+    { "&curvearrowright;", 17, 3, "\xe2\x86\xb7" },
+    { "&ltdot;", 7, 3, "\xe2\x8b\x96" },
+    { "&hslash;", 8, 3, "\xe2\x84\x8f" },
+    { "&gtrapprox;", 11, 3, "\xe2\xaa\x86" },
+    { "&frown;", 7, 3, "\xe2\x8c\xa2" },
+    { "&xmap;", 6, 3, "\xe2\x9f\xbc" },
+    { "&ldrushar;", 10, 3, "\xe2\xa5\x8b" },
+    { "&Vert;", 6, 3, "\xe2\x80\x96" },
+    { "&subset;", 8, 3, "\xe2\x8a\x82" },
+    { "&LessFullEqual;", 15, 3, "\xe2\x89\xa6" },
+    { "&scE;", 5, 3, "\xe2\xaa\xb4" },
+    { "&nVdash;", 8, 3, "\xe2\x8a\xae" },
+    { "&urtri;", 7, 3, "\xe2\x97\xb9" },
+    { "&boxvR;", 7, 3, "\xe2\x95\x9e" },
+    { "&supne;", 7, 3, "\xe2\x8a\x8b" },
+    { "&plustwo;", 9, 3, "\xe2\xa8\xa7" },
+    { "&Fouriertrf;", 12, 3, "\xe2\x84\xb1" },
+    { "&mu;", 4, 2, "\xce\xbc" },
+    { "&roang;", 7, 3, "\xe2\x9f\xad" },
+    { "&dscr;", 6, 4, "\xf0\x9d\x92\xb9" },
+    { "&Kcy;", 5, 2, "\xd0\x9a" },
+    { "&nedot;", 7, 5, "\xe2\x89\x90\xcc\xb8" },
+    { "&rrarr;", 7, 3, "\xe2\x87\x89" },
+    { "&emsp14;", 8, 3, "\xe2\x80\x85" },
+    { "&auml;", 6, 2, "\xc3\xa4" },
+    { "&lcedil;", 8, 2, "\xc4\xbc" },
+    { "&LeftArrowBar;", 14, 3, "\xe2\x87\xa4" },
+    { "&Kfr;", 5, 4, "\xf0\x9d\x94\x8e" },
+    { "&Emacr;", 7, 2, "\xc4\x92" },
+    { "&Tcedil;", 8, 2, "\xc5\xa2" },
+    { "&Tau;", 5, 2, "\xce\xa4" },
+    { "&Esim;", 6, 3, "\xe2\xa9\xb3" },
+    { "&Ecy;", 5, 2, "\xd0\xad" },
+    { "&LeftTeeArrow;", 14, 3, "\xe2\x86\xa4" },
+    { "&nsup;", 6, 3, "\xe2\x8a\x85" },
+    { "&subseteqq;", 11, 3, "\xe2\xab\x85" },
+    { "&gEl;", 5, 3, "\xe2\xaa\x8c" },
+    { "&dotplus;", 9, 3, "\xe2\x88\x94" },
+    { "&dotsquare;", 11, 3, "\xe2\x8a\xa1" },
+    { "&LeftVector;", 12, 3, "\xe2\x86\xbc" },
+    { "&triangleleft;", 14, 3, "\xe2\x97\x83" },
+    { "&nsupe;", 7, 3, "\xe2\x8a\x89" },
+    { "&par;", 5, 3, "\xe2\x88\xa5" },
+    { "&xopf;", 6, 4, "\xf0\x9d\x95\xa9" },
+    { "&fopf;", 6, 4, "\xf0\x9d\x95\x97" },
+    { "&ratail;", 8, 3, "\xe2\xa4\x9a" },
+    { "&Atilde;", 8, 2, "\xc3\x83" },
+    { "&cirE;", 6, 3, "\xe2\xa7\x83" },
+    { "&backcong;", 10, 3, "\xe2\x89\x8c" },
+    { "&Zopf;", 6, 3, "\xe2\x84\xa4" },
+    { "&RightTriangle;", 15, 3, "\xe2\x8a\xb3" },
+    { "&between;", 9, 3, "\xe2\x89\xac" },
+    { "&phiv;", 6, 2, "\xcf\x95" },
+    { "&incare;", 8, 3, "\xe2\x84\x85" },
+    { "&iacute;", 8, 2, "\xc3\xad" },
+    { "&lsqb;", 6, 1, "\x5b" },
+    { "&eqcirc;", 8, 3, "\xe2\x89\x96" },
+    { "&sscr;", 6, 4, "\xf0\x9d\x93\x88" },
+    { "&ovbar;", 7, 3, "\xe2\x8c\xbd" },
+    { "&downharpoonright;", 18, 3, "\xe2\x87\x82" },
+    { "&TRADE;", 7, 3, "\xe2\x84\xa2" },
+    { "&and;", 5, 3, "\xe2\x88\xa7" },
+    { "&otimesas;", 10, 3, "\xe2\xa8\xb6" },
+    { "&cularr;", 8, 3, "\xe2\x86\xb6" },
+    { "&lHar;", 6, 3, "\xe2\xa5\xa2" },
+    { "&Longleftrightarrow;", 20, 3, "\xe2\x9f\xba" },
+    { "&neArr;", 7, 3, "\xe2\x87\x97" },
+    { "&heartsuit;", 11, 3, "\xe2\x99\xa5" },
+    { "&Prime;", 7, 3, "\xe2\x80\xb3" },
+    { "&supsup;", 8, 3, "\xe2\xab\x96" },
+    { "&cirfnint;", 10, 3, "\xe2\xa8\x90" },
+    { "&coloneq;", 9, 3, "\xe2\x89\x94" },
+    { "&ecaron;", 8, 2, "\xc4\x9b" },
+    { "&Cscr;", 6, 4, "\xf0\x9d\x92\x9e" },
+    { "&lopar;", 7, 3, "\xe2\xa6\x85" },
+    { "&dd;", 4, 3, "\xe2\x85\x86" },
+    { "&supseteq;", 10, 3, "\xe2\x8a\x87" },
+    { "&Verbar;", 8, 3, "\xe2\x80\x96" },
+    { "&cemptyv;", 9, 3, "\xe2\xa6\xb2" },
+    { "&DifferentialD;", 15, 3, "\xe2\x85\x86" },
+    { "&kfr;", 5, 4, "\xf0\x9d\x94\xa8" },
+    { "&nearr;", 7, 3, "\xe2\x86\x97" },
+    { "&bigcirc;", 9, 3, "\xe2\x97\xaf" },
+    { "&toea;", 6, 3, "\xe2\xa4\xa8" },
+    { "&LeftDoubleBracket;", 19, 3, "\xe2\x9f\xa6" },
+    { "&DoubleLeftTee;", 15, 3, "\xe2\xab\xa4" },
+    { "&larrtl;", 8, 3, "\xe2\x86\xa2" },
+    { "&bkarow;", 8, 3, "\xe2\xa4\x8d" },
+    { "&glj;", 5, 3, "\xe2\xaa\xa4" },
+    { "&Zacute;", 8, 2, "\xc5\xb9" },
+    { "&PrecedesTilde;", 15, 3, "\xe2\x89\xbe" },
+    { "&lscr;", 6, 4, "\xf0\x9d\x93\x81" },
+    { "&Lscr;", 6, 3, "\xe2\x84\x92" },
+    { "&ap;", 4, 3, "\xe2\x89\x88" },
+    { "&CenterDot;", 11, 2, "\xc2\xb7" },
+    { "&iff;", 5, 3, "\xe2\x87\x94" },
+    { "&drcorn;", 8, 3, "\xe2\x8c\x9f" },
+    { "&xharr;", 7, 3, "\xe2\x9f\xb7" },
+    { "&utdot;", 7, 3, "\xe2\x8b\xb0" },
+    { "&rbrksld;", 9, 3, "\xe2\xa6\x8e" },
+    { "&QUOT;", 6, 1, "\x22" },
+    { "&gtquest;", 9, 3, "\xe2\xa9\xbc" },
+    { "&triangledown;", 14, 3, "\xe2\x96\xbf" },
+    { "&csup;", 6, 3, "\xe2\xab\x90" },
+    { "&nLtv;", 6, 5, "\xe2\x89\xaa\xcc\xb8" },
+    { "&squarf;", 8, 3, "\xe2\x96\xaa" },
+    { "&pitchfork;", 11, 3, "\xe2\x8b\x94" },
+    { "&icy;", 5, 2, "\xd0\xb8" },
+    { "&npr;", 5, 3, "\xe2\x8a\x80" },
+    { "&ddarr;", 7, 3, "\xe2\x87\x8a" },
+    { "&thetasym;", 10, 2, "\xcf\x91" },
+    { "&eth;", 5, 2, "\xc3\xb0" },
+    { "&copf;", 6, 4, "\xf0\x9d\x95\x94" },
+    { "&trade;", 7, 3, "\xe2\x84\xa2" },
+    { "&uuarr;", 7, 3, "\xe2\x87\x88" },
+    { "&duhar;", 7, 3, "\xe2\xa5\xaf" },
+    { "&ZHcy;", 6, 2, "\xd0\x96" },
+    { "&ccedil;", 8, 2, "\xc3\xa7" },
+    { "&lesdot;", 8, 3, "\xe2\xa9\xbf" },
+    { "&Acirc;", 7, 2, "\xc3\x82" },
+    { "&intcal;", 8, 3, "\xe2\x8a\xba" },
+    { "&scsim;", 7, 3, "\xe2\x89\xbf" },
+    { "&Ncedil;", 8, 2, "\xc5\x85" },
+    { "&zacute;", 8, 2, "\xc5\xba" },
+    { "&NotSucceedsTilde;", 18, 5, "\xe2\x89\xbf\xcc\xb8" },
+    { "&shortparallel;", 15, 3, "\xe2\x88\xa5" },
+    { "&NotRightTriangle;", 18, 3, "\xe2\x8b\xab" },
+    { "&Lcaron;", 8, 2, "\xc4\xbd" },
+    { "&kjcy;", 6, 2, "\xd1\x9c" },
+    { "&Larr;", 6, 3, "\xe2\x86\x9e" },
+    { "&frac18;", 8, 3, "\xe2\x85\x9b" },
+    { "&EqualTilde;", 12, 3, "\xe2\x89\x82" },
+    { "&ropf;", 6, 4, "\xf0\x9d\x95\xa3" },
+    { "&Uscr;", 6, 4, "\xf0\x9d\x92\xb0" },
+    { "&gtlPar;", 8, 3, "\xe2\xa6\x95" },
+    { "&LeftArrowRightArrow;", 21, 3, "\xe2\x87\x86" },
+    { "&LeftArrow;", 11, 3, "\xe2\x86\x90" },
+    { "&srarr;", 7, 3, "\xe2\x86\x92" },
+    { "&Gcedil;", 8, 2, "\xc4\xa2" },
+    { "&delta;", 7, 2, "\xce\xb4" },
+    { "&epar;", 6, 3, "\xe2\x8b\x95" },
+    { "&sect;", 6, 2, "\xc2\xa7" },
+    { "&plussim;", 9, 3, "\xe2\xa8\xa6" },
+    { "&supsim;", 8, 3, "\xe2\xab\x88" },
+    { "&xsqcup;", 8, 3, "\xe2\xa8\x86" },
+    { "&tcaron;", 8, 2, "\xc5\xa5" },
+    { "&NotSuperset;", 13, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&squf;", 6, 3, "\xe2\x96\xaa" },
+    { "&rBarr;", 7, 3, "\xe2\xa4\x8f" },
+    { "&simeq;", 7, 3, "\xe2\x89\x83" },
+    { "&iopf;", 6, 4, "\xf0\x9d\x95\x9a" },
+    { "&VerticalBar;", 13, 3, "\xe2\x88\xa3" },
+    { "&rtimes;", 8, 3, "\xe2\x8b\x8a" },
+    { "&Lambda;", 8, 2, "\xce\x9b" },
+    { "&DotEqual;", 10, 3, "\xe2\x89\x90" },
+    { "&maltese;", 9, 3, "\xe2\x9c\xa0" },
+    { "&rarrsim;", 9, 3, "\xe2\xa5\xb4" },
+    { "&iuml;", 6, 2, "\xc3\xaf" },
+    { "&Afr;", 5, 4, "\xf0\x9d\x94\x84" },
+    { "&hfr;", 5, 4, "\xf0\x9d\x94\xa5" },
+    { "&smtes;", 7, 6, "\xe2\xaa\xac\xef\xb8\x80" },
+    { "&aacute;", 8, 2, "\xc3\xa1" },
+    { "&rho;", 5, 2, "\xcf\x81" },
+    { "&Edot;", 6, 2, "\xc4\x96" },
+    { "&nles;", 6, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&DoubleRightTee;", 16, 3, "\xe2\x8a\xa8" },
+    { "&hearts;", 8, 3, "\xe2\x99\xa5" },
+    { "&Rarr;", 6, 3, "\xe2\x86\xa0" },
+    { "&Barv;", 6, 3, "\xe2\xab\xa7" },
+    { "&Gopf;", 6, 4, "\xf0\x9d\x94\xbe" },
+    { "&Sigma;", 7, 2, "\xce\xa3" },
+    { "&CloseCurlyDoubleQuote;", 23, 3, "\xe2\x80\x9d" },
+    { "&hookleftarrow;", 15, 3, "\xe2\x86\xa9" },
+    { "&aelig;", 7, 2, "\xc3\xa6" },
+    { "&planckh;", 9, 3, "\xe2\x84\x8e" },
+    { "&imof;", 6, 3, "\xe2\x8a\xb7" },
+    { "&Rcaron;", 8, 2, "\xc5\x98" },
+    { "&Fscr;", 6, 3, "\xe2\x84\xb1" },
+    { "&Iopf;", 6, 4, "\xf0\x9d\x95\x80" },
+    { "&xi;", 4, 2, "\xce\xbe" },
+    { "&cudarrl;", 9, 3, "\xe2\xa4\xb8" },
+    { "&gtreqqless;", 12, 3, "\xe2\xaa\x8c" },
+    { "&DoubleLongLeftRightArrow;", 26, 3, "\xe2\x9f\xba" },
+    { "&lsim;", 6, 3, "\xe2\x89\xb2" },
+    { "&Dot;", 5, 2, "\xc2\xa8" },
+    { "&boxUr;", 7, 3, "\xe2\x95\x99" },
+    { "&ExponentialE;", 14, 3, "\xe2\x85\x87" },
+    { "&jukcy;", 7, 2, "\xd1\x94" },
+    { "&nGtv;", 6, 5, "\xe2\x89\xab\xcc\xb8" },
+    { "&uwangle;", 9, 3, "\xe2\xa6\xa7" },
+    { "&Conint;", 8, 3, "\xe2\x88\xaf" },
+    { "&triminus;", 10, 3, "\xe2\xa8\xba" },
+    { "&thickapprox;", 13, 3, "\xe2\x89\x88" },
+    { "&Downarrow;", 11, 3, "\xe2\x87\x93" },
+    { "&bowtie;", 8, 3, "\xe2\x8b\x88" },
+    { "&lbrksld;", 9, 3, "\xe2\xa6\x8f" },
+    { "&bne;", 5, 4, "\x3d\xe2\x83\xa5" },
+    { "&nLt;", 5, 6, "\xe2\x89\xaa\xe2\x83\x92" },
+    { "&Uarrocir;", 10, 3, "\xe2\xa5\x89" },
+    { "&compfn;", 8, 3, "\xe2\x88\x98" },
+    { "&nwarhk;", 8, 3, "\xe2\xa4\xa3" },
+    { "&nbumpe;", 8, 5, "\xe2\x89\x8f\xcc\xb8" },
+    { "&sqsubset;", 10, 3, "\xe2\x8a\x8f" },
+    { "&circledast;", 12, 3, "\xe2\x8a\x9b" },
+    { "&Delta;", 7, 2, "\xce\x94" },
+    { "&varr;", 6, 3, "\xe2\x86\x95" },
+    { "&ncong;", 7, 3, "\xe2\x89\x87" },
+    { "&rarrc;", 7, 3, "\xe2\xa4\xb3" },
+    { "&Theta;", 7, 2, "\xce\x98" },
+    { "&TScy;", 6, 2, "\xd0\xa6" },
+    { "&Ycirc;", 7, 2, "\xc5\xb6" },
+    { "&sfrown;", 8, 3, "\xe2\x8c\xa2" },
+    { "&ForAll;", 8, 3, "\xe2\x88\x80" },
+    { "&cularrp;", 9, 3, "\xe2\xa4\xbd" },
+    { "&nparallel;", 11, 3, "\xe2\x88\xa6" },
+    { "&nlE;", 5, 5, "\xe2\x89\xa6\xcc\xb8" },
+    { "&ffllig;", 8, 3, "\xef\xac\x84" },
+    { "&omid;", 6, 3, "\xe2\xa6\xb6" },
+    { "&NotTildeEqual;", 15, 3, "\xe2\x89\x84" },
+    { "&oacute;", 8, 2, "\xc3\xb3" },
+    { "&bsemi;", 7, 3, "\xe2\x81\x8f" },
+    { "&iprod;", 7, 3, "\xe2\xa8\xbc" },
+    { "&nsucc;", 7, 3, "\xe2\x8a\x81" },
+    { "&Jukcy;", 7, 2, "\xd0\x84" },
+    { "&ggg;", 5, 3, "\xe2\x8b\x99" },
+    { "&ulcorn;", 8, 3, "\xe2\x8c\x9c" },
+    { "&nesim;", 7, 5, "\xe2\x89\x82\xcc\xb8" },
+    { "&rbrace;", 8, 1, "\x7d" },
+    { "&phmmat;", 8, 3, "\xe2\x84\xb3" },
+    { "&DoubleVerticalBar;", 19, 3, "\xe2\x88\xa5" },
+    { "&swarhk;", 8, 3, "\xe2\xa4\xa6" },
+    { "&gscr;", 6, 3, "\xe2\x84\x8a" },
+    { "&ni;", 4, 3, "\xe2\x88\x8b" },
+    { "&LeftUpDownVector;", 18, 3, "\xe2\xa5\x91" },
+    { "&geqq;", 6, 3, "\xe2\x89\xa7" },
+    { "&nGg;", 5, 5, "\xe2\x8b\x99\xcc\xb8" },
+    { "&nsubset;", 9, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&gimel;", 7, 3, "\xe2\x84\xb7" },
+    { "&Kopf;", 6, 4, "\xf0\x9d\x95\x82" },
+    { "&eqslantless;", 13, 3, "\xe2\xaa\x95" },
+    { "&hstrok;", 8, 2, "\xc4\xa7" },
+    { "&psi;", 5, 2, "\xcf\x88" },
+    { "&Lcedil;", 8, 2, "\xc4\xbb" },
+    { "&Escr;", 6, 3, "\xe2\x84\xb0" },
+    { "&MinusPlus;", 11, 3, "\xe2\x88\x93" },
+    { "&models;", 8, 3, "\xe2\x8a\xa7" },
+    { "&lescc;", 7, 3, "\xe2\xaa\xa8" },
+    { "&mldr;", 6, 3, "\xe2\x80\xa6" },
+    { "&pi;", 4, 2, "\xcf\x80" },
+    { "&DoubleLeftRightArrow;", 22, 3, "\xe2\x87\x94" },
+    { "&qfr;", 5, 4, "\xf0\x9d\x94\xae" },
+    { "&fflig;", 7, 3, "\xef\xac\x80" },
+    { "&ecolon;", 8, 3, "\xe2\x89\x95" },
+    { "&NotGreater;", 12, 3, "\xe2\x89\xaf" },
+    { "&ccupssm;", 9, 3, "\xe2\xa9\x90" },
+    { "&ocy;", 5, 2, "\xd0\xbe" },
+    { "&nharr;", 7, 3, "\xe2\x86\xae" },
+    { "&Otilde;", 8, 2, "\xc3\x95" },
+    { "&Icirc;", 7, 2, "\xc3\x8e" },
+    { "&boxhu;", 7, 3, "\xe2\x94\xb4" },
+    { "&Auml;", 6, 2, "\xc3\x84" },
+    { "&uacute;", 8, 2, "\xc3\xba" },
+    { "&boxUL;", 7, 3, "\xe2\x95\x9d" },
+    { "&VerticalSeparator;", 19, 3, "\xe2\x9d\x98" },
+    { "&LeftUpVector;", 14, 3, "\xe2\x86\xbf" },
+    { "&angmsdae;", 10, 3, "\xe2\xa6\xac" },
+    { "&Popf;", 6, 3, "\xe2\x84\x99" },
+    { "&bottom;", 8, 3, "\xe2\x8a\xa5" },
+    { "&lrhard;", 8, 3, "\xe2\xa5\xad" },
+    { "&vrtri;", 7, 3, "\xe2\x8a\xb3" },
+    { "&Otimes;", 8, 3, "\xe2\xa8\xb7" },
+    { "&ic;", 4, 3, "\xe2\x81\xa3" },
+    { "&Breve;", 7, 2, "\xcb\x98" },
+    { "&rightleftharpoons;", 19, 3, "\xe2\x87\x8c" },
+    { "&vBarv;", 7, 3, "\xe2\xab\xa9" },
+    { "&CloseCurlyQuote;", 17, 3, "\xe2\x80\x99" },
+    { "&spades;", 8, 3, "\xe2\x99\xa0" },
+    { "&SucceedsSlantEqual;", 20, 3, "\xe2\x89\xbd" },
+    { "&gtrarr;", 8, 3, "\xe2\xa5\xb8" },
+    { "&nbsp;", 6, 2, "\xc2\xa0" },
+    { "&udhar;", 7, 3, "\xe2\xa5\xae" },
+    { "&ucirc;", 7, 2, "\xc3\xbb" },
+    { "&Udblac;", 8, 2, "\xc5\xb0" },
+    { "&aopf;", 6, 4, "\xf0\x9d\x95\x92" },
+    { "&bopf;", 6, 4, "\xf0\x9d\x95\x93" },
+    { "&llcorner;", 10, 3, "\xe2\x8c\x9e" },
+    { "&lfr;", 5, 4, "\xf0\x9d\x94\xa9" },
+    { "&nsce;", 6, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&NotEqualTilde;", 15, 5, "\xe2\x89\x82\xcc\xb8" },
+    { "&Hat;", 5, 1, "\x5e" },
+    { "&nvrArr;", 8, 3, "\xe2\xa4\x83" },
+    { "&scap;", 6, 3, "\xe2\xaa\xb8" },
+    { "&lBarr;", 7, 3, "\xe2\xa4\x8e" },
+    { "&rotimes;", 9, 3, "\xe2\xa8\xb5" },
+    { "&blacklozenge;", 14, 3, "\xe2\xa7\xab" },
+    { "&napE;", 6, 5, "\xe2\xa9\xb0\xcc\xb8" },
+    { "&trie;", 6, 3, "\xe2\x89\x9c" },
+    { "&vBar;", 6, 3, "\xe2\xab\xa8" },
+    { "&Efr;", 5, 4, "\xf0\x9d\x94\x88" },
+    { "&ReverseEquilibrium;", 20, 3, "\xe2\x87\x8b" },
+    { "&subE;", 6, 3, "\xe2\xab\x85" },
+    { "&DScy;", 6, 2, "\xd0\x85" },
+    { "&Ocy;", 5, 2, "\xd0\x9e" },
+    { "&bull;", 6, 3, "\xe2\x80\xa2" },
+    { "&Hcirc;", 7, 2, "\xc4\xa4" },
+    { "&VerticalLine;", 14, 1, "\x7c" },
+    { "&UpArrowBar;", 12, 3, "\xe2\xa4\x92" },
+    { "&eqcolon;", 9, 3, "\xe2\x89\x95" },
+    { "&squ;", 5, 3, "\xe2\x96\xa1" },
+    { "&blacktriangleright;", 20, 3, "\xe2\x96\xb8" },
+    { "&Umacr;", 7, 2, "\xc5\xaa" },
+    { "&colone;", 8, 3, "\xe2\x89\x94" },
+    { "&weierp;", 8, 3, "\xe2\x84\x98" },
+    { "&vdash;", 7, 3, "\xe2\x8a\xa2" },
+    { "&tosa;", 6, 3, "\xe2\xa4\xa9" },
+    { "&Tstrok;", 8, 2, "\xc5\xa6" },
+    { "&gnsim;", 7, 3, "\xe2\x8b\xa7" },
+    { "&NotGreaterSlantEqual;", 22, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&notinvb;", 9, 3, "\xe2\x8b\xb7" },
+    { "&NotPrecedesSlantEqual;", 23, 3, "\xe2\x8b\xa0" },
+    { "&xlarr;", 7, 3, "\xe2\x9f\xb5" },
+    { "&orarr;", 7, 3, "\xe2\x86\xbb" },
+    { "&frac14;", 8, 2, "\xc2\xbc" },
+    { "&eqsim;", 7, 3, "\xe2\x89\x82" },
+    { "&nshortparallel;", 16, 3, "\xe2\x88\xa6" },
+    { "&kopf;", 6, 4, "\xf0\x9d\x95\x9c" },
+    { "&prnap;", 7, 3, "\xe2\xaa\xb9" },
+    { "&ac;", 4, 3, "\xe2\x88\xbe" },
+    { "&rdca;", 6, 3, "\xe2\xa4\xb7" },
+    { "&cwint;", 7, 3, "\xe2\x88\xb1" },
+    { "&Re;", 4, 3, "\xe2\x84\x9c" },
+    { "&vDash;", 7, 3, "\xe2\x8a\xa8" },
+    { "&UnderParenthesis;", 18, 3, "\xe2\x8f\x9d" },
+    { "&leftthreetimes;", 16, 3, "\xe2\x8b\x8b" },
+    { "&vfr;", 5, 4, "\xf0\x9d\x94\xb3" },
+    { "&VDash;", 7, 3, "\xe2\x8a\xab" },
+    { "&DoubleUpArrow;", 15, 3, "\xe2\x87\x91" },
+    { "&ntgl;", 6, 3, "\xe2\x89\xb9" },
+    { "&NotSucceedsEqual;", 18, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&nvHarr;", 8, 3, "\xe2\xa4\x84" },
+    { "&gvnE;", 6, 6, "\xe2\x89\xa9\xef\xb8\x80" },
+    { "&backsimeq;", 11, 3, "\xe2\x8b\x8d" },
+    { "&Ocirc;", 7, 2, "\xc3\x94" },
+    { "&leftarrow;", 11, 3, "\xe2\x86\x90" },
+    { "&boxV;", 6, 3, "\xe2\x95\x91" },
+    { "&ne;", 4, 3, "\xe2\x89\xa0" },
+    { "&nearhk;", 8, 3, "\xe2\xa4\xa4" },
+    { "&nang;", 6, 6, "\xe2\x88\xa0\xe2\x83\x92" },
+    { "&npar;", 6, 3, "\xe2\x88\xa6" },
+    { "&sharp;", 7, 3, "\xe2\x99\xaf" },
+    { "&jopf;", 6, 4, "\xf0\x9d\x95\x9b" },
+    { "&Rscr;", 6, 3, "\xe2\x84\x9b" },
+    { "&Xscr;", 6, 4, "\xf0\x9d\x92\xb3" },
+    { "&boxVH;", 7, 3, "\xe2\x95\xac" },
+    { "&vangrt;", 8, 3, "\xe2\xa6\x9c" },
+    { "&doteqdot;", 10, 3, "\xe2\x89\x91" },
+    { "&Xfr;", 5, 4, "\xf0\x9d\x94\x9b" },
+    { "&iecy;", 6, 2, "\xd0\xb5" },
+    { "&rbbrk;", 7, 3, "\xe2\x9d\xb3" },
+    { "&leqq;", 6, 3, "\xe2\x89\xa6" },
+    { "&olcir;", 7, 3, "\xe2\xa6\xbe" },
+    { "&ufisht;", 8, 3, "\xe2\xa5\xbe" },
+    { "&lessgtr;", 9, 3, "\xe2\x89\xb6" },
+    { "&Iuml;", 6, 2, "\xc3\x8f" },
+    { "&kscr;", 6, 4, "\xf0\x9d\x93\x80" },
+    { "&gne;", 5, 3, "\xe2\xaa\x88" },
+    { "&angmsdad;", 10, 3, "\xe2\xa6\xab" },
+    { "&ll;", 4, 3, "\xe2\x89\xaa" },
+    { "&Uopf;", 6, 4, "\xf0\x9d\x95\x8c" },
+    { "&SquareSubset;", 14, 3, "\xe2\x8a\x8f" },
+    { "&boxuR;", 7, 3, "\xe2\x95\x98" },
+    { "&llhard;", 8, 3, "\xe2\xa5\xab" },
+    { "&NotLessSlantEqual;", 19, 5, "\xe2\xa9\xbd\xcc\xb8" },
+    { "&gdot;", 6, 2, "\xc4\xa1" },
+    { "&varsupsetneq;", 14, 6, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { "&qprime;", 8, 3, "\xe2\x81\x97" },
+    { "&npolint;", 9, 3, "\xe2\xa8\x94" },
+    { "&DownRightVector;", 17, 3, "\xe2\x87\x81" },
+    { "&semi;", 6, 1, "\x3b" },
+    { "&UpTee;", 7, 3, "\xe2\x8a\xa5" },
+    { "&hercon;", 8, 3, "\xe2\x8a\xb9" },
+    { "&RightCeiling;", 14, 3, "\xe2\x8c\x89" },
+    { "&Gdot;", 6, 2, "\xc4\xa0" },
+    { "&exponentiale;", 14, 3, "\xe2\x85\x87" },
+    { "&cupcup;", 8, 3, "\xe2\xa9\x8a" },
+    { "&hardcy;", 8, 2, "\xd1\x8a" },
+    { "&RightDoubleBracket;", 20, 3, "\xe2\x9f\xa7" },
+    { "&succ;", 6, 3, "\xe2\x89\xbb" },
+    { "&quest;", 7, 1, "\x3f" },
+    { "&boxH;", 6, 3, "\xe2\x95\x90" },
+    { "&homtht;", 8, 3, "\xe2\x88\xbb" },
+    { "&nsupseteqq;", 12, 5, "\xe2\xab\x86\xcc\xb8" },
+    { "&SucceedsTilde;", 15, 3, "\xe2\x89\xbf" },
+    { "&curlyeqprec;", 13, 3, "\xe2\x8b\x9e" },
+    { "&dzigrarr;", 10, 3, "\xe2\x9f\xbf" },
+    { "&Updownarrow;", 13, 3, "\xe2\x87\x95" },
+    { "&leqslant;", 10, 3, "\xe2\xa9\xbd" },
+    { "&SubsetEqual;", 13, 3, "\xe2\x8a\x86" },
+    { "&LessTilde;", 11, 3, "\xe2\x89\xb2" },
+    { "&Vbar;", 6, 3, "\xe2\xab\xab" },
+    { "&rtrie;", 7, 3, "\xe2\x8a\xb5" },
+    { "&late;", 6, 3, "\xe2\xaa\xad" },
+    { "&VerticalTilde;", 15, 3, "\xe2\x89\x80" },
+    { "&NotLessGreater;", 16, 3, "\xe2\x89\xb8" },
+    { "&malt;", 6, 3, "\xe2\x9c\xa0" },
+    { "&rcaron;", 8, 2, "\xc5\x99" },
+    { "&lbbrk;", 7, 3, "\xe2\x9d\xb2" },
+    { "&LeftTee;", 9, 3, "\xe2\x8a\xa3" },
+    { "&gjcy;", 6, 2, "\xd1\x93" },
+    { "&gl;", 4, 3, "\xe2\x89\xb7" },
+    { "&check;", 7, 3, "\xe2\x9c\x93" },
+    { "&bump;", 6, 3, "\xe2\x89\x8e" },
+    { "&alefsym;", 9, 3, "\xe2\x84\xb5" },
+    { "&rfr;", 5, 4, "\xf0\x9d\x94\xaf" },
+    { "&SquareSupersetEqual;", 21, 3, "\xe2\x8a\x92" },
+    { "&boxVr;", 7, 3, "\xe2\x95\x9f" },
+    { "&LeftDownVector;", 16, 3, "\xe2\x87\x83" },
+    { "&boxDr;", 7, 3, "\xe2\x95\x93" },
+    { "&sqsupseteq;", 12, 3, "\xe2\x8a\x92" },
+    { "&TripleDot;", 11, 3, "\xe2\x83\x9b" },
+    { "&yacy;", 6, 2, "\xd1\x8f" },
+    { "&LJcy;", 6, 2, "\xd0\x89" },
+    { "&Zdot;", 6, 2, "\xc5\xbb" },
+    { "&NotSquareSubsetEqual;", 22, 3, "\xe2\x8b\xa2" },
+    { "&ShortDownArrow;", 16, 3, "\xe2\x86\x93" },
+    { "&ufr;", 5, 4, "\xf0\x9d\x94\xb2" },
+    { "&rnmid;", 7, 3, "\xe2\xab\xae" },
+    { "&gsiml;", 7, 3, "\xe2\xaa\x90" },
+    { "&scnap;", 7, 3, "\xe2\xaa\xba" },
+    { "&LowerRightArrow;", 17, 3, "\xe2\x86\x98" },
+    { "&RightFloor;", 12, 3, "\xe2\x8c\x8b" },
+    { "&ape;", 5, 3, "\xe2\x89\x8a" },
+    { "&harrcir;", 9, 3, "\xe2\xa5\x88" },
+    { "&Cayleys;", 9, 3, "\xe2\x84\xad" },
+    { "&langd;", 7, 3, "\xe2\xa6\x91" },
+    { "&ntlg;", 6, 3, "\xe2\x89\xb8" },
+    { "&permil;", 8, 3, "\xe2\x80\xb0" },
+    { "&Oscr;", 6, 4, "\xf0\x9d\x92\xaa" },
+    { "&nacute;", 8, 2, "\xc5\x84" },
+    { "&nhpar;", 7, 3, "\xe2\xab\xb2" },
+    { "&Pcy;", 5, 2, "\xd0\x9f" },
+    { "&LeftDownTeeVector;", 19, 3, "\xe2\xa5\xa1" },
+    { "&ltrie;", 7, 3, "\xe2\x8a\xb4" },
+    { "&Tab;", 5, 1, "\x09" },
+    { "&curlywedge;", 12, 3, "\xe2\x8b\x8f" },
+    { "&imacr;", 7, 2, "\xc4\xab" },
+    { "&leq;", 5, 3, "\xe2\x89\xa4" },
+    { "&elsdot;", 8, 3, "\xe2\xaa\x97" },
+    { "&vArr;", 6, 3, "\xe2\x87\x95" },
+    { "&CupCap;", 8, 3, "\xe2\x89\x8d" },
+    { "&vltri;", 7, 3, "\xe2\x8a\xb2" },
+    { "&diamondsuit;", 13, 3, "\xe2\x99\xa6" },
+    { "&nLl;", 5, 5, "\xe2\x8b\x98\xcc\xb8" },
+    { "&gnap;", 6, 3, "\xe2\xaa\x8a" },
+    { "&LeftCeiling;", 13, 3, "\xe2\x8c\x88" },
+    { "&ring;", 6, 2, "\xcb\x9a" },
+    { "&upsi;", 6, 2, "\xcf\x85" },
+    { "&andslope;", 10, 3, "\xe2\xa9\x98" },
+    { "&eogon;", 7, 2, "\xc4\x99" },
+    { "&lap;", 5, 3, "\xe2\xaa\x85" },
+    { "&NestedGreaterGreater;", 22, 3, "\xe2\x89\xab" },
+    { "&ltrif;", 7, 3, "\xe2\x97\x82" },
+    { "&operp;", 7, 3, "\xe2\xa6\xb9" },
+    { "&bigoplus;", 10, 3, "\xe2\xa8\x81" },
+    { "&rarrbfs;", 9, 3, "\xe2\xa4\xa0" },
+    { "&ohm;", 5, 2, "\xce\xa9" },
+    { "&otimes;", 8, 3, "\xe2\x8a\x97" },
+    { "&fscr;", 6, 4, "\xf0\x9d\x92\xbb" },
+    { "&Jscr;", 6, 4, "\xf0\x9d\x92\xa5" },
+    { "&rceil;", 7, 3, "\xe2\x8c\x89" },
+    { "&oline;", 7, 3, "\xe2\x80\xbe" },
+    { "&Cdot;", 6, 2, "\xc4\x8a" },
+    { "&lsimg;", 7, 3, "\xe2\xaa\x8f" },
+    { "&icirc;", 7, 2, "\xc3\xae" },
+    { "&NotLessTilde;", 14, 3, "\xe2\x89\xb4" },
+    { "&Ifr;", 5, 3, "\xe2\x84\x91" },
+    { "&rlhar;", 7, 3, "\xe2\x87\x8c" },
+    { "&escr;", 6, 3, "\xe2\x84\xaf" },
+    { "&phone;", 7, 3, "\xe2\x98\x8e" },
+    { "&xoplus;", 8, 3, "\xe2\xa8\x81" },
+    { "&smt;", 5, 3, "\xe2\xaa\xaa" },
+    { "&sup1;", 6, 2, "\xc2\xb9" },
+    { "&simne;", 7, 3, "\xe2\x89\x86" },
+    { "&chi;", 5, 2, "\xcf\x87" },
+    { "&nhArr;", 7, 3, "\xe2\x87\x8e" },
+    { "&ReverseElement;", 16, 3, "\xe2\x88\x8b" },
+    { "&Lstrok;", 8, 2, "\xc5\x81" },
+    { "&rationals;", 11, 3, "\xe2\x84\x9a" },
+    { "&tint;", 6, 3, "\xe2\x88\xad" },
+    { "&Dcaron;", 8, 2, "\xc4\x8e" },
+    { "&olcross;", 9, 3, "\xe2\xa6\xbb" },
+    { "&larrbfs;", 9, 3, "\xe2\xa4\x9f" },
+    { "&Ffr;", 5, 4, "\xf0\x9d\x94\x89" },
+    { "&searr;", 7, 3, "\xe2\x86\x98" },
+    { "&InvisibleComma;", 16, 3, "\xe2\x81\xa3" },
+    { "&eacute;", 8, 2, "\xc3\xa9" },
+    { "&GreaterSlantEqual;", 19, 3, "\xe2\xa9\xbe" },
+    { "&pertenk;", 9, 3, "\xe2\x80\xb1" },
+    { "&xwedge;", 8, 3, "\xe2\x8b\x80" },
+    { "&Utilde;", 8, 2, "\xc5\xa8" },
+    { "&angrt;", 7, 3, "\xe2\x88\x9f" },
+    { "&Superset;", 10, 3, "\xe2\x8a\x83" },
+    { "&vsubnE;", 8, 6, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "&ropar;", 7, 3, "\xe2\xa6\x86" },
+    { "&ucy;", 5, 2, "\xd1\x83" },
+    { "&pcy;", 5, 2, "\xd0\xbf" },
+    { "&jscr;", 6, 4, "\xf0\x9d\x92\xbf" },
+    { "&zigrarr;", 9, 3, "\xe2\x87\x9d" },
+    { "&seswar;", 8, 3, "\xe2\xa4\xa9" },
+    { "&Congruent;", 11, 3, "\xe2\x89\xa1" },
+    { "&aring;", 7, 2, "\xc3\xa5" },
+    { "&prnsim;", 8, 3, "\xe2\x8b\xa8" },
+    { "&npart;", 7, 5, "\xe2\x88\x82\xcc\xb8" },
+    { "&supdsub;", 9, 3, "\xe2\xab\x98" },
+    { "&bcong;", 7, 3, "\xe2\x89\x8c" },
+    { "&slarr;", 7, 3, "\xe2\x86\x90" },
+    { "&amacr;", 7, 2, "\xc4\x81" },
+    { "&fjlig;", 7, 2, "\x66\x6a" },
+    { "&sup3;", 6, 2, "\xc2\xb3" },
+    { "&Subset;", 8, 3, "\xe2\x8b\x90" },
+    { "&nsqsupe;", 9, 3, "\xe2\x8b\xa3" },
+    { "&amp;", 5, 1, "\x26" },
+    { "&uparrow;", 9, 3, "\xe2\x86\x91" },
+    { "&or;", 4, 3, "\xe2\x88\xa8" },
+    { "&Exists;", 8, 3, "\xe2\x88\x83" },
+    { "&boxHD;", 7, 3, "\xe2\x95\xa6" },
+    { "&gtreqless;", 11, 3, "\xe2\x8b\x9b" },
+    { "&ETH;", 5, 2, "\xc3\x90" },
+    { "&NotPrecedesEqual;", 18, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&NotLeftTriangle;", 17, 3, "\xe2\x8b\xaa" },
+    { "&forall;", 8, 3, "\xe2\x88\x80" },
+    { "&aogon;", 7, 2, "\xc4\x85" },
+    { "&Sscr;", 6, 4, "\xf0\x9d\x92\xae" },
+    { "&percnt;", 8, 1, "\x25" },
+    { "&larrlp;", 8, 3, "\xe2\x86\xab" },
+    { "&Cfr;", 5, 3, "\xe2\x84\xad" },
+    { "&Scirc;", 7, 2, "\xc5\x9c" },
+    { "&caron;", 7, 2, "\xcb\x87" },
+    { "&leftarrowtail;", 15, 3, "\xe2\x86\xa2" },
+    { "&nfr;", 5, 4, "\xf0\x9d\x94\xab" },
+    { "&Wedge;", 7, 3, "\xe2\x8b\x80" },
+    { "&sdot;", 6, 3, "\xe2\x8b\x85" },
+    { "&oplus;", 7, 3, "\xe2\x8a\x95" },
+    { "&wedgeq;", 8, 3, "\xe2\x89\x99" },
+    { "&divonx;", 8, 3, "\xe2\x8b\x87" },
+    { "&ngt;", 5, 3, "\xe2\x89\xaf" },
+    { "&olt;", 5, 3, "\xe2\xa7\x80" },
+    { "&hksearow;", 10, 3, "\xe2\xa4\xa5" },
+    { "&epsi;", 6, 2, "\xce\xb5" },
+    { "&Gamma;", 7, 2, "\xce\x93" },
+    { "&boxul;", 7, 3, "\xe2\x94\x98" },
+    { "&ccaron;", 8, 2, "\xc4\x8d" },
+    { "&simgE;", 7, 3, "\xe2\xaa\xa0" },
+    { "&Jfr;", 5, 4, "\xf0\x9d\x94\x8d" },
+    { "&submult;", 9, 3, "\xe2\xab\x81" },
+    { "&natur;", 7, 3, "\xe2\x99\xae" },
+    { "&IOcy;", 6, 2, "\xd0\x81" },
+    { "&ugrave;", 8, 2, "\xc3\xb9" },
+    { "&angrtvbd;", 10, 3, "\xe2\xa6\x9d" },
+    { "&circlearrowright;", 18, 3, "\xe2\x86\xbb" },
+    { "&curlyeqsucc;", 13, 3, "\xe2\x8b\x9f" },
+    { "&nexist;", 8, 3, "\xe2\x88\x84" },
+    { "&xutri;", 7, 3, "\xe2\x96\xb3" },
+    { "&Mopf;", 6, 4, "\xf0\x9d\x95\x84" },
+    { "&ShortUpArrow;", 14, 3, "\xe2\x86\x91" },
+    { "&digamma;", 9, 2, "\xcf\x9d" },
+    { "&vsubne;", 8, 6, "\xe2\x8a\x8a\xef\xb8\x80" },
+    { "&DownBreve;", 11, 2, "\xcc\x91" },
+    { "&AElig;", 7, 2, "\xc3\x86" },
+    { "&fpartint;", 10, 3, "\xe2\xa8\x8d" },
+    { "&rfloor;", 8, 3, "\xe2\x8c\x8b" },
+    { "&Vcy;", 5, 2, "\xd0\x92" },
+    { "&dHar;", 6, 3, "\xe2\xa5\xa5" },
+    { "&NotTildeFullEqual;", 19, 3, "\xe2\x89\x87" },
+    { "&napid;", 7, 5, "\xe2\x89\x8b\xcc\xb8" },
+    { "&SucceedsEqual;", 15, 3, "\xe2\xaa\xb0" },
+    { "&udarr;", 7, 3, "\xe2\x87\x85" },
+    { "&boxVR;", 7, 3, "\xe2\x95\xa0" },
+    { "&bsim;", 6, 3, "\xe2\x88\xbd" },
+    { "&esdot;", 7, 3, "\xe2\x89\x90" },
+    { "&Fcy;", 5, 2, "\xd0\xa4" },
+    { "&gtrdot;", 8, 3, "\xe2\x8b\x97" },
+    { "&Upsi;", 6, 2, "\xcf\x92" },
+    { "&timesd;", 8, 3, "\xe2\xa8\xb0" },
+    { "&rightthreetimes;", 17, 3, "\xe2\x8b\x8c" },
+    { "&angmsdab;", 10, 3, "\xe2\xa6\xa9" },
+    { "&solb;", 6, 3, "\xe2\xa7\x84" },
+    { "&lneq;", 6, 3, "\xe2\xaa\x87" },
+    { "&nis;", 5, 3, "\xe2\x8b\xbc" },
+    { "&RBarr;", 7, 3, "\xe2\xa4\x90" },
+    { "&LT;", 4, 1, "\x3c" },
+    { "&Zscr;", 6, 4, "\xf0\x9d\x92\xb5" },
+    { "&iiint;", 7, 3, "\xe2\x88\xad" },
+    { "&PlusMinus;", 11, 2, "\xc2\xb1" },
+    { "&Hstrok;", 8, 2, "\xc4\xa6" },
+    { "&urcrop;", 8, 3, "\xe2\x8c\x8e" },
+    { "&cscr;", 6, 4, "\xf0\x9d\x92\xb8" },
+    { "&Bumpeq;", 8, 3, "\xe2\x89\x8e" },
+    { "&popf;", 6, 4, "\xf0\x9d\x95\xa1" },
+    { "&congdot;", 9, 3, "\xe2\xa9\xad" },
+    { "&Del;", 5, 3, "\xe2\x88\x87" },
+    { "&iexcl;", 7, 2, "\xc2\xa1" },
+    { "&odiv;", 6, 3, "\xe2\xa8\xb8" },
+    { "&triangle;", 10, 3, "\xe2\x96\xb5" },
+    { "&Because;", 9, 3, "\xe2\x88\xb5" },
+    { "&supedot;", 9, 3, "\xe2\xab\x84" },
+    { "&kcy;", 5, 2, "\xd0\xba" },
+    { "&macr;", 6, 2, "\xc2\xaf" },
+    { "&boxbox;", 8, 3, "\xe2\xa7\x89" },
+    { "&looparrowright;", 16, 3, "\xe2\x86\xac" },
+    { "&bigtriangleup;", 15, 3, "\xe2\x96\xb3" },
+    { "&cir;", 5, 3, "\xe2\x97\x8b" },
+    { "&oscr;", 6, 3, "\xe2\x84\xb4" },
+    { "&And;", 5, 3, "\xe2\xa9\x93" },
+    { "&triplus;", 9, 3, "\xe2\xa8\xb9" },
+    { "&nu;", 4, 2, "\xce\xbd" },
+    { "&csub;", 6, 3, "\xe2\xab\x8f" },
+    { "&blacktriangleleft;", 19, 3, "\xe2\x97\x82" },
+    { "&rArr;", 6, 3, "\xe2\x87\x92" },
+    { "&leg;", 5, 3, "\xe2\x8b\x9a" },
+    { "&dstrok;", 8, 2, "\xc4\x91" },
+    { "&eopf;", 6, 4, "\xf0\x9d\x95\x96" },
+    { "&gtrsim;", 8, 3, "\xe2\x89\xb3" },
+    { "&bullet;", 8, 3, "\xe2\x80\xa2" },
+    { "&curarrm;", 9, 3, "\xe2\xa4\xbc" },
+    { "&angmsdaf;", 10, 3, "\xe2\xa6\xad" },
+    { "&middot;", 8, 2, "\xc2\xb7" },
+    { "&ogt;", 5, 3, "\xe2\xa7\x81" },
+    { "&rangd;", 7, 3, "\xe2\xa6\x92" },
+    { "&nsim;", 6, 3, "\xe2\x89\x81" },
+    { "&lowbar;", 8, 1, "\x5f" },
+    { "&nlsim;", 7, 3, "\xe2\x89\xb4" },
+    { "&boxvl;", 7, 3, "\xe2\x94\xa4" },
+    { "&NJcy;", 6, 2, "\xd0\x8a" },
+    { "&boxhU;", 7, 3, "\xe2\x95\xa8" },
+    { "&lceil;", 7, 3, "\xe2\x8c\x88" },
+    { "&vcy;", 5, 2, "\xd0\xb2" },
+    { "&dtdot;", 7, 3, "\xe2\x8b\xb1" },
+    { "&frac58;", 8, 3, "\xe2\x85\x9d" },
+    { "&NotSucceedsSlantEqual;", 23, 3, "\xe2\x8b\xa1" },
+    { "&lnE;", 5, 3, "\xe2\x89\xa8" },
+    { "&cups;", 6, 6, "\xe2\x88\xaa\xef\xb8\x80" },
+    { "&lrtri;", 7, 3, "\xe2\x8a\xbf" },
+    { "&longleftrightarrow;", 20, 3, "\xe2\x9f\xb7" },
+    { "&integers;", 10, 3, "\xe2\x84\xa4" },
+    { "&nvlt;", 6, 4, "\x3c\xe2\x83\x92" },
+    { "&uharr;", 7, 3, "\xe2\x86\xbe" },
+    { "&GreaterEqual;", 14, 3, "\xe2\x89\xa5" },
+    { "&order;", 7, 3, "\xe2\x84\xb4" },
+    { "&sqcaps;", 8, 6, "\xe2\x8a\x93\xef\xb8\x80" },
+    { "&Ucirc;", 7, 2, "\xc3\x9b" },
+    { "&blacktriangledown;", 19, 3, "\xe2\x96\xbe" },
+    { "&rarrap;", 8, 3, "\xe2\xa5\xb5" },
+    { "&smile;", 7, 3, "\xe2\x8c\xa3" },
+    { "&egrave;", 8, 2, "\xc3\xa8" },
+    { "&cylcty;", 8, 3, "\xe2\x8c\xad" },
+    { "&barvee;", 8, 3, "\xe2\x8a\xbd" },
+    { "&uplus;", 7, 3, "\xe2\x8a\x8e" },
+    { "&profline;", 10, 3, "\xe2\x8c\x92" },
+    { "&LessLess;", 10, 3, "\xe2\xaa\xa1" },
+    { "&zwnj;", 6, 3, "\xe2\x80\x8c" },
+    { "&DiacriticalTilde;", 18, 2, "\xcb\x9c" },
+    { "&emptyv;", 8, 3, "\xe2\x88\x85" },
+    { "&cupbrcap;", 10, 3, "\xe2\xa9\x88" },
+    { "&Therefore;", 11, 3, "\xe2\x88\xb4" },
+    { "&Ograve;", 8, 2, "\xc3\x92" },
+    { "&iukcy;", 7, 2, "\xd1\x96" },
+    { "&boxdr;", 7, 3, "\xe2\x94\x8c" },
+    { "&starf;", 7, 3, "\xe2\x98\x85" },
+    { "&NotRightTriangleEqual;", 23, 3, "\xe2\x8b\xad" },
+    { "&longrightarrow;", 16, 3, "\xe2\x9f\xb6" },
+    { "&downharpoonleft;", 17, 3, "\xe2\x87\x83" },
+    { "&nleftrightarrow;", 17, 3, "\xe2\x86\xae" },
+    { "&lvertneqq;", 11, 6, "\xe2\x89\xa8\xef\xb8\x80" },
+    { "&Jcy;", 5, 2, "\xd0\x99" },
+    { "&ord;", 5, 3, "\xe2\xa9\x9d" },
+    { "&euro;", 6, 3, "\xe2\x82\xac" },
+    { "&Laplacetrf;", 12, 3, "\xe2\x84\x92" },
+    { "&DoubleUpDownArrow;", 19, 3, "\xe2\x87\x95" },
+    { "&gesdot;", 8, 3, "\xe2\xaa\x80" },
+    { "&gsime;", 7, 3, "\xe2\xaa\x8e" },
+    { "&dtri;", 6, 3, "\xe2\x96\xbf" },
+    { "&dot;", 5, 2, "\xcb\x99" },
+    { "&bbrktbrk;", 10, 3, "\xe2\x8e\xb6" },
+    { "&NotSubsetEqual;", 16, 3, "\xe2\x8a\x88" },
+    { "&Ouml;", 6, 2, "\xc3\x96" },
+    { "&ReverseUpEquilibrium;", 22, 3, "\xe2\xa5\xaf" },
+    { "&ddotseq;", 9, 3, "\xe2\xa9\xb7" },
+    { "&Sfr;", 5, 4, "\xf0\x9d\x94\x96" },
+    { "&csupe;", 7, 3, "\xe2\xab\x92" },
+    { "&curvearrowleft;", 16, 3, "\xe2\x86\xb6" },
+    { "&RightVector;", 13, 3, "\xe2\x87\x80" },
+    { "&ncap;", 6, 3, "\xe2\xa9\x83" },
+    { "&emacr;", 7, 2, "\xc4\x93" },
+    { "&nvltrie;", 9, 6, "\xe2\x8a\xb4\xe2\x83\x92" },
+    { "&Eacute;", 8, 2, "\xc3\x89" },
+    { "&Backslash;", 11, 3, "\xe2\x88\x96" },
+    { "&Rightarrow;", 12, 3, "\xe2\x87\x92" },
+    { "&mDDot;", 7, 3, "\xe2\x88\xba" },
+    { "&Sacute;", 8, 2, "\xc5\x9a" },
+    { "&ecirc;", 7, 2, "\xc3\xaa" },
+    { "&Ubrcy;", 7, 2, "\xd0\x8e" },
+    { "&block;", 7, 3, "\xe2\x96\x88" },
+    { "&yacute;", 8, 2, "\xc3\xbd" },
+    { "&circlearrowleft;", 17, 3, "\xe2\x86\xba" },
+    { "&nvle;", 6, 6, "\xe2\x89\xa4\xe2\x83\x92" },
+    { "&minusdu;", 9, 3, "\xe2\xa8\xaa" },
+    { "&nvge;", 6, 6, "\xe2\x89\xa5\xe2\x83\x92" },
+    { "&lbarr;", 7, 3, "\xe2\xa4\x8c" },
+    { "&Tscr;", 6, 4, "\xf0\x9d\x92\xaf" },
+    { "&iocy;", 6, 2, "\xd1\x91" },
+    { "&nltri;", 7, 3, "\xe2\x8b\xaa" },
+    { "&Cconint;", 9, 3, "\xe2\x88\xb0" },
+    { "&LeftUpTeeVector;", 17, 3, "\xe2\xa5\xa0" },
+    { "&NotGreaterGreater;", 19, 5, "\xe2\x89\xab\xcc\xb8" },
+    { "&LessEqualGreater;", 18, 3, "\xe2\x8b\x9a" },
+    { "&zwj;", 5, 3, "\xe2\x80\x8d" },
+    { "&nesear;", 8, 3, "\xe2\xa4\xa8" },
+    { "&circledcirc;", 13, 3, "\xe2\x8a\x9a" },
+    { "&gacute;", 8, 2, "\xc7\xb5" },
+    { "&igrave;", 8, 2, "\xc3\xac" },
+    { "&apacir;", 8, 3, "\xe2\xa9\xaf" },
+    { "&dwangle;", 9, 3, "\xe2\xa6\xa6" },
+    { "&Topf;", 6, 4, "\xf0\x9d\x95\x8b" },
+    { "&iogon;", 7, 2, "\xc4\xaf" },
+    { "&DownLeftVector;", 16, 3, "\xe2\x86\xbd" },
+    { "&notnivc;", 9, 3, "\xe2\x8b\xbd" },
+    { "&diams;", 7, 3, "\xe2\x99\xa6" },
+    { "&DoubleRightArrow;", 18, 3, "\xe2\x87\x92" },
+    { "&approx;", 8, 3, "\xe2\x89\x88" },
+    { "&real;", 6, 3, "\xe2\x84\x9c" },
+    { "&swnwar;", 8, 3, "\xe2\xa4\xaa" },
+    { "&nvinfin;", 9, 3, "\xe2\xa7\x9e" },
+    { "&notinva;", 9, 3, "\xe2\x88\x89" },
+    { "&raemptyv;", 10, 3, "\xe2\xa6\xb3" },
+    { "&Vopf;", 6, 4, "\xf0\x9d\x95\x8d" },
+    { "&ddagger;", 9, 3, "\xe2\x80\xa1" },
+    { "&DD;", 4, 3, "\xe2\x85\x85" },
+    { "&Im;", 4, 3, "\xe2\x84\x91" },
+    { "&Gbreve;", 8, 2, "\xc4\x9e" },
+    { "&rarrb;", 7, 3, "\xe2\x87\xa5" },
+    { "&vnsup;", 7, 6, "\xe2\x8a\x83\xe2\x83\x92" },
+    { "&napprox;", 9, 3, "\xe2\x89\x89" },
+    { "&isins;", 7, 3, "\xe2\x8b\xb4" },
+    { "&bsol;", 6, 1, "\x5c" },
+    { "&orslope;", 9, 3, "\xe2\xa9\x97" },
+    { "&tscr;", 6, 4, "\xf0\x9d\x93\x89" },
+    { "&swarr;", 7, 3, "\xe2\x86\x99" },
+    { "&gtdot;", 7, 3, "\xe2\x8b\x97" },
+    { "&yscr;", 6, 4, "\xf0\x9d\x93\x8e" },
+    { "&emptyset;", 10, 3, "\xe2\x88\x85" },
+    { "&tstrok;", 8, 2, "\xc5\xa7" },
+    { "&Phi;", 5, 2, "\xce\xa6" },
+    { "&hscr;", 6, 4, "\xf0\x9d\x92\xbd" },
+    { "&capcup;", 8, 3, "\xe2\xa9\x87" },
+    { "&smallsetminus;", 15, 3, "\xe2\x88\x96" },
+    { "&ntrianglerighteq;", 18, 3, "\xe2\x8b\xad" },
+    { "&Iogon;", 7, 2, "\xc4\xae" },
+    { "&cupcap;", 8, 3, "\xe2\xa9\x86" },
+    { "&mp;", 4, 3, "\xe2\x88\x93" },
+    { "&djcy;", 6, 2, "\xd1\x92" },
+    { "&epsilon;", 9, 2, "\xce\xb5" },
+    { "&nspar;", 7, 3, "\xe2\x88\xa6" },
+    { "&Proportional;", 14, 3, "\xe2\x88\x9d" },
+    { "&NotReverseElement;", 19, 3, "\xe2\x88\x8c" },
+    { "&Omega;", 7, 2, "\xce\xa9" },
+    { "&marker;", 8, 3, "\xe2\x96\xae" },
+    { "&rtrif;", 7, 3, "\xe2\x96\xb8" },
+    { "&VeryThinSpace;", 15, 3, "\xe2\x80\x8a" },
+    { "&ltcir;", 7, 3, "\xe2\xa9\xb9" },
+    { "&Gcirc;", 7, 2, "\xc4\x9c" },
+    { "&cuesc;", 7, 3, "\xe2\x8b\x9f" },
+    { "&sung;", 6, 3, "\xe2\x99\xaa" },
+    { "&numero;", 8, 3, "\xe2\x84\x96" },
+    { "&gcirc;", 7, 2, "\xc4\x9d" },
+    { "&langle;", 8, 3, "\xe2\x9f\xa8" },
+    { "&pscr;", 6, 4, "\xf0\x9d\x93\x85" },
+    { "&nmid;", 6, 3, "\xe2\x88\xa4" },
+    { "&Longleftarrow;", 15, 3, "\xe2\x9f\xb8" },
+    { "&UpTeeArrow;", 12, 3, "\xe2\x86\xa5" },
+    { "&LeftRightVector;", 17, 3, "\xe2\xa5\x8e" },
+    { "&uscr;", 6, 4, "\xf0\x9d\x93\x8a" },
+    { "&notniva;", 9, 3, "\xe2\x88\x8c" },
+    { "&pointint;", 10, 3, "\xe2\xa8\x95" },
+    { "&nges;", 6, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&RightUpVectorBar;", 18, 3, "\xe2\xa5\x94" },
+    { "&leftrightsquigarrow;", 21, 3, "\xe2\x86\xad" },
+    { "&tdot;", 6, 3, "\xe2\x83\x9b" },
+    { "&uarr;", 6, 3, "\xe2\x86\x91" },
+    { "&swarrow;", 9, 3, "\xe2\x86\x99" },
+    { "&bumpeq;", 8, 3, "\xe2\x89\x8f" },
+    { "&succapprox;", 12, 3, "\xe2\xaa\xb8" },
+    { "&Eogon;", 7, 2, "\xc4\x98" },
+    { "&infintie;", 10, 3, "\xe2\xa7\x9d" },
+    { "&ltquest;", 9, 3, "\xe2\xa9\xbb" },
+    { "&efr;", 5, 4, "\xf0\x9d\x94\xa2" },
+    { "&lessapprox;", 12, 3, "\xe2\xaa\x85" },
+    { "&rppolint;", 10, 3, "\xe2\xa8\x92" },
+    { "&Omacr;", 7, 2, "\xc5\x8c" },
+    { "&ofr;", 5, 4, "\xf0\x9d\x94\xac" },
+    { "&dbkarow;", 9, 3, "\xe2\xa4\x8f" },
+    { "&eDot;", 6, 3, "\xe2\x89\x91" },
+    { "&larrpl;", 8, 3, "\xe2\xa4\xb9" },
+    { "&infin;", 7, 3, "\xe2\x88\x9e" },
+    { "&laquo;", 7, 2, "\xc2\xab" },
+    { "&Nscr;", 6, 4, "\xf0\x9d\x92\xa9" },
+    { "&lrm;", 5, 3, "\xe2\x80\x8e" },
+    { "&NotSubset;", 11, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&searrow;", 9, 3, "\xe2\x86\x98" },
+    { "&Aopf;", 6, 4, "\xf0\x9d\x94\xb8" },
+    { "&male;", 6, 3, "\xe2\x99\x82" },
+    { "&nexists;", 9, 3, "\xe2\x88\x84" },
+    { "&ell;", 5, 3, "\xe2\x84\x93" },
+    { "&REG;", 5, 2, "\xc2\xae" },
+    { "&xdtri;", 7, 3, "\xe2\x96\xbd" },
+    { "&cfr;", 5, 4, "\xf0\x9d\x94\xa0" },
+    { "&napos;", 7, 2, "\xc5\x89" },
+    { "&cuwed;", 7, 3, "\xe2\x8b\x8f" },
+    { "&TildeFullEqual;", 16, 3, "\xe2\x89\x85" },
+    { "&scy;", 5, 2, "\xd1\x81" },
+    { "&subsim;", 8, 3, "\xe2\xab\x87" },
+    { "&nsube;", 7, 3, "\xe2\x8a\x88" },
+    { "&subplus;", 9, 3, "\xe2\xaa\xbf" },
+    { "&frac23;", 8, 3, "\xe2\x85\x94" },
+    { "&Aring;", 7, 2, "\xc3\x85" },
+    { "&Sum;", 5, 3, "\xe2\x88\x91" },
+    { "&prnE;", 6, 3, "\xe2\xaa\xb5" },
+    { "&kappa;", 7, 2, "\xce\xba" },
+    { "&sqsub;", 7, 3, "\xe2\x8a\x8f" },
+    { "&uml;", 5, 2, "\xc2\xa8" },
+    { "&lesssim;", 9, 3, "\xe2\x89\xb2" },
+    { "&mfr;", 5, 4, "\xf0\x9d\x94\xaa" },
+    { "&triangleq;", 11, 3, "\xe2\x89\x9c" },
+    { "&lsquor;", 8, 3, "\xe2\x80\x9a" },
+    { "&Xi;", 4, 2, "\xce\x9e" },
+    { "&plusb;", 7, 3, "\xe2\x8a\x9e" },
+    { "&precnapprox;", 13, 3, "\xe2\xaa\xb9" },
+    { "&varpi;", 7, 2, "\xcf\x96" },
+    { "&NotTilde;", 10, 3, "\xe2\x89\x81" },
+    { "&RuleDelayed;", 13, 3, "\xe2\xa7\xb4" },
+    { "&plankv;", 8, 3, "\xe2\x84\x8f" },
+    { "&angmsdag;", 10, 3, "\xe2\xa6\xae" },
+    { "&drbkarow;", 10, 3, "\xe2\xa4\x90" },
+    { "&uharl;", 7, 3, "\xe2\x86\xbf" },
+    { "&suplarr;", 9, 3, "\xe2\xa5\xbb" },
+    { "&lates;", 7, 6, "\xe2\xaa\xad\xef\xb8\x80" },
+    { "&equivDD;", 9, 3, "\xe2\xa9\xb8" },
+    { "&doteq;", 7, 3, "\xe2\x89\x90" },
+    { "&gtcc;", 6, 3, "\xe2\xaa\xa7" },
+    { "&iscr;", 6, 4, "\xf0\x9d\x92\xbe" },
+    { "&boxHu;", 7, 3, "\xe2\x95\xa7" },
+    { "&ouml;", 6, 2, "\xc3\xb6" },
+    { "&cong;", 6, 3, "\xe2\x89\x85" },
+    { "&nsubseteqq;", 12, 5, "\xe2\xab\x85\xcc\xb8" },
+    { "&CirclePlus;", 12, 3, "\xe2\x8a\x95" },
+    { "&inodot;", 8, 2, "\xc4\xb1" },
+    { "&niv;", 5, 3, "\xe2\x88\x8b" },
+    { "&gel;", 5, 3, "\xe2\x8b\x9b" },
+    { "&Jopf;", 6, 4, "\xf0\x9d\x95\x81" },
+    { "&loz;", 5, 3, "\xe2\x97\x8a" },
+    { "&nvap;", 6, 6, "\xe2\x89\x8d\xe2\x83\x92" },
+    { "&rhard;", 7, 3, "\xe2\x87\x81" },
+    { "&sigmaf;", 8, 2, "\xcf\x82" },
+    { "&OverBracket;", 13, 3, "\xe2\x8e\xb4" },
+    { "&Ncaron;", 8, 2, "\xc5\x87" },
+    { "&image;", 7, 3, "\xe2\x84\x91" },
+    { "&geqslant;", 10, 3, "\xe2\xa9\xbe" },
+    { "&blacksquare;", 13, 3, "\xe2\x96\xaa" },
+    { "&top;", 5, 3, "\xe2\x8a\xa4" },
+    { "&ndash;", 7, 3, "\xe2\x80\x93" },
+    { "&Scy;", 5, 2, "\xd0\xa1" },
+    { "&IJlig;", 7, 2, "\xc4\xb2" },
+    { "&npreceq;", 9, 5, "\xe2\xaa\xaf\xcc\xb8" },
+    { "&rarr;", 6, 3, "\xe2\x86\x92" },
+    { "&supsetneqq;", 12, 3, "\xe2\xab\x8c" },
+    { "&Uparrow;", 9, 3, "\xe2\x87\x91" },
+    { "&wedge;", 7, 3, "\xe2\x88\xa7" },
+    { "&ContourIntegral;", 17, 3, "\xe2\x88\xae" },
+    { "&eDDot;", 7, 3, "\xe2\xa9\xb7" },
+    { "&omega;", 7, 2, "\xcf\x89" },
+    { "&gescc;", 7, 3, "\xe2\xaa\xa9" },
+    { "&jfr;", 5, 4, "\xf0\x9d\x94\xa7" },
+    { "&ltlarr;", 8, 3, "\xe2\xa5\xb6" },
+    { "&rbrkslu;", 9, 3, "\xe2\xa6\x90" },
+    { "&lopf;", 6, 4, "\xf0\x9d\x95\x9d" },
+    { "&abreve;", 8, 2, "\xc4\x83" },
+    { "&daleth;", 8, 3, "\xe2\x84\xb8" },
+    { "&exist;", 7, 3, "\xe2\x88\x83" },
+    { "&planck;", 8, 3, "\xe2\x84\x8f" },
+    { "&ge;", 4, 3, "\xe2\x89\xa5" },
+    { "&NotGreaterEqual;", 17, 3, "\xe2\x89\xb1" },
+    { "&Egrave;", 8, 2, "\xc3\x88" },
+    { "&radic;", 7, 3, "\xe2\x88\x9a" },
+    { "&NotCupCap;", 11, 3, "\xe2\x89\xad" },
+    { "&gammad;", 8, 2, "\xcf\x9d" },
+    { "&ijlig;", 7, 2, "\xc4\xb3" },
+    { "&scaron;", 8, 2, "\xc5\xa1" },
+    { "&hArr;", 6, 3, "\xe2\x87\x94" },
+    { "&upsih;", 7, 2, "\xcf\x92" },
+    { "&LeftUpVectorBar;", 17, 3, "\xe2\xa5\x98" },
+    { "&caps;", 6, 6, "\xe2\x88\xa9\xef\xb8\x80" },
+    { "&oelig;", 7, 2, "\xc5\x93" },
+    { "&parsl;", 7, 3, "\xe2\xab\xbd" },
+    { "&supset;", 8, 3, "\xe2\x8a\x83" },
+    { "&sopf;", 6, 4, "\xf0\x9d\x95\xa4" },
+    { "&Element;", 9, 3, "\xe2\x88\x88" },
+    { "&mapstodown;", 12, 3, "\xe2\x86\xa7" },
+    { "&capcap;", 8, 3, "\xe2\xa9\x8b" },
+    { "&lozenge;", 9, 3, "\xe2\x97\x8a" },
+    { "&egs;", 5, 3, "\xe2\xaa\x96" },
+    { "&shchcy;", 8, 2, "\xd1\x89" },
+    { "&fnof;", 6, 2, "\xc6\x92" },
+    { "&boxvH;", 7, 3, "\xe2\x95\xaa" },
+    { "&isinsv;", 8, 3, "\xe2\x8b\xb3" },
+    { "&nrtri;", 7, 3, "\xe2\x8b\xab" },
+    { "&Rfr;", 5, 3, "\xe2\x84\x9c" },
+    { "&oS;", 4, 3, "\xe2\x93\x88" },
+    { "&larrb;", 7, 3, "\xe2\x87\xa4" },
+    { "&lsh;", 5, 3, "\xe2\x86\xb0" },
+    { "&ogon;", 6, 2, "\xcb\x9b" },
+    { "&rightharpoondown;", 18, 3, "\xe2\x87\x81" },
+    { "&ncaron;", 8, 2, "\xc5\x88" },
+    { "&osol;", 6, 3, "\xe2\x8a\x98" },
+    { "&prap;", 6, 3, "\xe2\xaa\xb7" },
+    { "&vnsub;", 7, 6, "\xe2\x8a\x82\xe2\x83\x92" },
+    { "&rharul;", 8, 3, "\xe2\xa5\xac" },
+    { "&OpenCurlyDoubleQuote;", 22, 3, "\xe2\x80\x9c" },
+    { "&SquareSubsetEqual;", 19, 3, "\xe2\x8a\x91" },
+    { "&Kcedil;", 8, 2, "\xc4\xb6" },
+    { "&flat;", 6, 3, "\xe2\x99\xad" },
+    { "&LeftFloor;", 11, 3, "\xe2\x8c\x8a" },
+    { "&Lfr;", 5, 4, "\xf0\x9d\x94\x8f" },
+    { "&Cross;", 7, 3, "\xe2\xa8\xaf" },
+    { "&eng;", 5, 2, "\xc5\x8b" },
+    { "&lg;", 4, 3, "\xe2\x89\xb6" },
+    { "&Ropf;", 6, 3, "\xe2\x84\x9d" },
+    { "&RightArrow;", 12, 3, "\xe2\x86\x92" },
+    { "&bsolhsub;", 10, 3, "\xe2\x9f\x88" },
+    { "&Ncy;", 5, 2, "\xd0\x9d" },
+    { "&backprime;", 11, 3, "\xe2\x80\xb5" },
+    { "&lstrok;", 8, 2, "\xc5\x82" },
+    { "&qscr;", 6, 4, "\xf0\x9d\x93\x86" },
+    { "&nrarrc;", 8, 5, "\xe2\xa4\xb3\xcc\xb8" },
+    { "&LeftTriangle;", 14, 3, "\xe2\x8a\xb2" },
+    { "&intprod;", 9, 3, "\xe2\xa8\xbc" },
+    { "&Dcy;", 5, 2, "\xd0\x94" },
+    { "&ulcorner;", 10, 3, "\xe2\x8c\x9c" },
+    { "&rbrack;", 8, 1, "\x5d" },
+    { "&dashv;", 7, 3, "\xe2\x8a\xa3" },
+    { "&PrecedesEqual;", 15, 3, "\xe2\xaa\xaf" },
+    { "&Gfr;", 5, 4, "\xf0\x9d\x94\x8a" },
+    { "&Uring;", 7, 2, "\xc5\xae" },
+    { "&imped;", 7, 2, "\xc6\xb5" },
+    { "&wopf;", 6, 4, "\xf0\x9d\x95\xa8" },
+    { "&gesdoto;", 9, 3, "\xe2\xaa\x82" },
+    { "&dharl;", 7, 3, "\xe2\x87\x83" },
+    { "&becaus;", 8, 3, "\xe2\x88\xb5" },
+    { "&suphsol;", 9, 3, "\xe2\x9f\x89" },
+    { "&SuchThat;", 10, 3, "\xe2\x88\x8b" },
+    { "&lcy;", 5, 2, "\xd0\xbb" },
+    { "&Yuml;", 6, 2, "\xc5\xb8" },
+    { "&gneq;", 6, 3, "\xe2\xaa\x88" },
+    { "&nLeftarrow;", 12, 3, "\xe2\x87\x8d" },
+    { "&mcy;", 5, 2, "\xd0\xbc" },
+    { "&boxuL;", 7, 3, "\xe2\x95\x9b" },
+    { "&trianglelefteq;", 16, 3, "\xe2\x8a\xb4" },
+    { "&lcub;", 6, 1, "\x7b" },
+    { "&nleftarrow;", 12, 3, "\xe2\x86\x9a" },
+    { "&approxeq;", 10, 3, "\xe2\x89\x8a" },
+    { "&boxvL;", 7, 3, "\xe2\x95\xa1" },
+    { "&pre;", 5, 3, "\xe2\xaa\xaf" },
+    { "&Dashv;", 7, 3, "\xe2\xab\xa4" },
+    { "&omacr;", 7, 2, "\xc5\x8d" },
+    { "&ratio;", 7, 3, "\xe2\x88\xb6" },
+    { "&sqcups;", 8, 6, "\xe2\x8a\x94\xef\xb8\x80" },
+    { "&udblac;", 8, 2, "\xc5\xb1" },
+    { "&ultri;", 7, 3, "\xe2\x97\xb8" },
+    { "&DownLeftVectorBar;", 19, 3, "\xe2\xa5\x96" },
+    { "&Icy;", 5, 2, "\xd0\x98" },
+    { "&rdquo;", 7, 3, "\xe2\x80\x9d" },
+    { "&Gcy;", 5, 2, "\xd0\x93" },
+    { "&lArr;", 6, 3, "\xe2\x87\x90" },
+    { "&xotime;", 8, 3, "\xe2\xa8\x82" },
+    { "&ltrPar;", 8, 3, "\xe2\xa6\x96" },
+    { "&NonBreakingSpace;", 18, 2, "\xc2\xa0" },
+    { "&lsime;", 7, 3, "\xe2\xaa\x8d" },
+    { "&ycy;", 5, 2, "\xd1\x8b" },
+    { "&varsubsetneqq;", 15, 6, "\xe2\xab\x8b\xef\xb8\x80" },
+    { "&notni;", 7, 3, "\xe2\x88\x8c" },
+    { "&nsucceq;", 9, 5, "\xe2\xaa\xb0\xcc\xb8" },
+    { "&ohbar;", 7, 3, "\xe2\xa6\xb5" },
+    { "&rightsquigarrow;", 17, 3, "\xe2\x86\x9d" },
+    { "&ngeqslant;", 11, 5, "\xe2\xa9\xbe\xcc\xb8" },
+    { "&MediumSpace;", 13, 3, "\xe2\x81\x9f" },
+    { "&Ecaron;", 8, 2, "\xc4\x9a" },
+    { "&Sqrt;", 6, 3, "\xe2\x88\x9a" },
+    { "&gnapprox;", 10, 3, "\xe2\xaa\x8a" },
+    { "&filig;", 7, 3, "\xef\xac\x81" },
+    { "&esim;", 6, 3, "\xe2\x89\x82" },
+    { "&Bscr;", 6, 3, "\xe2\x84\xac" },
+    { "&RightTee;", 10, 3, "\xe2\x8a\xa2" },
+    { "&DownTee;", 9, 3, "\xe2\x8a\xa4" },
+    { "&upsilon;", 9, 2, "\xcf\x85" },
+    { "&capbrcup;", 10, 3, "\xe2\xa9\x89" },
+    { "&cup;", 5, 3, "\xe2\x88\xaa" },
+    { "&phi;", 5, 2, "\xcf\x86" },
+    { "&rHar;", 6, 3, "\xe2\xa5\xa4" },
+    { "&grave;", 7, 1, "\x60" },
+    { "&thorn;", 7, 2, "\xc3\xbe" },
+    { "&ii;", 4, 3, "\xe2\x85\x88" },
+    { "&NotLessLess;", 13, 5, "\xe2\x89\xaa\xcc\xb8" },
+    { "&succsim;", 9, 3, "\xe2\x89\xbf" },
+    { "&NegativeVeryThinSpace;", 23, 3, "\xe2\x80\x8b" },
+    { "&Ntilde;", 8, 2, "\xc3\x91" },
+    { "&uring;", 7, 2, "\xc5\xaf" },
+    { "&Itilde;", 8, 2, "\xc4\xa8" },
+    { "&profsurf;", 10, 3, "\xe2\x8c\x93" },
+    { "&nle;", 5, 3, "\xe2\x89\xb0" },
+    { "&ssmile;", 8, 3, "\xe2\x8c\xa3" },
+    { "&frac78;", 8, 3, "\xe2\x85\x9e" },
+    { "&supnE;", 7, 3, "\xe2\xab\x8c" },
+    { "&ngeq;", 6, 3, "\xe2\x89\xb1" },
+    { "&uHar;", 6, 3, "\xe2\xa5\xa3" },
+    { "&RightUpVector;", 15, 3, "\xe2\x86\xbe" },
+    { "&cupdot;", 8, 3, "\xe2\x8a\x8d" },
+    { "&gla;", 5, 3, "\xe2\xaa\xa5" },
+    { "&range;", 7, 3, "\xe2\xa6\xa5" },
+    { "&RightDownTeeVector;", 20, 3, "\xe2\xa5\x9d" },
+    { "&boxvh;", 7, 3, "\xe2\x94\xbc" },
+    { "&Omicron;", 9, 2, "\xce\x9f" },
+    { "&frac34;", 8, 2, "\xc2\xbe" },
+    { "&minusd;", 8, 3, "\xe2\x88\xb8" },
+    { "&ycirc;", 7, 2, "\xc5\xb7" },
+    { "&gap;", 5, 3, "\xe2\xaa\x86" },
+    { "&realpart;", 10, 3, "\xe2\x84\x9c" },
+    { "&xcirc;", 7, 3, "\xe2\x97\xaf" },
+    { "&umacr;", 7, 2, "\xc5\xab" },
+    { "&lagran;", 8, 3, "\xe2\x84\x92" },
+    { "&ordm;", 6, 2, "\xc2\xba" },
+    { "&aleph;", 7, 3, "\xe2\x84\xb5" },
+    { "&Upsilon;", 9, 2, "\xce\xa5" },
+    { "&NotLessEqual;", 14, 3, "\xe2\x89\xb0" },
+    { "&Rarrtl;", 8, 3, "\xe2\xa4\x96" },
+    { "&wcirc;", 7, 2, "\xc5\xb5" },
+    { "&csube;", 7, 3, "\xe2\xab\x91" },
+    { "&Sub;", 5, 3, "\xe2\x8b\x90" },
+    { "&acd;", 5, 3, "\xe2\x88\xbf" },
+    { "&LongLeftArrow;", 15, 3, "\xe2\x9f\xb5" },
+    { "&Poincareplane;", 15, 3, "\xe2\x84\x8c" },
+    { "&NotSquareSupersetEqual;", 24, 3, "\xe2\x8b\xa3" },
+    { "&Bfr;", 5, 4, "\xf0\x9d\x94\x85" },
+    { "&ncy;", 5, 2, "\xd0\xbd" },
+    { "&Epsilon;", 9, 2, "\xce\x95" },
+    { "&yicy;", 6, 2, "\xd1\x97" },
+    { "&micro;", 7, 2, "\xc2\xb5" },
+    { "&xodot;", 7, 3, "\xe2\xa8\x80" },
+    { "&ocir;", 6, 3, "\xe2\x8a\x9a" },
+    { "&nvDash;", 8, 3, "\xe2\x8a\xad" },
+    { "&Vfr;", 5, 4, "\xf0\x9d\x94\x99" },
+    { "&Coproduct;", 11, 3, "\xe2\x88\x90" },
+    { "&rcub;", 6, 1, "\x7d" },
+    { "&copysr;", 8, 3, "\xe2\x84\x97" },
+    { "&YUcy;", 6, 2, "\xd0\xae" },
+    { "&ast;", 5, 1, "\x2a" },
+    { "&NotElement;", 12, 3, "\xe2\x88\x89" },
+    { "&angmsd;", 8, 3, "\xe2\x88\xa1" },
+    { "&Yacute;", 8, 2, "\xc3\x9d" },
+    { "&gesles;", 8, 3, "\xe2\xaa\x94" },
+    { "&nlarr;", 7, 3, "\xe2\x86\x9a" },
+    { "&nrarrw;", 8, 5, "\xe2\x86\x9d\xcc\xb8" },
+    { "&Aacute;", 8, 2, "\xc3\x81" },
+    { "&ClockwiseContourIntegral;", 26, 3, "\xe2\x88\xb2" },
+    { "&gcy;", 5, 2, "\xd0\xb3" },
+    { "&Rcedil;", 8, 2, "\xc5\x96" },
+    { "&succnsim;", 10, 3, "\xe2\x8b\xa9" },
+    { "&KJcy;", 6, 2, "\xd0\x8c" },
+    { "&realine;", 9, 3, "\xe2\x84\x9b" },
+    { "&loplus;", 8, 3, "\xe2\xa8\xad" },
+    { "&Darr;", 6, 3, "\xe2\x86\xa1" },
+    { "&uuml;", 6, 2, "\xc3\xbc" },
+    { "&ldsh;", 6, 3, "\xe2\x86\xb2" },
+    { "&tscy;", 6, 2, "\xd1\x86" },
+    { "&midcir;", 8, 3, "\xe2\xab\xb0" },
+    { "&llarr;", 7, 3, "\xe2\x87\x87" },
+    { "&nlArr;", 7, 3, "\xe2\x87\x8d" },
+    { "&Leftrightarrow;", 16, 3, "\xe2\x87\x94" },
+    { "&rang;", 6, 3, "\xe2\x9f\xa9" },
+    { "&orderof;", 9, 3, "\xe2\x84\xb4" },
+    { "&lesg;", 6, 6, "\xe2\x8b\x9a\xef\xb8\x80" },
+    { "&angsph;", 8, 3, "\xe2\x88\xa2" },
+    { "&ltcc;", 6, 3, "\xe2\xaa\xa6" },
+    { "&subsup;", 8, 3, "\xe2\xab\x93" },
+    { "&blank;", 7, 3, "\xe2\x90\xa3" },
+    { "&nrarr;", 7, 3, "\xe2\x86\x9b" },
+    { "&ascr;", 6, 4, "\xf0\x9d\x92\xb6" },
+    { "&omicron;", 9, 2, "\xce\xbf" },
+    { "&vscr;", 6, 4, "\xf0\x9d\x93\x8b" },
+    { "&lesdoto;", 9, 3, "\xe2\xaa\x81" },
+    { "&zscr;", 6, 4, "\xf0\x9d\x93\x8f" },
+    { "&ngsim;", 7, 3, "\xe2\x89\xb5" },
+    { "&prE;", 5, 3, "\xe2\xaa\xb3" },
+    { "&boxv;", 6, 3, "\xe2\x94\x82" },
+    { "&Abreve;", 8, 2, "\xc4\x82" },
+    { "&rarrlp;", 8, 3, "\xe2\x86\xac" },
+    { "&dscy;", 6, 2, "\xd1\x95" },
+    { "&boxDl;", 7, 3, "\xe2\x95\x96" },
+    { "&Uogon;", 7, 2, "\xc5\xb2" },
+    { "&timesbar;", 10, 3, "\xe2\xa8\xb1" },
+    { "&khcy;", 6, 2, "\xd1\x85" },
+    { "&Scaron;", 8, 2, "\xc5\xa0" },
+    { "&preccurlyeq;", 13, 3, "\xe2\x89\xbc" },
+    { "&sigma;", 7, 2, "\xcf\x83" },
+    { "&sdote;", 7, 3, "\xe2\xa9\xa6" },
+    { "&Tcy;", 5, 2, "\xd0\xa2" },
+    { "&trpezium;", 10, 3, "\xe2\x8f\xa2" },
+    { "&Mu;", 4, 2, "\xce\x9c" },
+    { "&wp;", 4, 3, "\xe2\x84\x98" },
+    { "&Mfr;", 5, 4, "\xf0\x9d\x94\x90" },
+    { "&equest;", 8, 3, "\xe2\x89\x9f" },
+    { "&ordf;", 6, 2, "\xc2\xaa" },
+    { "&Proportion;", 12, 3, "\xe2\x88\xb7" },
+    { "&Ecirc;", 7, 2, "\xc3\x8a" },
+    { "&frac38;", 8, 3, "\xe2\x85\x9c" },
+    { "&cire;", 6, 3, "\xe2\x89\x97" },
+    { "&longmapsto;", 12, 3, "\xe2\x9f\xbc" },
+    { "&nwarr;", 7, 3, "\xe2\x86\x96" },
+    { "&CHcy;", 6, 2, "\xd0\xa7" },
+    { "&reg;", 5, 2, "\xc2\xae" },
+    { "&nsc;", 5, 3, "\xe2\x8a\x81" },
+    { "&dsol;", 6, 3, "\xe2\xa7\xb6" },
+    { "&lessdot;", 9, 3, "\xe2\x8b\x96" },
+    { "&Lt;", 4, 3, "\xe2\x89\xaa" },
+    { "&rhov;", 6, 2, "\xcf\xb1" },
+    { "&Jsercy;", 8, 2, "\xd0\x88" },
+    { "&zcaron;", 8, 2, "\xc5\xbe" },
+    { "&bot;", 5, 3, "\xe2\x8a\xa5" },
+    { "&sqsupset;", 10, 3, "\xe2\x8a\x90" },
+    { "&tritime;", 9, 3, "\xe2\xa8\xbb" },
+    { "&ocirc;", 7, 2, "\xc3\xb4" },
+    { "&veeeq;", 7, 3, "\xe2\x89\x9a" },
+    { "&lmoustache;", 12, 3, "\xe2\x8e\xb0" },
+    { "&Ucy;", 5, 2, "\xd0\xa3" },
+    { "&circ;", 6, 2, "\xcb\x86" },
+    { "&InvisibleTimes;", 16, 3, "\xe2\x81\xa2" },
+    { "&rlarr;", 7, 3, "\xe2\x87\x84" },
+    { "&SHcy;", 6, 2, "\xd0\xa8" },
+    { "&naturals;", 10, 3, "\xe2\x84\x95" },
+    { "&doublebarwedge;", 16, 3, "\xe2\x8c\x86" },
+    { "&Lopf;", 6, 4, "\xf0\x9d\x95\x83" },
+    { "&Iota;", 6, 2, "\xce\x99" },
+    { "&xscr;", 6, 4, "\xf0\x9d\x93\x8d" },
+    { "&Lmidot;", 8, 2, "\xc4\xbf" },
+    { "&questeq;", 9, 3, "\xe2\x89\x9f" },
+    { "&nvdash;", 8, 3, "\xe2\x8a\xac" },
+    { "&bigcap;", 8, 3, "\xe2\x8b\x82" },
+    { "&plus;", 6, 1, "\x2b" },
+    { "&hamilt;", 8, 3, "\xe2\x84\x8b" },
+    { "&xlArr;", 7, 3, "\xe2\x9f\xb8" },
+    { "&prsim;", 7, 3, "\xe2\x89\xbe" },
+    { "&commat;", 8, 1, "\x40" },
+    { "&Vscr;", 6, 4, "\xf0\x9d\x92\xb1" },
+    { "&LongRightArrow;", 16, 3, "\xe2\x9f\xb6" },
+    { "&DiacriticalDot;", 16, 2, "\xcb\x99" },
+    { "&longleftarrow;", 15, 3, "\xe2\x9f\xb5" },
+    { "&HorizontalLine;", 16, 3, "\xe2\x94\x80" },
+    { "&odsold;", 8, 3, "\xe2\xa6\xbc" },
+    { "&Colone;", 8, 3, "\xe2\xa9\xb4" },
+    { "&hairsp;", 8, 3, "\xe2\x80\x8a" },
+    { "&Pfr;", 5, 4, "\xf0\x9d\x94\x93" },
+    { "&isinv;", 7, 3, "\xe2\x88\x88" },
+    { "&iota;", 6, 2, "\xce\xb9" },
+    { "&zfr;", 5, 4, "\xf0\x9d\x94\xb7" },
+    { "&nopf;", 6, 4, "\xf0\x9d\x95\x9f" },
+    { "&pluscir;", 9, 3, "\xe2\xa8\xa2" },
+    { "&topfork;", 9, 3, "\xe2\xab\x9a" },
+    { "&fork;", 6, 3, "\xe2\x8b\x94" },
+    { "&andd;", 6, 3, "\xe2\xa9\x9c" },
+    { "&frac56;", 8, 3, "\xe2\x85\x9a" },
+    { "&CounterClockwiseContourIntegral;", 33, 3, "\xe2\x88\xb3" },
+    { "&target;", 8, 3, "\xe2\x8c\x96" },
+    { "&supe;", 6, 3, "\xe2\x8a\x87" },
+    { "&kappav;", 8, 2, "\xcf\xb0" },
+    { "&odblac;", 8, 2, "\xc5\x91" },
+    { "&wfr;", 5, 4, "\xf0\x9d\x94\xb4" },
+    { "&twoheadrightarrow;", 19, 3, "\xe2\x86\xa0" },
+    { "&Or;", 4, 3, "\xe2\xa9\x94" },
+    { "&RightTeeArrow;", 15, 3, "\xe2\x86\xa6" },
+    { "&ShortRightArrow;", 17, 3, "\xe2\x86\x92" },
+    { "&boxh;", 6, 3, "\xe2\x94\x80" },
+    { "&DownLeftTeeVector;", 19, 3, "\xe2\xa5\x9e" },
+    { "&sqsup;", 7, 3, "\xe2\x8a\x90" },
+    { "&subsetneq;", 11, 3, "\xe2\x8a\x8a" },
+    { "&ange;", 6, 3, "\xe2\xa6\xa4" },
+    { "&olarr;", 7, 3, "\xe2\x86\xba" },
+    { "&rsqb;", 6, 1, "\x5d" },
+    { "&mapstoleft;", 12, 3, "\xe2\x86\xa4" },
+    { "&xfr;", 5, 4, "\xf0\x9d\x94\xb5" },
+    { "&lrcorner;", 10, 3, "\xe2\x8c\x9f" },
+    { "&FilledVerySmallSquare;", 23, 3, "\xe2\x96\xaa" },
+    { "&hookrightarrow;", 16, 3, "\xe2\x86\xaa" },
+    { "&lt;", 4, 1, "\x3c" },
+    { "&vsupne;", 8, 6, "\xe2\x8a\x8b\xef\xb8\x80" },
+    { "&plusacir;", 10, 3, "\xe2\xa8\xa3" },
+    { "&ltri;", 6, 3, "\xe2\x97\x83" },
+    { "&sbquo;", 7, 3, "\xe2\x80\x9a" },
+    { "&eta;", 5, 2, "\xce\xb7" },
+    { "&zcy;", 5, 2, "\xd0\xb7" },
+    { "&smte;", 6, 3, "\xe2\xaa\xac" },
+    { "&sqsubseteq;", 12, 3, "\xe2\x8a\x91" },
+    { "&chcy;", 6, 2, "\xd1\x87" },
+    { "&nshortmid;", 11, 3, "\xe2\x88\xa4" },
+    { "&imagline;", 10, 3, "\xe2\x84\x90" },
+    { "&gt;", 4, 1, "\x3e" },
+    { "&Bcy;", 5, 2, "\xd0\x91" },
+    { "&clubsuit;", 10, 3, "\xe2\x99\xa3" },
+    { "&barwed;", 8, 3, "\xe2\x8c\x85" },
+    { "&ncedil;", 8, 2, "\xc5\x86" },
+    { "&beta;", 6, 2, "\xce\xb2" },
+    { "&it;", 4, 3, "\xe2\x81\xa2" },
+    { "&nwarrow;", 9, 3, "\xe2\x86\x96" },
+    { "&updownarrow;", 13, 3, "\xe2\x86\x95" },
+    { "&vert;", 6, 1, "\x7c" },
+    { "&intlarhk;", 10, 3, "\xe2\xa8\x97" },
+    { "&varepsilon;", 12, 2, "\xcf\xb5" },
+    { "&vopf;", 6, 4, "\xf0\x9d\x95\xa7" },
+    { "&int;", 5, 3, "\xe2\x88\xab" },
+    { "&thksim;", 8, 3, "\xe2\x88\xbc" },
+    { "&isindot;", 9, 3, "\xe2\x8b\xb5" },
+    { "&dlcrop;", 8, 3, "\xe2\x8c\x8d" },
+    { "&OverParenthesis;", 17, 3, "\xe2\x8f\x9c" },
+    { "&acirc;", 7, 2, "\xc3\xa2" },
+    { "&upharpoonright;", 16, 3, "\xe2\x86\xbe" },
+    { "&Imacr;", 7, 2, "\xc4\xaa" },
+    { "&varkappa;", 10, 2, "\xcf\xb0" },
+    { "&atilde;", 8, 2, "\xc3\xa3" },
+    { "&ofcir;", 7, 3, "\xe2\xa6\xbf" },
+    { "&larrsim;", 9, 3, "\xe2\xa5\xb3" },
+    { "&divide;", 8, 2, "\xc3\xb7" },
+    { "&nisd;", 6, 3, "\xe2\x8b\xba" },
+    { "&DoubleLeftArrow;", 17, 3, "\xe2\x87\x90" },
+    { "&blk12;", 7, 3, "\xe2\x96\x92" },
+    { "&UpArrow;", 9, 3, "\xe2\x86\x91" },
+    { "&NotCongruent;", 14, 3, "\xe2\x89\xa2" },
+    { "&roarr;", 7, 3, "\xe2\x87\xbe" },
+    { "&beth;", 6, 3, "\xe2\x84\xb6" },
+    { "&nLeftrightarrow;", 17, 3, "\xe2\x87\x8e" },
+    { "&map;", 5, 3, "\xe2\x86\xa6" },
+    { "&zhcy;", 6, 2, "\xd0\xb6" },
+    { "&dlcorn;", 8, 3, "\xe2\x8c\x9e" },
+    { "&IEcy;", 6, 2, "\xd0\x95" },
+    { "&sstarf;", 8, 3, "\xe2\x8b\x86" },
+    { "&Agrave;", 8, 2, "\xc3\x80" },
+    { "&nsqsube;", 9, 3, "\xe2\x8b\xa2" },
+    { "&Diamond;", 9, 3, "\xe2\x8b\x84" },
+    { "&UnderBrace;", 12, 3, "\xe2\x8f\x9f" },
+    { "&COPY;", 6, 2, "\xc2\xa9" },
+    { "&CircleTimes;", 13, 3, "\xe2\x8a\x97" },
+    { "&succneqq;", 10, 3, "\xe2\xaa\xb6" },
+    { "&scedil;", 8, 2, "\xc5\x9f" },
+    { "&acy;", 5, 2, "\xd0\xb0" },
+    { "&itilde;", 8, 2, "\xc4\xa9" }
 };
 
-static int
-entity_cmp(const void* p_key, const void* p_entity)
+
+/* These have to match the hash functions in scripts/build_entity_map.py. */
+static unsigned
+entity_hash(const char* name, size_t name_size)
 {
-    struct entity_key* key = (struct entity_key*) p_key;
-    struct entity* ent = (struct entity*) p_entity;
+    unsigned hash = 2166136261U;
+    size_t i;
+
+    for(i = 0; i < name_size; i++) {
+        hash ^= (unsigned char) name[i];
+        hash *= 16777619U;
+    }
 
-    return strncmp(key->name, ent->name, key->name_size);
+    return (hash & 0xffffffffU);
+}
+
+static unsigned
+entity_mix(unsigned hash)
+{
+    hash ^= hash >> 16;
+    hash = (hash * 0x85ebca6bU) & 0xffffffffU;
+    hash ^= hash >> 13;
+    hash = (hash * 0xc2b2ae35U) & 0xffffffffU;
+    hash ^= hash >> 16;
+    return hash;
 }
 
 const struct entity*
 entity_lookup(const char* name, size_t name_size)
 {
-    struct entity_key key = { name, name_size };
+    const struct entity* ent;
+    unsigned hash;
+
+    if(name_size > ENTITY_MAX_NAME_SIZE)
+        return NULL;
+
+    hash = entity_hash(name, name_size);
+    ent = &ENTITY_TABLE[entity_mix(hash ^ ENTITY_DISP[hash % ENTITY_BUCKET_COUNT]) % ENTITY_COUNT];
 
-    return bsearch(&key,
-                   entity_table,
-                   sizeof(entity_table) / sizeof(entity_table[0]),
-                   sizeof(struct entity),
-                   entity_cmp);
+    if(ent->name_size != name_size  ||  memcmp(ent->name, name, name_size) != 0)
+        return NULL;
+    return ent;
 }
@@ -30,10 +30,13 @@
 
 
 /* Most entities are formed by single Unicode codepoint, few by two codepoints.
- * Single-codepoint entities have codepoints[1] set to zero. */
+ * The entity stores them already encoded in UTF-8 (utf8_size bytes in utf8[],
+ * not zero-terminated). */
 struct entity {
     const char* name;
-    unsigned codepoints[2];
+    unsigned char name_size;
+    unsigned char utf8_size;
+    char utf8[8];
 };
 
 const struct entity* entity_lookup(const char* name, size_t name_size);
@@ -24,6 +24,7 @@
  */
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "md4c-html.h"
@@ -41,37 +42,157 @@
     #endif
 #endif
 
+#include "simd.h"
+#include "thread.h"
+
 #ifdef _WIN32
     #define snprintf _snprintf
 #endif
 
-#define SELF_LINK_MAX_CHARS 1024
-
 #define MD_HTML_TRY(lvalue, expr) \
     do { \
         lvalue = expr; \
         if (lvalue != 0) return lvalue; \
     } while(0)
 
-typedef struct MD_SELF_LINK_tag MD_SELF_LINK;
-struct MD_SELF_LINK_tag {
-    char text[SELF_LINK_MAX_CHARS];
-    unsigned text_size;
-    unsigned count;
-    MD_SELF_LINK* next;
+/* Anchor of a heading self link made by the built-in slugger. */
+typedef struct MD_HTML_ANCHOR_tag MD_HTML_ANCHOR;
+struct MD_HTML_ANCHOR_tag {
+    MD_SIZE off;            /* The anchor is in MD_HTML::anchor_chars. */
+    MD_SIZE size;
+    unsigned hash;
+    unsigned n_dups;        /* Last suffix tried for duplicates of the anchor. */
+    MD_SIZE pos;            /* Only for ranges: Where it goes in range_output. */
+};
+
+/* URL resolved by render_code_link() or render_wiki_link() (see
+ * md_html_set_link_memo()). */
+typedef struct MD_HTML_LINK_MEMO_ENTRY_tag MD_HTML_LINK_MEMO_ENTRY;
+struct MD_HTML_LINK_MEMO_ENTRY_tag {
+    MD_HTML_LINK_MEMO_ENTRY* next_in_bucket;
+    unsigned hash;
+    unsigned kind;          /* MD_SPAN_A_CODELINK or MD_SPAN_WIKILINK. */
+    MD_SIZE target_size;
+    MD_SIZE url_size;
+    /* Followed by the target and the URL. */
 };
 
+#define MD_HTML_LINK_MEMO_TARGET(entry)     ((MD_CHAR*) ((entry) + 1))
+#define MD_HTML_LINK_MEMO_URL(entry)        (MD_HTML_LINK_MEMO_TARGET(entry) + (entry)->target_size)
+#define MD_HTML_LINK_MEMO_ENTRY_SIZE(target_size, url_size)                 \
+        (sizeof(MD_HTML_LINK_MEMO_ENTRY) + ((size_t) (target_size) + (url_size)) * sizeof(MD_CHAR))
+
+/* Max. number of segments passed to process_output_iov() at once. */
+#define MD_HTML_IOV_MAX         64
+
+/* Shorter runs of the input are copied into the output buffer even for
+ * process_output_iov(): A segment of its own would cost more. */
+#define MD_HTML_IOV_MIN_REF     32
+
 struct MD_HTML_tag {
     void (*process_output)(const MD_CHAR*, MD_SIZE, void*);
+    void (*process_output_iov)(const MD_HTML_IOV*, unsigned, void*);
     int (*render_self_link)(const MD_CHAR*, MD_SIZE, void*, MD_HTML* html,
             int (*render)(MD_HTML* html, const MD_CHAR* data, MD_SIZE size));
     int (*record_self_link)(const MD_CHAR*, MD_SIZE, void*);
     int (*render_code_link)(const MD_CHAR*, MD_SIZE, void*, MD_HTML* html,
             int (*render)(MD_HTML* html, const MD_CHAR* data, MD_SIZE size));
+    int (*render_wiki_link)(const MD_CHAR*, MD_SIZE, void*, MD_HTML* html,
+            int (*render)(MD_HTML* html, const MD_CHAR* data, MD_SIZE size));
     void* userdata;
     unsigned flags;
     int image_nesting_level;
+
+    /* Output buffer. The output is passed to process_output() only when the
+     * buffer is full, and at the end of the document. */
+    MD_CHAR* out_buffer;
+    MD_SIZE out_size;
+    MD_SIZE out_capacity;   /* == flush threshold */
+
+    /* Only with process_output_iov(): The segments to pass to it, referring
+     * to the input, or to the output buffer. Anything in the output buffer
+     * after iov_copy_beg still has no segment. */
+    MD_HTML_IOV iov[MD_HTML_IOV_MAX];
+    unsigned n_iov;
+    MD_SIZE iov_copy_beg;
+
+    /* Only when rendering into a buffer of the caller (see
+     * md_html_to_buffer()): The output buffer is then the rest of dest, so
+     * the output needs no copying, until the first piece which does not fit.
+     * From then on we only count the output. */
+    int is_to_buffer;
+    MD_CHAR* dest;
+    MD_SIZE dest_size;
+    MD_SIZE dest_needed;
+
+    /* Only for renderers created with md_html_create(). */
+    MD_PARSER_CTX* parser_ctx;
+    unsigned parser_flags;
+    MD_HTML_CACHE* cache;
+    int is_caching;         /* Collecting the output of the document for the cache. */
+    int is_streaming;       /* Between md_html_feed() and md_html_finish(). */
+    int bom_pending;        /* md_html_feed() cannot tell yet whether there is a BOM. */
+    MD_SIZE n_bom_held;     /* Leading bytes held back meanwhile. */
+    MD_SIZE bom_size;       /* Size of the BOM skipped by md_html_load(). */
+
+    /* Only for renderers of ranges of a document processed in parallel (see
+     * md_html_set_threads()): Instead of calling process_output(), all the
+     * output of the range is collected here. (With is_caching, a copy of the
+     * output of the document is collected here as well.) */
+    int is_range;
+    MD_CHAR* range_output;
+    MD_SIZE range_size;
+    MD_SIZE range_alloc;
+    int range_failed;       /* Set if we have failed to grow range_output
+                             * (or the document is too large for the cache). */
+
+    /* Heading self links (MD_FLAG_HEADERSELFLINKS) without render_self_link()
+     * get their anchor from the built-in slugger: While inside the heading,
+     * its output is deferred into head_buffer (as the anchor has to precede
+     * it) and its plain text is collected into slug. */
+    int in_self_link;
+    int self_link_failed;
+    MD_CHAR* saved_out_buffer;
+    MD_SIZE saved_out_size;
+    MD_SIZE saved_out_capacity;
+    MD_CHAR* head_buffer;
+    MD_SIZE head_alloc;
+    MD_CHAR* slug;
+    MD_SIZE slug_size;
+    MD_SIZE slug_alloc;
+
+    /* Anchors used so far in the document, with a hash set over them
+     * (open addressing; anchor_slots[i] is an index into anchors + 1, or
+     * zero for an empty slot). Renderers of ranges only collect their
+     * anchors (and where they go); the renderer of the document then
+     * de-duplicates them in md_html_end_range(). */
+    MD_HTML_ANCHOR* anchors;
+    unsigned n_anchors;
+    unsigned alloc_anchors;
+    unsigned* anchor_slots;
+    unsigned n_anchor_slots;        /* Power of 2, or zero. */
+    MD_CHAR* anchor_chars;
+    MD_SIZE anchor_chars_size;
+    MD_SIZE anchor_chars_alloc;
+
+    /* Memo of the URLs from render_code_link() and render_wiki_link() (see
+     * md_html_set_link_memo()). When the memo misses, the URL the callback
+     * renders is collected into resolved, so it can be remembered. */
+    MD_HTML_LINK_MEMO* link_memo;
+    int is_resolving;
+    int resolve_failed;
+    MD_CHAR* resolved;
+    MD_SIZE resolved_size;
+    MD_SIZE resolved_alloc;
+    MD_CHAR* link_target;   /* Decoded target of a wiki link. */
+    MD_SIZE link_target_size;
+    MD_SIZE link_target_alloc;
+
     char escape_map[256];
+#ifndef MD4C_USE_UTF16
+    MD_SIMD_CHARSET html_esc_charset;   /* The same sets as in escape_map, */
+    MD_SIMD_CHARSET url_esc_charset;    /* for md_simd_find(). */
+#endif
 };
 
 #define NEED_HTML_ESC_FLAG   0x1
@@ -88,10 +209,220 @@ struct MD_HTML_tag {
 #define ISALNUM(ch)     (ISLOWER(ch) || ISUPPER(ch) || ISDIGIT(ch))
 
 
+/* Collect the output of a range (see md_html_set_threads()). */
+static void
+render_collect(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(r->range_size + size > r->range_alloc) {
+        MD_SIZE new_alloc = r->range_alloc + r->range_alloc / 2;
+        MD_CHAR* new_output;
+
+        if(new_alloc < r->range_size + size)
+            new_alloc = r->range_size + size;
+        new_output = (MD_CHAR*) realloc(r->range_output, new_alloc * sizeof(MD_CHAR));
+        if(new_output == NULL) {
+            r->range_failed = 1;
+            return;
+        }
+        r->range_output = new_output;
+        r->range_alloc = new_alloc;
+    }
+
+    memcpy(r->range_output + r->range_size, text, size * sizeof(MD_CHAR));
+    r->range_size += size;
+}
+
+static size_t md_html_cache_max_entry_size(const MD_HTML_CACHE* cache);
+
+/* Keep a copy of the output for the cache. */
+static inline void
+render_cache_collect(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    /* Give up early on documents too large for the cache. */
+    if(r->is_caching  &&  !r->range_failed) {
+        if(((size_t) r->range_size + size) * sizeof(MD_CHAR) > md_html_cache_max_entry_size(r->cache))
+            r->range_failed = 1;
+        else
+            render_collect(r, text, size);
+    }
+}
+
+/* Pass the output to the application, via whichever callback it has set. */
+static void
+render_to_buffer(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    /* Unless this is what we have flushed from the output buffer (and so it
+     * is already in place), copy it if it still fits. */
+    if(size > 0  &&  r->dest_needed + size <= r->dest_size  &&  text != r->dest + r->dest_needed)
+        memcpy(r->dest + r->dest_needed, text, size * sizeof(MD_CHAR));
+    r->dest_needed += size;
+
+    if(r->dest_needed < r->dest_size) {
+        r->out_buffer = r->dest + r->dest_needed;
+        r->out_capacity = r->dest_size - r->dest_needed;
+    } else {
+        r->out_buffer = NULL;
+        r->out_capacity = 0;
+    }
+}
+
+static void
+render_process_output(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(r->is_to_buffer) {
+        render_to_buffer(r, text, size);
+    } else if(r->process_output_iov != NULL) {
+        MD_HTML_IOV iov;
+
+        iov.data = text;
+        iov.size = size;
+        r->process_output_iov(&iov, 1, r->userdata);
+    } else {
+        r->process_output(text, size, r->userdata);
+    }
+}
+
+static inline void
+render_output(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(r->is_range) {
+        render_collect(r, text, size);
+    } else {
+        render_process_output(r, text, size);
+        render_cache_collect(r, text, size);
+    }
+}
+
+/* Make sure the buffer can hold at least size characters. */
+static int
+render_reserve(MD_CHAR** p_buffer, MD_SIZE* p_alloc, MD_SIZE size)
+{
+    MD_SIZE new_alloc;
+    MD_CHAR* new_buffer;
+
+    if(size <= *p_alloc)
+        return 0;
+
+    new_alloc = *p_alloc + *p_alloc / 2;
+    if(new_alloc < size)
+        new_alloc = size;
+    if(new_alloc < 64)
+        new_alloc = 64;
+    new_buffer = (MD_CHAR*) realloc(*p_buffer, new_alloc * sizeof(MD_CHAR));
+    if(new_buffer == NULL)
+        return -1;
+    *p_buffer = new_buffer;
+    *p_alloc = new_alloc;
+    return 0;
+}
+
+/* Switch back from head_buffer to the real output buffer. */
+static void
+render_end_defer(MD_HTML* r)
+{
+    r->out_buffer = r->saved_out_buffer;
+    r->out_size = r->saved_out_size;
+    r->out_capacity = r->saved_out_capacity;
+    r->in_self_link = 0;
+}
+
+static void
+render_flush(MD_HTML* r)
+{
+    /* If the parsing has failed inside a heading, drop what we have
+     * deferred of it. */
+    if(r->in_self_link)
+        render_end_defer(r);
+
+    if(r->n_iov > 0) {
+        unsigned i;
+
+        if(r->out_size > r->iov_copy_beg) {
+            r->iov[r->n_iov].data = r->out_buffer + r->iov_copy_beg;
+            r->iov[r->n_iov].size = r->out_size - r->iov_copy_beg;
+            r->n_iov++;
+        }
+        r->process_output_iov(r->iov, r->n_iov, r->userdata);
+        for(i = 0; i < r->n_iov; i++)
+            render_cache_collect(r, r->iov[i].data, (MD_SIZE) r->iov[i].size);
+        r->n_iov = 0;
+        r->iov_copy_beg = 0;
+        r->out_size = 0;
+    } else if(r->out_size > 0) {
+        render_output(r, r->out_buffer, r->out_size);
+        r->out_size = 0;
+    }
+}
+
+/* Inside a heading waiting for its anchor (see render_open_a_self_span()),
+ * the output buffer is head_buffer, and it grows instead of being flushed. */
+static int
+render_defer(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(render_reserve(&r->head_buffer, &r->head_alloc, r->out_size + size) != 0) {
+        r->self_link_failed = 1;
+        return -1;
+    }
+
+    r->out_buffer = r->head_buffer;
+    r->out_capacity = r->head_alloc;
+    memcpy(r->out_buffer + r->out_size, text, size * sizeof(MD_CHAR));
+    r->out_size += size;
+    return 0;
+}
+
 static inline int
 render_verbatim(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
 {
-    r->process_output(text, size, r->userdata);
+    /* (Even if the text would just fill the buffer: With zero capacity, the
+     * buffer may be NULL, so we must not copy even an empty text there.) */
+    if(r->out_size + size >= r->out_capacity) {
+        if(r->in_self_link)
+            return render_defer(r, text, size);
+
+        render_flush(r);
+
+        /* Do not bother with copying anything what would fill the buffer
+         * anyway. */
+        if(size >= r->out_capacity) {
+            if(size > 0)
+                render_output(r, text, size);
+            return 0;
+        }
+    }
+
+    memcpy(r->out_buffer + r->out_size, text, size * sizeof(MD_CHAR));
+    r->out_size += size;
+    return 0;
+}
+
+/* Like render_verbatim(), but for the text of the document (which stays valid
+ * until the rendering call returns): With process_output_iov(), longer runs
+ * of it are passed by reference instead of being copied. */
+static int
+render_ref(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
+{
+    if(r->process_output_iov == NULL  ||  size < MD_HTML_IOV_MIN_REF  ||  r->in_self_link)
+        return render_verbatim(r, text, size);
+
+    /* We may need two segments here (for the copied output and for the text)
+     * and render_flush() one more for whatever gets copied after it. */
+    if(r->n_iov + 3 > MD_HTML_IOV_MAX)
+        render_flush(r);
+
+    if(r->out_size > r->iov_copy_beg) {
+        r->iov[r->n_iov].data = r->out_buffer + r->iov_copy_beg;
+        r->iov[r->n_iov].size = r->out_size - r->iov_copy_beg;
+        r->n_iov++;
+        r->iov_copy_beg = r->out_size;
+    }
+    r->iov[r->n_iov].data = text;
+    r->iov[r->n_iov].size = size;
+    r->n_iov++;
+
+    /* Without the buffering, do not hold it back. */
+    if(r->out_capacity == 0)
+        render_flush(r);
     return 0;
 }
 
@@ -101,26 +432,38 @@ render_verbatim(MD_HTML* r, const MD_CHAR* text, MD_SIZE size)
         render_verbatim((r), (verbatim), (MD_SIZE) (strlen(verbatim)))
 
 
-static int
-render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
+/* Find the next character needing an escape. */
+#ifdef MD4C_USE_UTF16
+    #define ESC_FIND_NEXT(r, charset, flag, data, size, off)                        \
+        do {                                                                        \
+            while((off) < (size)  &&  !((r)->escape_map[(unsigned char)(data)[off]] & (flag)))  \
+                (off)++;                                                            \
+        } while(0)
+#else
+    #define ESC_FIND_NEXT(r, charset, flag, data, size, off)                        \
+        do {                                                                        \
+            (off) += (MD_OFFSET) md_simd_find(&(r)->charset,                        \
+                        (const unsigned char*) (data) + (off), (size) - (off));     \
+        } while(0)
+#endif
+
+/* With is_doc_text, data is the text of the document (see render_ref()). */
+static inline int
+render_html_escaped_(MD_HTML* r, const MD_CHAR* data, MD_SIZE size, int is_doc_text)
 {
     MD_OFFSET beg = 0;
     MD_OFFSET off = 0;
     int ret = 0;
 
-    /* Some characters need to be escaped in normal HTML text. */
-    #define NEED_HTML_ESC(ch)   (r->escape_map[(unsigned char)(ch)] & NEED_HTML_ESC_FLAG)
-
     while(1) {
-        /* Optimization: Use some loop unrolling. */
-        while(off + 3 < size  &&  !NEED_HTML_ESC(data[off+0])  &&  !NEED_HTML_ESC(data[off+1])
-                              &&  !NEED_HTML_ESC(data[off+2])  &&  !NEED_HTML_ESC(data[off+3]))
-            off += 4;
-        while(off < size  &&  !NEED_HTML_ESC(data[off]))
-            off++;
+        ESC_FIND_NEXT(r, html_esc_charset, NEED_HTML_ESC_FLAG, data, size, off);
 
-        if(off > beg)
-            MD_HTML_TRY(ret, render_verbatim(r, data + beg, off - beg));
+        if(off > beg) {
+            if(is_doc_text)
+                MD_HTML_TRY(ret, render_ref(r, data + beg, off - beg));
+            else
+                MD_HTML_TRY(ret, render_verbatim(r, data + beg, off - beg));
+        }
 
         if(off < size) {
             switch(data[off]) {
@@ -139,6 +482,18 @@ render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     return ret;
 }
 
+static int
+render_html_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
+{
+    return render_html_escaped_(r, data, size, 0);
+}
+
+static int
+render_text_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
+{
+    return render_html_escaped_(r, data, size, 1);
+}
+
 static int
 render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
@@ -147,12 +502,9 @@ render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     MD_OFFSET off = 0;
     int ret = 0;
 
-    /* Some characters need to be escaped in URL attributes. */
-    #define NEED_URL_ESC(ch)    (r->escape_map[(unsigned char)(ch)] & NEED_URL_ESC_FLAG)
-
     while(1) {
-        while(off < size  &&  !NEED_URL_ESC(data[off]))
-            off++;
+        ESC_FIND_NEXT(r, url_esc_charset, NEED_URL_ESC_FLAG, data, size, off);
+
         if(off > beg)
             MD_HTML_TRY(ret, render_verbatim(r, data + beg, off - beg));
 
@@ -179,17 +531,75 @@ render_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
     return ret;
 }
 
+static unsigned md_html_cache_hash(const MD_CHAR* input, MD_SIZE input_size,
+                                   unsigned parser_flags, unsigned renderer_flags);
+static const MD_HTML_LINK_MEMO_ENTRY* md_html_link_memo_lookup(MD_HTML_LINK_MEMO* memo,
+                unsigned kind, unsigned hash, const MD_CHAR* target, MD_SIZE target_size);
+static void md_html_link_memo_insert(MD_HTML_LINK_MEMO* memo, unsigned kind, unsigned hash,
+                const MD_CHAR* target, MD_SIZE target_size, const MD_CHAR* url, MD_SIZE url_size);
+
+/* The render function passed to render_code_link() and render_wiki_link()
+ * when the URL has to be remembered in the link memo. */
+static int
+render_resolved_url(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
+{
+    if(r->is_resolving) {
+        if(render_reserve(&r->resolved, &r->resolved_alloc, r->resolved_size + size) == 0) {
+            memcpy(r->resolved + r->resolved_size, data, size * sizeof(MD_CHAR));
+            r->resolved_size += size;
+        } else {
+            r->resolve_failed = 1;
+        }
+    }
+
+    return render_url_escaped(r, data, size);
+}
+
+/* Render the URL of a code link or wiki link target (kind is MD_SPAN_A_CODELINK
+ * or MD_SPAN_WIKILINK) via the application's resolver, or via the link memo
+ * if the resolver has seen the target already. */
+static int
+render_resolved_link(MD_HTML* r, unsigned kind, const MD_CHAR* data, MD_SIZE size,
+        int (*resolve)(const MD_CHAR*, MD_SIZE, void*, MD_HTML*,
+                       int (*)(MD_HTML*, const MD_CHAR*, MD_SIZE)))
+{
+    const MD_HTML_LINK_MEMO_ENTRY* entry;
+    unsigned hash;
+    int ret;
+
+    if(r->link_memo == NULL)
+        return resolve(data, size, r->userdata, r, render_url_escaped);
+
+    hash = md_html_cache_hash(data, size, kind, 0);
+    entry = md_html_link_memo_lookup(r->link_memo, kind, hash, data, size);
+    if(entry != NULL)
+        return render_url_escaped(r, MD_HTML_LINK_MEMO_URL(entry), entry->url_size);
+
+    r->is_resolving = 1;
+    r->resolve_failed = 0;
+    r->resolved_size = 0;
+    ret = resolve(data, size, r->userdata, r, render_resolved_url);
+    r->is_resolving = 0;
+
+    if(ret == 0  &&  !r->resolve_failed) {
+        md_html_link_memo_insert(r->link_memo, kind, hash, data, size,
+                                 r->resolved, r->resolved_size);
+    }
+    return ret;
+}
+
 static int
 render_codelink_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
     if (r->render_code_link) {
-        return r->render_code_link(data, size, r->userdata, r, render_url_escaped);
+        return render_resolved_link(r, MD_SPAN_A_CODELINK, data, size, r->render_code_link);
     } else {
         render_url_escaped(r, data, size);
         return 0;
     }
 }
 
+
 static int
 render_self_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
@@ -204,7 +614,7 @@ render_self_url_escaped(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 static int
 record_self_url(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
-    if (r->render_self_link)
+    if (r->record_self_link)
         return r->record_self_link(data, size, r->userdata);
     else
         return 0;
@@ -295,9 +705,7 @@ render_entity(MD_HTML* r, const MD_CHAR* text, MD_SIZE size,
 
         ent = entity_lookup(text, size);
         if(ent != NULL) {
-            MD_HTML_TRY(ret, render_utf8_codepoint(r, ent->codepoints[0], fn_append));
-            if(ent->codepoints[1])
-                MD_HTML_TRY(ret, render_utf8_codepoint(r, ent->codepoints[1], fn_append));
+            MD_HTML_TRY(ret, fn_append(r, ent->utf8, ent->utf8_size));
             return ret;
         }
     }
@@ -432,11 +840,224 @@ render_open_a_codelink_span(MD_HTML* r, const MD_SPAN_A_DETAIL* det)
     return ret;
 }
 
+/* Append the text of the heading to the slug: ASCII letters are lowercased,
+ * whitespace becomes '-', and any other ASCII character except alphanumerics,
+ * '-' and '_' is dropped. Anything else (i.e. UTF-8 sequences) is kept. */
+static int
+render_slug_append(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
+{
+    MD_SIZE i;
+
+    if(render_reserve(&r->slug, &r->slug_alloc, r->slug_size + size) != 0) {
+        r->self_link_failed = 1;
+        return -1;
+    }
+
+    for(i = 0; i < size; i++) {
+        MD_CHAR ch = data[i];
+
+        if(ISUPPER(ch))
+            ch += 'a' - 'A';
+        else if(ch == ' '  ||  ch == '\t'  ||  ch == '\n')
+            ch = '-';
+        else if(!ISALNUM(ch)  &&  ch != '-'  &&  ch != '_'  &&  (unsigned) ch < 0x80)
+            continue;
+        r->slug[r->slug_size++] = ch;
+    }
+
+    return 0;
+}
+
+static int
+render_slug_text(MD_HTML* r, MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size)
+{
+    switch(type) {
+        case MD_TEXT_NULLCHAR:  /* Pass through */
+        case MD_TEXT_HTML:      return 0;
+        case MD_TEXT_BR:        /* Pass through */
+        case MD_TEXT_SOFTBR:    return render_slug_append(r, " ", 1);
+        case MD_TEXT_ENTITY:
+            if(!(r->flags & MD_HTML_FLAG_VERBATIM_ENTITIES))
+                return render_entity(r, text, size, render_slug_append);
+            return render_slug_append(r, text, size);
+        default:                return render_slug_append(r, text, size);
+    }
+}
+
+static unsigned
+render_anchor_hash(const MD_CHAR* text, MD_SIZE size)
+{
+    unsigned hash = 2166136261U;
+    MD_SIZE i;
+
+    for(i = 0; i < size; i++) {
+        hash ^= (unsigned) text[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static MD_HTML_ANCHOR*
+render_find_anchor(MD_HTML* r, const MD_CHAR* text, MD_SIZE size, unsigned hash)
+{
+    unsigned mask = r->n_anchor_slots - 1;
+    unsigned i;
+
+    if(r->n_anchor_slots == 0)
+        return NULL;
+
+    for(i = hash & mask; r->anchor_slots[i] != 0; i = (i + 1) & mask) {
+        MD_HTML_ANCHOR* anchor = &r->anchors[r->anchor_slots[i] - 1];
+
+        if(anchor->hash == hash  &&  anchor->size == size  &&
+           memcmp(r->anchor_chars + anchor->off, text, size * sizeof(MD_CHAR)) == 0)
+            return anchor;
+    }
+    return NULL;
+}
+
+/* Append the anchor to the anchors (and, unless it is a range renderer,
+ * also to the hash set of them). */
+static MD_HTML_ANCHOR*
+render_add_anchor(MD_HTML* r, const MD_CHAR* text, MD_SIZE size, unsigned hash)
+{
+    MD_HTML_ANCHOR* anchor;
+    unsigned i;
+
+    if(r->n_anchors >= r->alloc_anchors) {
+        unsigned alloc_anchors = (r->alloc_anchors > 0 ? r->alloc_anchors * 2 : 16);
+        MD_HTML_ANCHOR* new_anchors;
+
+        new_anchors = (MD_HTML_ANCHOR*) realloc(r->anchors, alloc_anchors * sizeof(MD_HTML_ANCHOR));
+        if(new_anchors == NULL)
+            return NULL;
+        r->anchors = new_anchors;
+        r->alloc_anchors = alloc_anchors;
+    }
+    if(render_reserve(&r->anchor_chars, &r->anchor_chars_alloc, r->anchor_chars_size + size + 1) != 0)
+        return NULL;
+
+    /* Keep the load factor of the hash set below 3/4. */
+    if(!r->is_range  &&  (r->n_anchors + 1) * 4 > r->n_anchor_slots * 3) {
+        unsigned n_slots = (r->n_anchor_slots > 0 ? r->n_anchor_slots * 2 : 64);
+        unsigned* new_slots;
+        unsigned j;
+
+        new_slots = (unsigned*) calloc(n_slots, sizeof(unsigned));
+        if(new_slots == NULL)
+            return NULL;
+        for(j = 0; j < r->n_anchors; j++) {
+            for(i = r->anchors[j].hash & (n_slots - 1); new_slots[i] != 0; i = (i + 1) & (n_slots - 1))
+                ;
+            new_slots[i] = j + 1;
+        }
+        free(r->anchor_slots);
+        r->anchor_slots = new_slots;
+        r->n_anchor_slots = n_slots;
+    }
+
+    anchor = &r->anchors[r->n_anchors];
+    anchor->off = r->anchor_chars_size;
+    anchor->size = size;
+    anchor->hash = hash;
+    anchor->n_dups = 0;
+    anchor->pos = 0;
+    memcpy(r->anchor_chars + r->anchor_chars_size, text, size * sizeof(MD_CHAR));
+    r->anchor_chars_size += size;
+    r->n_anchors++;
+
+    if(!r->is_range) {
+        for(i = hash & (r->n_anchor_slots - 1); r->anchor_slots[i] != 0; i = (i + 1) & (r->n_anchor_slots - 1))
+            ;
+        r->anchor_slots[i] = r->n_anchors;
+    }
+
+    return anchor;
+}
+
+/* Forget the anchors of the previous document. */
+static void
+render_reset_anchors(MD_HTML* r)
+{
+    if(r->n_anchors > 0) {
+        if(r->n_anchor_slots > 0)
+            memset(r->anchor_slots, 0, r->n_anchor_slots * sizeof(unsigned));
+        r->n_anchors = 0;
+        r->anchor_chars_size = 0;
+    }
+}
+
+
+/* Render the opening tag of the self link with the anchor made from the slug
+ * (in r->slug). The first heading with a given slug gets it as it is, the
+ * next ones get "-1", "-2" etc. appended (skipping any anchor used already,
+ * e.g. by a heading "Foo 1"). */
+static int
+render_open_self_anchor(MD_HTML* r)
+{
+    MD_HTML_ANCHOR* anchor;
+    unsigned hash = render_anchor_hash(r->slug, r->slug_size);
+    int ret = 0;
+
+    anchor = render_find_anchor(r, r->slug, r->slug_size, hash);
+    if(anchor != NULL) {
+        MD_CHAR suffix[12];     /* '-' and up to 10 digits. */
+        MD_SIZE suffix_max = (MD_SIZE) (sizeof(suffix) / sizeof(MD_CHAR));
+        MD_SIZE suffix_beg;
+        unsigned n;
+
+        if(render_reserve(&r->slug, &r->slug_alloc, r->slug_size + suffix_max) != 0)
+            return -1;
+        do {
+            n = ++anchor->n_dups;
+            suffix_beg = suffix_max;
+            do {
+                suffix[--suffix_beg] = (MD_CHAR) ('0' + n % 10);
+                n /= 10;
+            } while(n > 0);
+            suffix[--suffix_beg] = '-';
+            memcpy(r->slug + r->slug_size, suffix + suffix_beg, (suffix_max - suffix_beg) * sizeof(MD_CHAR));
+            hash = render_anchor_hash(r->slug, r->slug_size + suffix_max - suffix_beg);
+        } while(render_find_anchor(r, r->slug, r->slug_size + suffix_max - suffix_beg, hash) != NULL);
+        r->slug_size += suffix_max - suffix_beg;
+    }
+
+    anchor = render_add_anchor(r, r->slug, r->slug_size, hash);
+    if(anchor == NULL)
+        return -1;
+
+    RENDER_VERBATIM(r, "<a name=\"");
+    MD_HTML_TRY(ret, render_url_escaped(r, r->slug, r->slug_size));
+    RENDER_VERBATIM(r, "\" href=\"#");
+    MD_HTML_TRY(ret, render_url_escaped(r, r->slug, r->slug_size));
+    RENDER_VERBATIM(r, "\">");
+    MD_HTML_TRY(ret, record_self_url(r, r->slug, r->slug_size));
+    return ret;
+}
+
 static int
 render_open_a_self_span(MD_HTML* r, const MD_SPAN_A_DETAIL* det)
 {
     int ret = 0;
 
+    if(r->render_self_link == NULL) {
+        /* Use the built-in slugger. We know the anchor only at the end of
+         * the heading, so defer its output until then. */
+        if(render_reserve(&r->head_buffer, &r->head_alloc, 1) != 0  ||
+           render_reserve(&r->slug, &r->slug_alloc, 1) != 0)
+            return -1;
+        r->saved_out_buffer = r->out_buffer;
+        r->saved_out_size = r->out_size;
+        r->saved_out_capacity = r->out_capacity;
+        r->out_buffer = r->head_buffer;
+        r->out_size = 0;
+        r->out_capacity = r->head_alloc;
+        r->slug_size = 0;
+        r->self_link_failed = 0;
+        r->in_self_link = 1;
+        return 0;
+    }
+
     RENDER_VERBATIM(r, "<a name=\"");
     MD_HTML_TRY(ret, render_attribute(r, &det->href, render_self_url_escaped));
     RENDER_VERBATIM(r, "\" href=\"#");
@@ -453,6 +1074,39 @@ render_open_a_self_span(MD_HTML* r, const MD_SPAN_A_DETAIL* det)
     return ret;
 }
 
+static int
+render_close_a_self_span(MD_HTML* r)
+{
+    int ret = 0;
+
+    if(r->in_self_link) {
+        const MD_CHAR* head = r->out_buffer;
+        MD_SIZE head_size = r->out_size;
+
+        render_end_defer(r);
+        if(r->self_link_failed)
+            return -1;
+
+        if(r->is_range) {
+            /* Only remember the slug and where the anchor goes. The renderer
+             * of the whole document makes it unique. */
+            MD_HTML_ANCHOR* anchor;
+
+            anchor = render_add_anchor(r, r->slug, r->slug_size, 0);
+            if(anchor == NULL)
+                return -1;
+            anchor->pos = r->range_size + r->out_size;
+        } else {
+            MD_HTML_TRY(ret, render_open_self_anchor(r));
+        }
+
+        MD_HTML_TRY(ret, render_verbatim(r, head, head_size));
+    }
+
+    RENDER_VERBATIM(r, "</a>");
+    return ret;
+}
+
 static int
 render_open_img_span(MD_HTML* r, const MD_SPAN_IMG_DETAIL* det)
 {
@@ -484,79 +1138,708 @@ render_close_img_span(MD_HTML* r, const MD_SPAN_IMG_DETAIL* det)
 }
 
 static int
-render_open_wikilink_span(MD_HTML* r, const MD_SPAN_WIKILINK_DETAIL* det)
+render_link_target_append(MD_HTML* r, const MD_CHAR* data, MD_SIZE size)
 {
-    int ret = 0;
-
-    RENDER_VERBATIM(r, "<x-wikilink data-target=\"");
-    MD_HTML_TRY(ret, render_attribute(r, &det->target, render_html_escaped));
-
-    RENDER_VERBATIM(r, "\">");
-    return ret;
+    if(render_reserve(&r->link_target, &r->link_target_alloc, r->link_target_size + size) != 0)
+        return -1;
+    memcpy(r->link_target + r->link_target_size, data, size * sizeof(MD_CHAR));
+    r->link_target_size += size;
+    return 0;
 }
 
-
-/**************************************
- ***  HTML renderer implementation  ***
- **************************************/
-
+/* Decode the attribute into link_target. */
 static int
-enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
+render_link_target(MD_HTML* r, const MD_ATTRIBUTE* attr)
 {
-    static const MD_CHAR* head[6] = { "<h1>", "<h2>", "<h3>", "<h4>", "<h5>", "<h6>" };
-    MD_HTML* r = (MD_HTML*) userdata;
+    int i;
     int ret = 0;
 
-    switch(type) {
-        case MD_BLOCK_DOC:      /* noop */ break;
-        case MD_BLOCK_QUOTE:    RENDER_VERBATIM(r, "<blockquote>\n"); break;
-        case MD_BLOCK_UL:       RENDER_VERBATIM(r, "<ul>\n"); break;
-        case MD_BLOCK_OL:       ret = render_open_ol_block(r, (const MD_BLOCK_OL_DETAIL*)detail); break;
-        case MD_BLOCK_LI:       ret = render_open_li_block(r, (const MD_BLOCK_LI_DETAIL*)detail); break;
-        case MD_BLOCK_HR:       RENDER_VERBATIM(r, (r->flags & MD_HTML_FLAG_XHTML) ? "<hr />\n" : "<hr>\n"); break;
-        case MD_BLOCK_H:        RENDER_VERBATIM(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]); break;
-        case MD_BLOCK_CODE:     ret = render_open_code_block(r, (const MD_BLOCK_CODE_DETAIL*) detail); break;
-        case MD_BLOCK_HTML:     /* noop */ break;
-        case MD_BLOCK_P:        RENDER_VERBATIM(r, "<p>"); break;
-        case MD_BLOCK_TABLE:    RENDER_VERBATIM(r, "<table>\n"); break;
-        case MD_BLOCK_THEAD:    RENDER_VERBATIM(r, "<thead>\n"); break;
-        case MD_BLOCK_TBODY:    RENDER_VERBATIM(r, "<tbody>\n"); break;
-        case MD_BLOCK_TR:       RENDER_VERBATIM(r, "<tr>\n"); break;
-        case MD_BLOCK_TH:       ret = render_open_td_block(r, "th", (MD_BLOCK_TD_DETAIL*)detail); break;
-        case MD_BLOCK_TD:       ret = render_open_td_block(r, "td", (MD_BLOCK_TD_DETAIL*)detail); break;
+    r->link_target_size = 0;
+    for(i = 0; attr->substr_offsets[i] < attr->size; i++) {
+        MD_TEXTTYPE type = attr->substr_types[i];
+        MD_OFFSET off = attr->substr_offsets[i];
+        MD_SIZE size = attr->substr_offsets[i+1] - off;
+        const MD_CHAR* text = attr->text + off;
+
+        if(type == MD_TEXT_NULLCHAR)
+            MD_HTML_TRY(ret, render_utf8_codepoint(r, 0x0000, render_link_target_append));
+        else if(type == MD_TEXT_ENTITY  &&  !(r->flags & MD_HTML_FLAG_VERBATIM_ENTITIES))
+            MD_HTML_TRY(ret, render_entity(r, text, size, render_link_target_append));
+        else
+            MD_HTML_TRY(ret, render_link_target_append(r, text, size));
     }
 
     return ret;
 }
 
 static int
-leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
+render_open_wikilink_span(MD_HTML* r, const MD_SPAN_WIKILINK_DETAIL* det)
 {
-    static const MD_CHAR* head[6] = { "</h1>\n", "</h2>\n", "</h3>\n", "</h4>\n", "</h5>\n", "</h6>\n" };
-    MD_HTML* r = (MD_HTML*) userdata;
     int ret = 0;
 
-    switch(type) {
-        case MD_BLOCK_DOC:      /*noop*/ break;
-        case MD_BLOCK_QUOTE:    RENDER_VERBATIM(r, "</blockquote>\n"); break;
-        case MD_BLOCK_UL:       RENDER_VERBATIM(r, "</ul>\n"); break;
-        case MD_BLOCK_OL:       RENDER_VERBATIM(r, "</ol>\n"); break;
-        case MD_BLOCK_LI:       RENDER_VERBATIM(r, "</li>\n"); break;
-        case MD_BLOCK_HR:       /*noop*/ break;
-        case MD_BLOCK_H:        RENDER_VERBATIM(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]); break;
-        case MD_BLOCK_CODE:     RENDER_VERBATIM(r, "</code></pre>\n"); break;
-        case MD_BLOCK_HTML:     /* noop */ break;
-        case MD_BLOCK_P:        RENDER_VERBATIM(r, "</p>\n"); break;
-        case MD_BLOCK_TABLE:    RENDER_VERBATIM(r, "</table>\n"); break;
-        case MD_BLOCK_THEAD:    RENDER_VERBATIM(r, "</thead>\n"); break;
-        case MD_BLOCK_TBODY:    RENDER_VERBATIM(r, "</tbody>\n"); break;
-        case MD_BLOCK_TR:       RENDER_VERBATIM(r, "</tr>\n"); break;
-        case MD_BLOCK_TH:       RENDER_VERBATIM(r, "</th>\n"); break;
-        case MD_BLOCK_TD:       RENDER_VERBATIM(r, "</td>\n"); break;
+    if(r->render_wiki_link != NULL) {
+        const MD_ATTRIBUTE* target = &det->target;
+
+        /* Unlike render_code_link(), the resolver gets the whole target at
+         * once, with any entities translated. */
+        if(target->substr_offsets[0] >= target->size  ||
+           (target->substr_types[0] == MD_TEXT_NORMAL  &&  target->substr_offsets[1] >= target->size)) {
+            RENDER_VERBATIM(r, "<a href=\"");
+            MD_HTML_TRY(ret, render_resolved_link(r, MD_SPAN_WIKILINK, target->text, target->size,
+                                                  r->render_wiki_link));
+        } else {
+            MD_HTML_TRY(ret, render_link_target(r, target));
+            RENDER_VERBATIM(r, "<a href=\"");
+            MD_HTML_TRY(ret, render_resolved_link(r, MD_SPAN_WIKILINK, r->link_target, r->link_target_size,
+                                                  r->render_wiki_link));
+        }
+        RENDER_VERBATIM(r, "\">");
+        return ret;
     }
 
-    return ret;
-}
+    RENDER_VERBATIM(r, "<x-wikilink data-target=\"");
+    MD_HTML_TRY(ret, render_attribute(r, &det->target, render_html_escaped));
+
+    RENDER_VERBATIM(r, "\">");
+    return ret;
+}
+
+
+/**********************
+ ***  Render cache  ***
+ **********************/
+
+#define MD_HTML_CACHE_SHARDS            16
+#define MD_HTML_CACHE_INITIAL_BUCKETS   16
+
+#ifdef MD_THREADS
+    #define MD_HTML_CACHE_LOCK(shard)       md_mutex_lock(&(shard)->mutex)
+    #define MD_HTML_CACHE_UNLOCK(shard)     md_mutex_unlock(&(shard)->mutex)
+#else
+    #define MD_HTML_CACHE_LOCK(shard)       do {} while(0)
+    #define MD_HTML_CACHE_UNLOCK(shard)     do {} while(0)
+#endif
+
+typedef struct MD_HTML_CACHE_ENTRY_tag MD_HTML_CACHE_ENTRY;
+struct MD_HTML_CACHE_ENTRY_tag {
+    MD_HTML_CACHE_ENTRY* next_in_bucket;
+    MD_HTML_CACHE_ENTRY* lru_prev;      /* More recently used. */
+    MD_HTML_CACHE_ENTRY* lru_next;      /* Less recently used. */
+    unsigned hash;
+    unsigned parser_flags;
+    unsigned renderer_flags;
+    unsigned n_readers;     /* Renderers passing the output to the application. */
+    int is_evicted;         /* Released by the last reader. */
+    MD_SIZE input_size;
+    MD_SIZE output_size;
+    /* Followed by the input and the output. */
+};
+
+#define MD_HTML_CACHE_INPUT(entry)      ((MD_CHAR*) ((entry) + 1))
+#define MD_HTML_CACHE_OUTPUT(entry)     (MD_HTML_CACHE_INPUT(entry) + (entry)->input_size)
+#define MD_HTML_CACHE_ENTRY_SIZE(input_size, output_size)                   \
+        (sizeof(MD_HTML_CACHE_ENTRY) + ((size_t) (input_size) + (output_size)) * sizeof(MD_CHAR))
+
+typedef struct MD_HTML_CACHE_SHARD_tag MD_HTML_CACHE_SHARD;
+struct MD_HTML_CACHE_SHARD_tag {
+#ifdef MD_THREADS
+    MD_MUTEX mutex;
+#endif
+    MD_HTML_CACHE_ENTRY** buckets;
+    unsigned n_buckets;                 /* Power of 2. */
+    MD_HTML_CACHE_ENTRY* lru_head;
+    MD_HTML_CACHE_ENTRY* lru_tail;
+    size_t size;
+    size_t n_entries;
+    size_t n_hits;
+    size_t n_misses;
+    size_t n_evictions;
+
+    /* Keep the shards (and their locks) in separate cache lines. */
+    char padding[64];
+};
+
+struct MD_HTML_CACHE_tag {
+    size_t max_shard_size;
+    MD_HTML_CACHE_SHARD shards[MD_HTML_CACHE_SHARDS];
+};
+
+static size_t
+md_html_cache_max_entry_size(const MD_HTML_CACHE* cache)
+{
+    return cache->max_shard_size;
+}
+
+/* Hash of the input and the flags. It only needs to spread the documents
+ * over the shards and the buckets (the input is then compared as a whole),
+ * but it has to be fast: It processes 16 bytes per iteration in four
+ * independent lanes (with the mixing of MurmurHash3). */
+#define MD_HTML_ROTL32(x, n)    (((x) << (n)) | ((x) >> (32 - (n))))
+
+static unsigned
+md_html_cache_hash(const MD_CHAR* input, MD_SIZE input_size,
+                   unsigned parser_flags, unsigned renderer_flags)
+{
+    const unsigned char* data = (const unsigned char*) input;
+    size_t size = (size_t) input_size * sizeof(MD_CHAR);
+    unsigned h[4];
+    unsigned hash;
+    int i;
+
+    h[0] = 0x9747b28cU ^ parser_flags;
+    h[1] = 0x85ebca6bU ^ renderer_flags;
+    h[2] = 0xc2b2ae35U ^ (unsigned) size;
+    h[3] = 0x27d4eb2fU;
+
+    while(size >= 16) {
+        for(i = 0; i < 4; i++) {
+            unsigned w;
+
+            memcpy(&w, data + 4 * i, 4);
+            w *= 0xcc9e2d51U;
+            w = MD_HTML_ROTL32(w, 15);
+            w *= 0x1b873593U;
+            h[i] ^= w;
+            h[i] = MD_HTML_ROTL32(h[i], 13) * 5 + 0xe6546b64U;
+        }
+        data += 16;
+        size -= 16;
+    }
+
+    hash = h[0] ^ MD_HTML_ROTL32(h[1], 7) ^ MD_HTML_ROTL32(h[2], 12) ^ MD_HTML_ROTL32(h[3], 18);
+    while(size > 0) {
+        hash = (hash ^ *data) * 16777619U;
+        data++;
+        size--;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+static MD_HTML_CACHE_SHARD*
+md_html_cache_shard(MD_HTML_CACHE* cache, unsigned hash)
+{
+    return &cache->shards[hash % MD_HTML_CACHE_SHARDS];
+}
+
+static MD_HTML_CACHE_ENTRY**
+md_html_cache_bucket(MD_HTML_CACHE_SHARD* shard, unsigned hash)
+{
+    /* The low bits have selected the shard already. */
+    return &shard->buckets[(hash / MD_HTML_CACHE_SHARDS) & (shard->n_buckets - 1)];
+}
+
+static MD_HTML_CACHE_ENTRY*
+md_html_cache_find(MD_HTML_CACHE_SHARD* shard, unsigned hash, const MD_CHAR* input,
+                   MD_SIZE input_size, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML_CACHE_ENTRY* entry;
+
+    for(entry = *md_html_cache_bucket(shard, hash); entry != NULL; entry = entry->next_in_bucket) {
+        if(entry->hash == hash  &&  entry->input_size == input_size  &&
+           entry->parser_flags == parser_flags  &&  entry->renderer_flags == renderer_flags  &&
+           (input_size == 0  ||
+            memcmp(MD_HTML_CACHE_INPUT(entry), input, (size_t) input_size * sizeof(MD_CHAR)) == 0))
+            return entry;
+    }
+
+    return NULL;
+}
+
+static void
+md_html_cache_lru_unlink(MD_HTML_CACHE_SHARD* shard, MD_HTML_CACHE_ENTRY* entry)
+{
+    if(entry->lru_prev != NULL)
+        entry->lru_prev->lru_next = entry->lru_next;
+    else
+        shard->lru_head = entry->lru_next;
+    if(entry->lru_next != NULL)
+        entry->lru_next->lru_prev = entry->lru_prev;
+    else
+        shard->lru_tail = entry->lru_prev;
+}
+
+static void
+md_html_cache_lru_push(MD_HTML_CACHE_SHARD* shard, MD_HTML_CACHE_ENTRY* entry)
+{
+    entry->lru_prev = NULL;
+    entry->lru_next = shard->lru_head;
+    if(shard->lru_head != NULL)
+        shard->lru_head->lru_prev = entry;
+    else
+        shard->lru_tail = entry;
+    shard->lru_head = entry;
+}
+
+static void
+md_html_cache_evict(MD_HTML_CACHE_SHARD* shard, MD_HTML_CACHE_ENTRY* entry)
+{
+    MD_HTML_CACHE_ENTRY** link = md_html_cache_bucket(shard, entry->hash);
+
+    while(*link != entry)
+        link = &(*link)->next_in_bucket;
+    *link = entry->next_in_bucket;
+    md_html_cache_lru_unlink(shard, entry);
+
+    shard->size -= MD_HTML_CACHE_ENTRY_SIZE(entry->input_size, entry->output_size);
+    shard->n_entries--;
+    shard->n_evictions++;
+
+    /* If some renderer is still passing the output to its application, it
+     * releases the entry when it is done. */
+    if(entry->n_readers > 0)
+        entry->is_evicted = 1;
+    else
+        free(entry);
+}
+
+/* Double the hashtable. On an allocation failure, we just live with longer
+ * buckets. */
+static void
+md_html_cache_grow(MD_HTML_CACHE_SHARD* shard)
+{
+    MD_HTML_CACHE_ENTRY** old_buckets = shard->buckets;
+    unsigned old_n_buckets = shard->n_buckets;
+    MD_HTML_CACHE_ENTRY** buckets;
+    unsigned i;
+
+    buckets = (MD_HTML_CACHE_ENTRY**) calloc((size_t) old_n_buckets * 2, sizeof(MD_HTML_CACHE_ENTRY*));
+    if(buckets == NULL)
+        return;
+
+    shard->buckets = buckets;
+    shard->n_buckets = old_n_buckets * 2;
+    for(i = 0; i < old_n_buckets; i++) {
+        MD_HTML_CACHE_ENTRY* entry = old_buckets[i];
+
+        while(entry != NULL) {
+            MD_HTML_CACHE_ENTRY* next = entry->next_in_bucket;
+            MD_HTML_CACHE_ENTRY** bucket = md_html_cache_bucket(shard, entry->hash);
+
+            entry->next_in_bucket = *bucket;
+            *bucket = entry;
+            entry = next;
+        }
+    }
+    free(old_buckets);
+}
+
+/* If the document is cached, pass its output to the application and return
+ * 0. Otherwise return -1. */
+static int
+md_html_cache_output(MD_HTML* r, unsigned hash, const MD_CHAR* input, MD_SIZE input_size)
+{
+    MD_HTML_CACHE_SHARD* shard = md_html_cache_shard(r->cache, hash);
+    MD_HTML_CACHE_ENTRY* entry;
+
+    MD_HTML_CACHE_LOCK(shard);
+    entry = md_html_cache_find(shard, hash, input, input_size, r->parser_flags, r->flags);
+    if(entry == NULL) {
+        shard->n_misses++;
+        MD_HTML_CACHE_UNLOCK(shard);
+        return -1;
+    }
+    shard->n_hits++;
+    md_html_cache_lru_unlink(shard, entry);
+    md_html_cache_lru_push(shard, entry);
+    entry->n_readers++;
+    MD_HTML_CACHE_UNLOCK(shard);
+
+    /* Do not hold the lock while the application processes the output. */
+    if(entry->output_size > 0)
+        render_process_output(r, MD_HTML_CACHE_OUTPUT(entry), entry->output_size);
+
+    MD_HTML_CACHE_LOCK(shard);
+    entry->n_readers--;
+    if(entry->n_readers == 0  &&  entry->is_evicted)
+        free(entry);
+    MD_HTML_CACHE_UNLOCK(shard);
+    return 0;
+}
+
+static void
+md_html_cache_insert(MD_HTML* r, unsigned hash, const MD_CHAR* input, MD_SIZE input_size)
+{
+    MD_HTML_CACHE* cache = r->cache;
+    MD_HTML_CACHE_SHARD* shard = md_html_cache_shard(cache, hash);
+    size_t entry_size = MD_HTML_CACHE_ENTRY_SIZE(input_size, r->range_size);
+    MD_HTML_CACHE_ENTRY* entry;
+
+    if(entry_size > cache->max_shard_size)
+        return;
+
+    entry = (MD_HTML_CACHE_ENTRY*) malloc(entry_size);
+    if(entry == NULL)
+        return;
+    memset(entry, 0, sizeof(MD_HTML_CACHE_ENTRY));
+    entry->hash = hash;
+    entry->parser_flags = r->parser_flags;
+    entry->renderer_flags = r->flags;
+    entry->input_size = input_size;
+    entry->output_size = r->range_size;
+    if(input_size > 0)
+        memcpy(MD_HTML_CACHE_INPUT(entry), input, (size_t) input_size * sizeof(MD_CHAR));
+    if(r->range_size > 0)
+        memcpy(MD_HTML_CACHE_OUTPUT(entry), r->range_output, (size_t) r->range_size * sizeof(MD_CHAR));
+
+    MD_HTML_CACHE_LOCK(shard);
+    if(md_html_cache_find(shard, hash, input, input_size, r->parser_flags, r->flags) != NULL) {
+        /* Another renderer has been faster. */
+        MD_HTML_CACHE_UNLOCK(shard);
+        free(entry);
+        return;
+    }
+
+    if(shard->n_entries >= shard->n_buckets)
+        md_html_cache_grow(shard);
+    entry->next_in_bucket = *md_html_cache_bucket(shard, hash);
+    *md_html_cache_bucket(shard, hash) = entry;
+    md_html_cache_lru_push(shard, entry);
+    shard->size += entry_size;
+    shard->n_entries++;
+
+    /* The new entry itself fits, so it is never evicted here. */
+    while(shard->size > cache->max_shard_size)
+        md_html_cache_evict(shard, shard->lru_tail);
+    MD_HTML_CACHE_UNLOCK(shard);
+}
+
+MD_HTML_CACHE*
+md_html_cache_create(size_t max_size)
+{
+    MD_HTML_CACHE* cache;
+    int i;
+
+    cache = (MD_HTML_CACHE*) calloc(1, sizeof(MD_HTML_CACHE));
+    if(cache == NULL)
+        return NULL;
+
+    cache->max_shard_size = max_size / MD_HTML_CACHE_SHARDS;
+    for(i = 0; i < MD_HTML_CACHE_SHARDS; i++) {
+        MD_HTML_CACHE_SHARD* shard = &cache->shards[i];
+
+        shard->buckets = (MD_HTML_CACHE_ENTRY**) calloc(MD_HTML_CACHE_INITIAL_BUCKETS,
+                                                         sizeof(MD_HTML_CACHE_ENTRY*));
+        if(shard->buckets == NULL) {
+            while(--i >= 0)
+                free(cache->shards[i].buckets);
+            free(cache);
+            return NULL;
+        }
+        shard->n_buckets = MD_HTML_CACHE_INITIAL_BUCKETS;
+    }
+
+#ifdef MD_THREADS
+    for(i = 0; i < MD_HTML_CACHE_SHARDS; i++)
+        md_mutex_init(&cache->shards[i].mutex);
+#endif
+    return cache;
+}
+
+void
+md_html_cache_get_stats(MD_HTML_CACHE* cache, MD_HTML_CACHE_STATS* stats)
+{
+    int i;
+
+    memset(stats, 0, sizeof(MD_HTML_CACHE_STATS));
+    for(i = 0; i < MD_HTML_CACHE_SHARDS; i++) {
+        MD_HTML_CACHE_SHARD* shard = &cache->shards[i];
+
+        MD_HTML_CACHE_LOCK(shard);
+        stats->n_hits += shard->n_hits;
+        stats->n_misses += shard->n_misses;
+        stats->n_evictions += shard->n_evictions;
+        stats->n_entries += shard->n_entries;
+        stats->size += shard->size;
+        MD_HTML_CACHE_UNLOCK(shard);
+    }
+}
+
+void
+md_html_cache_destroy(MD_HTML_CACHE* cache)
+{
+    int i;
+
+    if(cache == NULL)
+        return;
+
+    for(i = 0; i < MD_HTML_CACHE_SHARDS; i++) {
+        MD_HTML_CACHE_SHARD* shard = &cache->shards[i];
+        MD_HTML_CACHE_ENTRY* entry = shard->lru_head;
+
+        while(entry != NULL) {
+            MD_HTML_CACHE_ENTRY* next = entry->lru_next;
+            free(entry);
+            entry = next;
+        }
+        free(shard->buckets);
+#ifdef MD_THREADS
+        md_mutex_fini(&shard->mutex);
+#endif
+    }
+    free(cache);
+}
+
+
+/************************************
+ ***  Memo of the resolved links  ***
+ ************************************/
+
+#define MD_HTML_LINK_MEMO_INITIAL_BUCKETS   64
+
+/* The entries are never changed nor freed until md_html_link_memo_destroy(),
+ * so a renderer may use an entry it has found without holding the lock. */
+struct MD_HTML_LINK_MEMO_tag {
+#ifdef MD_THREADS
+    MD_MUTEX mutex;
+#endif
+    MD_HTML_LINK_MEMO_ENTRY** buckets;
+    unsigned n_buckets;                 /* Power of 2. */
+    size_t max_size;
+    size_t size;
+    size_t n_entries;
+    size_t n_hits;
+    size_t n_misses;
+};
+
+#ifdef MD_THREADS
+    #define MD_HTML_LINK_MEMO_LOCK(memo)    md_mutex_lock(&(memo)->mutex)
+    #define MD_HTML_LINK_MEMO_UNLOCK(memo)  md_mutex_unlock(&(memo)->mutex)
+#else
+    #define MD_HTML_LINK_MEMO_LOCK(memo)    do {} while(0)
+    #define MD_HTML_LINK_MEMO_UNLOCK(memo)  do {} while(0)
+#endif
+
+static MD_HTML_LINK_MEMO_ENTRY*
+md_html_link_memo_find(MD_HTML_LINK_MEMO* memo, unsigned kind, unsigned hash,
+                       const MD_CHAR* target, MD_SIZE target_size)
+{
+    MD_HTML_LINK_MEMO_ENTRY* entry;
+
+    for(entry = memo->buckets[hash & (memo->n_buckets - 1)]; entry != NULL; entry = entry->next_in_bucket) {
+        if(entry->hash == hash  &&  entry->kind == kind  &&  entry->target_size == target_size  &&
+           memcmp(MD_HTML_LINK_MEMO_TARGET(entry), target, (size_t) target_size * sizeof(MD_CHAR)) == 0)
+            return entry;
+    }
+
+    return NULL;
+}
+
+/* Double the hashtable. On an allocation failure, we just live with longer
+ * buckets. */
+static void
+md_html_link_memo_grow(MD_HTML_LINK_MEMO* memo)
+{
+    MD_HTML_LINK_MEMO_ENTRY** old_buckets = memo->buckets;
+    unsigned old_n_buckets = memo->n_buckets;
+    MD_HTML_LINK_MEMO_ENTRY** buckets;
+    unsigned i;
+
+    buckets = (MD_HTML_LINK_MEMO_ENTRY**) calloc((size_t) old_n_buckets * 2, sizeof(MD_HTML_LINK_MEMO_ENTRY*));
+    if(buckets == NULL)
+        return;
+
+    memo->buckets = buckets;
+    memo->n_buckets = old_n_buckets * 2;
+    for(i = 0; i < old_n_buckets; i++) {
+        MD_HTML_LINK_MEMO_ENTRY* entry = old_buckets[i];
+
+        while(entry != NULL) {
+            MD_HTML_LINK_MEMO_ENTRY* next = entry->next_in_bucket;
+            MD_HTML_LINK_MEMO_ENTRY** bucket = &buckets[entry->hash & (memo->n_buckets - 1)];
+
+            entry->next_in_bucket = *bucket;
+            *bucket = entry;
+            entry = next;
+        }
+    }
+    free(old_buckets);
+}
+
+static const MD_HTML_LINK_MEMO_ENTRY*
+md_html_link_memo_lookup(MD_HTML_LINK_MEMO* memo, unsigned kind, unsigned hash,
+                         const MD_CHAR* target, MD_SIZE target_size)
+{
+    MD_HTML_LINK_MEMO_ENTRY* entry;
+
+    MD_HTML_LINK_MEMO_LOCK(memo);
+    entry = md_html_link_memo_find(memo, kind, hash, target, target_size);
+    if(entry != NULL)
+        memo->n_hits++;
+    else
+        memo->n_misses++;
+    MD_HTML_LINK_MEMO_UNLOCK(memo);
+    return entry;
+}
+
+/* Remember the URL, unless the memo is full. */
+static void
+md_html_link_memo_insert(MD_HTML_LINK_MEMO* memo, unsigned kind, unsigned hash,
+                         const MD_CHAR* target, MD_SIZE target_size,
+                         const MD_CHAR* url, MD_SIZE url_size)
+{
+    size_t entry_size = MD_HTML_LINK_MEMO_ENTRY_SIZE(target_size, url_size);
+    MD_HTML_LINK_MEMO_ENTRY* entry;
+    MD_HTML_LINK_MEMO_ENTRY** bucket;
+
+    entry = (MD_HTML_LINK_MEMO_ENTRY*) malloc(entry_size);
+    if(entry == NULL)
+        return;
+    entry->hash = hash;
+    entry->kind = kind;
+    entry->target_size = target_size;
+    entry->url_size = url_size;
+    if(target_size > 0)
+        memcpy(MD_HTML_LINK_MEMO_TARGET(entry), target, (size_t) target_size * sizeof(MD_CHAR));
+    if(url_size > 0)
+        memcpy(MD_HTML_LINK_MEMO_URL(entry), url, (size_t) url_size * sizeof(MD_CHAR));
+
+    MD_HTML_LINK_MEMO_LOCK(memo);
+    if(memo->size + entry_size > memo->max_size  ||
+       md_html_link_memo_find(memo, kind, hash, target, target_size) != NULL)
+    {
+        /* Full, or another renderer has been faster. */
+        MD_HTML_LINK_MEMO_UNLOCK(memo);
+        free(entry);
+        return;
+    }
+
+    if(memo->n_entries >= memo->n_buckets)
+        md_html_link_memo_grow(memo);
+    bucket = &memo->buckets[hash & (memo->n_buckets - 1)];
+    entry->next_in_bucket = *bucket;
+    *bucket = entry;
+    memo->size += entry_size;
+    memo->n_entries++;
+    MD_HTML_LINK_MEMO_UNLOCK(memo);
+}
+
+MD_HTML_LINK_MEMO*
+md_html_link_memo_create(size_t max_size)
+{
+    MD_HTML_LINK_MEMO* memo;
+
+    memo = (MD_HTML_LINK_MEMO*) calloc(1, sizeof(MD_HTML_LINK_MEMO));
+    if(memo == NULL)
+        return NULL;
+
+    memo->buckets = (MD_HTML_LINK_MEMO_ENTRY**) calloc(MD_HTML_LINK_MEMO_INITIAL_BUCKETS,
+                                                        sizeof(MD_HTML_LINK_MEMO_ENTRY*));
+    if(memo->buckets == NULL) {
+        free(memo);
+        return NULL;
+    }
+    memo->n_buckets = MD_HTML_LINK_MEMO_INITIAL_BUCKETS;
+    memo->max_size = max_size;
+
+#ifdef MD_THREADS
+    md_mutex_init(&memo->mutex);
+#endif
+    return memo;
+}
+
+void
+md_html_link_memo_get_stats(MD_HTML_LINK_MEMO* memo, MD_HTML_LINK_MEMO_STATS* stats)
+{
+    MD_HTML_LINK_MEMO_LOCK(memo);
+    stats->n_hits = memo->n_hits;
+    stats->n_misses = memo->n_misses;
+    stats->n_entries = memo->n_entries;
+    stats->size = memo->size;
+    MD_HTML_LINK_MEMO_UNLOCK(memo);
+}
+
+void
+md_html_link_memo_destroy(MD_HTML_LINK_MEMO* memo)
+{
+    unsigned i;
+
+    if(memo == NULL)
+        return;
+
+    for(i = 0; i < memo->n_buckets; i++) {
+        MD_HTML_LINK_MEMO_ENTRY* entry = memo->buckets[i];
+
+        while(entry != NULL) {
+            MD_HTML_LINK_MEMO_ENTRY* next = entry->next_in_bucket;
+            free(entry);
+            entry = next;
+        }
+    }
+    free(memo->buckets);
+#ifdef MD_THREADS
+    md_mutex_fini(&memo->mutex);
+#endif
+    free(memo);
+}
+
+
+/**************************************
+ ***  HTML renderer implementation  ***
+ **************************************/
+
+static int
+enter_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    static const MD_CHAR* head[6] = { "<h1>", "<h2>", "<h3>", "<h4>", "<h5>", "<h6>" };
+    MD_HTML* r = (MD_HTML*) userdata;
+    int ret = 0;
+
+    switch(type) {
+        case MD_BLOCK_DOC:      render_reset_anchors(r); break;
+        case MD_BLOCK_QUOTE:    RENDER_VERBATIM(r, "<blockquote>\n"); break;
+        case MD_BLOCK_UL:       RENDER_VERBATIM(r, "<ul>\n"); break;
+        case MD_BLOCK_OL:       ret = render_open_ol_block(r, (const MD_BLOCK_OL_DETAIL*)detail); break;
+        case MD_BLOCK_LI:       ret = render_open_li_block(r, (const MD_BLOCK_LI_DETAIL*)detail); break;
+        case MD_BLOCK_HR:       RENDER_VERBATIM(r, (r->flags & MD_HTML_FLAG_XHTML) ? "<hr />\n" : "<hr>\n"); break;
+        case MD_BLOCK_H:        RENDER_VERBATIM(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]); break;
+        case MD_BLOCK_CODE:     ret = render_open_code_block(r, (const MD_BLOCK_CODE_DETAIL*) detail); break;
+        case MD_BLOCK_HTML:     /* noop */ break;
+        case MD_BLOCK_P:        RENDER_VERBATIM(r, "<p>"); break;
+        case MD_BLOCK_TABLE:    RENDER_VERBATIM(r, "<table>\n"); break;
+        case MD_BLOCK_THEAD:    RENDER_VERBATIM(r, "<thead>\n"); break;
+        case MD_BLOCK_TBODY:    RENDER_VERBATIM(r, "<tbody>\n"); break;
+        case MD_BLOCK_TR:       RENDER_VERBATIM(r, "<tr>\n"); break;
+        case MD_BLOCK_TH:       ret = render_open_td_block(r, "th", (MD_BLOCK_TD_DETAIL*)detail); break;
+        case MD_BLOCK_TD:       ret = render_open_td_block(r, "td", (MD_BLOCK_TD_DETAIL*)detail); break;
+    }
+
+    return ret;
+}
+
+static int
+leave_block_callback(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    static const MD_CHAR* head[6] = { "</h1>\n", "</h2>\n", "</h3>\n", "</h4>\n", "</h5>\n", "</h6>\n" };
+    MD_HTML* r = (MD_HTML*) userdata;
+    int ret = 0;
+
+    switch(type) {
+        case MD_BLOCK_DOC:      /*noop*/ break;
+        case MD_BLOCK_QUOTE:    RENDER_VERBATIM(r, "</blockquote>\n"); break;
+        case MD_BLOCK_UL:       RENDER_VERBATIM(r, "</ul>\n"); break;
+        case MD_BLOCK_OL:       RENDER_VERBATIM(r, "</ol>\n"); break;
+        case MD_BLOCK_LI:       RENDER_VERBATIM(r, "</li>\n"); break;
+        case MD_BLOCK_HR:       /*noop*/ break;
+        case MD_BLOCK_H:        RENDER_VERBATIM(r, head[((MD_BLOCK_H_DETAIL*)detail)->level - 1]); break;
+        case MD_BLOCK_CODE:     RENDER_VERBATIM(r, "</code></pre>\n"); break;
+        case MD_BLOCK_HTML:     /* noop */ break;
+        case MD_BLOCK_P:        RENDER_VERBATIM(r, "</p>\n"); break;
+        case MD_BLOCK_TABLE:    RENDER_VERBATIM(r, "</table>\n"); break;
+        case MD_BLOCK_THEAD:    RENDER_VERBATIM(r, "</thead>\n"); break;
+        case MD_BLOCK_TBODY:    RENDER_VERBATIM(r, "</tbody>\n"); break;
+        case MD_BLOCK_TR:       RENDER_VERBATIM(r, "</tr>\n"); break;
+        case MD_BLOCK_TH:       RENDER_VERBATIM(r, "</th>\n"); break;
+        case MD_BLOCK_TD:       RENDER_VERBATIM(r, "</td>\n"); break;
+    }
+
+    return ret;
+}
 
 static int
 enter_span_callback(MD_SPANTYPE type, void* detail, void* userdata)
@@ -622,13 +1905,13 @@ leave_span_callback(MD_SPANTYPE type, void* detail, void* userdata)
         case MD_SPAN_U:                 RENDER_VERBATIM(r, "</u>"); break;
         case MD_SPAN_A:                 RENDER_VERBATIM(r, "</a>"); break;
         case MD_SPAN_A_CODELINK:        RENDER_VERBATIM(r, "</a>"); break;
-        case MD_SPAN_A_SELF:            RENDER_VERBATIM(r, "</a>"); break;
+        case MD_SPAN_A_SELF:            ret = render_close_a_self_span(r); break;
         case MD_SPAN_IMG:               /*noop, handled above*/ break;
         case MD_SPAN_CODE:              RENDER_VERBATIM(r, "</code>"); break;
         case MD_SPAN_DEL:               RENDER_VERBATIM(r, "</del>"); break;
         case MD_SPAN_LATEXMATH:         /*fall through*/
         case MD_SPAN_LATEXMATH_DISPLAY: RENDER_VERBATIM(r, "</x-equation>"); break;
-        case MD_SPAN_WIKILINK:          RENDER_VERBATIM(r, "</x-wikilink>"); break;
+        case MD_SPAN_WIKILINK:          RENDER_VERBATIM(r, (r->render_wiki_link != NULL ? "</a>" : "</x-wikilink>")); break;
     }
 
     return ret;
@@ -640,6 +1923,9 @@ text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdat
     MD_HTML* r = (MD_HTML*) userdata;
     int ret = 0;
 
+    if(r->in_self_link)
+        MD_HTML_TRY(ret, render_slug_text(r, type, text, size));
+
     switch(type) {
         case MD_TEXT_NULLCHAR:  ret = render_utf8_codepoint(r, 0x0000, render_verbatim); break;
         case MD_TEXT_BR:        RENDER_VERBATIM(r, (r->image_nesting_level == 0
@@ -647,9 +1933,9 @@ text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdat
                                         : " "));
                                 break;
         case MD_TEXT_SOFTBR:    RENDER_VERBATIM(r, (r->image_nesting_level == 0 ? "\n" : " ")); break;
-        case MD_TEXT_HTML:      ret = render_verbatim(r, text, size); break;
+        case MD_TEXT_HTML:      ret = render_ref(r, text, size); break;
         case MD_TEXT_ENTITY:    ret = render_entity(r, text, size, render_html_escaped); break;
-        default:                ret = render_html_escaped(r, text, size); break;
+        default:                ret = render_text_escaped(r, text, size); break;
     }
 
     return ret;
@@ -663,47 +1949,546 @@ debug_log_callback(const char* msg, void* userdata)
         fprintf(stderr, "MD4C: %s\n", msg);
 }
 
-int
-md_html(const MD_CHAR* input, MD_SIZE input_size, MD_HTML_CALLBACKS callbacks,
-        void* userdata, unsigned parser_flags, unsigned renderer_flags)
+/* Free the buffers of the built-in anchors and of the link resolving. */
+static void
+render_free_buffers(MD_HTML* r)
+{
+    free(r->head_buffer);
+    free(r->slug);
+    free(r->anchors);
+    free(r->anchor_slots);
+    free(r->anchor_chars);
+    free(r->resolved);
+    free(r->link_target);
+}
+
+static void
+md_html_setup(MD_HTML* r, MD_HTML_CALLBACKS callbacks, unsigned renderer_flags)
 {
-    MD_HTML render = { callbacks.process_output, callbacks.render_self_link, callbacks.record_self_link, callbacks.render_code_link, userdata, renderer_flags, 0, { 0 } };
     int i;
 
-    MD_PARSER parser = {
-        0,
-        parser_flags,
-        enter_block_callback,
-        leave_block_callback,
-        enter_span_callback,
-        leave_span_callback,
-        text_callback,
-        debug_log_callback,
-        NULL
-    };
+    memset(r, 0, sizeof(MD_HTML));
+    r->process_output = callbacks.process_output;
+    r->process_output_iov = callbacks.process_output_iov;
+    r->render_self_link = callbacks.render_self_link;
+    r->record_self_link = callbacks.record_self_link;
+    r->render_code_link = callbacks.render_code_link;
+    r->render_wiki_link = callbacks.render_wiki_link;
+    r->flags = renderer_flags;
 
     /* Build map of characters which need escaping. */
     for(i = 0; i < 256; i++) {
         unsigned char ch = (unsigned char) i;
 
         if(strchr("\"&<>", ch) != NULL)
-            render.escape_map[i] |= NEED_HTML_ESC_FLAG;
+            r->escape_map[i] |= NEED_HTML_ESC_FLAG;
 
         if(!ISALNUM(ch)  &&  strchr("~-_.+!*(),%#@?=;:/,+$", ch) == NULL)
-            render.escape_map[i] |= NEED_URL_ESC_FLAG;
+            r->escape_map[i] |= NEED_URL_ESC_FLAG;
+    }
+#ifndef MD4C_USE_UTF16
+    {
+        char map[256];
+
+        for(i = 0; i < 256; i++)
+            map[i] = r->escape_map[i] & NEED_HTML_ESC_FLAG;
+        md_simd_charset_init(&r->html_esc_charset, map);
+        for(i = 0; i < 256; i++)
+            map[i] = r->escape_map[i] & NEED_URL_ESC_FLAG;
+        md_simd_charset_init(&r->url_esc_charset, map);
     }
+#endif
+}
+
+static void
+md_html_setup_parser(MD_PARSER* parser, unsigned parser_flags)
+{
+    memset(parser, 0, sizeof(MD_PARSER));
+    parser->flags = parser_flags;
+    parser->enter_block = enter_block_callback;
+    parser->leave_block = leave_block_callback;
+    parser->enter_span = enter_span_callback;
+    parser->leave_span = leave_span_callback;
+    parser->text = text_callback;
+    parser->debug_log = debug_log_callback;
+}
+
+/* UTF-8 byte order mark (BOM). */
+static const MD_CHAR md_html_bom[3] = { 0xef, 0xbb, 0xbf };
 
+static void
+md_html_skip_bom(MD_HTML* r, const MD_CHAR** p_input, MD_SIZE* p_input_size)
+{
     /* Consider skipping UTF-8 byte order mark (BOM). */
-    if(renderer_flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1) {
-        static const MD_CHAR bom[3] = { 0xef, 0xbb, 0xbf };
-        if(input_size >= sizeof(bom)  &&  memcmp(input, bom, sizeof(bom)) == 0) {
-            input += sizeof(bom);
-            input_size -= sizeof(bom);
+    if(r->flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1) {
+        if(*p_input_size >= sizeof(md_html_bom)  &&  memcmp(*p_input, md_html_bom, sizeof(md_html_bom)) == 0) {
+            *p_input += sizeof(md_html_bom);
+            *p_input_size -= sizeof(md_html_bom);
+        }
+    }
+}
+
+int
+md_html(const MD_CHAR* input, MD_SIZE input_size, MD_HTML_CALLBACKS callbacks,
+        void* userdata, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
+    MD_CHAR buffer[MD_HTML_DEFAULT_FLUSH_THRESHOLD];
+    MD_PARSER parser;
+    int ret;
+
+    md_html_setup(&render, callbacks, renderer_flags);
+    render.userdata = userdata;
+    render.out_buffer = buffer;
+    render.out_capacity = MD_HTML_DEFAULT_FLUSH_THRESHOLD;
+    md_html_setup_parser(&parser, parser_flags);
+    md_html_skip_bom(&render, &input, &input_size);
+
+    ret = md_parse(input, input_size, &parser, (void*) &render);
+    render_flush(&render);
+    render_free_buffers(&render);
+
+    return ret;
+}
+
+static void
+render_begin_to_buffer(MD_HTML* r, MD_CHAR* buffer, MD_SIZE buffer_size)
+{
+    if(buffer == NULL)
+        buffer_size = 0;
+
+    r->is_to_buffer = 1;
+    r->dest = buffer;
+    r->dest_size = buffer_size;
+    r->dest_needed = 0;
+    r->out_buffer = (buffer_size > 0 ? buffer : NULL);
+    r->out_size = 0;
+    r->out_capacity = buffer_size;
+}
+
+int
+md_html_to_buffer(const MD_CHAR* input, MD_SIZE input_size, MD_CHAR* buffer,
+                  MD_SIZE buffer_size, MD_SIZE* p_needed,
+                  unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML render;
+    MD_HTML_CALLBACKS callbacks;
+    MD_PARSER parser;
+    int ret;
+
+    memset(&callbacks, 0, sizeof(MD_HTML_CALLBACKS));
+    md_html_setup(&render, callbacks, renderer_flags);
+    render_begin_to_buffer(&render, buffer, buffer_size);
+    md_html_setup_parser(&parser, parser_flags);
+    md_html_skip_bom(&render, &input, &input_size);
+
+    ret = md_parse(input, input_size, &parser, (void*) &render);
+    render_flush(&render);
+    render_free_buffers(&render);
+
+    *p_needed = render.dest_needed;
+    return ret;
+}
+
+MD_HTML*
+md_html_create(MD_HTML_CALLBACKS callbacks, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML* r;
+    MD_PARSER parser;
+
+    r = (MD_HTML*) malloc(sizeof(MD_HTML));
+    if(r == NULL)
+        return NULL;
+    md_html_setup(r, callbacks, renderer_flags);
+
+    md_html_setup_parser(&parser, parser_flags);
+    r->parser_flags = parser_flags;
+    r->parser_ctx = md_parser_create(&parser);
+    if(r->parser_ctx == NULL) {
+        free(r);
+        return NULL;
+    }
+
+    if(md_html_set_flush_threshold(r, MD_HTML_DEFAULT_FLUSH_THRESHOLD) != 0) {
+        md_html_destroy(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+int
+md_html_set_flush_threshold(MD_HTML* r, MD_SIZE threshold)
+{
+    MD_CHAR* buffer = NULL;
+
+    /* Make sure nothing is lost from the old buffer. */
+    render_flush(r);
+
+    if(threshold > 0) {
+        buffer = (MD_CHAR*) malloc(threshold * sizeof(MD_CHAR));
+        if(buffer == NULL)
+            return -1;
+    }
+
+    free(r->out_buffer);
+    r->out_buffer = buffer;
+    r->out_capacity = threshold;
+    return 0;
+}
+
+int
+md_html_render(MD_HTML* r, const MD_CHAR* input, MD_SIZE input_size, void* userdata)
+{
+    const MD_CHAR* doc = input;
+    MD_SIZE doc_size = input_size;
+    unsigned hash = 0;
+    int ret;
+
+    r->userdata = userdata;
+    r->image_nesting_level = 0;
+    r->is_streaming = 0;
+
+    if(r->cache != NULL  &&  !(r->flags & MD_HTML_FLAG_NO_CACHE)) {
+        hash = md_html_cache_hash(input, input_size, r->parser_flags, r->flags);
+        if(md_html_cache_output(r, hash, input, input_size) == 0)
+            return 0;
+
+        r->is_caching = 1;
+        r->range_size = 0;
+        r->range_failed = 0;
+    }
+
+    md_html_skip_bom(r, &doc, &doc_size);
+    ret = md_parser_parse(r->parser_ctx, doc, doc_size, (void*) r);
+    render_flush(r);
+
+    if(r->is_caching) {
+        if(ret == 0  &&  !r->range_failed)
+            md_html_cache_insert(r, hash, input, input_size);
+        r->is_caching = 0;
+    }
+
+    return ret;
+}
+
+/* The BOM may be split between the chunks passed to md_html_feed(): Hold
+ * back the leading bytes of the document as long as they match the BOM.
+ * Returns -1 on error; otherwise the BOM is skipped, or the held bytes are
+ * passed to the parser once they do not match. */
+static int
+md_html_feed_bom(MD_HTML* r, const MD_CHAR** p_input, MD_SIZE* p_input_size)
+{
+    while(*p_input_size > 0  &&  r->n_bom_held < sizeof(md_html_bom)) {
+        if(**p_input != md_html_bom[r->n_bom_held]) {
+            r->bom_pending = 0;
+            return md_parser_feed(r->parser_ctx, md_html_bom, r->n_bom_held, (void*) r);
+        }
+        r->n_bom_held++;
+        (*p_input)++;
+        (*p_input_size)--;
+    }
+
+    if(r->n_bom_held == sizeof(md_html_bom))
+        r->bom_pending = 0;
+    return 0;
+}
+
+int
+md_html_render_tree(MD_HTML* r, const MD_TREE* tree, void* userdata)
+{
+    MD_PARSER parser;
+    int ret;
+
+    r->userdata = userdata;
+    r->image_nesting_level = 0;
+    r->is_streaming = 0;
+
+    md_html_setup_parser(&parser, 0);
+    ret = md_tree_replay(tree, &parser, (void*) r);
+    render_flush(r);
+
+    return ret;
+}
+
+/* Run md_html_render() or md_html_render_tree() with the output going into
+ * the buffer of the caller. */
+static int
+md_html_render_to_buffer_(MD_HTML* r, const MD_CHAR* input, MD_SIZE input_size,
+                          const MD_TREE* tree, MD_CHAR* buffer, MD_SIZE buffer_size,
+                          MD_SIZE* p_needed, void* userdata)
+{
+    MD_CHAR* out_buffer = r->out_buffer;
+    MD_SIZE out_capacity = r->out_capacity;
+    void (*process_output_iov)(const MD_HTML_IOV*, unsigned, void*) = r->process_output_iov;
+    int ret;
+
+    render_begin_to_buffer(r, buffer, buffer_size);
+    r->process_output_iov = NULL;
+
+    if(tree != NULL)
+        ret = md_html_render_tree(r, tree, userdata);
+    else
+        ret = md_html_render(r, input, input_size, userdata);
+
+    *p_needed = r->dest_needed;
+    r->is_to_buffer = 0;
+    r->out_buffer = out_buffer;
+    r->out_capacity = out_capacity;
+    r->process_output_iov = process_output_iov;
+    return ret;
+}
+
+int
+md_html_render_to_buffer(MD_HTML* r, const MD_CHAR* input, MD_SIZE input_size,
+                         MD_CHAR* buffer, MD_SIZE buffer_size, MD_SIZE* p_needed,
+                         void* userdata)
+{
+    return md_html_render_to_buffer_(r, input, input_size, NULL,
+                buffer, buffer_size, p_needed, userdata);
+}
+
+int
+md_html_render_tree_to_buffer(MD_HTML* r, const MD_TREE* tree, MD_CHAR* buffer,
+                              MD_SIZE buffer_size, MD_SIZE* p_needed, void* userdata)
+{
+    return md_html_render_to_buffer_(r, NULL, 0, tree,
+                buffer, buffer_size, p_needed, userdata);
+}
+
+void
+md_html_set_cache(MD_HTML* r, MD_HTML_CACHE* cache)
+{
+    r->cache = cache;
+}
+
+void
+md_html_set_link_memo(MD_HTML* r, MD_HTML_LINK_MEMO* memo)
+{
+    r->link_memo = memo;
+}
+
+int
+md_html_feed(MD_HTML* r, const MD_CHAR* input, MD_SIZE input_size, void* userdata)
+{
+    int ret = 0;
+
+    r->userdata = userdata;
+    if(!r->is_streaming) {
+        r->image_nesting_level = 0;
+        r->is_streaming = 1;
+        r->bom_pending = (r->flags & MD_HTML_FLAG_SKIP_UTF8_BOM  &&  sizeof(MD_CHAR) == 1);
+        r->n_bom_held = 0;
+    }
+
+    if(r->bom_pending)
+        ret = md_html_feed_bom(r, &input, &input_size);
+    if(ret == 0)
+        ret = md_parser_feed(r->parser_ctx, input, input_size, (void*) r);
+    if(ret != 0)
+        r->is_streaming = 0;
+
+    /* Whatever we have got so far, pass it to the application. */
+    render_flush(r);
+
+    return ret;
+}
+
+int
+md_html_finish(MD_HTML* r, void* userdata)
+{
+    int ret;
+
+    r->userdata = userdata;
+    if(!r->is_streaming) {
+        r->image_nesting_level = 0;
+        r->bom_pending = 0;
+    }
+    r->is_streaming = 0;
+
+    /* The document is shorter than the BOM, so what we hold is no BOM. */
+    ret = 0;
+    if(r->bom_pending) {
+        r->bom_pending = 0;
+        ret = md_parser_feed(r->parser_ctx, md_html_bom, r->n_bom_held, (void*) r);
+    }
+
+    if(ret == 0)
+        ret = md_parser_finish(r->parser_ctx, (void*) r);
+    render_flush(r);
+
+    return ret;
+}
+
+static int
+md_html_begin_range(unsigned index, void* userdata, void** p_range_userdata)
+{
+    MD_HTML* r = (MD_HTML*) userdata;
+    MD_HTML* range;
+
+    (void) index;
+
+    range = (MD_HTML*) malloc(sizeof(MD_HTML));
+    if(range == NULL)
+        return -1;
+
+    memcpy(range, r, sizeof(MD_HTML));
+    range->image_nesting_level = 0;
+    range->parser_ctx = NULL;
+    range->is_range = 1;
+    range->range_output = NULL;
+    range->range_size = 0;
+    range->range_alloc = 0;
+    range->range_failed = 0;
+    range->is_caching = 0;
+    range->process_output_iov = NULL;
+    range->n_iov = 0;
+    range->iov_copy_beg = 0;
+    range->is_to_buffer = 0;
+    range->in_self_link = 0;
+    range->head_buffer = NULL;
+    range->head_alloc = 0;
+    range->slug = NULL;
+    range->slug_alloc = 0;
+    range->anchors = NULL;
+    range->n_anchors = 0;
+    range->alloc_anchors = 0;
+    range->anchor_slots = NULL;
+    range->n_anchor_slots = 0;
+    range->anchor_chars = NULL;
+    range->anchor_chars_size = 0;
+    range->anchor_chars_alloc = 0;
+    range->resolved = NULL;
+    range->resolved_alloc = 0;
+    range->link_target = NULL;
+    range->link_target_alloc = 0;
+    range->out_size = 0;
+    /* The output buffer of a renderer writing into a buffer of the caller
+     * is the rest of that buffer, which may be anything. */
+    if(r->is_to_buffer)
+        range->out_capacity = MD_HTML_DEFAULT_FLUSH_THRESHOLD;
+    if(range->out_capacity > 0) {
+        range->out_buffer = (MD_CHAR*) malloc(range->out_capacity * sizeof(MD_CHAR));
+        if(range->out_buffer == NULL) {
+            free(range);
+            return -1;
         }
     }
 
-    int ret = md_parse(input, input_size, &parser, (void*) &render);
+    *p_range_userdata = (void*) range;
+    return 0;
+}
+
+/* Pass the output of the range on, making the anchors of its headings
+ * unique within the document on the way. */
+static int
+render_range_output(MD_HTML* r, MD_HTML* range)
+{
+    MD_SIZE pos = 0;
+    unsigned i;
+    int ret = 0;
+
+    for(i = 0; i < range->n_anchors; i++) {
+        const MD_HTML_ANCHOR* anchor = &range->anchors[i];
+
+        MD_HTML_TRY(ret, render_verbatim(r, range->range_output + pos, anchor->pos - pos));
+        pos = anchor->pos;
+
+        r->slug_size = 0;
+        if(render_reserve(&r->slug, &r->slug_alloc, anchor->size + 1) != 0)
+            return -1;
+        memcpy(r->slug, range->anchor_chars + anchor->off, anchor->size * sizeof(MD_CHAR));
+        r->slug_size = anchor->size;
+        MD_HTML_TRY(ret, render_open_self_anchor(r));
+    }
+
+    return render_verbatim(r, range->range_output + pos, range->range_size - pos);
+}
+
+static int
+md_html_end_range(unsigned index, void* range_userdata, int ret, void* userdata)
+{
+    MD_HTML* r = (MD_HTML*) userdata;
+    MD_HTML* range = (MD_HTML*) range_userdata;
+
+    (void) index;
+
+    if(ret == 0) {
+        render_flush(range);
+        if(range->range_failed)
+            ret = -1;
+        else
+            ret = render_range_output(r, range);
+    }
+
+    if(range->in_self_link)
+        render_end_defer(range);
+    render_free_buffers(range);
+    free(range->range_output);
+    free(range->out_buffer);
+    free(range);
+    return (ret == 0 ? 0 : -1);
+}
+
+int
+md_html_set_threads(MD_HTML* r, unsigned n_threads)
+{
+    static const MD_PARALLEL_CALLBACKS callbacks = { md_html_begin_range, md_html_end_range };
+
+    return md_parser_set_parallel(r->parser_ctx, n_threads, &callbacks);
+}
+
+int
+md_html_load(MD_HTML* r, const MD_CHAR* input, MD_SIZE input_size, void* userdata)
+{
+    MD_SIZE size = input_size;
+    int ret;
+
+    r->userdata = userdata;
+    r->image_nesting_level = 0;
+    r->is_streaming = 0;
+    md_html_skip_bom(r, &input, &input_size);
+    r->bom_size = size - input_size;
+
+    ret = md_parser_load(r->parser_ctx, input, input_size, (void*) r);
+    render_flush(r);
 
     return ret;
 }
 
+int
+md_html_edit(MD_HTML* r, MD_OFFSET off, MD_SIZE removed_size, const MD_CHAR* text,
+             MD_SIZE size, MD_EDIT_RESULT* result, void* userdata)
+{
+    int ret;
+
+    /* The BOM is not part of the document the parser knows about. */
+    if(off < r->bom_size)
+        return -1;
+
+    r->userdata = userdata;
+    r->image_nesting_level = 0;
+
+    /* The anchors are unique only among the headings in the blocks rendered
+     * by this call. */
+    render_reset_anchors(r);
+
+    ret = md_parser_edit(r->parser_ctx, off - r->bom_size, removed_size, text, size, result, (void*) r);
+    render_flush(r);
+
+    return ret;
+}
+
+void
+md_html_destroy(MD_HTML* r)
+{
+    if(r == NULL)
+        return;
+
+    if(r->parser_ctx != NULL)
+        md_parser_destroy(r->parser_ctx);
+    render_free_buffers(r);
+    free(r->range_output);
+    free(r->out_buffer);
+    free(r);
+}
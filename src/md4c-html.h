@@ -38,12 +38,24 @@
 #define MD_HTML_FLAG_VERBATIM_ENTITIES      0x0002
 #define MD_HTML_FLAG_SKIP_UTF8_BOM          0x0004
 #define MD_HTML_FLAG_XHTML                  0x0008
+/* Do not use the cache set with md_html_set_cache(). */
+#define MD_HTML_FLAG_NO_CACHE               0x0010
 
 
 typedef struct MD_HTML_tag MD_HTML;
 struct MD_HTML_tag;
 
 
+/* A segment of the output for process_output_iov(). On the usual platforms,
+ * it has the same layout as struct iovec, so an array of them may be passed
+ * to writev() as it is. */
+typedef struct MD_HTML_IOV_tag MD_HTML_IOV;
+struct MD_HTML_IOV_tag {
+    const MD_CHAR* data;
+    size_t size;
+};
+
+
 typedef struct MD_HTML_CALLBACKS_tag MD_HTML_CALLBACKS;
 struct MD_HTML_CALLBACKS_tag {
     /*
@@ -52,7 +64,7 @@ struct MD_HTML_CALLBACKS_tag {
      * Typical implementation may just output the bytes to a file or append to
      * some buffer.
      *
-     * This callback is required.
+     * This callback is required, unless process_output_iov is set.
      */
      void (*process_output)(const MD_CHAR*, MD_SIZE, void*);
     /* The callback receives the text in the self link and can adjust the text to what the
@@ -64,13 +76,19 @@ struct MD_HTML_CALLBACKS_tag {
      * If it returns non-0 to report an error, that error will be passed back to the parser and
      * terminate parsing.
      *
-     * This callback is optional, and may be NULL.
+     * This callback is optional, and may be NULL. If it is NULL, the anchor is made from the
+     * plain text of the heading (ASCII letters lowercased, whitespace turned into '-', other
+     * ASCII punctuation dropped), and it is made unique within the document by appending
+     * "-1", "-2" etc. to the repeated ones.
      */
     int (*render_self_link)(const MD_CHAR* /*chars*/, MD_SIZE /*size*/, void* /*userdata*/, MD_HTML* /*html*/,
             int (*render)(MD_HTML* /*html*/, const MD_CHAR* /*chars*/, MD_SIZE /*size*/));
     /* Called after render_self_link was called, in order to mutate any state recording the link
      * that was generated, if needed. Allows each link to be unique.
      *
+     * Without render_self_link, it is called with the (unique) anchor made for the heading,
+     * always on the calling thread and in the order of the document.
+     *
      * If it returns non-0 to report an error, that error will be passed back to the parser and
      * terminate parsing.
      *
@@ -87,6 +105,27 @@ struct MD_HTML_CALLBACKS_tag {
      */
     int (*render_code_link)(const MD_CHAR* /*chars*/, MD_SIZE /*size*/, void* /*userdata*/, MD_HTML* /*html*/,
             int (*render)(MD_HTML* /*html*/, const MD_CHAR* /*chars*/, MD_SIZE /*size*/));
+    /* The same as render_code_link, but for the target of a wiki link: `[[the target|label]]`.
+     * If set, wiki links are rendered as <a href="..."> with the URL instead of
+     * <x-wikilink data-target="...">.
+     *
+     * This callback is optional, and may be NULL.
+     */
+    int (*render_wiki_link)(const MD_CHAR* /*chars*/, MD_SIZE /*size*/, void* /*userdata*/, MD_HTML* /*html*/,
+            int (*render)(MD_HTML* /*html*/, const MD_CHAR* /*chars*/, MD_SIZE /*size*/));
+    /* Alternative to process_output for scatter-gather output (e.g. with
+     * writev()): If set, it is called instead of process_output, with batches
+     * of segments of the output in the right order. Longer runs of text are
+     * not copied: Such segments point directly into the input. The others
+     * point into the output buffer of the renderer (or into the cache). All
+     * of them are valid only until the callback returns.
+     *
+     * The output is flushed at the same times as with process_output (see
+     * md_html_set_flush_threshold()), and also whenever the batch gets full.
+     *
+     * This callback is optional, and may be NULL.
+     */
+    void (*process_output_iov)(const MD_HTML_IOV* /*iov*/, unsigned /*n_iov*/, void* /*userdata*/);
 };
 
 /* Render Markdown into HTML.
@@ -108,6 +147,203 @@ int md_html(const MD_CHAR* input, MD_SIZE input_size, MD_HTML_CALLBACKS callback
             void* userdata, unsigned parser_flags, unsigned renderer_flags);
 
 
+/* The renderer does not pass each HTML fragment (a tag, an escaped piece of
+ * text, ...) to process_output() separately. It collects the output in an
+ * internal buffer and flushes it to process_output() whenever the buffer
+ * reaches the flush threshold, and at the end of each document.
+ *
+ * md_html() always uses the default threshold.
+ */
+#define MD_HTML_DEFAULT_FLUSH_THRESHOLD     4096
+
+/* Reusable renderer.
+ *
+ * When many documents are rendered with the same callbacks and flags, it is
+ * cheaper to create the renderer once and then call md_html_render() for each
+ * of them: The renderer keeps its output buffer as well as the internal
+ * buffers of the parser (see md_parser_create()) between the documents.
+ *
+ * md_html_create() returns NULL on an allocation failure.
+ *
+ * md_html_set_flush_threshold() changes the size of the output buffer. Zero
+ * disables the buffering: Each fragment is then passed to process_output()
+ * as soon as it is generated. Returns -1 on an allocation failure (the old
+ * buffer is then kept), 0 on success.
+ *
+ * md_html_render() renders one document. Its params and return value have
+ * the same meaning as with md_html(). The renderer must not be used from
+ * multiple threads at the same time.
+ */
+MD_HTML* md_html_create(MD_HTML_CALLBACKS callbacks, unsigned parser_flags, unsigned renderer_flags);
+int md_html_set_flush_threshold(MD_HTML* html, MD_SIZE threshold);
+int md_html_render(MD_HTML* html, const MD_CHAR* input, MD_SIZE input_size, void* userdata);
+void md_html_destroy(MD_HTML* html);
+
+/* Render large documents on up to n_threads threads (including the calling
+ * one). See md_parser_set_parallel() for the details. The output of each
+ * part of the document is collected in memory and passed to process_output()
+ * in the right order on the calling thread, but the other callbacks
+ * (render_self_link() etc.) may then be called from multiple threads at the
+ * same time, and not in the order of the document.
+ *
+ * Zero or one disables it (the default). Returns -1 if md4c has been built
+ * without support for threads.
+ */
+int md_html_set_threads(MD_HTML* html, unsigned n_threads);
+
+/* Streaming input: Render the document passed in arbitrary chunks, calling
+ * md_html_finish() after the last one. See md_parser_feed() for the details.
+ *
+ * Each md_html_feed() call also flushes the output buffer, so any HTML which
+ * could be generated from the input received so far is passed to the
+ * process_output() callback before the call returns.
+ */
+int md_html_feed(MD_HTML* html, const MD_CHAR* input, MD_SIZE input_size, void* userdata);
+int md_html_finish(MD_HTML* html, void* userdata);
+
+/* Incremental re-parse: md_html_load() renders the whole document like
+ * md_html_render(). Each md_html_edit() then renders only the HTML of the
+ * top-level blocks affected by the edit; *result tells which of the blocks
+ * rendered previously it replaces. See md_parser_edit() for the details.
+ *
+ * The offset of the edit refers to the input passed to md_html_load(), but
+ * the edit must not touch the UTF-8 BOM if the input starts with one.
+ *
+ * Note the built-in anchors of heading self links (see render_self_link())
+ * rendered by md_html_edit() are unique only among the re-rendered blocks.
+ */
+int md_html_load(MD_HTML* html, const MD_CHAR* input, MD_SIZE input_size, void* userdata);
+int md_html_edit(MD_HTML* html, MD_OFFSET off, MD_SIZE removed_size, const MD_CHAR* text,
+                 MD_SIZE size, MD_EDIT_RESULT* result, void* userdata);
+
+/* Render a document tree (see md_parse_tree()) without parsing the document
+ * again. The params and return value have the same meaning as with
+ * md_html_render(). Note the tree should be built from the input without
+ * the UTF-8 BOM: Unlike md_html_render(), this cannot skip it.
+ */
+int md_html_render_tree(MD_HTML* html, const MD_TREE* tree, void* userdata);
+
+/* Render into a buffer provided by the caller instead of calling
+ * process_output(). The HTML is written directly into the buffer (it is not
+ * terminated with a zero), so a pool of fixed-size buffers may be used
+ * without any reallocations or copying of the output.
+ *
+ * *p_needed is always set to the exact size of the whole output. If it is
+ * greater than buffer_size, the output did not fit: The buffer then holds
+ * only some beginning of it, and the caller may render it again into a big
+ * enough buffer. With buffer set to NULL (or buffer_size set to zero), the
+ * output is only counted and nothing is written.
+ *
+ * md_html_to_buffer() is a counterpart of md_html() without any callbacks.
+ * md_html_render_to_buffer() and md_html_render_tree_to_buffer() use the
+ * callbacks of the reusable renderer (except the output ones) and otherwise
+ * work as md_html_render() and md_html_render_tree(). To avoid parsing the
+ * document again when a second pass is needed, parse it with md_parse_tree()
+ * and render the tree twice.
+ *
+ * Returns -1 on error (if md_parse() fails), 0 otherwise (even if the output
+ * did not fit).
+ */
+int md_html_to_buffer(const MD_CHAR* input, MD_SIZE input_size, MD_CHAR* buffer,
+                      MD_SIZE buffer_size, MD_SIZE* p_needed,
+                      unsigned parser_flags, unsigned renderer_flags);
+int md_html_render_to_buffer(MD_HTML* html, const MD_CHAR* input, MD_SIZE input_size,
+                             MD_CHAR* buffer, MD_SIZE buffer_size, MD_SIZE* p_needed,
+                             void* userdata);
+int md_html_render_tree_to_buffer(MD_HTML* html, const MD_TREE* tree, MD_CHAR* buffer,
+                                  MD_SIZE buffer_size, MD_SIZE* p_needed, void* userdata);
+
+
+/* Render cache.
+ *
+ * Services rendering the same documents over and over (templates, repeated
+ * comments, ...) may let the renderers share a cache of the rendered HTML.
+ * The cache is keyed by the input (compared byte by byte, so hash collisions
+ * are harmless) together with the parser and renderer flags. When
+ * md_html_render() finds the document in the cache, it passes the cached
+ * HTML to process_output() in a single call, without parsing it. Otherwise
+ * it renders the document as usual, and stores a copy of its output.
+ *
+ * The cache is split into shards, each with its own lock and its own least
+ * recently used list, so renderers on many threads (each thread with its
+ * own MD_HTML) may share one cache. When md4c is built without threads, the
+ * cache must not be used from multiple threads.
+ *
+ * Param max_size of md_html_cache_create() limits the memory taken by the
+ * cached documents (their input and output). When a new document does not
+ * fit, the least recently used ones in its shard are evicted. Documents
+ * larger than 1/16 of max_size are never cached. md_html_cache_create()
+ * returns NULL on an allocation failure.
+ *
+ * The cache assumes the output depends only on the input and the flags.
+ * So all the renderers sharing the cache have to use the same
+ * render_self_link(), render_code_link() and render_wiki_link() callbacks
+ * (the built-in anchors used without render_self_link() are fine), and if
+ * these make the output depend on any other state (e.g. numbering of
+ * repeated anchors via record_self_link()), such renderer has to opt out with
+ * MD_HTML_FLAG_NO_CACHE (or do without md_html_set_cache()).
+ *
+ * Only md_html_render() uses the cache. The cache must outlive all the
+ * renderers using it.
+ */
+typedef struct MD_HTML_CACHE_tag MD_HTML_CACHE;
+
+typedef struct MD_HTML_CACHE_STATS {
+    size_t n_hits;
+    size_t n_misses;
+    size_t n_evictions;
+    size_t n_entries;
+    size_t size;            /* Memory taken by the cached documents. */
+} MD_HTML_CACHE_STATS;
+
+MD_HTML_CACHE* md_html_cache_create(size_t max_size);
+void md_html_cache_get_stats(MD_HTML_CACHE* cache, MD_HTML_CACHE_STATS* stats);
+void md_html_cache_destroy(MD_HTML_CACHE* cache);
+
+/* Set the cache for the renderer (NULL to stop using it). */
+void md_html_set_cache(MD_HTML* html, MD_HTML_CACHE* cache);
+
+
+/* Link memo.
+ *
+ * Resolving the targets of code links and wiki links (render_code_link() and
+ * render_wiki_link()) may be expensive, and the same targets tend to repeat
+ * over the pages of a site. With a link memo set, the renderer looks the
+ * target up in the memo first, and calls the callback only if it is not
+ * there. The URL the callback passes to the render function is then
+ * remembered for the next time.
+ *
+ * Param max_size of md_html_link_memo_create() limits the memory taken by the
+ * remembered targets and URLs. When the memo is full, it stops growing, and
+ * any new targets are then always resolved by the callbacks. Nothing is ever
+ * evicted, so the memo may be shared by the renderers of one site build on
+ * many threads (each thread with its own MD_HTML) without them invalidating
+ * what the others read; when md4c is built without threads, it must not be
+ * used from multiple threads. md_html_link_memo_create() returns NULL on an
+ * allocation failure.
+ *
+ * All the renderers sharing the memo have to use the same callbacks, which
+ * have to resolve each target always to the same URL and render it only via
+ * the render function. Create a new memo whenever that changes (e.g. for the
+ * next build). The memo must outlive all the renderers using it.
+ */
+typedef struct MD_HTML_LINK_MEMO_tag MD_HTML_LINK_MEMO;
+
+typedef struct MD_HTML_LINK_MEMO_STATS {
+    size_t n_hits;
+    size_t n_misses;
+    size_t n_entries;
+    size_t size;            /* Memory taken by the remembered links. */
+} MD_HTML_LINK_MEMO_STATS;
+
+MD_HTML_LINK_MEMO* md_html_link_memo_create(size_t max_size);
+void md_html_link_memo_get_stats(MD_HTML_LINK_MEMO* memo, MD_HTML_LINK_MEMO_STATS* stats);
+void md_html_link_memo_destroy(MD_HTML_LINK_MEMO* memo);
+
+/* Set the link memo for the renderer (NULL to stop using it). */
+void md_html_set_link_memo(MD_HTML* html, MD_HTML_LINK_MEMO* memo);
+
+
 #ifdef __cplusplus
     }  /* extern "C" { */
 #endif
@@ -26,6 +26,7 @@
 #include "md4c.h"
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -46,6 +47,9 @@
     #endif
 #endif
 
+#include "simd.h"
+#include "thread.h"
+
 /* Make the UTF-8 support the default. */
 #if !defined MD4C_USE_ASCII && !defined MD4C_USE_UTF8 && !defined MD4C_USE_UTF16
     #define MD4C_USE_UTF8
@@ -117,6 +121,72 @@
 /* Suppress "unused parameter" warnings. */
 #define MD_UNUSED(x)                ((void)x)
 
+/* Collecting of MD_PARSE_STATS. Without MD4C_ENABLE_STATS, all of it expands
+ * to nothing. (MD_STATS_TIMER() declares a variable, so use it among other
+ * declarations and without any semicolon.) */
+#ifdef MD4C_ENABLE_STATS
+    #ifdef _WIN32
+        #ifndef WIN32_LEAN_AND_MEAN
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #include <windows.h>
+    #else
+        #include <time.h>
+    #endif
+
+    static double
+    md_stats_clock(void)
+    {
+    #ifdef _WIN32
+        LARGE_INTEGER freq, now;
+
+        QueryPerformanceFrequency(&freq);
+        QueryPerformanceCounter(&now);
+        return (double) now.QuadPart / (double) freq.QuadPart;
+    #else
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+    #endif
+    }
+
+    #define MD_STATS_TIMER(t)       double t;
+    #define MD_STATS_START(t)                                               \
+        do {                                                                \
+            (t) = (ctx->parser.stats != NULL ? md_stats_clock() : 0.0);     \
+        } while(0)
+    #define MD_STATS_STOP(t, member)                                        \
+        do {                                                                \
+            if(ctx->parser.stats != NULL)                                   \
+                ctx->parser.stats->member += md_stats_clock() - (t);        \
+        } while(0)
+    #define MD_STATS_ADD(member, n)                                         \
+        do {                                                                \
+            if(ctx->parser.stats != NULL)                                   \
+                ctx->parser.stats->member += (n);                           \
+        } while(0)
+#else
+    #define MD_STATS_TIMER(t)
+    #define MD_STATS_START(t)           do {} while(0)
+    #define MD_STATS_STOP(t, member)    do {} while(0)
+    #define MD_STATS_ADD(member, n)     do {} while(0)
+#endif
+
+/* Call an application callback (for MD_PARSE_STATS::callback_time). */
+#ifdef MD4C_ENABLE_STATS
+    #define MD_CALLBACK(ret, call)                                          \
+        do {                                                                \
+            MD_STATS_TIMER(md_stats_t0_)                                    \
+            MD_STATS_START(md_stats_t0_);                                   \
+            (ret) = (call);                                                 \
+            MD_STATS_STOP(md_stats_t0_, callback_time);                     \
+            MD_STATS_ADD(n_callbacks, 1);                                   \
+        } while(0)
+#else
+    #define MD_CALLBACK(ret, call)      do { (ret) = (call); } while(0)
+#endif
+
 
 /************************
  ***  Internal Types  ***
@@ -131,6 +201,8 @@ typedef struct MD_MARK_tag MD_MARK;
 typedef struct MD_BLOCK_tag MD_BLOCK;
 typedef struct MD_CONTAINER_tag MD_CONTAINER;
 typedef struct MD_REF_DEF_tag MD_REF_DEF;
+typedef struct MD_ARENA_CHUNK_tag MD_ARENA_CHUNK;
+typedef struct MD_SPAN_ATTRS_tag MD_SPAN_ATTRS;
 
 
 /* During analyzes of inline marks, we need to manage some "mark chains",
@@ -152,19 +224,29 @@ struct MD_CTX_tag {
     MD_PARSER parser;
     void* userdata;
 
+    /* Parallel processing of the blocks. See md_parser_set_parallel(). */
+    unsigned n_threads;
+    MD_PARALLEL_CALLBACKS parallel;
+
     /* When this is true, it allows some optimizations. */
     int doc_ends_with_newline;
 
     /* Helper temporary growing buffer. */
     CHAR* buffer;
-    unsigned alloc_buffer;
+    SZ alloc_buffer;
+
+    /* Arena for short-lived allocations. See md_arena_alloc(). */
+    MD_ARENA_CHUNK* arena_first;
+    MD_ARENA_CHUNK* arena_current;
+    size_t arena_used;
 
     /* Reference definitions. */
     MD_REF_DEF* ref_defs;
     int n_ref_defs;
     int alloc_ref_defs;
-    void** ref_def_hashtable;
+    MD_REF_DEF** ref_def_hashtable;     /* Open addressing, size is power of 2. */
     int ref_def_hashtable_size;
+    int n_ref_defs_in_hashtable;    /* Any ref. defs beyond are not hashed (yet). */
 
     /* Stack of inline/span markers.
      * This is only used for parsing a single block contents but by storing it
@@ -178,32 +260,48 @@ struct MD_CTX_tag {
     char mark_char_map[128];
 #else
     char mark_char_map[256];
+    MD_SIMD_CHARSET mark_charset;   /* The same set, for md_simd_find(). */
+    MD_SIMD_CHARSET table_row_charset;  /* See md_scan_table_row(). */
 #endif
 
     /* For resolving of inline spans. */
-    MD_MARKCHAIN mark_chains[13];
-#define PTR_CHAIN                               (ctx->mark_chains[0])
-#define TABLECELLBOUNDARIES                     (ctx->mark_chains[1])
-#define ASTERISK_OPENERS_extraword_mod3_0       (ctx->mark_chains[2])
-#define ASTERISK_OPENERS_extraword_mod3_1       (ctx->mark_chains[3])
-#define ASTERISK_OPENERS_extraword_mod3_2       (ctx->mark_chains[4])
-#define ASTERISK_OPENERS_intraword_mod3_0       (ctx->mark_chains[5])
-#define ASTERISK_OPENERS_intraword_mod3_1       (ctx->mark_chains[6])
-#define ASTERISK_OPENERS_intraword_mod3_2       (ctx->mark_chains[7])
-#define UNDERSCORE_OPENERS                      (ctx->mark_chains[8])
-#define TILDE_OPENERS_1                         (ctx->mark_chains[9])
-#define TILDE_OPENERS_2                         (ctx->mark_chains[10])
-#define BRACKET_OPENERS                         (ctx->mark_chains[11])
-#define DOLLAR_OPENERS                          (ctx->mark_chains[12])
+    MD_MARKCHAIN mark_chains[12];
+#define TABLECELLBOUNDARIES                     (ctx->mark_chains[0])
+#define ASTERISK_OPENERS_extraword_mod3_0       (ctx->mark_chains[1])
+#define ASTERISK_OPENERS_extraword_mod3_1       (ctx->mark_chains[2])
+#define ASTERISK_OPENERS_extraword_mod3_2       (ctx->mark_chains[3])
+#define ASTERISK_OPENERS_intraword_mod3_0       (ctx->mark_chains[4])
+#define ASTERISK_OPENERS_intraword_mod3_1       (ctx->mark_chains[5])
+#define ASTERISK_OPENERS_intraword_mod3_2       (ctx->mark_chains[6])
+#define UNDERSCORE_OPENERS                      (ctx->mark_chains[7])
+#define TILDE_OPENERS_1                         (ctx->mark_chains[8])
+#define TILDE_OPENERS_2                         (ctx->mark_chains[9])
+#define BRACKET_OPENERS                         (ctx->mark_chains[10])
+#define DOLLAR_OPENERS                          (ctx->mark_chains[11])
+/* TABLECELLBOUNDARIES is not a chain of openers, so md_rollback() must not
+ * walk it. */
 #define OPENERS_CHAIN_FIRST                     1
-#define OPENERS_CHAIN_LAST                      12
+#define OPENERS_CHAIN_LAST                      11
 
     int n_table_cell_boundaries;
 
+    /* For processing tables. Cell boundaries of the current table row (see
+     * md_process_table_row()) and the column alignments of the current table.
+     * Kept here so they are reused by all the rows and tables. */
+    OFF* table_cell_offs;
+    int n_table_cell_offs;
+    int alloc_table_cell_offs;
+    MD_ALIGN* table_align;
+    int alloc_table_align;
+
     /* For resolving links. */
     int unresolved_link_head;
     int unresolved_link_tail;
 
+    /* Stack of attributes of the link-like spans we are currently in. See
+     * md_push_span_attrs() and md_leave_span_attrs(). */
+    MD_SPAN_ATTRS* span_attrs;
+
     /* For resolving raw HTML. */
     OFF html_comment_horizon;
     OFF html_proc_instr_horizon;
@@ -219,8 +317,8 @@ struct MD_CTX_tag {
      */
     void* block_bytes;
     MD_BLOCK* current_block;
-    int n_block_bytes;
-    int alloc_block_bytes;
+    size_t n_block_bytes;
+    size_t alloc_block_bytes;
 
     /* For container block analysis. */
     MD_CONTAINER* containers;
@@ -228,13 +326,14 @@ struct MD_CTX_tag {
     int alloc_containers;
 
     /* Minimal indentation to call the block "indented code block". */
-    unsigned code_indent_offset;
+    OFF code_indent_offset;
 
     /* Contextual info for line analysis. */
     SZ code_fence_length;   /* For checking closing fence length. */
     int html_block_type;    /* For checking closing raw HTML condition. */
     int last_line_has_list_loosening_effect;
     int last_list_item_starts_with_two_blank_lines;
+    size_t list_item_opener_end; /* n_block_bytes after the last MD_BLOCK_LI opener. */
 };
 
 enum MD_LINETYPE_tag {
@@ -258,7 +357,7 @@ struct MD_LINE_ANALYSIS_tag {
     unsigned data       : 16;
     OFF beg;
     OFF end;
-    unsigned indent;        /* Indentation level. */
+    OFF indent;             /* Indentation level. */
 };
 
 typedef struct MD_LINE_tag MD_LINE;
@@ -362,7 +461,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
             off++;
 
         if(off > 0) {
-            ret = ctx->parser.text(type, str, off, ctx->userdata);
+            MD_CALLBACK(ret, ctx->parser.text(type, str, off, ctx->userdata));
             if(ret != 0)
                 return ret;
 
@@ -374,7 +473,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
         if(off >= size)
             return 0;
 
-        ret = ctx->parser.text(MD_TEXT_NULLCHAR, _T(""), 1, ctx->userdata);
+        MD_CALLBACK(ret, ctx->parser.text(MD_TEXT_NULLCHAR, _T(""), 1, ctx->userdata));
         if(ret != 0)
             return ret;
         off++;
@@ -382,6 +481,184 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 }
 
 
+/***************************
+ ***  Memory Management  ***
+ ***************************/
+
+/* All memory is allocated via the allocator provided by the application in
+ * MD_PARSER::allocator or, if there is none, via the standard C library. */
+static inline void*
+md_malloc(MD_CTX* ctx, size_t size)
+{
+    const MD_ALLOCATOR* allocator = ctx->parser.allocator;
+    MD_STATS_ADD(n_allocs, 1);
+    return (allocator != NULL ? allocator->alloc(size, allocator->allocator_data) : malloc(size));
+}
+
+static inline void*
+md_realloc(MD_CTX* ctx, void* ptr, size_t size)
+{
+    const MD_ALLOCATOR* allocator = ctx->parser.allocator;
+    MD_STATS_ADD(n_allocs, 1);
+    return (allocator != NULL ? allocator->resize(ptr, size, allocator->allocator_data) : realloc(ptr, size));
+}
+
+static inline void
+md_free(MD_CTX* ctx, void* ptr)
+{
+    const MD_ALLOCATOR* allocator = ctx->parser.allocator;
+    if(allocator != NULL)
+        allocator->release(ptr, allocator->allocator_data);
+    else
+        free(ptr);
+}
+
+/* Arena for short-lived objects (copies of multi-line labels and titles,
+ * attribute strings, the ref. def. hashtable etc.).
+ *
+ * Allocation is just a bump of a pointer in the current chunk. Nothing is
+ * ever freed individually: The caller may remember a position in the arena
+ * with md_arena_save() and later release everything allocated since then
+ * with md_arena_restore(). Whole arena is released at the end of the document.
+ *
+ * Note that md_arena_restore() does not free the chunks. They stay in the list
+ * and get reused by subsequent allocations. */
+struct MD_ARENA_CHUNK_tag {
+    MD_ARENA_CHUNK* next;
+    size_t size;        /* Size of the data area which follows the header. */
+};
+
+typedef struct MD_ARENA_MARK_tag MD_ARENA_MARK;
+struct MD_ARENA_MARK_tag {
+    MD_ARENA_CHUNK* chunk;
+    size_t used;
+};
+
+#define MD_ARENA_ALIGN(sz)          (((sz) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+#define MD_ARENA_CHUNK_DATA(chunk)  ((char*)(chunk) + MD_ARENA_ALIGN(sizeof(MD_ARENA_CHUNK)))
+#define MD_ARENA_MIN_CHUNK_SIZE     (4 * 1024)
+#define MD_ARENA_MAX_CHUNK_SIZE     (256 * 1024)
+
+static void*
+md_arena_alloc(MD_CTX* ctx, size_t size)
+{
+    MD_ARENA_CHUNK* chunk = ctx->arena_current;
+    void* ptr;
+
+    size = MD_ARENA_ALIGN(size);
+    MD_STATS_ADD(n_arena_allocs, 1);
+
+    if(chunk == NULL  ||  ctx->arena_used + size > chunk->size) {
+        MD_ARENA_CHUNK* last = chunk;
+
+        /* Reuse the following chunk, if there is any large enough. */
+        chunk = (chunk != NULL ? chunk->next : ctx->arena_first);
+        while(chunk != NULL  &&  chunk->size < size) {
+            last = chunk;
+            chunk = chunk->next;
+        }
+
+        if(chunk == NULL) {
+            size_t chunk_size = (last != NULL ? last->size * 2 : MD_ARENA_MIN_CHUNK_SIZE);
+
+            if(chunk_size > MD_ARENA_MAX_CHUNK_SIZE)
+                chunk_size = MD_ARENA_MAX_CHUNK_SIZE;
+            if(chunk_size < size)
+                chunk_size = size;
+
+            chunk = (MD_ARENA_CHUNK*) md_malloc(ctx, MD_ARENA_ALIGN(sizeof(MD_ARENA_CHUNK)) + chunk_size);
+            if(chunk == NULL)
+                return NULL;
+            chunk->next = NULL;
+            chunk->size = chunk_size;
+
+            if(last != NULL)
+                last->next = chunk;
+            else
+                ctx->arena_first = chunk;
+        }
+
+        ctx->arena_current = chunk;
+        ctx->arena_used = 0;
+    }
+
+    ptr = MD_ARENA_CHUNK_DATA(chunk) + ctx->arena_used;
+    ctx->arena_used += size;
+    return ptr;
+}
+
+/* Resize a block allocated with md_arena_alloc(). If it is the most recent
+ * allocation, it may grow in place. Otherwise new block is allocated. */
+static void*
+md_arena_realloc(MD_CTX* ctx, void* ptr, size_t old_size, size_t new_size)
+{
+    void* new_ptr;
+
+    if(ptr != NULL  &&  ctx->arena_current != NULL  &&
+       (char*) ptr + MD_ARENA_ALIGN(old_size) == MD_ARENA_CHUNK_DATA(ctx->arena_current) + ctx->arena_used  &&
+       ctx->arena_used - MD_ARENA_ALIGN(old_size) + MD_ARENA_ALIGN(new_size) <= ctx->arena_current->size)
+    {
+        ctx->arena_used += MD_ARENA_ALIGN(new_size) - MD_ARENA_ALIGN(old_size);
+        return ptr;
+    }
+
+    new_ptr = md_arena_alloc(ctx, new_size);
+    if(new_ptr != NULL  &&  ptr != NULL)
+        memcpy(new_ptr, ptr, (old_size < new_size ? old_size : new_size));
+    return new_ptr;
+}
+
+static inline void
+md_arena_save(MD_CTX* ctx, MD_ARENA_MARK* mark)
+{
+    mark->chunk = ctx->arena_current;
+    mark->used = ctx->arena_used;
+}
+
+static inline void
+md_arena_restore(MD_CTX* ctx, const MD_ARENA_MARK* mark)
+{
+    ctx->arena_current = mark->chunk;
+    ctx->arena_used = mark->used;
+}
+
+/* Count the bytes allocated since the mark (including the tails of any chunks
+ * which were skipped as too small). */
+static size_t
+md_arena_size_since(MD_CTX* ctx, const MD_ARENA_MARK* mark)
+{
+    MD_ARENA_CHUNK* chunk = mark->chunk;
+    size_t size;
+
+    if(chunk == ctx->arena_current)
+        return ctx->arena_used - mark->used;
+
+    size = (chunk != NULL ? chunk->size - mark->used : 0);
+    chunk = (chunk != NULL ? chunk->next : ctx->arena_first);
+    while(chunk != ctx->arena_current) {
+        size += chunk->size;
+        chunk = chunk->next;
+    }
+    return size + ctx->arena_used;
+}
+
+static void
+md_arena_free(MD_CTX* ctx)
+{
+    MD_ARENA_CHUNK* chunk = ctx->arena_first;
+
+    while(chunk != NULL) {
+        MD_ARENA_CHUNK* next = chunk->next;
+        md_free(ctx, chunk);
+        chunk = next;
+    }
+
+    ctx->arena_first = NULL;
+    ctx->arena_current = NULL;
+    ctx->arena_used = 0;
+}
+
+
 #define MD_CHECK(func)                                                      \
     do {                                                                    \
         ret = (func);                                                       \
@@ -396,7 +673,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
             CHAR* new_buffer;                                               \
             SZ new_size = ((sz) + (sz) / 2 + 128) & ~127;                   \
                                                                             \
-            new_buffer = realloc(ctx->buffer, new_size);                    \
+            new_buffer = md_realloc(ctx, ctx->buffer, new_size * sizeof(CHAR)); \
             if(new_buffer == NULL) {                                        \
                 MD_LOG("realloc() failed.");                                \
                 ret = -1;                                                   \
@@ -411,7 +688,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_ENTER_BLOCK(type, arg)                                           \
     do {                                                                    \
-        ret = ctx->parser.enter_block((type), (arg), ctx->userdata);        \
+        MD_CALLBACK(ret, ctx->parser.enter_block((type), (arg), ctx->userdata)); \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from enter_block() callback.");                 \
             goto abort;                                                     \
@@ -420,7 +697,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_LEAVE_BLOCK(type, arg)                                           \
     do {                                                                    \
-        ret = ctx->parser.leave_block((type), (arg), ctx->userdata);        \
+        MD_CALLBACK(ret, ctx->parser.leave_block((type), (arg), ctx->userdata)); \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from leave_block() callback.");                 \
             goto abort;                                                     \
@@ -429,7 +706,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_ENTER_SPAN(type, arg)                                            \
     do {                                                                    \
-        ret = ctx->parser.enter_span((type), (arg), ctx->userdata);         \
+        MD_CALLBACK(ret, ctx->parser.enter_span((type), (arg), ctx->userdata)); \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from enter_span() callback.");                  \
             goto abort;                                                     \
@@ -438,7 +715,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 
 #define MD_LEAVE_SPAN(type, arg)                                            \
     do {                                                                    \
-        ret = ctx->parser.leave_span((type), (arg), ctx->userdata);         \
+        MD_CALLBACK(ret, ctx->parser.leave_span((type), (arg), ctx->userdata)); \
         if(ret != 0) {                                                      \
             MD_LOG("Aborted from leave_span() callback.");                  \
             goto abort;                                                     \
@@ -448,7 +725,7 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
 #define MD_TEXT(type, str, size)                                            \
     do {                                                                    \
         if(size > 0) {                                                      \
-            ret = ctx->parser.text((type), (str), (size), ctx->userdata);   \
+            MD_CALLBACK(ret, ctx->parser.text((type), (str), (size), ctx->userdata)); \
             if(ret != 0) {                                                  \
                 MD_LOG("Aborted from text() callback.");                    \
                 goto abort;                                                 \
@@ -510,213 +787,435 @@ struct MD_UNICODE_FOLD_INFO_tag {
 
 
 #if defined MD4C_USE_UTF16 || defined MD4C_USE_UTF8
-    /* Binary search over sorted "map" of codepoints. Consecutive sequences
-     * of codepoints may be encoded in the map by just using the
-     * (MIN_CODEPOINT | 0x40000000) and (MAX_CODEPOINT | 0x80000000).
+    /* The Unicode properties are looked up in two-stage tables: The codepoint
+     * space is split into blocks of (1 << shift) codepoints, STAGE1 maps each
+     * block to the index of its (deduplicated) data in STAGE2. The codepoints
+     * beyond STAGE1 have no property.
      *
-     * Returns index of the found record in the map (in the case of ranges,
-     * the minimal value is used); or -1 on failure. */
-    static int
-    md_unicode_bsearch__(unsigned codepoint, const unsigned* map, size_t map_size)
+     * md_unicode_bitmap__() handles the tables of boolean properties, where
+     * STAGE2 holds bitmaps (one bit per codepoint). */
+    static inline int
+    md_unicode_bitmap__(unsigned codepoint, const unsigned char* stage1, size_t stage1_size,
+                        const unsigned char* stage2, unsigned shift)
     {
-        int beg, end;
-        int pivot_beg, pivot_end;
-
-        beg = 0;
-        end = (int) map_size-1;
-        while(beg <= end) {
-            /* Pivot may be a range, not just a single value. */
-            pivot_beg = pivot_end = (beg + end) / 2;
-            if(map[pivot_end] & 0x40000000)
-                pivot_end++;
-            if(map[pivot_beg] & 0x80000000)
-                pivot_beg--;
-
-            if(codepoint < (map[pivot_beg] & 0x00ffffff))
-                end = pivot_beg - 1;
-            else if(codepoint > (map[pivot_end] & 0x00ffffff))
-                beg = pivot_end + 1;
-            else
-                return pivot_beg;
-        }
+        unsigned index;
 
-        return -1;
+        if((codepoint >> shift) >= stage1_size)
+            return FALSE;
+
+        index = ((unsigned) stage1[codepoint >> shift] << shift) + (codepoint & ((1U << shift) - 1));
+        return (stage2[index >> 3] >> (index & 0x7)) & 0x1;
     }
 
     static int
     md_is_unicode_whitespace__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
         /* Unicode "Zs" category.
          * (generated by scripts/build_whitespace_map.py) */
-        static const unsigned WHITESPACE_MAP[] = {
-            S(0x0020), S(0x00a0), S(0x1680), R(0x2000,0x200a), S(0x202f), S(0x205f), S(0x3000)
+#define WHITESPACE_BLOCK_SHIFT   7
+        static const unsigned char WHITESPACE_STAGE1[] = {
+            0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2
+        };
+        static const unsigned char WHITESPACE_STAGE2[] = {
+            0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00,
+            0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00
         };
-#undef R
-#undef S
 
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISWHITESPACE_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, WHITESPACE_MAP, SIZEOF_ARRAY(WHITESPACE_MAP)) >= 0);
+        return md_unicode_bitmap__(codepoint, WHITESPACE_STAGE1, SIZEOF_ARRAY(WHITESPACE_STAGE1),
+                    WHITESPACE_STAGE2, WHITESPACE_BLOCK_SHIFT);
+#undef WHITESPACE_BLOCK_SHIFT
     }
 
     static int
     md_is_unicode_punct__(unsigned codepoint)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
         /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
          * (generated by scripts/build_punct_map.py) */
-        static const unsigned PUNCT_MAP[] = {
-            R(0x0021,0x0023), R(0x0025,0x002a), R(0x002c,0x002f), R(0x003a,0x003b), R(0x003f,0x0040),
-            R(0x005b,0x005d), S(0x005f), S(0x007b), S(0x007d), S(0x00a1), S(0x00a7), S(0x00ab), R(0x00b6,0x00b7),
-            S(0x00bb), S(0x00bf), S(0x037e), S(0x0387), R(0x055a,0x055f), R(0x0589,0x058a), S(0x05be), S(0x05c0),
-            S(0x05c3), S(0x05c6), R(0x05f3,0x05f4), R(0x0609,0x060a), R(0x060c,0x060d), S(0x061b), R(0x061e,0x061f),
-            R(0x066a,0x066d), S(0x06d4), R(0x0700,0x070d), R(0x07f7,0x07f9), R(0x0830,0x083e), S(0x085e),
-            R(0x0964,0x0965), S(0x0970), S(0x09fd), S(0x0a76), S(0x0af0), S(0x0c77), S(0x0c84), S(0x0df4), S(0x0e4f),
-            R(0x0e5a,0x0e5b), R(0x0f04,0x0f12), S(0x0f14), R(0x0f3a,0x0f3d), S(0x0f85), R(0x0fd0,0x0fd4),
-            R(0x0fd9,0x0fda), R(0x104a,0x104f), S(0x10fb), R(0x1360,0x1368), S(0x1400), S(0x166e), R(0x169b,0x169c),
-            R(0x16eb,0x16ed), R(0x1735,0x1736), R(0x17d4,0x17d6), R(0x17d8,0x17da), R(0x1800,0x180a),
-            R(0x1944,0x1945), R(0x1a1e,0x1a1f), R(0x1aa0,0x1aa6), R(0x1aa8,0x1aad), R(0x1b5a,0x1b60),
-            R(0x1bfc,0x1bff), R(0x1c3b,0x1c3f), R(0x1c7e,0x1c7f), R(0x1cc0,0x1cc7), S(0x1cd3), R(0x2010,0x2027),
-            R(0x2030,0x2043), R(0x2045,0x2051), R(0x2053,0x205e), R(0x207d,0x207e), R(0x208d,0x208e),
-            R(0x2308,0x230b), R(0x2329,0x232a), R(0x2768,0x2775), R(0x27c5,0x27c6), R(0x27e6,0x27ef),
-            R(0x2983,0x2998), R(0x29d8,0x29db), R(0x29fc,0x29fd), R(0x2cf9,0x2cfc), R(0x2cfe,0x2cff), S(0x2d70),
-            R(0x2e00,0x2e2e), R(0x2e30,0x2e4f), S(0x2e52), R(0x3001,0x3003), R(0x3008,0x3011), R(0x3014,0x301f),
-            S(0x3030), S(0x303d), S(0x30a0), S(0x30fb), R(0xa4fe,0xa4ff), R(0xa60d,0xa60f), S(0xa673), S(0xa67e),
-            R(0xa6f2,0xa6f7), R(0xa874,0xa877), R(0xa8ce,0xa8cf), R(0xa8f8,0xa8fa), S(0xa8fc), R(0xa92e,0xa92f),
-            S(0xa95f), R(0xa9c1,0xa9cd), R(0xa9de,0xa9df), R(0xaa5c,0xaa5f), R(0xaade,0xaadf), R(0xaaf0,0xaaf1),
-            S(0xabeb), R(0xfd3e,0xfd3f), R(0xfe10,0xfe19), R(0xfe30,0xfe52), R(0xfe54,0xfe61), S(0xfe63), S(0xfe68),
-            R(0xfe6a,0xfe6b), R(0xff01,0xff03), R(0xff05,0xff0a), R(0xff0c,0xff0f), R(0xff1a,0xff1b),
-            R(0xff1f,0xff20), R(0xff3b,0xff3d), S(0xff3f), S(0xff5b), S(0xff5d), R(0xff5f,0xff65), R(0x10100,0x10102),
-            S(0x1039f), S(0x103d0), S(0x1056f), S(0x10857), S(0x1091f), S(0x1093f), R(0x10a50,0x10a58), S(0x10a7f),
-            R(0x10af0,0x10af6), R(0x10b39,0x10b3f), R(0x10b99,0x10b9c), S(0x10ead), R(0x10f55,0x10f59),
-            R(0x11047,0x1104d), R(0x110bb,0x110bc), R(0x110be,0x110c1), R(0x11140,0x11143), R(0x11174,0x11175),
-            R(0x111c5,0x111c8), S(0x111cd), S(0x111db), R(0x111dd,0x111df), R(0x11238,0x1123d), S(0x112a9),
-            R(0x1144b,0x1144f), R(0x1145a,0x1145b), S(0x1145d), S(0x114c6), R(0x115c1,0x115d7), R(0x11641,0x11643),
-            R(0x11660,0x1166c), R(0x1173c,0x1173e), S(0x1183b), R(0x11944,0x11946), S(0x119e2), R(0x11a3f,0x11a46),
-            R(0x11a9a,0x11a9c), R(0x11a9e,0x11aa2), R(0x11c41,0x11c45), R(0x11c70,0x11c71), R(0x11ef7,0x11ef8),
-            S(0x11fff), R(0x12470,0x12474), R(0x16a6e,0x16a6f), S(0x16af5), R(0x16b37,0x16b3b), S(0x16b44),
-            R(0x16e97,0x16e9a), S(0x16fe2), S(0x1bc9f), R(0x1da87,0x1da8b), R(0x1e95e,0x1e95f)
+#define PUNCT_BLOCK_SHIFT   7
+        static const unsigned char PUNCT_STAGE1[] = {
+            0, 1, 2, 2, 2, 2, 3, 4, 2, 2, 5, 6, 7, 8, 9, 10, 11, 2, 12, 13, 14, 15, 2, 2, 16, 17, 2, 18, 19, 2, 20,
+            21, 22, 23, 2, 2, 2, 2, 24, 2, 25, 2, 2, 2, 26, 27, 28, 29, 30, 2, 31, 2, 32, 33, 34, 35, 36, 37, 2, 2, 2,
+            2, 2, 2, 38, 39, 2, 2, 2, 2, 40, 2, 2, 2, 2, 2, 2, 2, 41, 42, 2, 2, 2, 43, 2, 2, 2, 2, 2, 44, 15, 2, 45,
+            2, 2, 2, 46, 47, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 48, 2, 2, 49, 50, 2, 2, 51,
+            52, 53, 54, 55, 56, 2, 57, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 58, 2, 59, 2,
+            60, 2, 2, 2, 61, 2, 2, 2, 2, 62, 2, 2, 63, 2, 2, 2, 2, 2, 64, 2, 65, 2, 66, 67, 68, 69, 2, 2, 2, 2, 2, 70,
+            71, 2, 72, 73, 74, 75, 76, 77, 2, 2, 78, 79, 2, 80, 81, 2, 82, 2, 83, 2, 84, 85, 86, 87, 2, 2, 88, 2, 2,
+            2, 2, 89, 2, 90, 2, 2, 2, 2, 2, 2, 2, 2, 91, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 92, 93, 94, 2, 2, 2, 2, 2, 2, 95, 2, 85, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 96, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 97, 2, 2, 2, 2,
+            2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 98
+        };
+        static const unsigned char PUNCT_STAGE2[] = {
+            0x00, 0x00, 0x00, 0x00, 0xee, 0xf7, 0x00, 0x8c, 0x01, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x28, 0x00,
+            0x00, 0x00, 0x00, 0x82, 0x08, 0xc0, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x40, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x36, 0x00, 0xc8, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0x00,
+            0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+            0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0x17,
+            0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07,
+            0x00, 0x00, 0x00, 0x00, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff,
+            0xff, 0x00, 0xff, 0xff, 0xef, 0xff, 0xfb, 0x7f, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x06,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x60, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x04,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xf3, 0xff, 0x00, 0x00, 0x01, 0x20, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xc0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+            0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x3f, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0xff, 0xff,
+            0xff, 0xff, 0xf7, 0xff, 0x0b, 0x0d, 0x00, 0x00, 0xee, 0xf7, 0x00, 0x8c, 0x01, 0x00, 0x00, 0xb8, 0x00,
+            0x00, 0x00, 0xa8, 0x3f, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x00, 0x00, 0x00,
+            0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0xd8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xe0, 0x21, 0x00, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
+            0x00, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xff,
+            0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xdc, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x10,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00,
+            0x00, 0x00, 0x00
         };
-#undef R
-#undef S
 
         /* The ASCII ones are the most frequently used ones, also CommonMark
          * specification requests few more in this range. */
         if(codepoint <= 0x7f)
             return ISPUNCT_(codepoint);
 
-        return (md_unicode_bsearch__(codepoint, PUNCT_MAP, SIZEOF_ARRAY(PUNCT_MAP)) >= 0);
+        return md_unicode_bitmap__(codepoint, PUNCT_STAGE1, SIZEOF_ARRAY(PUNCT_STAGE1),
+                    PUNCT_STAGE2, PUNCT_BLOCK_SHIFT);
+#undef PUNCT_BLOCK_SHIFT
     }
 
     static void
     md_get_unicode_fold_info(unsigned codepoint, MD_UNICODE_FOLD_INFO* info)
     {
-#define R(cp_min, cp_max)   ((cp_min) | 0x40000000), ((cp_max) | 0x80000000)
-#define S(cp)               (cp)
-        /* Unicode "Pc", "Pd", "Pe", "Pf", "Pi", "Po", "Ps" categories.
+        /* Unicode case folding ("C" and "F" statuses). STAGE2 holds indexes
+         * into FOLD_RECORDS[].
          * (generated by scripts/build_folding_map.py) */
-        static const unsigned FOLD_MAP_1[] = {
-            R(0x0041,0x005a), S(0x00b5), R(0x00c0,0x00d6), R(0x00d8,0x00de), R(0x0100,0x012e), R(0x0132,0x0136),
-            R(0x0139,0x0147), R(0x014a,0x0176), S(0x0178), R(0x0179,0x017d), S(0x017f), S(0x0181), S(0x0182),
-            S(0x0184), S(0x0186), S(0x0187), S(0x0189), S(0x018a), S(0x018b), S(0x018e), S(0x018f), S(0x0190),
-            S(0x0191), S(0x0193), S(0x0194), S(0x0196), S(0x0197), S(0x0198), S(0x019c), S(0x019d), S(0x019f),
-            R(0x01a0,0x01a4), S(0x01a6), S(0x01a7), S(0x01a9), S(0x01ac), S(0x01ae), S(0x01af), S(0x01b1), S(0x01b2),
-            S(0x01b3), S(0x01b5), S(0x01b7), S(0x01b8), S(0x01bc), S(0x01c4), S(0x01c5), S(0x01c7), S(0x01c8),
-            S(0x01ca), R(0x01cb,0x01db), R(0x01de,0x01ee), S(0x01f1), S(0x01f2), S(0x01f4), S(0x01f6), S(0x01f7),
-            R(0x01f8,0x021e), S(0x0220), R(0x0222,0x0232), S(0x023a), S(0x023b), S(0x023d), S(0x023e), S(0x0241),
-            S(0x0243), S(0x0244), S(0x0245), R(0x0246,0x024e), S(0x0345), S(0x0370), S(0x0372), S(0x0376), S(0x037f),
-            S(0x0386), R(0x0388,0x038a), S(0x038c), S(0x038e), S(0x038f), R(0x0391,0x03a1), R(0x03a3,0x03ab),
-            S(0x03c2), S(0x03cf), S(0x03d0), S(0x03d1), S(0x03d5), S(0x03d6), R(0x03d8,0x03ee), S(0x03f0), S(0x03f1),
-            S(0x03f4), S(0x03f5), S(0x03f7), S(0x03f9), S(0x03fa), R(0x03fd,0x03ff), R(0x0400,0x040f),
-            R(0x0410,0x042f), R(0x0460,0x0480), R(0x048a,0x04be), S(0x04c0), R(0x04c1,0x04cd), R(0x04d0,0x052e),
-            R(0x0531,0x0556), R(0x10a0,0x10c5), S(0x10c7), S(0x10cd), R(0x13f8,0x13fd), S(0x1c80), S(0x1c81),
-            S(0x1c82), S(0x1c83), S(0x1c84), S(0x1c85), S(0x1c86), S(0x1c87), S(0x1c88), R(0x1c90,0x1cba),
-            R(0x1cbd,0x1cbf), R(0x1e00,0x1e94), S(0x1e9b), R(0x1ea0,0x1efe), R(0x1f08,0x1f0f), R(0x1f18,0x1f1d),
-            R(0x1f28,0x1f2f), R(0x1f38,0x1f3f), R(0x1f48,0x1f4d), S(0x1f59), S(0x1f5b), S(0x1f5d), S(0x1f5f),
-            R(0x1f68,0x1f6f), S(0x1fb8), S(0x1fb9), S(0x1fba), S(0x1fbb), S(0x1fbe), R(0x1fc8,0x1fcb), S(0x1fd8),
-            S(0x1fd9), S(0x1fda), S(0x1fdb), S(0x1fe8), S(0x1fe9), S(0x1fea), S(0x1feb), S(0x1fec), S(0x1ff8),
-            S(0x1ff9), S(0x1ffa), S(0x1ffb), S(0x2126), S(0x212a), S(0x212b), S(0x2132), R(0x2160,0x216f), S(0x2183),
-            R(0x24b6,0x24cf), R(0x2c00,0x2c2e), S(0x2c60), S(0x2c62), S(0x2c63), S(0x2c64), R(0x2c67,0x2c6b),
-            S(0x2c6d), S(0x2c6e), S(0x2c6f), S(0x2c70), S(0x2c72), S(0x2c75), S(0x2c7e), S(0x2c7f), R(0x2c80,0x2ce2),
-            S(0x2ceb), S(0x2ced), S(0x2cf2), R(0xa640,0xa66c), R(0xa680,0xa69a), R(0xa722,0xa72e), R(0xa732,0xa76e),
-            S(0xa779), S(0xa77b), S(0xa77d), R(0xa77e,0xa786), S(0xa78b), S(0xa78d), S(0xa790), S(0xa792),
-            R(0xa796,0xa7a8), S(0xa7aa), S(0xa7ab), S(0xa7ac), S(0xa7ad), S(0xa7ae), S(0xa7b0), S(0xa7b1), S(0xa7b2),
-            S(0xa7b3), R(0xa7b4,0xa7be), S(0xa7c2), S(0xa7c4), S(0xa7c5), S(0xa7c6), S(0xa7c7), S(0xa7c9), S(0xa7f5),
-            R(0xab70,0xabbf), R(0xff21,0xff3a), R(0x10400,0x10427), R(0x104b0,0x104d3), R(0x10c80,0x10cb2),
-            R(0x118a0,0x118bf), R(0x16e40,0x16e5f), R(0x1e900,0x1e921)
-        };
-        static const unsigned FOLD_MAP_1_DATA[] = {
-            0x0061, 0x007a, 0x03bc, 0x00e0, 0x00f6, 0x00f8, 0x00fe, 0x0101, 0x012f, 0x0133, 0x0137, 0x013a, 0x0148,
-            0x014b, 0x0177, 0x00ff, 0x017a, 0x017e, 0x0073, 0x0253, 0x0183, 0x0185, 0x0254, 0x0188, 0x0256, 0x0257,
-            0x018c, 0x01dd, 0x0259, 0x025b, 0x0192, 0x0260, 0x0263, 0x0269, 0x0268, 0x0199, 0x026f, 0x0272, 0x0275,
-            0x01a1, 0x01a5, 0x0280, 0x01a8, 0x0283, 0x01ad, 0x0288, 0x01b0, 0x028a, 0x028b, 0x01b4, 0x01b6, 0x0292,
-            0x01b9, 0x01bd, 0x01c6, 0x01c6, 0x01c9, 0x01c9, 0x01cc, 0x01cc, 0x01dc, 0x01df, 0x01ef, 0x01f3, 0x01f3,
-            0x01f5, 0x0195, 0x01bf, 0x01f9, 0x021f, 0x019e, 0x0223, 0x0233, 0x2c65, 0x023c, 0x019a, 0x2c66, 0x0242,
-            0x0180, 0x0289, 0x028c, 0x0247, 0x024f, 0x03b9, 0x0371, 0x0373, 0x0377, 0x03f3, 0x03ac, 0x03ad, 0x03af,
-            0x03cc, 0x03cd, 0x03ce, 0x03b1, 0x03c1, 0x03c3, 0x03cb, 0x03c3, 0x03d7, 0x03b2, 0x03b8, 0x03c6, 0x03c0,
-            0x03d9, 0x03ef, 0x03ba, 0x03c1, 0x03b8, 0x03b5, 0x03f8, 0x03f2, 0x03fb, 0x037b, 0x037d, 0x0450, 0x045f,
-            0x0430, 0x044f, 0x0461, 0x0481, 0x048b, 0x04bf, 0x04cf, 0x04c2, 0x04ce, 0x04d1, 0x052f, 0x0561, 0x0586,
-            0x2d00, 0x2d25, 0x2d27, 0x2d2d, 0x13f0, 0x13f5, 0x0432, 0x0434, 0x043e, 0x0441, 0x0442, 0x0442, 0x044a,
-            0x0463, 0xa64b, 0x10d0, 0x10fa, 0x10fd, 0x10ff, 0x1e01, 0x1e95, 0x1e61, 0x1ea1, 0x1eff, 0x1f00, 0x1f07,
-            0x1f10, 0x1f15, 0x1f20, 0x1f27, 0x1f30, 0x1f37, 0x1f40, 0x1f45, 0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60,
-            0x1f67, 0x1fb0, 0x1fb1, 0x1f70, 0x1f71, 0x03b9, 0x1f72, 0x1f75, 0x1fd0, 0x1fd1, 0x1f76, 0x1f77, 0x1fe0,
-            0x1fe1, 0x1f7a, 0x1f7b, 0x1fe5, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x03c9, 0x006b, 0x00e5, 0x214e, 0x2170,
-            0x217f, 0x2184, 0x24d0, 0x24e9, 0x2c30, 0x2c5e, 0x2c61, 0x026b, 0x1d7d, 0x027d, 0x2c68, 0x2c6c, 0x0251,
-            0x0271, 0x0250, 0x0252, 0x2c73, 0x2c76, 0x023f, 0x0240, 0x2c81, 0x2ce3, 0x2cec, 0x2cee, 0x2cf3, 0xa641,
-            0xa66d, 0xa681, 0xa69b, 0xa723, 0xa72f, 0xa733, 0xa76f, 0xa77a, 0xa77c, 0x1d79, 0xa77f, 0xa787, 0xa78c,
-            0x0265, 0xa791, 0xa793, 0xa797, 0xa7a9, 0x0266, 0x025c, 0x0261, 0x026c, 0x026a, 0x029e, 0x0287, 0x029d,
-            0xab53, 0xa7b5, 0xa7bf, 0xa7c3, 0xa794, 0x0282, 0x1d8e, 0xa7c8, 0xa7ca, 0xa7f6, 0x13a0, 0x13ef, 0xff41,
-            0xff5a, 0x10428, 0x1044f, 0x104d8, 0x104fb, 0x10cc0, 0x10cf2, 0x118c0, 0x118df, 0x16e60, 0x16e7f, 0x1e922,
-            0x1e943
-        };
-        static const unsigned FOLD_MAP_2[] = {
-            S(0x00df), S(0x0130), S(0x0149), S(0x01f0), S(0x0587), S(0x1e96), S(0x1e97), S(0x1e98), S(0x1e99),
-            S(0x1e9a), S(0x1e9e), S(0x1f50), R(0x1f80,0x1f87), R(0x1f88,0x1f8f), R(0x1f90,0x1f97), R(0x1f98,0x1f9f),
-            R(0x1fa0,0x1fa7), R(0x1fa8,0x1faf), S(0x1fb2), S(0x1fb3), S(0x1fb4), S(0x1fb6), S(0x1fbc), S(0x1fc2),
-            S(0x1fc3), S(0x1fc4), S(0x1fc6), S(0x1fcc), S(0x1fd6), S(0x1fe4), S(0x1fe6), S(0x1ff2), S(0x1ff3),
-            S(0x1ff4), S(0x1ff6), S(0x1ffc), S(0xfb00), S(0xfb01), S(0xfb02), S(0xfb05), S(0xfb06), S(0xfb13),
-            S(0xfb14), S(0xfb15), S(0xfb16), S(0xfb17)
-        };
-        static const unsigned FOLD_MAP_2_DATA[] = {
-            0x0073,0x0073, 0x0069,0x0307, 0x02bc,0x006e, 0x006a,0x030c, 0x0565,0x0582, 0x0068,0x0331, 0x0074,0x0308,
-            0x0077,0x030a, 0x0079,0x030a, 0x0061,0x02be, 0x0073,0x0073, 0x03c5,0x0313, 0x1f00,0x03b9, 0x1f07,0x03b9,
-            0x1f00,0x03b9, 0x1f07,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f20,0x03b9, 0x1f27,0x03b9, 0x1f60,0x03b9,
-            0x1f67,0x03b9, 0x1f60,0x03b9, 0x1f67,0x03b9, 0x1f70,0x03b9, 0x03b1,0x03b9, 0x03ac,0x03b9, 0x03b1,0x0342,
-            0x03b1,0x03b9, 0x1f74,0x03b9, 0x03b7,0x03b9, 0x03ae,0x03b9, 0x03b7,0x0342, 0x03b7,0x03b9, 0x03b9,0x0342,
-            0x03c1,0x0313, 0x03c5,0x0342, 0x1f7c,0x03b9, 0x03c9,0x03b9, 0x03ce,0x03b9, 0x03c9,0x0342, 0x03c9,0x03b9,
-            0x0066,0x0066, 0x0066,0x0069, 0x0066,0x006c, 0x0073,0x0074, 0x0073,0x0074, 0x0574,0x0576, 0x0574,0x0565,
-            0x0574,0x056b, 0x057e,0x0576, 0x0574,0x056d
-        };
-        static const unsigned FOLD_MAP_3[] = {
-            S(0x0390), S(0x03b0), S(0x1f52), S(0x1f54), S(0x1f56), S(0x1fb7), S(0x1fc7), S(0x1fd2), S(0x1fd3),
-            S(0x1fd7), S(0x1fe2), S(0x1fe3), S(0x1fe7), S(0x1ff7), S(0xfb03), S(0xfb04)
-        };
-        static const unsigned FOLD_MAP_3_DATA[] = {
-            0x03b9,0x0308,0x0301, 0x03c5,0x0308,0x0301, 0x03c5,0x0313,0x0300, 0x03c5,0x0313,0x0301,
-            0x03c5,0x0313,0x0342, 0x03b1,0x0342,0x03b9, 0x03b7,0x0342,0x03b9, 0x03b9,0x0308,0x0300,
-            0x03b9,0x0308,0x0301, 0x03b9,0x0308,0x0342, 0x03c5,0x0308,0x0300, 0x03c5,0x0308,0x0301,
-            0x03c5,0x0308,0x0342, 0x03c9,0x0342,0x03b9, 0x0066,0x0066,0x0069, 0x0066,0x0066,0x006c
-        };
-#undef R
-#undef S
+#define FOLD_BLOCK_SHIFT   6
         static const struct {
-            const unsigned* map;
-            const unsigned* data;
-            size_t map_size;
+            int delta;
+            unsigned tail[2];
             unsigned n_codepoints;
-        } FOLD_MAP_LIST[] = {
-            { FOLD_MAP_1, FOLD_MAP_1_DATA, SIZEOF_ARRAY(FOLD_MAP_1), 1 },
-            { FOLD_MAP_2, FOLD_MAP_2_DATA, SIZEOF_ARRAY(FOLD_MAP_2), 2 },
-            { FOLD_MAP_3, FOLD_MAP_3_DATA, SIZEOF_ARRAY(FOLD_MAP_3), 3 }
+        } FOLD_RECORDS[] = {
+            { 0, { 0x0000, 0x0000 }, 1 }, { 32, { 0x0000, 0x0000 }, 1 }, { 775, { 0x0000, 0x0000 }, 1 },
+            { 1, { 0x0000, 0x0000 }, 1 }, { -121, { 0x0000, 0x0000 }, 1 }, { -268, { 0x0000, 0x0000 }, 1 },
+            { 210, { 0x0000, 0x0000 }, 1 }, { 206, { 0x0000, 0x0000 }, 1 }, { 205, { 0x0000, 0x0000 }, 1 },
+            { 79, { 0x0000, 0x0000 }, 1 }, { 202, { 0x0000, 0x0000 }, 1 }, { 203, { 0x0000, 0x0000 }, 1 },
+            { 207, { 0x0000, 0x0000 }, 1 }, { 211, { 0x0000, 0x0000 }, 1 }, { 209, { 0x0000, 0x0000 }, 1 },
+            { 213, { 0x0000, 0x0000 }, 1 }, { 214, { 0x0000, 0x0000 }, 1 }, { 218, { 0x0000, 0x0000 }, 1 },
+            { 217, { 0x0000, 0x0000 }, 1 }, { 219, { 0x0000, 0x0000 }, 1 }, { 2, { 0x0000, 0x0000 }, 1 },
+            { -97, { 0x0000, 0x0000 }, 1 }, { -56, { 0x0000, 0x0000 }, 1 }, { -130, { 0x0000, 0x0000 }, 1 },
+            { 10795, { 0x0000, 0x0000 }, 1 }, { -163, { 0x0000, 0x0000 }, 1 }, { 10792, { 0x0000, 0x0000 }, 1 },
+            { -195, { 0x0000, 0x0000 }, 1 }, { 69, { 0x0000, 0x0000 }, 1 }, { 71, { 0x0000, 0x0000 }, 1 },
+            { 116, { 0x0000, 0x0000 }, 1 }, { 38, { 0x0000, 0x0000 }, 1 }, { 37, { 0x0000, 0x0000 }, 1 },
+            { 64, { 0x0000, 0x0000 }, 1 }, { 63, { 0x0000, 0x0000 }, 1 }, { 8, { 0x0000, 0x0000 }, 1 },
+            { -30, { 0x0000, 0x0000 }, 1 }, { -25, { 0x0000, 0x0000 }, 1 }, { -15, { 0x0000, 0x0000 }, 1 },
+            { -22, { 0x0000, 0x0000 }, 1 }, { -54, { 0x0000, 0x0000 }, 1 }, { -48, { 0x0000, 0x0000 }, 1 },
+            { -60, { 0x0000, 0x0000 }, 1 }, { -64, { 0x0000, 0x0000 }, 1 }, { -7, { 0x0000, 0x0000 }, 1 },
+            { 80, { 0x0000, 0x0000 }, 1 }, { 15, { 0x0000, 0x0000 }, 1 }, { 48, { 0x0000, 0x0000 }, 1 },
+            { 7264, { 0x0000, 0x0000 }, 1 }, { -8, { 0x0000, 0x0000 }, 1 }, { -6222, { 0x0000, 0x0000 }, 1 },
+            { -6221, { 0x0000, 0x0000 }, 1 }, { -6212, { 0x0000, 0x0000 }, 1 }, { -6210, { 0x0000, 0x0000 }, 1 },
+            { -6211, { 0x0000, 0x0000 }, 1 }, { -6204, { 0x0000, 0x0000 }, 1 }, { -6180, { 0x0000, 0x0000 }, 1 },
+            { 35267, { 0x0000, 0x0000 }, 1 }, { -3008, { 0x0000, 0x0000 }, 1 }, { -58, { 0x0000, 0x0000 }, 1 },
+            { -74, { 0x0000, 0x0000 }, 1 }, { -7173, { 0x0000, 0x0000 }, 1 }, { -86, { 0x0000, 0x0000 }, 1 },
+            { -100, { 0x0000, 0x0000 }, 1 }, { -112, { 0x0000, 0x0000 }, 1 }, { -128, { 0x0000, 0x0000 }, 1 },
+            { -126, { 0x0000, 0x0000 }, 1 }, { -7517, { 0x0000, 0x0000 }, 1 }, { -8383, { 0x0000, 0x0000 }, 1 },
+            { -8262, { 0x0000, 0x0000 }, 1 }, { 28, { 0x0000, 0x0000 }, 1 }, { 16, { 0x0000, 0x0000 }, 1 },
+            { 26, { 0x0000, 0x0000 }, 1 }, { -10743, { 0x0000, 0x0000 }, 1 }, { -3814, { 0x0000, 0x0000 }, 1 },
+            { -10727, { 0x0000, 0x0000 }, 1 }, { -10780, { 0x0000, 0x0000 }, 1 }, { -10749, { 0x0000, 0x0000 }, 1 },
+            { -10783, { 0x0000, 0x0000 }, 1 }, { -10782, { 0x0000, 0x0000 }, 1 }, { -10815, { 0x0000, 0x0000 }, 1 },
+            { -35332, { 0x0000, 0x0000 }, 1 }, { -42280, { 0x0000, 0x0000 }, 1 }, { -42308, { 0x0000, 0x0000 }, 1 },
+            { -42319, { 0x0000, 0x0000 }, 1 }, { -42315, { 0x0000, 0x0000 }, 1 }, { -42305, { 0x0000, 0x0000 }, 1 },
+            { -42258, { 0x0000, 0x0000 }, 1 }, { -42282, { 0x0000, 0x0000 }, 1 }, { -42261, { 0x0000, 0x0000 }, 1 },
+            { 928, { 0x0000, 0x0000 }, 1 }, { -42307, { 0x0000, 0x0000 }, 1 }, { -35384, { 0x0000, 0x0000 }, 1 },
+            { -38864, { 0x0000, 0x0000 }, 1 }, { 40, { 0x0000, 0x0000 }, 1 }, { 34, { 0x0000, 0x0000 }, 1 },
+            { -108, { 0x0073, 0x0000 }, 2 }, { -199, { 0x0307, 0x0000 }, 2 }, { 371, { 0x006e, 0x0000 }, 2 },
+            { -390, { 0x030c, 0x0000 }, 2 }, { -34, { 0x0582, 0x0000 }, 2 }, { -7726, { 0x0331, 0x0000 }, 2 },
+            { -7715, { 0x0308, 0x0000 }, 2 }, { -7713, { 0x030a, 0x0000 }, 2 }, { -7712, { 0x030a, 0x0000 }, 2 },
+            { -7737, { 0x02be, 0x0000 }, 2 }, { -7723, { 0x0073, 0x0000 }, 2 }, { -7051, { 0x0313, 0x0000 }, 2 },
+            { -128, { 0x03b9, 0x0000 }, 2 }, { -136, { 0x03b9, 0x0000 }, 2 }, { -112, { 0x03b9, 0x0000 }, 2 },
+            { -120, { 0x03b9, 0x0000 }, 2 }, { -64, { 0x03b9, 0x0000 }, 2 }, { -72, { 0x03b9, 0x0000 }, 2 },
+            { -66, { 0x03b9, 0x0000 }, 2 }, { -7170, { 0x03b9, 0x0000 }, 2 }, { -7176, { 0x03b9, 0x0000 }, 2 },
+            { -7173, { 0x0342, 0x0000 }, 2 }, { -7179, { 0x03b9, 0x0000 }, 2 }, { -78, { 0x03b9, 0x0000 }, 2 },
+            { -7180, { 0x03b9, 0x0000 }, 2 }, { -7190, { 0x03b9, 0x0000 }, 2 }, { -7183, { 0x0342, 0x0000 }, 2 },
+            { -7189, { 0x03b9, 0x0000 }, 2 }, { -7197, { 0x0342, 0x0000 }, 2 }, { -7203, { 0x0313, 0x0000 }, 2 },
+            { -7201, { 0x0342, 0x0000 }, 2 }, { -118, { 0x03b9, 0x0000 }, 2 }, { -7210, { 0x03b9, 0x0000 }, 2 },
+            { -7206, { 0x03b9, 0x0000 }, 2 }, { -7213, { 0x0342, 0x0000 }, 2 }, { -7219, { 0x03b9, 0x0000 }, 2 },
+            { -64154, { 0x0066, 0x0000 }, 2 }, { -64155, { 0x0069, 0x0000 }, 2 }, { -64156, { 0x006c, 0x0000 }, 2 },
+            { -64146, { 0x0074, 0x0000 }, 2 }, { -64147, { 0x0074, 0x0000 }, 2 }, { -62879, { 0x0576, 0x0000 }, 2 },
+            { -62880, { 0x0565, 0x0000 }, 2 }, { -62881, { 0x056b, 0x0000 }, 2 }, { -62872, { 0x0576, 0x0000 }, 2 },
+            { -62883, { 0x056d, 0x0000 }, 2 }, { 41, { 0x0308, 0x0301 }, 3 }, { 21, { 0x0308, 0x0301 }, 3 },
+            { -7053, { 0x0313, 0x0300 }, 3 }, { -7055, { 0x0313, 0x0301 }, 3 }, { -7057, { 0x0313, 0x0342 }, 3 },
+            { -7174, { 0x0342, 0x03b9 }, 3 }, { -7184, { 0x0342, 0x03b9 }, 3 }, { -7193, { 0x0308, 0x0300 }, 3 },
+            { -7194, { 0x0308, 0x0301 }, 3 }, { -7198, { 0x0308, 0x0342 }, 3 }, { -7197, { 0x0308, 0x0300 }, 3 },
+            { -7198, { 0x0308, 0x0301 }, 3 }, { -7202, { 0x0308, 0x0342 }, 3 }, { -7214, { 0x0342, 0x03b9 }, 3 },
+            { -64157, { 0x0066, 0x0069 }, 3 }, { -64158, { 0x0066, 0x006c }, 3 }
         };
-
-        int i;
+        static const unsigned char FOLD_STAGE1[] = {
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 20,
+            21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 23, 0, 0, 0, 0, 0, 24, 24, 25, 24, 26, 27, 28, 29, 0, 0, 0, 0, 30, 31,
+            32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 35, 36, 24, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 38, 39, 0, 40, 41, 42, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            48, 0, 49, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 54
+        };
+        static const unsigned char FOLD_STAGE2[] = {
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 97, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 98, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 4, 3, 0, 3, 0, 3, 0, 5, 0,
+            6, 3, 0, 3, 0, 7, 3, 0, 8, 8, 3, 0, 0, 9, 10, 11, 3, 0, 8, 12, 0, 13, 14, 3, 0, 0, 0, 13, 15, 0, 16, 3, 0,
+            3, 0, 3, 0, 17, 3, 0, 17, 0, 0, 3, 0, 17, 3, 0, 18, 18, 3, 0, 3, 0, 19, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0,
+            0, 20, 3, 0, 20, 3, 0, 20, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 99, 20, 3, 0, 3, 0, 21, 22, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 23, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 24, 3, 0, 25, 26, 0, 0, 3, 0, 27, 28, 29, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0,
+            0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 30, 0, 0, 0, 0, 0, 0, 31, 0, 32, 32, 32, 0, 33, 0, 34, 34, 142, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 143, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 36, 37, 0, 0, 0, 38, 39, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 40, 41, 0, 0, 42, 43, 0, 3, 0, 44, 3,
+            0, 0, 23, 23, 23, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 46, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+            48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 0, 48, 0, 0, 0, 0, 0,
+            48, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 49, 49, 49, 49, 49, 49, 0, 0, 50, 51, 52, 53, 53, 54, 55, 56, 57, 0, 0, 0, 0, 0, 0, 0, 58, 58, 58,
+            58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+            58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 0, 0, 58, 58, 58, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 101, 102, 103, 104, 105, 59, 0, 0, 106, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 0,
+            0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49,
+            0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49, 49, 0,
+            0, 107, 0, 144, 0, 145, 0, 146, 0, 0, 49, 0, 49, 0, 49, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 49, 49, 49, 49, 49,
+            49, 49, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 108, 108, 108, 108, 108, 108, 108, 109,
+            109, 109, 109, 109, 109, 109, 109, 110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111,
+            111, 111, 112, 112, 112, 112, 112, 112, 112, 112, 113, 113, 113, 113, 113, 113, 113, 113, 0, 0, 114, 115,
+            116, 0, 117, 147, 49, 49, 60, 60, 118, 0, 61, 0, 0, 0, 119, 120, 121, 0, 122, 148, 62, 62, 62, 62, 123, 0,
+            0, 0, 0, 0, 149, 150, 0, 0, 124, 151, 49, 49, 63, 63, 0, 0, 0, 0, 0, 0, 152, 153, 125, 0, 126, 154, 49,
+            49, 64, 64, 44, 0, 0, 0, 0, 0, 127, 128, 129, 0, 130, 155, 65, 65, 66, 66, 131, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 0,
+            0, 68, 69, 0, 0, 0, 0, 0, 0, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71, 71,
+            71, 71, 71, 71, 71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 72, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+            47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 73, 74, 75, 0, 0, 3, 0, 3, 0, 3, 0, 76, 77,
+            78, 79, 0, 3, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 80, 80, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 0, 0, 0, 3, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0,
+            3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3,
+            0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 3, 0, 81, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 0, 3,
+            0, 82, 0, 0, 3, 0, 3, 0, 0, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 83, 84, 85, 86,
+            83, 0, 87, 88, 89, 90, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 3, 0, 0, 0, 3, 0, 41, 91, 92, 3, 0, 3, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 93, 93, 93, 93, 93,
+            93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+            93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93,
+            93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 93, 132, 133, 134,
+            156, 157, 135, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 137, 138, 139, 140, 141, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94,
+            94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+            94, 94, 94, 94, 94, 94, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94,
+            94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 33,
+            33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+            33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 95, 95, 95,
+            95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+            95, 95, 95, 95, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0
+        };
+        unsigned record;
 
         /* Fast path for ASCII characters. */
         if(codepoint <= 0x7f) {
@@ -727,39 +1226,20 @@ struct MD_UNICODE_FOLD_INFO_tag {
             return;
         }
 
-        /* Try to locate the codepoint in any of the maps. */
-        for(i = 0; i < (int) SIZEOF_ARRAY(FOLD_MAP_LIST); i++) {
-            int index;
-
-            index = md_unicode_bsearch__(codepoint, FOLD_MAP_LIST[i].map, FOLD_MAP_LIST[i].map_size);
-            if(index >= 0) {
-                /* Found the mapping. */
-                unsigned n_codepoints = FOLD_MAP_LIST[i].n_codepoints;
-                const unsigned* map = FOLD_MAP_LIST[i].map;
-                const unsigned* codepoints = FOLD_MAP_LIST[i].data + (index * n_codepoints);
-
-                memcpy(info->codepoints, codepoints, sizeof(unsigned) * n_codepoints);
-                info->n_codepoints = n_codepoints;
-
-                if(FOLD_MAP_LIST[i].map[index] != codepoint) {
-                    /* The found mapping maps whole range of codepoints,
-                     * i.e. we have to offset info->codepoints[0] accordingly. */
-                    if((map[index] & 0x00ffffff)+1 == codepoints[0]) {
-                        /* Alternating type of the range. */
-                        info->codepoints[0] = codepoint + ((codepoint & 0x1) == (map[index] & 0x1) ? 1 : 0);
-                    } else {
-                        /* Range to range kind of mapping. */
-                        info->codepoints[0] += (codepoint - (map[index] & 0x00ffffff));
-                    }
-                }
-
-                return;
-            }
+        if((codepoint >> FOLD_BLOCK_SHIFT) >= SIZEOF_ARRAY(FOLD_STAGE1)) {
+            /* No mapping. Map the codepoint to itself. */
+            info->codepoints[0] = codepoint;
+            info->n_codepoints = 1;
+            return;
         }
 
-        /* No mapping found. Map the codepoint to itself. */
-        info->codepoints[0] = codepoint;
-        info->n_codepoints = 1;
+        record = FOLD_STAGE2[((unsigned) FOLD_STAGE1[codepoint >> FOLD_BLOCK_SHIFT] << FOLD_BLOCK_SHIFT) +
+                             (codepoint & ((1U << FOLD_BLOCK_SHIFT) - 1))];
+        info->codepoints[0] = codepoint + FOLD_RECORDS[record].delta;
+        info->codepoints[1] = FOLD_RECORDS[record].tail[0];
+        info->codepoints[2] = FOLD_RECORDS[record].tail[1];
+        info->n_codepoints = FOLD_RECORDS[record].n_codepoints;
+#undef FOLD_BLOCK_SHIFT
     }
 #endif
 
@@ -961,7 +1441,8 @@ md_merge_lines(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines, int n_lines,
     }
 }
 
-/* Wrapper of md_merge_lines() which allocates new buffer for the output string.
+/* Wrapper of md_merge_lines() which allocates new buffer for the output string
+ * (from the arena).
  */
 static int
 md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines, int n_lines,
@@ -970,7 +1451,7 @@ md_merge_lines_alloc(MD_CTX* ctx, OFF beg, OFF end, const MD_LINE* lines, int n_
     CHAR* buffer;
 
     MD_ASSERT(end >= beg);
-    buffer = (CHAR*) malloc(sizeof(CHAR) * (end - beg));
+    buffer = (CHAR*) md_arena_alloc(ctx, sizeof(CHAR) * (end - beg));
     if(buffer == NULL) {
         MD_LOG("malloc() failed.");
         return -1;
@@ -1396,18 +1877,19 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
         build->substr_alloc = (build->substr_alloc > 0
                 ? build->substr_alloc + build->substr_alloc / 2
                 : 8);
-        new_substr_types = (MD_TEXTTYPE*) realloc(build->substr_types,
+        new_substr_types = (MD_TEXTTYPE*) md_arena_realloc(ctx, build->substr_types,
+                                    build->substr_count * sizeof(MD_TEXTTYPE),
                                     build->substr_alloc * sizeof(MD_TEXTTYPE));
         if(new_substr_types == NULL) {
             MD_LOG("realloc() failed.");
             return -1;
         }
         /* Note +1 to reserve space for final offset (== raw_size). */
-        new_substr_offsets = (OFF*) realloc(build->substr_offsets,
+        new_substr_offsets = (OFF*) md_arena_realloc(ctx, build->substr_offsets,
+                                    build->substr_count * sizeof(OFF),
                                     (build->substr_alloc+1) * sizeof(OFF));
         if(new_substr_offsets == NULL) {
             MD_LOG("realloc() failed.");
-            free(new_substr_types);
             return -1;
         }
 
@@ -1421,18 +1903,6 @@ md_build_attr_append_substr(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build,
     return 0;
 }
 
-static void
-md_free_attribute(MD_CTX* ctx, MD_ATTRIBUTE_BUILD* build)
-{
-    MD_UNUSED(ctx);
-
-    if(build->substr_alloc > 0) {
-        free(build->text);
-        free(build->substr_types);
-        free(build->substr_offsets);
-    }
-}
-
 static int
 md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
                    unsigned flags, MD_ATTRIBUTE* attr, MD_ATTRIBUTE_BUILD* build)
@@ -1444,7 +1914,7 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
     memset(build, 0, sizeof(MD_ATTRIBUTE_BUILD));
 
     /* If there is no backslash and no ampersand, build trivial attribute
-     * without any malloc(). */
+     * without any allocation. Otherwise the attribute is built in the arena. */
     is_trivial = TRUE;
     for(raw_off = 0; raw_off < raw_size; raw_off++) {
         if(ISANYOF3_(raw_text[raw_off], _T('\\'), _T('&'), _T('\0'))) {
@@ -1464,7 +1934,7 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
         build->trivial_offsets[1] = raw_size;
         off = raw_size;
     } else {
-        build->text = (CHAR*) malloc(raw_size * sizeof(CHAR));
+        build->text = (CHAR*) md_arena_alloc(ctx, raw_size * sizeof(CHAR));
         if(build->text == NULL) {
             MD_LOG("malloc() failed.");
             goto abort;
@@ -1515,7 +1985,6 @@ md_build_attribute(MD_CTX* ctx, const CHAR* raw_text, SZ raw_size,
     return 0;
 
 abort:
-    md_free_attribute(ctx, build);
     return -1;
 }
 
@@ -1546,331 +2015,180 @@ md_fnv1a(unsigned base, const void* data, size_t n)
 struct MD_REF_DEF_tag {
     CHAR* label;
     CHAR* title;
-    unsigned hash;
+    unsigned* norm_label;       /* Normalized label. See md_link_label_normalize(). */
+    SZ norm_label_size;
+    unsigned hash;              /* Hash of norm_label[]. */
     SZ label_size;
     SZ title_size;
     OFF dest_beg;
     OFF dest_end;
-    unsigned char label_needs_free : 1;
-    unsigned char title_needs_free : 1;
 };
 
 /* Label equivalence is quite complicated with regards to whitespace and case
- * folding. This complicates computing a hash of it as well as direct comparison
- * of two labels. */
-
-static unsigned
-md_link_label_hash(const CHAR* label, SZ size)
+ * folding. Therefore we compare labels in a normalized form: A sequence of
+ * case-folded codepoints where any leading and trailing whitespace is removed
+ * and any inner whitespace sequence is replaced with a single ' '. Two labels
+ * are equivalent iff their normalized forms are equal, i.e. their hash may be
+ * compared first, and then the arrays with a plain memcmp().
+ *
+ * md_link_label_normalize() allocates the normalized form of the label from
+ * the arena and computes its FNV-1a hash. */
+static int
+md_link_label_normalize(MD_CTX* ctx, const CHAR* label, SZ size,
+                        unsigned** p_norm, SZ* p_norm_size, unsigned* p_hash)
 {
-    unsigned hash = MD_FNV1A_BASE;
+    unsigned* norm;
+    SZ n = 0;
     OFF off;
     unsigned codepoint;
-    int is_whitespace = FALSE;
+    SZ char_size;
+    MD_UNICODE_FOLD_INFO fold_info;
+
+    /* Each char folds into at most 3 codepoints. */
+    norm = (unsigned*) md_arena_alloc(ctx, 3 * size * sizeof(unsigned));
+    if(norm == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
+    }
 
     off = md_skip_unicode_whitespace(label, 0, size);
     while(off < size) {
-        SZ char_size;
-
         codepoint = md_decode_unicode(label, off, size, &char_size);
-        is_whitespace = ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off]);
-
-        if(is_whitespace) {
-            codepoint = ' ';
-            hash = md_fnv1a(hash, &codepoint, sizeof(unsigned));
+        if(ISUNICODEWHITESPACE_(codepoint) || ISNEWLINE_(label[off])) {
             off = md_skip_unicode_whitespace(label, off, size);
+            if(off < size)
+                norm[n++] = _T(' ');
         } else {
-            MD_UNICODE_FOLD_INFO fold_info;
-
             md_get_unicode_fold_info(codepoint, &fold_info);
-            hash = md_fnv1a(hash, fold_info.codepoints, fold_info.n_codepoints * sizeof(unsigned));
+            memcpy(norm + n, fold_info.codepoints, fold_info.n_codepoints * sizeof(unsigned));
+            n += fold_info.n_codepoints;
             off += char_size;
         }
     }
 
-    return hash;
-}
-
-static OFF
-md_link_label_cmp_load_fold_info(const CHAR* label, OFF off, SZ size,
-                                 MD_UNICODE_FOLD_INFO* fold_info)
-{
-    unsigned codepoint;
-    SZ char_size;
-
-    if(off >= size) {
-        /* Treat end of a link label as a whitespace. */
-        goto whitespace;
-    }
-
-    codepoint = md_decode_unicode(label, off, size, &char_size);
-    off += char_size;
-    if(ISUNICODEWHITESPACE_(codepoint)) {
-        /* Treat all whitespace as equivalent */
-        goto whitespace;
-    }
-
-    /* Get real folding info. */
-    md_get_unicode_fold_info(codepoint, fold_info);
-    return off;
-
-whitespace:
-    fold_info->codepoints[0] = _T(' ');
-    fold_info->n_codepoints = 1;
-    return md_skip_unicode_whitespace(label, off, size);
-}
-
-static int
-md_link_label_cmp(const CHAR* a_label, SZ a_size, const CHAR* b_label, SZ b_size)
-{
-    OFF a_off;
-    OFF b_off;
-    MD_UNICODE_FOLD_INFO a_fi = { { 0 }, 0 };
-    MD_UNICODE_FOLD_INFO b_fi = { { 0 }, 0 };
-    OFF a_fi_off = 0;
-    OFF b_fi_off = 0;
-    int cmp;
-
-    a_off = md_skip_unicode_whitespace(a_label, 0, a_size);
-    b_off = md_skip_unicode_whitespace(b_label, 0, b_size);
-    while(a_off < a_size || a_fi_off < a_fi.n_codepoints ||
-          b_off < b_size || b_fi_off < b_fi.n_codepoints)
-    {
-        /* If needed, load fold info for next char. */
-        if(a_fi_off >= a_fi.n_codepoints) {
-            a_fi_off = 0;
-            a_off = md_link_label_cmp_load_fold_info(a_label, a_off, a_size, &a_fi);
-        }
-        if(b_fi_off >= b_fi.n_codepoints) {
-            b_fi_off = 0;
-            b_off = md_link_label_cmp_load_fold_info(b_label, b_off, b_size, &b_fi);
-        }
-
-        /* Can be negative when b < a. */
-        cmp = b_fi.codepoints[b_fi_off] - a_fi.codepoints[a_fi_off];
-        if(cmp != 0)
-            return cmp;
-
-        a_fi_off++;
-        b_fi_off++;
-    }
-
+    /* Give the unused tail back to the arena. (This shrinks in place.) */
+    *p_norm = (unsigned*) md_arena_realloc(ctx, norm, 3 * size * sizeof(unsigned), n * sizeof(unsigned));
+    *p_norm_size = n;
+    *p_hash = md_fnv1a(MD_FNV1A_BASE, norm, n * sizeof(unsigned));
     return 0;
 }
 
-typedef struct MD_REF_DEF_LIST_tag MD_REF_DEF_LIST;
-struct MD_REF_DEF_LIST_tag {
-    int n_ref_defs;
-    int alloc_ref_defs;
-    MD_REF_DEF* ref_defs[];  /* Valid items always  point into ctx->ref_defs[] */
-};
-
-static int
-md_ref_def_cmp(const void* a, const void* b)
-{
-    const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-    const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-    if(a_ref->hash < b_ref->hash)
-        return -1;
-    else if(a_ref->hash > b_ref->hash)
-        return +1;
-    else
-        return md_link_label_cmp(a_ref->label, a_ref->label_size, b_ref->label, b_ref->label_size);
-}
-
-static int
-md_ref_def_cmp_for_sort(const void* a, const void* b)
+static inline int
+md_ref_def_label_eq(const MD_REF_DEF* def, const unsigned* norm, SZ norm_size, unsigned hash)
 {
-    int cmp;
-
-    cmp = md_ref_def_cmp(a, b);
-
-    /* Ensure stability of the sorting. */
-    if(cmp == 0) {
-        const MD_REF_DEF* a_ref = *(const MD_REF_DEF**)a;
-        const MD_REF_DEF* b_ref = *(const MD_REF_DEF**)b;
-
-        if(a_ref < b_ref)
-            cmp = -1;
-        else if(a_ref > b_ref)
-            cmp = +1;
-        else
-            cmp = 0;
-    }
-
-    return cmp;
+    return (def->hash == hash  &&  def->norm_label_size == norm_size  &&
+            memcmp(def->norm_label, norm, norm_size * sizeof(unsigned)) == 0);
 }
 
 static int
 md_build_ref_def_hashtable(MD_CTX* ctx)
 {
-    int i, j;
+    unsigned mask;
+    int i;
+    MD_STATS_TIMER(t0)
 
     if(ctx->n_ref_defs == 0)
         return 0;
 
-    ctx->ref_def_hashtable_size = (ctx->n_ref_defs * 5) / 4;
-    ctx->ref_def_hashtable = malloc(ctx->ref_def_hashtable_size * sizeof(void*));
-    if(ctx->ref_def_hashtable == NULL) {
-        MD_LOG("malloc() failed.");
-        goto abort;
-    }
-    memset(ctx->ref_def_hashtable, 0, ctx->ref_def_hashtable_size * sizeof(void*));
-
-    /* Each member of ctx->ref_def_hashtable[] can be:
-     *  -- NULL,
-     *  -- pointer to the MD_REF_DEF in ctx->ref_defs[], or
-     *  -- pointer to a MD_REF_DEF_LIST, which holds multiple pointers to
-     *     such MD_REF_DEFs.
-     */
-    for(i = 0; i < ctx->n_ref_defs; i++) {
-        MD_REF_DEF* def = &ctx->ref_defs[i];
-        void* bucket;
-        MD_REF_DEF_LIST* list;
-
-        def->hash = md_link_label_hash(def->label, def->label_size);
-        bucket = ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size];
-
-        if(bucket == NULL) {
-            /* The bucket is empty. Make it just point to the def. */
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = def;
-            continue;
-        }
-
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-            /* The bucket already contains one ref. def. Lets see whether it
-             * is the same label (ref. def. duplicate) or different one
-             * (hash conflict). */
-            MD_REF_DEF* old_def = (MD_REF_DEF*) bucket;
+    MD_STATS_START(t0);
 
-            if(md_link_label_cmp(def->label, def->label_size, old_def->label, old_def->label_size) == 0) {
-                /* Duplicate label: Ignore this ref. def. */
-                continue;
-            }
+    /* Keep the load factor at most 1/2 so the probe sequences stay short.
+     * If the table is large enough (streaming input), we just add the ref.
+     * defs which are not there yet. */
+    if(ctx->ref_def_hashtable_size < 2 * ctx->n_ref_defs) {
+        int size = 16;
 
-            /* Make the bucket complex, i.e. able to hold more ref. defs. */
-            list = (MD_REF_DEF_LIST*) malloc(sizeof(MD_REF_DEF_LIST) + 2 * sizeof(MD_REF_DEF*));
-            if(list == NULL) {
-                MD_LOG("malloc() failed.");
-                goto abort;
-            }
-            list->ref_defs[0] = old_def;
-            list->ref_defs[1] = def;
-            list->n_ref_defs = 2;
-            list->alloc_ref_defs = 2;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
-            continue;
-        }
+        while(size < 2 * ctx->n_ref_defs)
+            size *= 2;
 
-        /* Append the def to the complex bucket list.
-         *
-         * Note in this case we ignore potential duplicates to avoid expensive
-         * iterating over the complex bucket. Below, we revisit all the complex
-         * buckets and handle it more cheaply after the complex bucket contents
-         * is sorted. */
-        list = (MD_REF_DEF_LIST*) bucket;
-        if(list->n_ref_defs >= list->alloc_ref_defs) {
-            int alloc_ref_defs = list->alloc_ref_defs + list->alloc_ref_defs / 2;
-            MD_REF_DEF_LIST* list_tmp = (MD_REF_DEF_LIST*) realloc(list,
-                        sizeof(MD_REF_DEF_LIST) + alloc_ref_defs * sizeof(MD_REF_DEF*));
-            if(list_tmp == NULL) {
-                MD_LOG("realloc() failed.");
-                goto abort;
-            }
-            list = list_tmp;
-            list->alloc_ref_defs = alloc_ref_defs;
-            ctx->ref_def_hashtable[def->hash % ctx->ref_def_hashtable_size] = list;
+        ctx->ref_def_hashtable = (MD_REF_DEF**) md_arena_alloc(ctx, size * sizeof(MD_REF_DEF*));
+        if(ctx->ref_def_hashtable == NULL) {
+            MD_LOG("malloc() failed.");
+            goto abort;
         }
-
-        list->ref_defs[list->n_ref_defs] = def;
-        list->n_ref_defs++;
+        memset(ctx->ref_def_hashtable, 0, size * sizeof(MD_REF_DEF*));
+        ctx->ref_def_hashtable_size = size;
+        ctx->n_ref_defs_in_hashtable = 0;
     }
 
-    /* Sort the complex buckets so we can use bsearch() with them. */
-    for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-        void* bucket = ctx->ref_def_hashtable[i];
-        MD_REF_DEF_LIST* list;
-
-        if(bucket == NULL)
-            continue;
-        if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
-            continue;
-
-        list = (MD_REF_DEF_LIST*) bucket;
-        qsort(list->ref_defs, list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp_for_sort);
+    mask = (unsigned) ctx->ref_def_hashtable_size - 1;
+    for(i = ctx->n_ref_defs_in_hashtable; i < ctx->n_ref_defs; i++) {
+        MD_REF_DEF* def = &ctx->ref_defs[i];
+        unsigned index = def->hash & mask;
 
-        /* Disable all duplicates in the complex bucket by forcing all such
-         * records to point to the 1st such ref. def. I.e. no matter which
-         * record is found during the lookup, it will always point to the right
-         * ref. def. in ctx->ref_defs[]. */
-        for(j = 1; j < list->n_ref_defs; j++) {
-            if(md_ref_def_cmp(&list->ref_defs[j-1], &list->ref_defs[j]) == 0)
-                list->ref_defs[j] = list->ref_defs[j-1];
+        while(ctx->ref_def_hashtable[index] != NULL) {
+            /* If the label is already there, ignore this ref. def. (the first
+             * one always wins). */
+            if(md_ref_def_label_eq(ctx->ref_def_hashtable[index], def->norm_label, def->norm_label_size, def->hash))
+                break;
+            index = (index + 1) & mask;
         }
+
+        if(ctx->ref_def_hashtable[index] == NULL)
+            ctx->ref_def_hashtable[index] = def;
     }
+    ctx->n_ref_defs_in_hashtable = ctx->n_ref_defs;
 
+    MD_STATS_STOP(t0, ref_def_time);
     return 0;
 
 abort:
+    ctx->ref_def_hashtable = NULL;
+    ctx->ref_def_hashtable_size = 0;
+    ctx->n_ref_defs_in_hashtable = 0;
+    MD_STATS_STOP(t0, ref_def_time);
     return -1;
 }
 
-static void
-md_free_ref_def_hashtable(MD_CTX* ctx)
+static const MD_REF_DEF*
+md_lookup_ref_def(MD_CTX* ctx, const unsigned* norm, SZ norm_size, unsigned hash)
 {
-    if(ctx->ref_def_hashtable != NULL) {
-        int i;
+    const MD_REF_DEF* def;
+    int i;
 
-        for(i = 0; i < ctx->ref_def_hashtable_size; i++) {
-            void* bucket = ctx->ref_def_hashtable[i];
-            if(bucket == NULL)
-                continue;
-            if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs)
-                continue;
-            free(bucket);
+    MD_STATS_ADD(n_ref_def_lookups, 1);
+    if(ctx->ref_def_hashtable_size > 0) {
+        unsigned mask = (unsigned) ctx->ref_def_hashtable_size - 1;
+        unsigned index = hash & mask;
+
+        while((def = ctx->ref_def_hashtable[index]) != NULL) {
+            if(md_ref_def_label_eq(def, norm, norm_size, hash))
+                return def;
+            index = (index + 1) & mask;
         }
+    }
 
-        free(ctx->ref_def_hashtable);
+    /* With a streaming input, the hashtable is rebuilt only from time to
+     * time, so few most recent ref. defs may be missing there. */
+    for(i = ctx->n_ref_defs_in_hashtable; i < ctx->n_ref_defs; i++) {
+        def = &ctx->ref_defs[i];
+        if(md_ref_def_label_eq(def, norm, norm_size, hash))
+            return def;
     }
+
+    return NULL;
 }
 
-static const MD_REF_DEF*
-md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
+/* Fix ref. defs. ctx->ref_defs[from ... to-1] after the document text has
+ * moved from old_text into new_text, with n_removed bytes replaced by
+ * n_inserted ones somewhere before all of them. (Labels and titles spanning
+ * multiple lines live in the arena; those do not need any fixing.) */
+static void
+md_rebase_ref_defs(MD_CTX* ctx, int from, int to, const CHAR* old_text, SZ old_size,
+                   CHAR* new_text, SZ n_removed, SZ n_inserted)
 {
-    unsigned hash;
-    void* bucket;
-
-    if(ctx->ref_def_hashtable_size == 0)
-        return NULL;
-
-    hash = md_link_label_hash(label, label_size);
-    bucket = ctx->ref_def_hashtable[hash % ctx->ref_def_hashtable_size];
+    ptrdiff_t shift = (ptrdiff_t) n_inserted - (ptrdiff_t) n_removed;
+    int i;
 
-    if(bucket == NULL) {
-        return NULL;
-    } else if(ctx->ref_defs <= (MD_REF_DEF*) bucket  &&  (MD_REF_DEF*) bucket < ctx->ref_defs + ctx->n_ref_defs) {
-        const MD_REF_DEF* def = (MD_REF_DEF*) bucket;
+    for(i = from; i < to; i++) {
+        MD_REF_DEF* def = &ctx->ref_defs[i];
 
-        if(md_link_label_cmp(def->label, def->label_size, label, label_size) == 0)
-            return def;
-        else
-            return NULL;
-    } else {
-        MD_REF_DEF_LIST* list = (MD_REF_DEF_LIST*) bucket;
-        MD_REF_DEF key_buf;
-        const MD_REF_DEF* key = &key_buf;
-        const MD_REF_DEF** ret;
-
-        key_buf.label = (CHAR*) label;
-        key_buf.label_size = label_size;
-        key_buf.hash = md_link_label_hash(key_buf.label, key_buf.label_size);
-
-        ret = (const MD_REF_DEF**) bsearch(&key, list->ref_defs,
-                    list->n_ref_defs, sizeof(MD_REF_DEF*), md_ref_def_cmp);
-        if(ret != NULL)
-            return *ret;
-        else
-            return NULL;
+        if(old_text <= def->label  &&  def->label <= old_text + old_size)
+            def->label = new_text + ((def->label - old_text) + shift);
+        if(old_text <= def->title  &&  def->title <= old_text + old_size)
+            def->title = new_text + ((def->title - old_text) + shift);
+        def->dest_beg = def->dest_beg - n_removed + n_inserted;
+        def->dest_end = def->dest_end - n_removed + n_inserted;
     }
 }
 
@@ -1890,7 +2208,6 @@ struct MD_LINK_ATTR_tag {
 
     CHAR* title;
     SZ title_size;
-    int title_needs_free;
 };
 
 
@@ -2191,17 +2508,28 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
     /* So, it _is_ a reference definition. Remember it. */
     if(ctx->n_ref_defs >= ctx->alloc_ref_defs) {
         MD_REF_DEF* new_defs;
+        int new_alloc;
 
-        ctx->alloc_ref_defs = (ctx->alloc_ref_defs > 0
+        new_alloc = (ctx->alloc_ref_defs > 0
                 ? ctx->alloc_ref_defs + ctx->alloc_ref_defs / 2
                 : 16);
-        new_defs = (MD_REF_DEF*) realloc(ctx->ref_defs, ctx->alloc_ref_defs * sizeof(MD_REF_DEF));
+        new_defs = (MD_REF_DEF*) md_realloc(ctx, ctx->ref_defs, new_alloc * sizeof(MD_REF_DEF));
         if(new_defs == NULL) {
             MD_LOG("realloc() failed.");
+            ret = -1;
             goto abort;
         }
 
+        /* If there is a hashtable already (streaming input), it now points
+         * to the old buffer. */
+        if(new_defs != ctx->ref_defs) {
+            ctx->ref_def_hashtable = NULL;
+            ctx->ref_def_hashtable_size = 0;
+            ctx->n_ref_defs_in_hashtable = 0;
+        }
+
         ctx->ref_defs = new_defs;
+        ctx->alloc_ref_defs = new_alloc;
     }
     def = &ctx->ref_defs[ctx->n_ref_defs];
     memset(def, 0, sizeof(MD_REF_DEF));
@@ -2211,19 +2539,20 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         MD_CHECK(md_merge_lines_alloc(ctx, label_contents_beg, label_contents_end,
                     lines + label_contents_line_index, n_lines - label_contents_line_index,
                     _T(' '), &def->label, &def->label_size));
-        def->label_needs_free = TRUE;
     } else {
         def->label = (CHAR*) STR(label_contents_beg);
         MD_ASSERT(label_contents_end >= label_contents_beg);
         def->label_size = label_contents_end - label_contents_beg;
     }
 
+    MD_CHECK(md_link_label_normalize(ctx, def->label, def->label_size,
+                &def->norm_label, &def->norm_label_size, &def->hash));
+
     if(title_is_multiline) {
         MD_ASSERT(n_lines >= title_contents_line_index);
         MD_CHECK(md_merge_lines_alloc(ctx, title_contents_beg, title_contents_end,
                     lines + title_contents_line_index, n_lines - title_contents_line_index,
                     _T('\n'), &def->title, &def->title_size));
-        def->title_needs_free = TRUE;
     } else {
         def->title = (CHAR*) STR(title_contents_beg);
         MD_ASSERT(title_contents_end >= title_contents_beg);
@@ -2239,10 +2568,6 @@ md_is_link_reference_definition(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
 abort:
     /* Failure. */
-    if(def != NULL  &&  def->label_needs_free)
-        free(def->label);
-    if(def != NULL  &&  def->title_needs_free)
-        free(def->title);
     return ret;
 }
 
@@ -2252,9 +2577,12 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
 {
     const MD_REF_DEF* def;
     const MD_LINE* beg_line;
-    int is_multiline;
+    MD_ARENA_MARK arena_mark;
     CHAR* label;
     SZ label_size;
+    unsigned* norm_label;
+    SZ norm_label_size;
+    unsigned hash;
     int ret;
 
     MD_ASSERT(CH(beg) == _T('[') || CH(beg) == _T('!'));
@@ -2265,9 +2593,9 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
 
     /* Find lines corresponding to the beg and end positions. */
     beg_line = md_lookup_line(beg, lines, n_lines);
-    is_multiline = (end > beg_line->end);
+    md_arena_save(ctx, &arena_mark);
 
-    if(is_multiline) {
+    if(end > beg_line->end) {
         MD_ASSERT(n_lines + lines >= beg_line);
         MD_CHECK(md_merge_lines_alloc(ctx, beg, end, beg_line,
                  (int)(n_lines - (beg_line - lines)), _T(' '), &label, &label_size));
@@ -2277,21 +2605,19 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
         label_size = end - beg;
     }
 
-    def = md_lookup_ref_def(ctx, label, label_size);
+    MD_CHECK(md_link_label_normalize(ctx, label, label_size, &norm_label, &norm_label_size, &hash));
+    def = md_lookup_ref_def(ctx, norm_label, norm_label_size, hash);
     if(def != NULL) {
         attr->dest_beg = def->dest_beg;
         attr->dest_end = def->dest_end;
         attr->title = def->title;
         attr->title_size = def->title_size;
-        attr->title_needs_free = FALSE;
     }
 
-    if(is_multiline)
-        free(label);
-
     ret = (def != NULL);
 
 abort:
+    md_arena_restore(ctx, &arena_mark);
     return ret;
 }
 
@@ -2330,7 +2656,6 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
         attr->dest_end = off;
         attr->title = NULL;
         attr->title_size = 0;
-        attr->title_needs_free = FALSE;
         off++;
         *p_end = off;
         return TRUE;
@@ -2374,18 +2699,15 @@ md_is_inline_link_spec(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
     if(title_contents_beg >= title_contents_end) {
         attr->title = NULL;
         attr->title_size = 0;
-        attr->title_needs_free = FALSE;
     } else if(!title_is_multiline) {
         attr->title = (CHAR*) STR(title_contents_beg);
         MD_ASSERT(title_contents_end >= title_contents_beg);
         attr->title_size = title_contents_end - title_contents_beg;
-        attr->title_needs_free = FALSE;
     } else {
         MD_ASSERT(n_lines >= title_contents_line_index);
         MD_CHECK(md_merge_lines_alloc(ctx, title_contents_beg, title_contents_end,
                     lines + title_contents_line_index, n_lines - title_contents_line_index,
                     _T('\n'), &attr->title, &attr->title_size));
-        attr->title_needs_free = TRUE;
     }
 
     *p_end = off;
@@ -2395,23 +2717,6 @@ abort:
     return ret;
 }
 
-static void
-md_free_ref_defs(MD_CTX* ctx)
-{
-    int i;
-
-    for(i = 0; i < ctx->n_ref_defs; i++) {
-        MD_REF_DEF* def = &ctx->ref_defs[i];
-
-        if(def->label_needs_free)
-            free(def->label);
-        if(def->title_needs_free)
-            free(def->title);
-    }
-
-    free(ctx->ref_defs);
-}
-
 
 /******************************************
  ***  Processing Inlines (a.k.a Spans)  ***
@@ -2511,6 +2816,7 @@ struct MD_MARK_tag {
 #define MD_MARK_AUTOLINK                    0x20  /* Distinguisher for '<', '>'. */
 #define MD_MARK_VALIDPERMISSIVEAUTOLINK     0x20  /* For permissive autolinks. */
 #define MD_MARK_HASNESTEDBRACKETS           0x20  /* For '[' to rule out invalid link labels early */
+#define MD_MARK_INSIDELINKDEST              0x40  /* For '[' and '!' inside a resolved link's (...) */
 
 static MD_MARKCHAIN*
 md_asterisk_chain(MD_CTX* ctx, unsigned flags)
@@ -2553,7 +2859,7 @@ md_push_mark(MD_CTX* ctx)
         ctx->alloc_marks = (ctx->alloc_marks > 0
                 ? ctx->alloc_marks + ctx->alloc_marks / 2
                 : 64);
-        new_marks = realloc(ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
+        new_marks = md_realloc(ctx, ctx->marks, ctx->alloc_marks * sizeof(MD_MARK));
         if(new_marks == NULL) {
             MD_LOG("realloc() failed.");
             return NULL;
@@ -2674,6 +2980,8 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
     int i;
     int mark_index;
 
+    MD_STATS_ADD(n_rollbacks, 1);
+
     /* Cut all unresolved openers at the mark index. */
     for(i = OPENERS_CHAIN_FIRST; i < OPENERS_CHAIN_LAST+1; i++) {
         MD_MARKCHAIN* chain = &ctx->mark_chains[i];
@@ -2793,6 +3101,23 @@ md_build_mark_char_map(MD_CTX* ctx)
                 ctx->mark_char_map[i] = 1;
         }
     }
+
+#ifndef MD4C_USE_UTF16
+    md_simd_charset_init(&ctx->mark_charset, ctx->mark_char_map);
+
+    if(ctx->parser.flags & MD_FLAG_TABLES) {
+        char table_row_map[256] = { 0 };
+
+        table_row_map['\\'] = 1;
+        table_row_map['`'] = 1;
+        table_row_map['<'] = 1;
+        table_row_map['['] = 1;
+        table_row_map['|'] = 1;
+        if(ctx->parser.flags & MD_FLAG_PERMISSIVEURLAUTOLINKS)
+            table_row_map[':'] = 1;
+        md_simd_charset_init(&ctx->table_row_charset, table_row_map);
+    }
+#endif
 }
 
 /* We limit code span marks to lower than 32 backticks. This solves the
@@ -3050,10 +3375,6 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
     /* For UTF-16, mark_char_map[] covers only ASCII. */
     #define IS_MARK_CHAR(off)   ((CH(off) < SIZEOF_ARRAY(ctx->mark_char_map))  &&  \
                                 (ctx->mark_char_map[(unsigned char) CH(off)]))
-#else
-    /* For 8-bit encodings, mark_char_map[] covers all 256 elements. */
-    #define IS_MARK_CHAR(off)   (ctx->mark_char_map[(unsigned char) CH(off)])
-#endif
 
             /* Optimization: Use some loop unrolling. */
             while(off + 3 < line_end  &&  !IS_MARK_CHAR(off+0)  &&  !IS_MARK_CHAR(off+1)
@@ -3061,6 +3382,15 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
                 off += 4;
             while(off < line_end  &&  !IS_MARK_CHAR(off+0))
                 off++;
+#else
+            /* For 8-bit encodings, skip to the next mark character with the
+             * (possibly vectorized) md_simd_find(). (Note the previous mark
+             * may have taken us beyond the line end already.) */
+            if(off < line_end) {
+                off += (OFF) md_simd_find(&ctx->mark_charset,
+                            (const unsigned char*) STR(off), line_end - off);
+            }
+#endif
 
             if(off >= line_end)
                 break;
@@ -3495,6 +3825,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
         MD_MARK* next_closer;
         MD_LINK_ATTR attr;
         int is_link = FALSE;
+        int mark_index;
 
         if(next_index >= 0) {
             next_opener = &ctx->marks[next_index];
@@ -3510,10 +3841,16 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
          *
          * (Note we here analyze from inner to outer as the marks are ordered
          * by closer->beg.)
+         *
+         * Also an opener inside of the (...) of an already resolved link or
+         * image cannot start anything, e.g. "[](![)]()". (Such openers get
+         * MD_MARK_INSIDELINKDEST when the link is resolved, as that link need
+         * not be the last one by then, e.g. "![]([)![]()]()".)
          */
         if((opener->beg < last_link_beg  &&  closer->end < last_link_end)  ||
            (opener->beg < last_img_beg  &&  closer->end < last_img_end)  ||
-           (opener->beg < last_link_end  &&  opener->ch == '['))
+           (opener->beg < last_link_end  &&  opener->ch == '[')  ||
+           (opener->flags & MD_MARK_INSIDELINKDEST))
         {
             opener_index = next_index;
             continue;
@@ -3552,9 +3889,13 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                     delim = m;
                     break;
                 }
-                MD_ASSERT(m->beg >= opener->end);
-                if(m->ch != 'D'  &&  m->beg - opener->end > 100)
-                    break;
+                /* (The dummy marks of a resolved nested link hold its
+                 * destination and title, not any position.) */
+                if(m->ch != 'D') {
+                    MD_ASSERT(m->beg >= opener->end);
+                    if(m->beg - opener->end > 100)
+                        break;
+                }
                 delim_index++;
             }
             dest_beg = opener->end;
@@ -3652,8 +3993,6 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                         if((mark->flags & (MD_MARK_OPENER | MD_MARK_RESOLVED)) == (MD_MARK_OPENER | MD_MARK_RESOLVED)) {
                             if(ctx->marks[mark->next].beg >= inline_link_end) {
                                 /* Cancel the link status. */
-                                if(attr.title_needs_free)
-                                    free(attr.title);
                                 is_link = FALSE;
                                 break;
                             }
@@ -3693,9 +4032,6 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
             MD_ASSERT(ctx->marks[opener_index+2].ch == 'D');
             md_mark_store_ptr(ctx, opener_index+2, attr.title);
-            /* The title might or might not have been allocated for us. */
-            if(attr.title_needs_free)
-                md_mark_chain_append(ctx, &PTR_CHAIN, opener_index+2);
             ctx->marks[opener_index+2].prev = attr.title_size;
 
             if(opener->ch == '[') {
@@ -3706,6 +4042,16 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                 last_img_end = closer->end;
             }
 
+            /* Disable the openers inside of the (...). See above. */
+            for(mark_index = closer_index + 1; mark_index < ctx->n_marks; mark_index++) {
+                MD_MARK* mark = &ctx->marks[mark_index];
+
+                if(mark->beg >= closer->end)
+                    break;
+                if(mark->ch == '['  ||  mark->ch == '!')
+                    mark->flags |= MD_MARK_INSIDELINKDEST;
+            }
+
             md_analyze_link_contents(ctx, lines, n_lines, opener_index+1, closer_index);
 
             /* If the link text is formed by nothing but permissive autolink,
@@ -4120,12 +4466,17 @@ static int
 md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mode)
 {
     int ret;
+    MD_STATS_TIMER(t0)
 
     /* Reset the previously collected stack of marks. */
     ctx->n_marks = 0;
 
     /* Collect all marks. */
+    MD_STATS_START(t0);
     MD_CHECK(md_collect_marks(ctx, lines, n_lines, table_mode));
+    MD_STATS_STOP(t0, mark_collect_time);
+    MD_STATS_ADD(n_marks, ctx->n_marks);
+    MD_STATS_START(t0);
 
     /* (1) Links. */
     md_analyze_marks(ctx, lines, n_lines, 0, ctx->n_marks, _T("[]!"));
@@ -4144,6 +4495,7 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mod
         TABLECELLBOUNDARIES.tail = -1;
         ctx->n_table_cell_boundaries = 0;
         md_analyze_marks(ctx, lines, n_lines, 0, ctx->n_marks, _T("|"));
+        MD_STATS_STOP(t0, mark_analysis_time);
         return ret;
     }
 
@@ -4151,6 +4503,7 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines, int table_mod
     md_analyze_link_contents(ctx, lines, n_lines, 0, ctx->n_marks);
 
 abort:
+    MD_STATS_STOP(t0, mark_analysis_time);
     return ret;
 }
 
@@ -4169,52 +4522,105 @@ md_analyze_link_contents(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
     }
 }
 
+/* Attributes of a link-like span (link, image, wiki link).
+ *
+ * They are built only once, when entering the span, and the same detail is
+ * then reused for the matching leave. The record and all the attribute strings
+ * live in the arena; leaving the span releases them. As the spans are always
+ * properly nested, a simple stack does the job. */
+struct MD_SPAN_ATTRS_tag {
+    MD_SPAN_ATTRS* prev;
+    MD_ARENA_MARK arena_mark;
+    MD_SPANTYPE type;
+    union {
+        MD_SPAN_A_DETAIL a;
+        MD_SPAN_IMG_DETAIL img;
+        MD_SPAN_WIKILINK_DETAIL wikilink;
+    } det;
+    /* Trivial attributes point into these. */
+    MD_ATTRIBUTE_BUILD builds[2];
+};
+
+static MD_SPAN_ATTRS*
+md_push_span_attrs(MD_CTX* ctx, MD_SPANTYPE type)
+{
+    MD_ARENA_MARK arena_mark;
+    MD_SPAN_ATTRS* attrs;
+
+    md_arena_save(ctx, &arena_mark);
+    attrs = (MD_SPAN_ATTRS*) md_arena_alloc(ctx, sizeof(MD_SPAN_ATTRS));
+    if(attrs == NULL) {
+        MD_LOG("malloc() failed.");
+        return NULL;
+    }
+
+    memset(attrs, 0, sizeof(MD_SPAN_ATTRS));
+    attrs->prev = ctx->span_attrs;
+    attrs->arena_mark = arena_mark;
+    attrs->type = type;
+    ctx->span_attrs = attrs;
+    return attrs;
+}
+
+static int
+md_leave_span_attrs(MD_CTX* ctx, MD_SPANTYPE type)
+{
+    MD_SPAN_ATTRS* attrs = ctx->span_attrs;
+    int ret = 0;
+
+    MD_ASSERT(attrs != NULL);
+    MD_ASSERT(attrs->type == type);
+    ctx->span_attrs = attrs->prev;
+
+    MD_LEAVE_SPAN(type, &attrs->det);
+
+abort:
+    md_arena_restore(ctx, &attrs->arena_mark);
+    return ret;
+}
+
 static int
-md_enter_leave_span_a(MD_CTX* ctx, int enter, MD_SPANTYPE type,
-                      const CHAR* dest, SZ dest_size, int prohibit_escapes_in_dest,
-                      const CHAR* title, SZ title_size)
+md_enter_span_a(MD_CTX* ctx, MD_SPANTYPE type,
+                const CHAR* dest, SZ dest_size, int prohibit_escapes_in_dest,
+                const CHAR* title, SZ title_size)
 {
-    MD_ATTRIBUTE_BUILD href_build = { 0 };
-    MD_ATTRIBUTE_BUILD title_build = { 0 };
-    MD_SPAN_A_DETAIL det;
+    MD_SPAN_ATTRS* attrs;
     int ret = 0;
 
+    attrs = md_push_span_attrs(ctx, type);
+    if(attrs == NULL)
+        return -1;
+
     /* Note we here rely on fact that MD_SPAN_A_DETAIL and
      * MD_SPAN_IMG_DETAIL are binary-compatible. */
-    memset(&det, 0, sizeof(MD_SPAN_A_DETAIL));
     MD_CHECK(md_build_attribute(ctx, dest, dest_size,
                     (prohibit_escapes_in_dest ? MD_BUILD_ATTR_NO_ESCAPES : 0),
-                    &det.href, &href_build));
-    MD_CHECK(md_build_attribute(ctx, title, title_size, 0, &det.title, &title_build));
+                    &attrs->det.a.href, &attrs->builds[0]));
+    MD_CHECK(md_build_attribute(ctx, title, title_size, 0,
+                    &attrs->det.a.title, &attrs->builds[1]));
 
-    if(enter)
-        MD_ENTER_SPAN(type, &det);
-    else
-        MD_LEAVE_SPAN(type, &det);
+    MD_ENTER_SPAN(type, &attrs->det);
 
 abort:
-    md_free_attribute(ctx, &href_build);
-    md_free_attribute(ctx, &title_build);
     return ret;
 }
 
 static int
-md_enter_leave_span_wikilink(MD_CTX* ctx, int enter, const CHAR* target, SZ target_size)
+md_enter_span_wikilink(MD_CTX* ctx, const CHAR* target, SZ target_size)
 {
-    MD_ATTRIBUTE_BUILD target_build = { 0 };
-    MD_SPAN_WIKILINK_DETAIL det;
+    MD_SPAN_ATTRS* attrs;
     int ret = 0;
 
-    memset(&det, 0, sizeof(MD_SPAN_WIKILINK_DETAIL));
-    MD_CHECK(md_build_attribute(ctx, target, target_size, 0, &det.target, &target_build));
+    attrs = md_push_span_attrs(ctx, MD_SPAN_WIKILINK);
+    if(attrs == NULL)
+        return -1;
 
-    if (enter)
-        MD_ENTER_SPAN(MD_SPAN_WIKILINK, &det);
-    else
-        MD_LEAVE_SPAN(MD_SPAN_WIKILINK, &det);
+    MD_CHECK(md_build_attribute(ctx, target, target_size, 0,
+                    &attrs->det.wikilink.target, &attrs->builds[0]));
+
+    MD_ENTER_SPAN(MD_SPAN_WIKILINK, &attrs->det);
 
 abort:
-    md_free_attribute(ctx, &target_build);
     return ret;
 }
 
@@ -4353,6 +4759,11 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                             int has_label;
                             SZ target_sz;
 
+                            if(mark->ch == ']') {
+                                MD_CHECK(md_leave_span_attrs(ctx, MD_SPAN_WIKILINK));
+                                break;
+                            }
+
                             MD_ASSERT(opener->end >= opener->beg);
                             has_label = (opener->end - opener->beg > 2);
 
@@ -4364,7 +4775,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                                 target_sz = closer->beg - opener->end;
                             }
 
-                            MD_CHECK(md_enter_leave_span_wikilink(ctx, (mark->ch != ']'),
+                            MD_CHECK(md_enter_span_wikilink(ctx,
                                     has_label ? STR(opener->beg+2) : STR(opener->end),
                                     target_sz));
 
@@ -4379,17 +4790,23 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 
                     if ((ctx->parser.flags & MD_FLAG_CODELINKS)  &&  *STR(dest_mark->beg) == '$')
                     {
-                        MD_ASSERT(dest_mark->end >= dest_mark->beg + 1);
-                        MD_ASSERT(title_mark >= ctx->marks);
-                        MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
-                                MD_SPAN_A_CODELINK,
-                                STR(dest_mark->beg + 1), dest_mark->end - (dest_mark->beg + 1), FALSE,
-                                md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
-								title_mark->prev));
+                        if(mark->ch == ']') {
+                            MD_CHECK(md_leave_span_attrs(ctx, MD_SPAN_A_CODELINK));
+                        } else {
+                            MD_ASSERT(dest_mark->end >= dest_mark->beg + 1);
+                            MD_ASSERT(title_mark >= ctx->marks);
+                            MD_CHECK(md_enter_span_a(ctx, MD_SPAN_A_CODELINK,
+                                    STR(dest_mark->beg + 1), dest_mark->end - (dest_mark->beg + 1), FALSE,
+                                    md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
+                                    title_mark->prev));
+                        }
+                    } else if(mark->ch == ']') {
+                        MD_CHECK(md_leave_span_attrs(ctx,
+                                    (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A)));
                     } else {
                         MD_ASSERT(dest_mark->end >= dest_mark->beg);
                         MD_ASSERT(title_mark >= ctx->marks);
-                        MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
+                        MD_CHECK(md_enter_span_a(ctx,
                                     (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
                                     STR(dest_mark->beg), dest_mark->end - dest_mark->beg, FALSE,
                                     md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
@@ -4437,6 +4854,14 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                     if(mark->flags & MD_MARK_OPENER)
                         closer->flags |= MD_MARK_VALIDPERMISSIVEAUTOLINK;
 
+                    if(!(closer->flags & MD_MARK_VALIDPERMISSIVEAUTOLINK))
+                        break;
+
+                    if(!(mark->flags & MD_MARK_OPENER)) {
+                        MD_CHECK(md_leave_span_attrs(ctx, MD_SPAN_A));
+                        break;
+                    }
+
                     if(opener->ch == '@' || opener->ch == '.') {
                         dest_size += 7;
                         MD_TEMP_BUFFER(dest_size * sizeof(CHAR));
@@ -4447,9 +4872,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
                         dest = ctx->buffer;
                     }
 
-                    if(closer->flags & MD_MARK_VALIDPERMISSIVEAUTOLINK)
-                        MD_CHECK(md_enter_leave_span_a(ctx, (mark->flags & MD_MARK_OPENER),
-                                    MD_SPAN_A, dest, dest_size, TRUE, NULL, 0));
+                    MD_CHECK(md_enter_span_a(ctx, MD_SPAN_A, dest, dest_size, TRUE, NULL, 0));
                     break;
                 }
 
@@ -4595,44 +5018,192 @@ abort:
 }
 
 static int
-md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
-                     const MD_ALIGN* align, int col_count)
+md_push_table_cell_off(MD_CTX* ctx, OFF off)
+{
+    if(ctx->n_table_cell_offs >= ctx->alloc_table_cell_offs) {
+        OFF* new_offs;
+        int new_alloc;
+
+        new_alloc = (ctx->alloc_table_cell_offs > 0
+                ? ctx->alloc_table_cell_offs * 2
+                : 64);
+        new_offs = md_realloc(ctx, ctx->table_cell_offs, new_alloc * sizeof(OFF));
+        if(new_offs == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        ctx->table_cell_offs = new_offs;
+        ctx->alloc_table_cell_offs = new_alloc;
+    }
+
+    ctx->table_cell_offs[ctx->n_table_cell_offs++] = off;
+    return 0;
+}
+
+/* Find the pipes which form the cell boundaries of the table row without
+ * the full inline analysis of the row.
+ *
+ * A pipe is not a cell boundary if it is escaped or if it is inside a code
+ * span, a raw HTML, an autolink or a link. Except links, we recognize all of
+ * those here exactly the way md_collect_marks() does. Links would need the
+ * whole machinery of md_resolve_links() so if the row contains any bracket,
+ * we give up (*p_need_analysis is set) and the caller has to use
+ * md_analyze_inlines() instead.
+ *
+ * This way the inlines of most rows are collected and analyzed only once, by
+ * the processing of the individual cells.
+ */
+static int
+md_scan_table_row(MD_CTX* ctx, OFF beg, OFF end, int* p_need_analysis)
 {
     MD_LINE line;
-    OFF* pipe_offs = NULL;
-    int i, j, k, n;
+    OFF codespan_last_potential_closers[CODESPAN_MARK_MAXLEN] = { 0 };
+    int codespan_scanned_till_paragraph_end = FALSE;
+    OFF html_horizons[4];
+    OFF off = beg;
     int ret = 0;
 
     line.beg = beg;
     line.end = end;
+    *p_need_analysis = FALSE;
 
-    /* Break the line into table cells by identifying pipe characters who
-     * form the cell boundary. */
-    MD_CHECK(md_analyze_inlines(ctx, &line, 1, TRUE));
+    /* md_is_html_any() assumes it is called with growing offsets. If we give
+     * up, md_collect_marks() restarts from the line beginning so it has to
+     * see the horizons as if we have never been here. */
+    html_horizons[0] = ctx->html_comment_horizon;
+    html_horizons[1] = ctx->html_proc_instr_horizon;
+    html_horizons[2] = ctx->html_decl_horizon;
+    html_horizons[3] = ctx->html_cdata_horizon;
 
-    /* We have to remember the cell boundaries in local buffer because
-     * ctx->marks[] shall be reused during cell contents processing. */
-    n = ctx->n_table_cell_boundaries + 2;
-    pipe_offs = (OFF*) malloc(n * sizeof(OFF));
-    if(pipe_offs == NULL) {
-        MD_LOG("malloc() failed.");
-        ret = -1;
-        goto abort;
+    while(TRUE) {
+        CHAR ch;
+
+#ifdef MD4C_USE_UTF16
+        while(off < end  &&  !ISANYOF(off, _T("\\`<[|:")))
+            off++;
+#else
+        if(off < end) {
+            off += (OFF) md_simd_find(&ctx->table_row_charset,
+                        (const unsigned char*) STR(off), end - off);
+        }
+#endif
+
+        if(off >= end)
+            break;
+
+        ch = CH(off);
+
+        if(ch == _T('\\')) {
+            if(off+1 < ctx->size  &&  (ISPUNCT(off+1) || ISNEWLINE(off+1)))
+                off += 2;
+            else
+                off++;
+            continue;
+        }
+
+        if(ch == _T('`')) {
+            OFF opener_beg, opener_end;
+            OFF closer_beg, closer_end;
+
+            if(md_is_code_span(ctx, &line, 1, off, &opener_beg, &opener_end,
+                        &closer_beg, &closer_end, codespan_last_potential_closers,
+                        &codespan_scanned_till_paragraph_end))
+                off = closer_end;
+            else
+                off = opener_end;
+            continue;
+        }
+
+        if(ch == _T('<')) {
+            OFF tmp;
+            int missing_mailto;
+
+            if(!(ctx->parser.flags & MD_FLAG_NOHTMLSPANS)  &&
+               md_is_html_any(ctx, &line, 1, off, end, &tmp))
+                off = tmp;
+            else if(md_is_autolink(ctx, off, end, &tmp, &missing_mailto))
+                off = tmp;
+            else
+                off++;
+            continue;
+        }
+
+        if(ch == _T('['))
+            goto need_analysis;
+
+        if(ch == _T(':')) {
+            /* md_collect_marks() skips also the character after "http://" and
+             * alike. Leave such (rare) rows to the full analysis. */
+            if((ctx->parser.flags & MD_FLAG_PERMISSIVEURLAUTOLINKS)  &&
+               off + 3 < end  &&  CH(off+1) == _T('/')  &&  CH(off+2) == _T('/')  &&
+               ISANYOF(off+3, _T("\\`<[|")))
+                goto need_analysis;
+            off++;
+            continue;
+        }
+
+        /* An unescaped pipe outside of any code span etc.: a cell boundary. */
+        MD_CHECK(md_push_table_cell_off(ctx, off+1));
+        off++;
     }
-    j = 0;
-    pipe_offs[j++] = beg;
-    for(i = TABLECELLBOUNDARIES.head; i >= 0; i = ctx->marks[i].next) {
-        MD_MARK* mark = &ctx->marks[i];
-        pipe_offs[j++] = mark->end;
+
+    return 0;
+
+need_analysis:
+    ctx->html_comment_horizon = html_horizons[0];
+    ctx->html_proc_instr_horizon = html_horizons[1];
+    ctx->html_decl_horizon = html_horizons[2];
+    ctx->html_cdata_horizon = html_horizons[3];
+    *p_need_analysis = TRUE;
+
+abort:
+    return ret;
+}
+
+static int
+md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
+                     const MD_ALIGN* align, int col_count)
+{
+    MD_ARENA_MARK arena_mark;
+    const OFF* offs;
+    int need_analysis;
+    int i, k, n;
+    int ret = 0;
+
+    md_arena_save(ctx, &arena_mark);
+
+    /* Collect the offsets where the cells begin; the last one is a sentinel
+     * as if there were a pipe after the end of the line. */
+    ctx->n_table_cell_offs = 0;
+    MD_CHECK(md_push_table_cell_off(ctx, beg));
+    MD_CHECK(md_scan_table_row(ctx, beg, end, &need_analysis));
+
+    if(need_analysis) {
+        MD_LINE line;
+
+        /* Break the line into table cells by identifying pipe characters who
+         * form the cell boundary. */
+        line.beg = beg;
+        line.end = end;
+        MD_CHECK(md_analyze_inlines(ctx, &line, 1, TRUE));
+
+        ctx->n_table_cell_offs = 1;
+        for(i = TABLECELLBOUNDARIES.head; i >= 0; i = ctx->marks[i].next)
+            MD_CHECK(md_push_table_cell_off(ctx, ctx->marks[i].end));
     }
-    pipe_offs[j++] = end+1;
 
-    /* Process cells. */
+    MD_CHECK(md_push_table_cell_off(ctx, end+1));
+
+    /* Process cells. Note ctx->marks[] get reused during the cell contents
+     * processing but the ctx->table_cell_offs[] do not. */
+    offs = ctx->table_cell_offs;
+    n = ctx->n_table_cell_offs;
     MD_ENTER_BLOCK(MD_BLOCK_TR, NULL);
     k = 0;
-    for(i = 0; i < j-1  &&  k < col_count; i++) {
-        if(pipe_offs[i] < pipe_offs[i+1]-1)
-            MD_CHECK(md_process_table_cell(ctx, cell_type, align[k++], pipe_offs[i], pipe_offs[i+1]-1));
+    for(i = 0; i < n-1  &&  k < col_count; i++) {
+        if(offs[i] < offs[i+1]-1)
+            MD_CHECK(md_process_table_cell(ctx, cell_type, align[k++], offs[i], offs[i+1]-1));
     }
     /* Make sure we call enough table cells even if the current table contains
      * too few of them. */
@@ -4641,21 +5212,14 @@ md_process_table_row(MD_CTX* ctx, MD_BLOCKTYPE cell_type, OFF beg, OFF end,
     MD_LEAVE_BLOCK(MD_BLOCK_TR, NULL);
 
 abort:
-    free(pipe_offs);
-
-    /* Free any temporary memory blocks stored within some dummy marks. */
-    for(i = PTR_CHAIN.head; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
-    PTR_CHAIN.head = -1;
-    PTR_CHAIN.tail = -1;
-
+    /* Release any link titles copied into the arena during the row analysis. */
+    md_arena_restore(ctx, &arena_mark);
     return ret;
 }
 
 static int
 md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines, int n_lines)
 {
-    MD_ALIGN* align;
     int i;
     int ret = 0;
 
@@ -4663,31 +5227,37 @@ md_process_table_block_contents(MD_CTX* ctx, int col_count, const MD_LINE* lines
      * with the underlines. */
     MD_ASSERT(n_lines >= 2);
 
-    align = malloc(col_count * sizeof(MD_ALIGN));
-    if(align == NULL) {
-        MD_LOG("malloc() failed.");
-        ret = -1;
-        goto abort;
+    if(col_count > ctx->alloc_table_align) {
+        MD_ALIGN* new_align;
+
+        new_align = md_realloc(ctx, ctx->table_align, col_count * sizeof(MD_ALIGN));
+        if(new_align == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+
+        ctx->table_align = new_align;
+        ctx->alloc_table_align = col_count;
     }
 
-    md_analyze_table_alignment(ctx, lines[1].beg, lines[1].end, align, col_count);
+    md_analyze_table_alignment(ctx, lines[1].beg, lines[1].end, ctx->table_align, col_count);
 
     MD_ENTER_BLOCK(MD_BLOCK_THEAD, NULL);
     MD_CHECK(md_process_table_row(ctx, MD_BLOCK_TH,
-                        lines[0].beg, lines[0].end, align, col_count));
+                        lines[0].beg, lines[0].end, ctx->table_align, col_count));
     MD_LEAVE_BLOCK(MD_BLOCK_THEAD, NULL);
 
     if(n_lines > 2) {
         MD_ENTER_BLOCK(MD_BLOCK_TBODY, NULL);
         for(i = 2; i < n_lines; i++) {
             MD_CHECK(md_process_table_row(ctx, MD_BLOCK_TD,
-                     lines[i].beg, lines[i].end, align, col_count));
+                     lines[i].beg, lines[i].end, ctx->table_align, col_count));
         }
         MD_LEAVE_BLOCK(MD_BLOCK_TBODY, NULL);
     }
 
 abort:
-    free(align);
     return ret;
 }
 
@@ -4717,7 +5287,7 @@ struct MD_BLOCK_tag {
      * MD_BLOCK_LI:     Task mark offset in the input doc.
      * MD_BLOCK_OL:     Start item number.
      */
-    unsigned n_lines;
+    OFF n_lines;
 };
 
 struct MD_CONTAINER_tag {
@@ -4725,9 +5295,9 @@ struct MD_CONTAINER_tag {
     unsigned is_loose    : 8;
     unsigned is_task     : 8;
     unsigned start;
-    unsigned mark_indent;
-    unsigned contents_indent;
-    OFF block_byte_off;
+    OFF mark_indent;
+    OFF contents_indent;
+    size_t block_byte_off;
     OFF task_mark_off;
 };
 
@@ -4735,19 +5305,16 @@ struct MD_CONTAINER_tag {
 static int
 md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, int n_lines)
 {
-    int i;
     int ret;
+    MD_STATS_TIMER(t0)
 
     MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
-    MD_CHECK(md_process_inlines(ctx, lines, n_lines));
 
-abort:
-    /* Free any temporary memory blocks stored within some dummy marks. */
-    for(i = PTR_CHAIN.head; i >= 0; i = ctx->marks[i].next)
-        free(md_mark_get_ptr(ctx, i));
-    PTR_CHAIN.head = -1;
-    PTR_CHAIN.tail = -1;
+    MD_STATS_START(t0);
+    ret = md_process_inlines(ctx, lines, n_lines);
+    MD_STATS_STOP(t0, inline_time);
 
+abort:
     return ret;
 }
 
@@ -4762,12 +5329,10 @@ md_process_verbatim_block_contents(MD_CTX* ctx, MD_TEXTTYPE text_type, const MD_
 
     for(i = 0; i < n_lines; i++) {
         const MD_VERBATIMLINE* line = &lines[i];
-        int indent = line->indent;
-
-        MD_ASSERT(indent >= 0);
+        OFF indent = line->indent;
 
         /* Output code indentation. */
-        while(indent > (int) indent_chunk_size) {
+        while(indent > indent_chunk_size) {
             MD_TEXT(text_type, indent_chunk_str, indent_chunk_size);
             indent -= indent_chunk_size;
         }
@@ -4860,12 +5425,17 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
     } det;
     MD_ATTRIBUTE_BUILD info_build;
     MD_ATTRIBUTE_BUILD lang_build;
+    MD_ARENA_MARK arena_mark;
     int is_in_tight_list;
-    int clean_fence_code_detail = FALSE;
     int ret = 0;
 
     memset(&det, 0, sizeof(det));
 
+    /* Anything the block processing allocates from the arena (attributes,
+     * copies of multi-line link titles etc.) is released when we are done
+     * with the block. */
+    md_arena_save(ctx, &arena_mark);
+
     if(ctx->n_containers == 0)
         is_in_tight_list = FALSE;
     else
@@ -4880,7 +5450,6 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
             /* For fenced code block, we may need to set the info string. */
             if(block->data != 0) {
                 memset(&det.code, 0, sizeof(MD_BLOCK_CODE_DETAIL));
-                clean_fence_code_detail = TRUE;
                 MD_CHECK(md_setup_fenced_code_detail(ctx, block, &det.code, &info_build, &lang_build));
             }
             break;
@@ -4889,7 +5458,7 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
             det.table.col_count = block->data;
             det.table.head_row_count = 1;
             MD_ASSERT(block->n_lines >= 2);
-            det.table.body_row_count = block->n_lines - 2;
+            det.table.body_row_count = (unsigned) (block->n_lines - 2);
             break;
 
         default:
@@ -4926,18 +5495,13 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
             OFF end = ((const MD_LINE*)(block + 1))->end;
             if (ctx->parser.flags & MD_FLAG_HEADERSELFLINKS) {
                 MD_ASSERT(end >= beg);
-                MD_CHECK(md_enter_leave_span_a(
-                    ctx, /*enter*/1, MD_SPAN_A_SELF,
-                    STR(beg), end - beg, FALSE, "", 0u));
+                MD_CHECK(md_enter_span_a(ctx, MD_SPAN_A_SELF,
+                                STR(beg), end - beg, FALSE, "", 0u));
             }
             MD_CHECK(md_process_normal_block_contents(ctx,
                             (const MD_LINE*)(block + 1), block->n_lines));
-            if (ctx->parser.flags & MD_FLAG_HEADERSELFLINKS) {
-                MD_ASSERT(end >= beg);
-                MD_CHECK(md_enter_leave_span_a(
-                    ctx, /*enter*/0, MD_SPAN_A_SELF,
-                    STR(beg), end - beg, FALSE, "", 0u));
-            }
+            if (ctx->parser.flags & MD_FLAG_HEADERSELFLINKS)
+                MD_CHECK(md_leave_span_attrs(ctx, MD_SPAN_A_SELF));
             break;
         }
 
@@ -4951,17 +5515,18 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
         MD_LEAVE_BLOCK(block->type, (void*) &det);
 
 abort:
-    if(clean_fence_code_detail) {
-        md_free_attribute(ctx, &info_build);
-        md_free_attribute(ctx, &lang_build);
-    }
+    /* On success, all the spans have been left. On error, drop whatever is
+     * left of the span attributes together with the arena. */
+    ctx->span_attrs = NULL;
+    md_arena_restore(ctx, &arena_mark);
     return ret;
 }
 
+/* Process the blocks in the given range of ctx->block_bytes. The range must
+ * consist of complete top-level blocks (with all their nested blocks). */
 static int
-md_process_all_blocks(MD_CTX* ctx)
+md_process_block_range(MD_CTX* ctx, size_t byte_off, size_t byte_end)
 {
-    int byte_off = 0;
     int ret = 0;
 
     /* ctx->containers now is not needed for detection of lists and list items
@@ -4970,7 +5535,7 @@ md_process_all_blocks(MD_CTX* ctx)
      * level of lists. */
     ctx->n_containers = 0;
 
-    while(byte_off < ctx->n_block_bytes) {
+    while(byte_off < byte_end) {
         MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
         union {
             MD_BLOCK_UL_DETAIL ul;
@@ -4978,6 +5543,9 @@ md_process_all_blocks(MD_CTX* ctx)
             MD_BLOCK_LI_DETAIL li;
         } det;
 
+        if(!(block->flags & MD_BLOCK_CONTAINER_CLOSER))
+            MD_STATS_ADD(n_blocks, 1);
+
         switch(block->type) {
             case MD_BLOCK_UL:
                 det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
@@ -4985,7 +5553,7 @@ md_process_all_blocks(MD_CTX* ctx)
                 break;
 
             case MD_BLOCK_OL:
-                det.ol.start = block->n_lines;
+                det.ol.start = (unsigned) block->n_lines;
                 det.ol.is_tight =  (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
                 det.ol.mark_delimiter = (CHAR) block->data;
                 break;
@@ -5035,75 +5603,426 @@ md_process_all_blocks(MD_CTX* ctx)
         byte_off += sizeof(MD_BLOCK);
     }
 
-    ctx->n_block_bytes = 0;
+abort:
+    return ret;
+}
+
+/* Process blocks in ctx->block_bytes up to the given byte offset, and then
+ * remove them from there.
+ *
+ * The range must not cut any container, nor any block still being built.
+ * (Normally we process everything when the whole document has been analyzed.
+ * Only with streaming input, we may process just the blocks which are
+ * complete so far.) */
+static int
+md_process_blocks(MD_CTX* ctx, size_t n_block_bytes)
+{
+    int ret = 0;
+
+    MD_CHECK(md_process_block_range(ctx, 0, n_block_bytes));
+
+    MD_ASSERT(ctx->current_block == NULL  ||  (char*) ctx->current_block >= (char*) ctx->block_bytes + n_block_bytes);
+    if(n_block_bytes < ctx->n_block_bytes) {
+        memmove(ctx->block_bytes, (char*) ctx->block_bytes + n_block_bytes,
+                ctx->n_block_bytes - n_block_bytes);
+        if(ctx->current_block != NULL)
+            ctx->current_block = (MD_BLOCK*) ((char*) ctx->current_block - n_block_bytes);
+    }
+    ctx->n_block_bytes -= n_block_bytes;
 
 abort:
     return ret;
 }
 
 
-/************************************
- ***  Grouping Lines into Blocks  ***
- ************************************/
 
-static void*
-md_push_block_bytes(MD_CTX* ctx, int n_bytes)
-{
-    void* ptr;
+/*****************************
+ ***  Parallel Processing  ***
+ *****************************/
 
-    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
-        void* new_block_bytes;
+/* Minimal amount of text in one range (so that the parallel processing pays
+ * off), and how many ranges per thread we aim for (so that a thread which has
+ * got an easy range can help with the others). */
+#ifndef MD_PARALLEL_MIN_RANGE_SIZE
+    #define MD_PARALLEL_MIN_RANGE_SIZE      (64 * 1024)
+#endif
+#define MD_PARALLEL_RANGES_PER_THREAD       4
 
-        ctx->alloc_block_bytes = (ctx->alloc_block_bytes > 0
-                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
-                : 512);
-        new_block_bytes = realloc(ctx->block_bytes, ctx->alloc_block_bytes);
-        if(new_block_bytes == NULL) {
-            MD_LOG("realloc() failed.");
-            return NULL;
-        }
+#ifdef MD_THREADS
 
-        /* Fix the ->current_block after the reallocation. */
-        if(ctx->current_block != NULL) {
-            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
-            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
-        }
+typedef struct MD_RANGE_tag MD_RANGE;
+struct MD_RANGE_tag {
+    size_t byte_beg;
+    size_t byte_end;
+    void* userdata;
+    int ret;
+};
 
-        ctx->block_bytes = new_block_bytes;
+typedef struct MD_PARALLEL_tag MD_PARALLEL;
+struct MD_PARALLEL_tag {
+    MD_CTX* ctx;        /* Snapshot of the main context for the other threads. */
+    MD_RANGE* ranges;
+    int n_ranges;
+    int next_range;     /* Next range nobody works on yet. */
+    int failed;         /* Set when any range fails; the others then stop. */
+    MD_MUTEX mutex;
+#ifdef MD4C_ENABLE_STATS
+    MD_PARSE_STATS stats;   /* Summed from the worker threads. */
+#endif
+};
+
+#ifdef MD4C_ENABLE_STATS
+static void
+md_stats_merge(MD_PARSE_STATS* dst, const MD_PARSE_STATS* src)
+{
+    dst->line_analysis_time += src->line_analysis_time;
+    dst->block_build_time += src->block_build_time;
+    dst->ref_def_time += src->ref_def_time;
+    dst->mark_collect_time += src->mark_collect_time;
+    dst->mark_analysis_time += src->mark_analysis_time;
+    dst->inline_time += src->inline_time;
+    dst->callback_time += src->callback_time;
+    dst->n_lines += src->n_lines;
+    dst->n_blocks += src->n_blocks;
+    dst->n_marks += src->n_marks;
+    dst->n_rollbacks += src->n_rollbacks;
+    dst->n_ref_def_lookups += src->n_ref_def_lookups;
+    dst->n_allocs += src->n_allocs;
+    dst->n_arena_allocs += src->n_arena_allocs;
+    dst->n_callbacks += src->n_callbacks;
+}
+#endif
+
+/* Get how much text the lines of the leaf block have. */
+static size_t
+md_block_text_size(const MD_BLOCK* block)
+{
+    size_t size = 0;
+    unsigned i;
+
+    if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML) {
+        const MD_VERBATIMLINE* lines = (const MD_VERBATIMLINE*) (block + 1);
+        for(i = 0; i < block->n_lines; i++)
+            size += lines[i].end - lines[i].beg;
+    } else {
+        const MD_LINE* lines = (const MD_LINE*) (block + 1);
+        for(i = 0; i < block->n_lines; i++)
+            size += lines[i].end - lines[i].beg;
     }
 
-    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
-    ctx->n_block_bytes += n_bytes;
-    return ptr;
+    return size;
 }
 
+/* Split ctx->block_bytes into ranges of top-level blocks with roughly the same
+ * amount of text. Returns count of the ranges, or -1 on an error. If it is
+ * not worth splitting the document, zero is returned. */
 static int
-md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
+md_parallel_split(MD_CTX* ctx, MD_RANGE** p_ranges)
 {
-    MD_BLOCK* block;
+    MD_RANGE* ranges;
+    int n_ranges;
+    size_t total = 0;
+    size_t size = 0;
+    size_t byte_off;
+    int depth = 0;
+    int i = 0;
 
-    MD_ASSERT(ctx->current_block == NULL);
+    for(byte_off = 0; byte_off < ctx->n_block_bytes; byte_off += sizeof(MD_BLOCK)) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
 
-    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
-    if(block == NULL)
-        return -1;
+        if(block->flags & MD_BLOCK_CONTAINER)
+            continue;
+        total += md_block_text_size(block);
+        if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+            byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+        else
+            byte_off += block->n_lines * sizeof(MD_LINE);
+    }
 
-    switch(line->type) {
-        case MD_LINE_HR:
-            block->type = MD_BLOCK_HR;
-            break;
+    if(total / MD_PARALLEL_MIN_RANGE_SIZE < (size_t) ctx->n_threads * MD_PARALLEL_RANGES_PER_THREAD)
+        n_ranges = (int) (total / MD_PARALLEL_MIN_RANGE_SIZE);
+    else
+        n_ranges = (int) ctx->n_threads * MD_PARALLEL_RANGES_PER_THREAD;
+    if(n_ranges < 2)
+        return 0;
 
-        case MD_LINE_ATXHEADER:
-        case MD_LINE_SETEXTHEADER:
-            block->type = MD_BLOCK_H;
-            break;
+    ranges = (MD_RANGE*) md_malloc(ctx, n_ranges * sizeof(MD_RANGE));
+    if(ranges == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
+    }
 
-        case MD_LINE_FENCEDCODE:
-        case MD_LINE_INDENTEDCODE:
-            block->type = MD_BLOCK_CODE;
-            break;
+    ranges[0].byte_beg = 0;
+    for(byte_off = 0; byte_off < ctx->n_block_bytes; ) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
 
-        case MD_LINE_TEXT:
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER)
+                depth--;
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER)
+                depth++;
+        } else {
+            size += md_block_text_size(block);
+            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+            else
+                byte_off += block->n_lines * sizeof(MD_LINE);
+        }
+        byte_off += sizeof(MD_BLOCK);
+
+        /* End the range after a top-level block which gets us past its
+         * share of the text. */
+        if(depth == 0  &&  i < n_ranges - 1  &&  byte_off < ctx->n_block_bytes  &&
+           size >= (total / n_ranges) * (i + 1))
+        {
+            ranges[i].byte_end = byte_off;
+            i++;
+            ranges[i].byte_beg = byte_off;
+        }
+    }
+    ranges[i].byte_end = ctx->n_block_bytes;
+
+    *p_ranges = ranges;
+    return i + 1;
+}
+
+/* Process ranges until there is none left. */
+static void
+md_parallel_work(MD_PARALLEL* par, MD_CTX* ctx)
+{
+    int i;
+    int failed;
+    int ret;
+
+    while(TRUE) {
+        md_mutex_lock(&par->mutex);
+        i = par->next_range++;
+        failed = par->failed;
+        md_mutex_unlock(&par->mutex);
+
+        if(i >= par->n_ranges  ||  failed)
+            break;
+
+        ctx->userdata = par->ranges[i].userdata;
+        ret = md_process_block_range(ctx, par->ranges[i].byte_beg, par->ranges[i].byte_end);
+        par->ranges[i].ret = ret;
+
+        if(ret != 0) {
+            md_mutex_lock(&par->mutex);
+            par->failed = TRUE;
+            md_mutex_unlock(&par->mutex);
+        }
+    }
+}
+
+MD_THREAD_PROC(md_parallel_thread_proc, arg)
+{
+    MD_PARALLEL* par = (MD_PARALLEL*) arg;
+    MD_CTX ctx;
+#ifdef MD4C_ENABLE_STATS
+    MD_PARSE_STATS stats;
+#endif
+
+    /* Everything else than the scratch buffers for the inline processing can
+     * be shared with the main context. Note we copy its snapshot taken before
+     * it has processed any block (the main thread is already working with
+     * it), so the inline state (the mark chains etc.) is in its initial
+     * state. */
+    memcpy(&ctx, par->ctx, sizeof(MD_CTX));
+    ctx.buffer = NULL;
+    ctx.alloc_buffer = 0;
+    ctx.arena_first = NULL;
+    ctx.arena_current = NULL;
+    ctx.arena_used = 0;
+    ctx.marks = NULL;
+    ctx.n_marks = 0;
+    ctx.alloc_marks = 0;
+    ctx.table_cell_offs = NULL;
+    ctx.alloc_table_cell_offs = 0;
+    ctx.table_align = NULL;
+    ctx.alloc_table_align = 0;
+
+#ifdef MD4C_ENABLE_STATS
+    /* The stats of the main context are not ours to touch. */
+    if(ctx.parser.stats != NULL) {
+        memset(&stats, 0, sizeof(MD_PARSE_STATS));
+        ctx.parser.stats = &stats;
+    }
+#endif
+
+    /* md_process_block_range() needs as many containers as the deepest
+     * nesting level of lists. */
+    ctx.containers = NULL;
+    if(ctx.alloc_containers > 0) {
+        ctx.containers = (MD_CONTAINER*) md_malloc(&ctx, ctx.alloc_containers * sizeof(MD_CONTAINER));
+        if(ctx.containers == NULL)
+            goto out;   /* Let the other threads do the work. */
+    }
+
+    md_parallel_work(par, &ctx);
+
+out:
+    md_free(&ctx, ctx.buffer);
+    md_free(&ctx, ctx.marks);
+    md_free(&ctx, ctx.table_cell_offs);
+    md_free(&ctx, ctx.table_align);
+    md_free(&ctx, ctx.containers);
+    md_arena_free(&ctx);
+#ifdef MD4C_ENABLE_STATS
+    if(ctx.parser.stats != NULL) {
+        md_mutex_lock(&par->mutex);
+        md_stats_merge(&par->stats, &stats);
+        md_mutex_unlock(&par->mutex);
+    }
+#endif
+    MD_THREAD_PROC_RETURN;
+}
+
+/* Process (and remove) all the blocks in ctx->block_bytes on multiple threads.
+ * The main thread takes part in it with the main context. */
+static int
+md_process_blocks_parallel(MD_CTX* ctx)
+{
+    MD_PARALLEL par;
+    MD_CTX proto;
+    MD_THREAD threads[64];
+    void* userdata = ctx->userdata;
+    int n_threads = 0;
+    int n_begun;
+    int i;
+    int ret = 0;
+
+    par.n_ranges = md_parallel_split(ctx, &par.ranges);
+    if(par.n_ranges < 0)
+        return -1;
+    if(par.n_ranges == 0)
+        return md_process_blocks(ctx, ctx->n_block_bytes);
+
+    memcpy(&proto, ctx, sizeof(MD_CTX));
+    par.ctx = &proto;
+    par.next_range = 0;
+    par.failed = FALSE;
+    md_mutex_init(&par.mutex);
+#ifdef MD4C_ENABLE_STATS
+    memset(&par.stats, 0, sizeof(MD_PARSE_STATS));
+#endif
+
+    for(n_begun = 0; n_begun < par.n_ranges; n_begun++) {
+        par.ranges[n_begun].userdata = NULL;
+        par.ranges[n_begun].ret = -1;   /* Until processed. */
+        ret = ctx->parallel.begin_range((unsigned) n_begun, userdata, &par.ranges[n_begun].userdata);
+        if(ret != 0) {
+            MD_LOG("Aborted from begin_range() callback.");
+            par.failed = TRUE;
+            break;
+        }
+    }
+
+    if(!par.failed) {
+        /* Any thread we fail to start just means more work for the others. */
+        while(n_threads + 1 < (int) ctx->n_threads  &&  n_threads + 1 < par.n_ranges  &&
+              n_threads < (int) SIZEOF_ARRAY(threads))
+        {
+            if(md_thread_create(&threads[n_threads], md_parallel_thread_proc, &par) != 0)
+                break;
+            n_threads++;
+        }
+
+        md_parallel_work(&par, ctx);
+
+        for(i = 0; i < n_threads; i++)
+            md_thread_join(threads[i]);
+        ctx->userdata = userdata;
+#ifdef MD4C_ENABLE_STATS
+        if(ctx->parser.stats != NULL)
+            md_stats_merge(ctx->parser.stats, &par.stats);
+#endif
+    }
+
+    for(i = 0; i < n_begun; i++) {
+        int end_ret;
+
+        if(ret == 0  &&  par.ranges[i].ret != 0)
+            ret = par.ranges[i].ret;
+
+        end_ret = ctx->parallel.end_range((unsigned) i, par.ranges[i].userdata, par.ranges[i].ret, userdata);
+        if(ret == 0  &&  end_ret != 0) {
+            MD_LOG("Aborted from end_range() callback.");
+            ret = end_ret;
+        }
+    }
+
+    md_mutex_fini(&par.mutex);
+    md_free(ctx, par.ranges);
+    ctx->n_block_bytes = 0;
+    return ret;
+}
+
+#endif  /* MD_THREADS */
+
+
+/************************************
+ ***  Grouping Lines into Blocks  ***
+ ************************************/
+
+static void*
+md_push_block_bytes(MD_CTX* ctx, size_t n_bytes)
+{
+    void* ptr;
+
+    if(ctx->n_block_bytes + n_bytes > ctx->alloc_block_bytes) {
+        void* new_block_bytes;
+
+        ctx->alloc_block_bytes = (ctx->alloc_block_bytes > 0
+                ? ctx->alloc_block_bytes + ctx->alloc_block_bytes / 2
+                : 512);
+        new_block_bytes = md_realloc(ctx, ctx->block_bytes, ctx->alloc_block_bytes);
+        if(new_block_bytes == NULL) {
+            MD_LOG("realloc() failed.");
+            return NULL;
+        }
+
+        /* Fix the ->current_block after the reallocation. */
+        if(ctx->current_block != NULL) {
+            OFF off_current_block = (OFF) ((char*) ctx->current_block - (char*) ctx->block_bytes);
+            ctx->current_block = (MD_BLOCK*) ((char*) new_block_bytes + off_current_block);
+        }
+
+        ctx->block_bytes = new_block_bytes;
+    }
+
+    ptr = (char*)ctx->block_bytes + ctx->n_block_bytes;
+    ctx->n_block_bytes += n_bytes;
+    return ptr;
+}
+
+static int
+md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
+{
+    MD_BLOCK* block;
+
+    MD_ASSERT(ctx->current_block == NULL);
+
+    block = (MD_BLOCK*) md_push_block_bytes(ctx, sizeof(MD_BLOCK));
+    if(block == NULL)
+        return -1;
+
+    switch(line->type) {
+        case MD_LINE_HR:
+            block->type = MD_BLOCK_HR;
+            break;
+
+        case MD_LINE_ATXHEADER:
+        case MD_LINE_SETEXTHEADER:
+            block->type = MD_BLOCK_H;
+            break;
+
+        case MD_LINE_FENCEDCODE:
+        case MD_LINE_INDENTEDCODE:
+            block->type = MD_BLOCK_CODE;
+            break;
+
+        case MD_LINE_TEXT:
             block->type = MD_BLOCK_P;
             break;
 
@@ -5137,7 +6056,7 @@ static int
 md_consume_link_reference_definitions(MD_CTX* ctx)
 {
     MD_LINE* lines = (MD_LINE*) (ctx->current_block + 1);
-    unsigned n_lines = ctx->current_block->n_lines;
+    unsigned n_lines = (unsigned) ctx->current_block->n_lines;
     unsigned n = 0;
 
     /* Compute how many lines at the start of the block form one or more
@@ -5172,8 +6091,7 @@ md_consume_link_reference_definitions(MD_CTX* ctx)
             MD_ASSERT(n_lines >= n);
             memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
             ctx->current_block->n_lines -= n;
-            MD_ASSERT(ctx->n_block_bytes >= 0);
-            MD_ASSERT((unsigned)ctx->n_block_bytes >= n * sizeof(MD_LINE));
+            MD_ASSERT(ctx->n_block_bytes >= n * sizeof(MD_LINE));
             ctx->n_block_bytes -= n * sizeof(MD_LINE);
         }
     }
@@ -5256,7 +6174,7 @@ md_add_line_into_current_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* analysis)
 }
 
 static int
-md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
+md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, OFF start,
                         unsigned data, unsigned flags)
 {
     MD_BLOCK* block;
@@ -5273,6 +6191,9 @@ md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
     block->data = data;
     block->n_lines = start;
 
+    if(type == MD_BLOCK_LI  &&  (flags & MD_BLOCK_CONTAINER_OPENER))
+        ctx->list_item_opener_end = ctx->n_block_bytes;
+
 abort:
     return ret;
 }
@@ -5702,7 +6623,7 @@ md_push_container(MD_CTX* ctx, const MD_CONTAINER* container)
         ctx->alloc_containers = (ctx->alloc_containers > 0
                 ? ctx->alloc_containers + ctx->alloc_containers / 2
                 : 16);
-        new_containers = realloc(ctx->containers, ctx->alloc_containers * sizeof(MD_CONTAINER));
+        new_containers = md_realloc(ctx, ctx->containers, ctx->alloc_containers * sizeof(MD_CONTAINER));
         if(new_containers == NULL) {
             MD_LOG("realloc() failed.");
             return -1;
@@ -5737,7 +6658,7 @@ md_enter_child_containers(MD_CTX* ctx, int n_children)
             case _T('*'):
                 /* Remember offset in ctx->block_bytes so we can revisit the
                  * block if we detect it is a loose list. */
-                md_end_current_block(ctx);
+                MD_CHECK(md_end_current_block(ctx));
                 c->block_byte_off = ctx->n_block_bytes;
 
                 MD_CHECK(md_push_container_bytes(ctx,
@@ -5807,7 +6728,7 @@ abort:
 }
 
 static int
-md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
+md_is_container_mark(MD_CTX* ctx, OFF indent, OFF beg, OFF* p_end, MD_CONTAINER* p_container)
 {
     OFF off = beg;
     OFF max_end;
@@ -5866,11 +6787,11 @@ md_is_container_mark(MD_CTX* ctx, unsigned indent, OFF beg, OFF* p_end, MD_CONTA
     return FALSE;
 }
 
-static unsigned
-md_line_indentation(MD_CTX* ctx, unsigned total_indent, OFF beg, OFF* p_end)
+static OFF
+md_line_indentation(MD_CTX* ctx, OFF total_indent, OFF beg, OFF* p_end)
 {
     OFF off = beg;
-    unsigned indent = total_indent;
+    OFF indent = total_indent;
 
     while(off < ctx->size  &&  ISBLANK(off)) {
         if(CH(off) == _T('\t'))
@@ -5893,7 +6814,7 @@ static int
 md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                 const MD_LINE_ANALYSIS* pivot_line, MD_LINE_ANALYSIS* line)
 {
-    unsigned total_indent = 0;
+    OFF total_indent = 0;
     int n_parents = 0;
     int n_brothers = 0;
     int n_children = 0;
@@ -6032,13 +6953,9 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                  */
                 if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
                    n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
+                   ctx->n_block_bytes == ctx->list_item_opener_end)
                 {
-                    MD_ASSERT(ctx->n_block_bytes >= 0);
-                    MD_ASSERT((unsigned)ctx->n_block_bytes >= sizeof(MD_BLOCK));
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        ctx->last_list_item_starts_with_two_blank_lines = TRUE;
+                    ctx->last_list_item_starts_with_two_blank_lines = TRUE;
                 }
     #endif
             }
@@ -6053,14 +6970,9 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
             if(ctx->last_list_item_starts_with_two_blank_lines) {
                 if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
                    n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes >= 0 &&
-                   (unsigned)ctx->n_block_bytes > sizeof(MD_BLOCK))
+                   ctx->n_block_bytes == ctx->list_item_opener_end)
                 {
-                    MD_ASSERT(ctx->n_block_bytes >= 0);
-                    MD_ASSERT((unsigned)ctx->n_block_bytes >= sizeof(MD_BLOCK));
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
-                        n_parents--;
+                    n_parents--;
                 }
 
                 ctx->last_list_item_starts_with_two_blank_lines = FALSE;
@@ -6453,6 +7365,28 @@ abort:
     return ret;
 }
 
+/* Analyze the line beginning at the offset beg, and add it into the block
+ * structure. */
+static inline int
+md_consume_line(MD_CTX* ctx, OFF beg, OFF* p_end,
+                const MD_LINE_ANALYSIS** p_pivot_line, MD_LINE_ANALYSIS* line)
+{
+    int ret;
+    MD_STATS_TIMER(t0)
+
+    MD_STATS_START(t0);
+    ret = md_analyze_line(ctx, beg, p_end, *p_pivot_line, line);
+    MD_STATS_STOP(t0, line_analysis_time);
+    MD_STATS_ADD(n_lines, 1);
+    if(ret < 0)
+        return ret;
+
+    MD_STATS_START(t0);
+    ret = md_process_line(ctx, p_pivot_line, line);
+    MD_STATS_STOP(t0, block_build_time);
+    return ret;
+}
+
 static int
 md_process_doc(MD_CTX *ctx)
 {
@@ -6468,17 +7402,21 @@ md_process_doc(MD_CTX *ctx)
         if(line == pivot_line)
             line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
 
-        MD_CHECK(md_analyze_line(ctx, off, &off, pivot_line, line));
-        MD_CHECK(md_process_line(ctx, &pivot_line, line));
+        MD_CHECK(md_consume_line(ctx, off, &off, &pivot_line, line));
     }
 
-    md_end_current_block(ctx);
+    MD_CHECK(md_end_current_block(ctx));
 
     MD_CHECK(md_build_ref_def_hashtable(ctx));
 
     /* Process all blocks. */
     MD_CHECK(md_leave_child_containers(ctx, 0));
-    MD_CHECK(md_process_all_blocks(ctx));
+#ifdef MD_THREADS
+    if(ctx->n_threads > 1)
+        MD_CHECK(md_process_blocks_parallel(ctx));
+    else
+#endif
+        MD_CHECK(md_process_blocks(ctx, ctx->n_block_bytes));
 
     MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
 
@@ -6510,51 +7448,2350 @@ abort:
 }
 
 
-/********************
- ***  Public API  ***
- ********************/
+/*************************
+ ***  Streaming Input  ***
+ *************************/
 
-int
-md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+/* State of md_parser_feed() and md_parser_finish(). */
+typedef struct MD_STREAM_tag MD_STREAM;
+struct MD_STREAM_tag {
+    int is_active;          /* Non-zero between first feed and finish. */
+
+    /* All the input received so far. We keep all of it as the blocks and
+     * the ref. defs. refer to it. */
+    CHAR* text;
+    SZ size;
+    SZ alloc;
+
+    /* Where the next line to analyze begins. */
+    OFF off;
+
+    /* Same as the local variables of md_process_doc(), but they have to
+     * survive between the calls. */
+    MD_LINE_ANALYSIS line_buf[2];
+    const MD_LINE_ANALYSIS* pivot_line;
+
+    /* If the first pending block is held back for referring to an unknown
+     * link label, the count of ref. defs. at the time we have checked it.
+     * (There is no point in checking it again, until a new one appears.) */
+    int held_n_ref_defs;
+};
+
+/* Check whether the link label [beg, end) is a link which no ref. def. can
+ * change: An inline link "[label](...)" or a wiki link "[[label]]".
+ *
+ * We only recognize the simple cases: For example, an inline link whose
+ * "(...)" contains a code span opener (which could also cancel the link)
+ * is not recognized, and the block is then merely held back longer than
+ * strictly necessary. */
+static int
+md_stream_is_link_final(MD_CTX* ctx, const MD_LINE* lines, int n_lines,
+                        OFF beg, OFF end, int is_single_line, int is_table)
 {
-    MD_CTX ctx;
-    int i;
+    MD_ARENA_MARK arena_mark;
+    MD_LINK_ATTR attr;
+    OFF link_end;
+    OFF off;
     int ret;
 
-    if(parser->abi_version != 0) {
-        if(parser->debug_log != NULL)
-            parser->debug_log("Unsupported abi_version.", userdata);
-        return -1;
+    /* Wiki link. (The outer brackets cannot be escaped, and they cannot be
+     * a part of a code span or raw HTML without the label being one too.) */
+    if((ctx->parser.flags & MD_FLAG_WIKILINKS)  &&  is_single_line  &&
+       beg > 0  &&  CH(beg-1) == _T('[')  &&
+       !(beg > 1  &&  (CH(beg-2) == _T('\\')  ||  CH(beg-2) == _T('!')))  &&
+       end < ctx->size  &&  CH(end) == _T(']')  &&
+       end - beg > 2  &&  end - beg <= 102  &&  CH(beg+1) != _T('|'))
+        return TRUE;
+
+    /* Inline link. (But not "[foo][label](...)" nor "[foo]![label](...)"
+     * where the label may be a part of the full reference link.) */
+    if(end >= ctx->size  ||  CH(end) != _T('('))
+        return FALSE;
+    off = beg;
+    if(off > 0  &&  CH(off-1) == _T('!'))
+        off--;
+    if(off > 0  &&  CH(off-1) == _T(']'))
+        return FALSE;
+
+    /* In a table, each row is a separate paragraph-like unit. */
+    if(is_table) {
+        if(!is_single_line)
+            return FALSE;
+        n_lines = 1;
     }
 
-    /* Setup context structure. */
-    memset(&ctx, 0, sizeof(MD_CTX));
-    ctx.text = text;
-    ctx.size = size;
-    memcpy(&ctx.parser, parser, sizeof(MD_PARSER));
-    ctx.userdata = userdata;
-    ctx.code_indent_offset = (ctx.parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
-    md_build_mark_char_map(&ctx);
-    ctx.doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+    md_arena_save(ctx, &arena_mark);
+    ret = md_is_inline_link_spec(ctx, lines, n_lines, end, &link_end, &attr);
+    md_arena_restore(ctx, &arena_mark);
+    if(ret <= 0)
+        return ret;
 
-    /* Reset all unresolved opener mark chains. */
-    for(i = 0; i < (int) SIZEOF_ARRAY(ctx.mark_chains); i++) {
-        ctx.mark_chains[i].head = -1;
-        ctx.mark_chains[i].tail = -1;
+    /* Code spans, raw HTML, autolinks and math spans are resolved before
+     * the links, and they cancel the link when they cross the final ')'.
+     * Similarly, a table cell boundary may split the link. */
+    for(off = beg; off < link_end; off++) {
+        if(CH(off) == _T('`')  ||  CH(off) == _T('<'))
+            return FALSE;
+        if(CH(off) == _T('|')  &&  is_table)
+            return FALSE;
+        if(CH(off) == _T('$')  &&  (ctx->parser.flags & MD_FLAG_LATEXMATHSPANS))
+            return FALSE;
     }
-    ctx.unresolved_link_head = -1;
-    ctx.unresolved_link_tail = -1;
 
-    /* All the work. */
-    ret = md_process_doc(&ctx);
+    return TRUE;
+}
 
-    /* Clean-up. */
-    md_free_ref_defs(&ctx);
-    md_free_ref_def_hashtable(&ctx);
-    free(ctx.buffer);
-    free(ctx.marks);
-    free(ctx.block_bytes);
-    free(ctx.containers);
+/* Check whether all potential link labels in the block are already defined
+ * (or they cannot be reference links at all). If they are, no ref. def.
+ * appearing later in the document can change how the block is rendered
+ * because the first definition of a label wins. */
+static int
+md_stream_is_block_ready(MD_CTX* ctx, const MD_BLOCK* block)
+{
+    const MD_LINE* lines = (const MD_LINE*) (block + 1);
+    int n_lines = (int) block->n_lines;
+    int i;
 
-    return ret;
+    if(block->type == MD_BLOCK_CODE  ||  block->type == MD_BLOCK_HTML  ||  block->type == MD_BLOCK_HR)
+        return TRUE;
+
+    for(i = 0; i < n_lines; i++) {
+        OFF off = lines[i].beg;
+
+        while(off < lines[i].end) {
+            OFF end;
+            int beg_line_index, end_line_index;
+            OFF contents_beg, contents_end;
+            MD_LINK_ATTR attr;
+            int ret;
+
+#ifdef MD4C_USE_UTF16
+            while(off < lines[i].end  &&  CH(off) != _T('['))
+                off++;
+#else
+            {
+                const CHAR* ptr = (const CHAR*) memchr(STR(off), '[', lines[i].end - off);
+                off = (ptr != NULL ? (OFF) (ptr - ctx->text) : lines[i].end);
+            }
+#endif
+            if(off >= lines[i].end)
+                break;
+
+            if(md_is_link_label(ctx, lines + i, n_lines - i, off, &end,
+                        &beg_line_index, &end_line_index, &contents_beg, &contents_end))
+            {
+                ret = md_stream_is_link_final(ctx, lines + i + end_line_index,
+                        n_lines - i - end_line_index, off, end,
+                        (beg_line_index == end_line_index),
+                        (block->type == MD_BLOCK_TABLE));
+                if(ret < 0)
+                    return -1;
+                if(!ret) {
+                    ret = md_is_link_reference(ctx, lines, n_lines, off, end, &attr);
+                    if(ret <= 0)
+                        return ret;     /* Unknown label (0) or error (-1). */
+                }
+            }
+
+            off++;
+        }
+    }
+
+    return TRUE;
+}
+
+/* Get how many bytes at the start of ctx->block_bytes (all of them complete
+ * top-level blocks, with any nested blocks) can be processed right now. */
+static int
+md_stream_ready_block_bytes(MD_CTX* ctx, MD_STREAM* stream, size_t* p_n_ready)
+{
+    size_t byte_off = 0;
+    size_t n_ready = 0;
+    int depth = 0;
+
+    if(ctx->parser.flags & MD_FLAG_REFDEFSFIRST) {
+        *p_n_ready = ctx->n_block_bytes;
+        return 0;
+    }
+
+    *p_n_ready = 0;
+    if(stream->held_n_ref_defs == ctx->n_ref_defs)
+        return 0;
+
+    while(byte_off < ctx->n_block_bytes) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
+
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER)
+                depth--;
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER)
+                depth++;
+        } else {
+            int ret = md_stream_is_block_ready(ctx, block);
+            if(ret < 0)
+                return -1;
+            if(!ret) {
+                stream->held_n_ref_defs = ctx->n_ref_defs;
+                break;
+            }
+
+            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+            else
+                byte_off += block->n_lines * sizeof(MD_LINE);
+        }
+
+        byte_off += sizeof(MD_BLOCK);
+        if(depth == 0)
+            n_ready = byte_off;
+    }
+
+    if(n_ready == ctx->n_block_bytes)
+        stream->held_n_ref_defs = -1;
+    *p_n_ready = n_ready;
+    return 0;
+}
+
+/* Process whatever complete top-level blocks we can. This is called whenever
+ * the line analysis is between two top-level blocks. */
+static int
+md_stream_flush(MD_CTX* ctx, MD_STREAM* stream)
+{
+    size_t n_ready;
+    int ret = 0;
+
+    if(ctx->n_block_bytes == 0)
+        return 0;
+
+    /* Rebuild the hashtable if too many ref. defs. are not there. (Rebuilding
+     * it too often would be expensive, and it would also waste the arena where
+     * the hashtable lives until the end of the document.) */
+    if(ctx->n_ref_defs - ctx->n_ref_defs_in_hashtable > 16  &&
+       ctx->n_ref_defs - ctx->n_ref_defs_in_hashtable > ctx->n_ref_defs_in_hashtable)
+        MD_CHECK(md_build_ref_def_hashtable(ctx));
+
+    MD_CHECK(md_stream_ready_block_bytes(ctx, stream, &n_ready));
+
+    if(n_ready > 0)
+        MD_CHECK(md_process_blocks(ctx, n_ready));
+
+abort:
+    return ret;
+}
+
+/* Analyze all complete lines received so far (or all lines, if is_final). */
+static int
+md_stream_analyze(MD_CTX* ctx, MD_STREAM* stream, int is_final)
+{
+    OFF end;
+    int ret = 0;
+
+    if(is_final) {
+        end = stream->size;
+    } else {
+        /* Find the end of the last complete line. Note we cannot say whether
+         * a trailing '\r' is complete until we see what follows. */
+        end = stream->size;
+        while(end > 0  &&  !ISNEWLINE_(stream->text[end-1]))
+            end--;
+        if(end > 0  &&  end == stream->size  &&  stream->text[end-1] == _T('\r')) {
+            end--;
+            while(end > 0  &&  !ISNEWLINE_(stream->text[end-1]))
+                end--;
+        }
+    }
+
+    ctx->text = stream->text;
+    ctx->size = end;
+    ctx->doc_ends_with_newline = (end > 0  &&  ISNEWLINE_(stream->text[end-1]));
+
+    while(stream->off < end) {
+        MD_LINE_ANALYSIS* line = &stream->line_buf[0];
+
+        if(line == stream->pivot_line)
+            line = &stream->line_buf[1];
+
+        MD_CHECK(md_consume_line(ctx, stream->off, &stream->off, &stream->pivot_line, line));
+
+        if(ctx->n_containers == 0  &&  ctx->current_block == NULL)
+            MD_CHECK(md_stream_flush(ctx, stream));
+    }
+
+abort:
+    return ret;
+}
+
+
+/******************************
+ ***  Incremental Re-parse  ***
+ ******************************/
+
+/* The document loaded with md_parser_load() is remembered as a sequence of
+ * segments. Each segment begins on a line where the line analysis is in the
+ * same state as at the start of the document (no container nor block is
+ * open). Hence any segment can be analyzed again without looking at what
+ * precedes it. The segment ends where the next one begins. */
+typedef struct MD_SEGMENT_tag MD_SEGMENT;
+struct MD_SEGMENT_tag {
+    OFF beg;
+    unsigned n_blocks;      /* Count of top-level blocks in the segment. */
+    int n_ref_defs;         /* Count of ref. defs. in the segment. */
+};
+
+/* How much arena garbage md_parser_edit() tolerates before it re-parses the
+ * whole document: As much as the document size, but at least 64 KB. */
+#define MD_EDITDOC_MAX_ARENA_GARBAGE(size)                              \
+        ((size) * sizeof(CHAR) > 64 * 1024 ? (size) * sizeof(CHAR) : 64 * 1024)
+
+/* State of md_parser_load() and md_parser_edit(). */
+typedef struct MD_EDITDOC_tag MD_EDITDOC;
+struct MD_EDITDOC_tag {
+    int is_loaded;
+
+    /* Copy of the document. An edit builds the new text in the spare buffer,
+     * so the old text is still available when comparing the ref. defs. */
+    CHAR* text;
+    SZ size;
+    SZ alloc;
+    CHAR* spare_text;
+    SZ spare_alloc;
+
+    MD_SEGMENT* segments;
+    int n_segments;
+    int alloc_segments;
+
+    /* Segments found by md_editdoc_analyze(). */
+    MD_SEGMENT* new_segments;
+    int n_new_segments;
+    int alloc_new_segments;
+
+    /* Bytes of the arena which the edits could not release. See
+     * md_parser_edit(). */
+    size_t arena_garbage;
+};
+
+/* Check whether the line analysis is in its initial state. */
+static int
+md_editdoc_is_clean(MD_CTX* ctx, const MD_LINE_ANALYSIS* pivot_line)
+{
+    return (ctx->n_containers == 0  &&  ctx->current_block == NULL  &&
+            pivot_line == &md_dummy_blank_line  &&  ctx->html_block_type == 0  &&
+            !ctx->last_line_has_list_loosening_effect  &&
+            !ctx->last_list_item_starts_with_two_blank_lines);
+}
+
+/* Count top-level blocks in the given range of ctx->block_bytes. */
+static unsigned
+md_editdoc_count_blocks(MD_CTX* ctx, size_t byte_off, size_t byte_end)
+{
+    unsigned n = 0;
+    int depth = 0;
+
+    while(byte_off < byte_end) {
+        MD_BLOCK* block = (MD_BLOCK*)((char*)ctx->block_bytes + byte_off);
+
+        if(block->flags & MD_BLOCK_CONTAINER) {
+            if(block->flags & MD_BLOCK_CONTAINER_CLOSER)
+                depth--;
+            if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
+                if(depth == 0)
+                    n++;
+                depth++;
+            }
+        } else {
+            if(depth == 0)
+                n++;
+
+            if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+                byte_off += block->n_lines * sizeof(MD_VERBATIMLINE);
+            else
+                byte_off += block->n_lines * sizeof(MD_LINE);
+        }
+
+        byte_off += sizeof(MD_BLOCK);
+    }
+
+    return n;
+}
+
+static int
+md_editdoc_push_segment(MD_CTX* ctx, MD_EDITDOC* doc, OFF beg, unsigned n_blocks, int n_ref_defs)
+{
+    MD_SEGMENT* seg;
+
+    if(doc->n_new_segments >= doc->alloc_new_segments) {
+        MD_SEGMENT* new_segments;
+        int alloc_new_segments;
+
+        alloc_new_segments = doc->alloc_new_segments + doc->alloc_new_segments / 2;
+        if(alloc_new_segments < doc->n_new_segments + 1)
+            alloc_new_segments = doc->n_new_segments + 1;
+        if(alloc_new_segments < 64)
+            alloc_new_segments = 64;
+        new_segments = (MD_SEGMENT*) md_realloc(ctx, doc->new_segments,
+                    alloc_new_segments * sizeof(MD_SEGMENT));
+        if(new_segments == NULL) {
+            MD_LOG("realloc() failed.");
+            return -1;
+        }
+
+        doc->new_segments = new_segments;
+        doc->alloc_new_segments = alloc_new_segments;
+    }
+
+    seg = &doc->new_segments[doc->n_new_segments++];
+    seg->beg = beg;
+    seg->n_blocks = n_blocks;
+    seg->n_ref_defs = n_ref_defs;
+    return 0;
+}
+
+/* Find the (old) segment beginning at the given offset. */
+static int
+md_editdoc_find_segment(MD_EDITDOC* doc, int from, OFF beg)
+{
+    int lo = from;
+    int hi = doc->n_segments - 1;
+
+    while(lo <= hi) {
+        int pivot = (lo + hi) / 2;
+
+        if(doc->segments[pivot].beg < beg)
+            lo = pivot + 1;
+        else if(doc->segments[pivot].beg > beg)
+            hi = pivot - 1;
+        else
+            return pivot;
+    }
+
+    return -1;
+}
+
+/* Analyze lines of ctx->text from the given offset and collect the blocks
+ * into ctx->block_bytes and the segments into doc->new_segments.
+ *
+ * If sync_from >= 0, doc->segments describe the document before an edit
+ * which has replaced n_removed bytes with n_inserted ones, and which ends at
+ * sync_min (in the new text). Once we are past the edit and at a line where
+ * some old segment (sync_from or later) begins, we stop: The rest of the
+ * document would be analyzed exactly as before. The index of that segment
+ * (or doc->n_segments if we reach the end of the document) is stored into
+ * *p_sync. */
+static int
+md_editdoc_analyze(MD_CTX* ctx, MD_EDITDOC* doc, OFF off, int sync_from,
+                   OFF sync_min, SZ n_removed, SZ n_inserted, int* p_sync)
+{
+    const MD_LINE_ANALYSIS* pivot_line = &md_dummy_blank_line;
+    MD_LINE_ANALYSIS line_buf[2];
+    MD_LINE_ANALYSIS* line = &line_buf[0];
+    OFF seg_beg = off;
+    size_t seg_byte_off = ctx->n_block_bytes;
+    int seg_ref_def_index = ctx->n_ref_defs;
+    unsigned n_blocks;
+    int ret = 0;
+
+    doc->n_new_segments = 0;
+    *p_sync = doc->n_segments;
+
+    while(off < ctx->size) {
+        if(line == pivot_line)
+            line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
+
+        MD_CHECK(md_consume_line(ctx, off, &off, &pivot_line, line));
+
+        if(!md_editdoc_is_clean(ctx, pivot_line))
+            continue;
+
+        if(sync_from >= 0  &&  off >= sync_min) {
+            int sync = md_editdoc_find_segment(doc, sync_from, off + n_removed - n_inserted);
+            if(sync >= 0) {
+                *p_sync = sync;
+                break;
+            }
+        }
+
+        /* Start a new segment here. (Blank lines do not deserve a segment
+         * of their own; they stay in the current one.) */
+        n_blocks = md_editdoc_count_blocks(ctx, seg_byte_off, ctx->n_block_bytes);
+        if(n_blocks > 0  ||  ctx->n_ref_defs > seg_ref_def_index) {
+            MD_CHECK(md_editdoc_push_segment(ctx, doc, seg_beg, n_blocks,
+                        ctx->n_ref_defs - seg_ref_def_index));
+            seg_beg = off;
+            seg_byte_off = ctx->n_block_bytes;
+            seg_ref_def_index = ctx->n_ref_defs;
+        }
+    }
+
+    if(off >= ctx->size) {
+        /* The same as the end of md_process_doc(). */
+        MD_CHECK(md_end_current_block(ctx));
+        MD_CHECK(md_leave_child_containers(ctx, 0));
+    }
+
+    if(seg_beg < off) {
+        n_blocks = md_editdoc_count_blocks(ctx, seg_byte_off, ctx->n_block_bytes);
+        MD_CHECK(md_editdoc_push_segment(ctx, doc, seg_beg, n_blocks,
+                    ctx->n_ref_defs - seg_ref_def_index));
+    }
+
+abort:
+    return ret;
+}
+
+/* Check whether the ref. defs. appended by md_editdoc_analyze() (i.e. those
+ * from old_n_ref_defs up) are the same as ctx->ref_defs[beg ... end-1] which
+ * they are about to replace. */
+static int
+md_editdoc_same_ref_defs(MD_CTX* ctx, const CHAR* old_text, int beg, int end, int old_n_ref_defs)
+{
+    int i;
+
+    if(ctx->n_ref_defs - old_n_ref_defs != end - beg)
+        return FALSE;
+
+    for(i = 0; i < end - beg; i++) {
+        const MD_REF_DEF* old_def = &ctx->ref_defs[beg + i];
+        const MD_REF_DEF* new_def = &ctx->ref_defs[old_n_ref_defs + i];
+
+        if(!md_ref_def_label_eq(old_def, new_def->norm_label, new_def->norm_label_size, new_def->hash))
+            return FALSE;
+        if(old_def->title_size != new_def->title_size  ||
+           memcmp(old_def->title, new_def->title, old_def->title_size * sizeof(CHAR)) != 0)
+            return FALSE;
+        if(old_def->dest_end - old_def->dest_beg != new_def->dest_end - new_def->dest_beg  ||
+           memcmp(old_text + old_def->dest_beg, STR(new_def->dest_beg),
+                  (old_def->dest_end - old_def->dest_beg) * sizeof(CHAR)) != 0)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+
+/****************************
+ ***  Context Management  ***
+ ****************************/
+
+/* Copy MD_PARSER provided by the application. Note it may be shorter than
+ * our MD_PARSER if the application has been built with older md4c.h. */
+static int
+md_copy_parser(MD_PARSER* dst, const MD_PARSER* src)
+{
+    switch(src->abi_version) {
+        case 0:
+            memset(dst, 0, sizeof(MD_PARSER));
+            memcpy(dst, src, offsetof(MD_PARSER, allocator));
+            return 0;
+
+        case 1:
+            memset(dst, 0, sizeof(MD_PARSER));
+            memcpy(dst, src, offsetof(MD_PARSER, stats));
+            return 0;
+
+        case MD_PARSER_ABI_VERSION:
+            memcpy(dst, src, sizeof(MD_PARSER));
+            return 0;
+
+        default:
+            return -1;
+    }
+}
+
+/* Set up the context for the given parser. This covers everything which is
+ * derived only from MD_PARSER and hence it can be reused for any number of
+ * documents. */
+static void
+md_setup_ctx(MD_CTX* ctx, const MD_PARSER* parser)
+{
+    memset(ctx, 0, sizeof(MD_CTX));
+    memcpy(&ctx->parser, parser, sizeof(MD_PARSER));
+    ctx->code_indent_offset = (ctx->parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
+    md_build_mark_char_map(ctx);
+}
+
+/* Reset the state of the line analysis so it can start at the beginning of
+ * a document (or at any offset where no block nor container is open). */
+static void
+md_reset_analysis_state(MD_CTX* ctx)
+{
+    ctx->html_comment_horizon = 0;
+    ctx->html_proc_instr_horizon = 0;
+    ctx->html_decl_horizon = 0;
+    ctx->html_cdata_horizon = 0;
+
+    ctx->current_block = NULL;
+    ctx->n_block_bytes = 0;
+    ctx->n_containers = 0;
+
+    ctx->code_fence_length = 0;
+    ctx->html_block_type = 0;
+    ctx->last_line_has_list_loosening_effect = 0;
+    ctx->last_list_item_starts_with_two_blank_lines = 0;
+    ctx->list_item_opener_end = (size_t) -1;
+}
+
+/* Reset all the per-document state so the context is ready to parse the given
+ * document. Any buffers allocated for the previous document are kept. */
+static void
+md_reset_ctx(MD_CTX* ctx, const CHAR* text, SZ size, void* userdata)
+{
+    int i;
+
+    ctx->text = text;
+    ctx->size = size;
+    ctx->userdata = userdata;
+    ctx->doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+
+    ctx->n_ref_defs = 0;
+    ctx->ref_def_hashtable = NULL;
+    ctx->ref_def_hashtable_size = 0;
+    ctx->n_ref_defs_in_hashtable = 0;
+    ctx->n_marks = 0;
+
+    /* Reset all unresolved opener mark chains. */
+    for(i = 0; i < (int) SIZEOF_ARRAY(ctx->mark_chains); i++) {
+        ctx->mark_chains[i].head = -1;
+        ctx->mark_chains[i].tail = -1;
+    }
+    ctx->n_table_cell_boundaries = 0;
+    ctx->unresolved_link_head = -1;
+    ctx->unresolved_link_tail = -1;
+
+    if(ctx->parser.stats != NULL)
+        memset(ctx->parser.stats, 0, sizeof(MD_PARSE_STATS));
+
+    md_reset_analysis_state(ctx);
+}
+
+/* Release whatever the last document has left behind. */
+static void
+md_finish_ctx(MD_CTX* ctx)
+{
+    ctx->ref_def_hashtable = NULL;
+    ctx->ref_def_hashtable_size = 0;
+    ctx->n_ref_defs_in_hashtable = 0;
+    ctx->n_ref_defs = 0;
+
+    /* Everything in the arena belongs to the document (e.g. copies of
+     * ref. def. labels). */
+    ctx->arena_current = NULL;
+    ctx->arena_used = 0;
+}
+
+/* Get how much memory the (growing) buffers of the context occupy. */
+static size_t
+md_ctx_retained_bytes(MD_CTX* ctx)
+{
+    MD_ARENA_CHUNK* chunk;
+    size_t n;
+
+    n = (size_t) ctx->alloc_buffer * sizeof(CHAR) +
+        (size_t) ctx->alloc_ref_defs * sizeof(MD_REF_DEF) +
+        (size_t) ctx->alloc_marks * sizeof(MD_MARK) +
+        (size_t) ctx->alloc_table_cell_offs * sizeof(OFF) +
+        (size_t) ctx->alloc_table_align * sizeof(MD_ALIGN) +
+        (size_t) ctx->alloc_block_bytes +
+        (size_t) ctx->alloc_containers * sizeof(MD_CONTAINER);
+
+    for(chunk = ctx->arena_first; chunk != NULL; chunk = chunk->next)
+        n += chunk->size;
+
+    return n;
+}
+
+/* Free all the growing buffers of the context. */
+static void
+md_release_ctx_buffers(MD_CTX* ctx)
+{
+    md_free(ctx, ctx->buffer);
+    ctx->buffer = NULL;
+    ctx->alloc_buffer = 0;
+
+    md_free(ctx, ctx->ref_defs);
+    ctx->ref_defs = NULL;
+    ctx->alloc_ref_defs = 0;
+
+    md_free(ctx, ctx->marks);
+    ctx->marks = NULL;
+    ctx->alloc_marks = 0;
+
+    md_free(ctx, ctx->table_cell_offs);
+    ctx->table_cell_offs = NULL;
+    ctx->alloc_table_cell_offs = 0;
+
+    md_free(ctx, ctx->table_align);
+    ctx->table_align = NULL;
+    ctx->alloc_table_align = 0;
+
+    md_free(ctx, ctx->block_bytes);
+    ctx->block_bytes = NULL;
+    ctx->alloc_block_bytes = 0;
+
+    md_free(ctx, ctx->containers);
+    ctx->containers = NULL;
+    ctx->alloc_containers = 0;
+
+    md_arena_free(ctx);
+}
+
+
+/********************
+ ***  Public API  ***
+ ********************/
+
+struct MD_PARSER_CTX_tag {
+    MD_CTX ctx;
+    size_t retain_limit;
+    MD_STREAM stream;
+    MD_EDITDOC doc;
+};
+
+int
+md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    MD_PARSER parser_copy;
+    int ret;
+
+    if(md_copy_parser(&parser_copy, parser) != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
+
+    /* Setup context structure. */
+    md_setup_ctx(&ctx, &parser_copy);
+    md_reset_ctx(&ctx, text, size, userdata);
+
+    /* All the work. */
+    ret = md_process_doc(&ctx);
+
+    /* Clean-up. */
+    md_finish_ctx(&ctx);
+    md_release_ctx_buffers(&ctx);
+
+    return ret;
+}
+
+MD_PARSER_CTX*
+md_parser_create(const MD_PARSER* parser)
+{
+    MD_PARSER_CTX* pctx;
+    MD_PARSER parser_copy;
+
+    if(md_copy_parser(&parser_copy, parser) != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", NULL);
+        return NULL;
+    }
+
+    if(parser_copy.allocator != NULL)
+        pctx = (MD_PARSER_CTX*) parser_copy.allocator->alloc(sizeof(MD_PARSER_CTX), parser_copy.allocator->allocator_data);
+    else
+        pctx = (MD_PARSER_CTX*) malloc(sizeof(MD_PARSER_CTX));
+    if(pctx == NULL) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("malloc() failed.", NULL);
+        return NULL;
+    }
+
+    md_setup_ctx(&pctx->ctx, &parser_copy);
+    pctx->retain_limit = 0;
+    memset(&pctx->stream, 0, sizeof(MD_STREAM));
+    memset(&pctx->doc, 0, sizeof(MD_EDITDOC));
+    return pctx;
+}
+
+void
+md_parser_set_retain_limit(MD_PARSER_CTX* pctx, size_t max_bytes)
+{
+    pctx->retain_limit = max_bytes;
+}
+
+/* Free the buffers of md_parser_feed() and md_parser_load(). */
+static void
+md_parser_release_text_buffers(MD_PARSER_CTX* pctx)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_EDITDOC* doc = &pctx->doc;
+
+    md_free(ctx, pctx->stream.text);
+    pctx->stream.text = NULL;
+    pctx->stream.alloc = 0;
+
+    md_free(ctx, doc->text);
+    doc->text = NULL;
+    doc->alloc = 0;
+    md_free(ctx, doc->spare_text);
+    doc->spare_text = NULL;
+    doc->spare_alloc = 0;
+    md_free(ctx, doc->segments);
+    doc->segments = NULL;
+    doc->alloc_segments = 0;
+    md_free(ctx, doc->new_segments);
+    doc->new_segments = NULL;
+    doc->alloc_new_segments = 0;
+}
+
+int
+md_parser_set_parallel(MD_PARSER_CTX* pctx, unsigned n_threads, const MD_PARALLEL_CALLBACKS* callbacks)
+{
+    MD_CTX* ctx = &pctx->ctx;
+
+    if(n_threads <= 1  ||  callbacks == NULL) {
+        ctx->n_threads = 0;
+        return 0;
+    }
+
+#ifdef MD_THREADS
+    ctx->n_threads = n_threads;
+    memcpy(&ctx->parallel, callbacks, sizeof(MD_PARALLEL_CALLBACKS));
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/* Release the buffers if they have grown too much. */
+static void
+md_parser_apply_retain_limit(MD_PARSER_CTX* pctx)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_EDITDOC* doc = &pctx->doc;
+
+    if(pctx->retain_limit > 0  &&
+       md_ctx_retained_bytes(ctx) + (size_t) pctx->stream.alloc * sizeof(CHAR) +
+       (size_t) (doc->alloc + doc->spare_alloc) * sizeof(CHAR) +
+       (size_t) (doc->alloc_segments + doc->alloc_new_segments) * sizeof(MD_SEGMENT) > pctx->retain_limit)
+    {
+        md_release_ctx_buffers(ctx);
+        md_parser_release_text_buffers(pctx);
+    }
+}
+
+int
+md_parser_parse(MD_PARSER_CTX* pctx, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    int ret;
+
+    /* Abandon any unfinished streamed document or loaded document. */
+    pctx->stream.is_active = FALSE;
+    pctx->doc.is_loaded = FALSE;
+
+    md_reset_ctx(ctx, text, size, userdata);
+    ret = md_process_doc(ctx);
+    md_finish_ctx(ctx);
+
+    /* Do not let a single huge document pin its buffers forever. */
+    md_parser_apply_retain_limit(pctx);
+
+    ctx->text = NULL;
+    ctx->userdata = NULL;
+    return ret;
+}
+
+/* End the streamed document (successfully or not). */
+static void
+md_parser_end_stream(MD_PARSER_CTX* pctx)
+{
+    MD_CTX* ctx = &pctx->ctx;
+
+    pctx->stream.is_active = FALSE;
+    md_finish_ctx(ctx);
+    md_parser_apply_retain_limit(pctx);
+
+    ctx->text = NULL;
+    ctx->userdata = NULL;
+}
+
+static int
+md_parser_begin_stream(MD_PARSER_CTX* pctx, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_STREAM* stream = &pctx->stream;
+    int ret = 0;
+
+    pctx->doc.is_loaded = FALSE;
+    md_reset_ctx(ctx, NULL, 0, userdata);
+    stream->is_active = TRUE;
+    stream->size = 0;
+    stream->off = 0;
+    stream->pivot_line = &md_dummy_blank_line;
+    stream->held_n_ref_defs = -1;
+
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+
+abort:
+    return ret;
+}
+
+int
+md_parser_feed(MD_PARSER_CTX* pctx, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_STREAM* stream = &pctx->stream;
+    int ret = 0;
+
+    if(!stream->is_active)
+        MD_CHECK(md_parser_begin_stream(pctx, userdata));
+    ctx->userdata = userdata;
+
+    if(stream->size + size > stream->alloc) {
+        CHAR* new_text;
+        SZ new_alloc;
+
+        new_alloc = stream->alloc + stream->alloc / 2;
+        if(new_alloc < stream->size + size)
+            new_alloc = stream->size + size;
+        if(new_alloc < 4096)
+            new_alloc = 4096;
+        new_text = (CHAR*) md_realloc(ctx, stream->text, new_alloc * sizeof(CHAR));
+        if(new_text == NULL) {
+            MD_LOG("realloc() failed.");
+            ret = -1;
+            goto abort;
+        }
+
+        /* Fix the ref. defs. which point into the old buffer. */
+        if(new_text != stream->text  &&  stream->text != NULL)
+            md_rebase_ref_defs(ctx, 0, ctx->n_ref_defs, stream->text, stream->size, new_text, 0, 0);
+
+        stream->text = new_text;
+        stream->alloc = new_alloc;
+    }
+
+    if(size > 0) {
+        memcpy(stream->text + stream->size, text, size * sizeof(CHAR));
+        stream->size += size;
+    }
+
+    MD_CHECK(md_stream_analyze(ctx, stream, FALSE));
+    return 0;
+
+abort:
+    md_parser_end_stream(pctx);
+    return ret;
+}
+
+int
+md_parser_finish(MD_PARSER_CTX* pctx, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_STREAM* stream = &pctx->stream;
+    int ret = 0;
+
+    if(!stream->is_active)
+        MD_CHECK(md_parser_begin_stream(pctx, userdata));
+    ctx->userdata = userdata;
+
+    MD_CHECK(md_stream_analyze(ctx, stream, TRUE));
+
+    /* The same as the end of md_process_doc(). */
+    MD_CHECK(md_end_current_block(ctx));
+    if(ctx->n_ref_defs_in_hashtable < ctx->n_ref_defs)
+        MD_CHECK(md_build_ref_def_hashtable(ctx));
+    MD_CHECK(md_leave_child_containers(ctx, 0));
+    MD_CHECK(md_process_blocks(ctx, ctx->n_block_bytes));
+
+    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+
+abort:
+    md_parser_end_stream(pctx);
+    return ret;
+}
+
+/* Unload the document of md_parser_load() (after a failure). */
+static void
+md_parser_unload(MD_PARSER_CTX* pctx)
+{
+    MD_CTX* ctx = &pctx->ctx;
+
+    pctx->doc.is_loaded = FALSE;
+    md_finish_ctx(ctx);
+    md_parser_apply_retain_limit(pctx);
+
+    ctx->text = NULL;
+    ctx->userdata = NULL;
+}
+
+/* Make sure the buffer can hold the given count of characters. Its contents
+ * is not preserved. */
+static int
+md_parser_reserve_text(MD_CTX* ctx, CHAR** p_text, SZ* p_alloc, SZ size)
+{
+    CHAR* new_text;
+    SZ new_alloc;
+
+    if(size <= *p_alloc)
+        return 0;
+
+    new_alloc = *p_alloc + *p_alloc / 2;
+    if(new_alloc < size)
+        new_alloc = size;
+    if(new_alloc < 4096)
+        new_alloc = 4096;
+
+    new_text = (CHAR*) md_malloc(ctx, new_alloc * sizeof(CHAR));
+    if(new_text == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
+    }
+
+    md_free(ctx, *p_text);
+    *p_text = new_text;
+    *p_alloc = new_alloc;
+    return 0;
+}
+
+/* Analyze and process the whole ctx->text, remembering its segments. */
+static int
+md_editdoc_process_all(MD_CTX* ctx, MD_EDITDOC* doc)
+{
+    MD_SEGMENT* tmp;
+    int sync;
+    int ret = 0;
+
+    MD_CHECK(md_editdoc_analyze(ctx, doc, 0, -1, 0, 0, 0, &sync));
+    MD_CHECK(md_build_ref_def_hashtable(ctx));
+    MD_CHECK(md_process_blocks(ctx, ctx->n_block_bytes));
+
+    tmp = doc->segments;
+    doc->segments = doc->new_segments;
+    doc->new_segments = tmp;
+    sync = doc->alloc_segments;
+    doc->alloc_segments = doc->alloc_new_segments;
+    doc->alloc_new_segments = sync;
+    doc->n_segments = doc->n_new_segments;
+    doc->n_new_segments = 0;
+
+abort:
+    return ret;
+}
+
+int
+md_parser_load(MD_PARSER_CTX* pctx, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_EDITDOC* doc = &pctx->doc;
+    int ret = 0;
+
+    /* Abandon any unfinished streamed document or loaded document. */
+    pctx->stream.is_active = FALSE;
+    doc->is_loaded = FALSE;
+    md_finish_ctx(ctx);
+    ctx->userdata = userdata;
+
+    MD_CHECK(md_parser_reserve_text(ctx, &doc->text, &doc->alloc, size));
+    if(size > 0)
+        memcpy(doc->text, text, size * sizeof(CHAR));
+    doc->size = size;
+    doc->n_segments = 0;
+    doc->arena_garbage = 0;
+
+    md_reset_ctx(ctx, doc->text, size, userdata);
+    MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
+    MD_CHECK(md_editdoc_process_all(ctx, doc));
+    MD_LEAVE_BLOCK(MD_BLOCK_DOC, NULL);
+
+    doc->is_loaded = TRUE;
+    return 0;
+
+abort:
+    md_parser_unload(pctx);
+    return ret;
+}
+
+int
+md_parser_edit(MD_PARSER_CTX* pctx, MD_OFFSET off, MD_SIZE removed_size,
+               const MD_CHAR* text, MD_SIZE size, MD_EDIT_RESULT* result, void* userdata)
+{
+    MD_CTX* ctx = &pctx->ctx;
+    MD_EDITDOC* doc = &pctx->doc;
+    CHAR* old_text = doc->text;
+    SZ old_size = doc->size;
+    SZ new_size;
+    int old_n_ref_defs = ctx->n_ref_defs;
+    MD_ARENA_MARK arena_mark;
+    int first, sync;
+    int def_beg = 0, def_end;
+    int may_restore_arena = TRUE;
+    size_t arena_garbage = doc->arena_garbage;
+    int is_full = FALSE;
+    SZ tmp_alloc;
+    unsigned first_block = 0, n_removed_blocks = 0, n_added_blocks = 0;
+    int i;
+    int ret = 0;
+
+    ctx->userdata = userdata;
+    if(!doc->is_loaded  ||  off > old_size  ||  removed_size > old_size - off) {
+        MD_LOG("md_parser_edit(): No document loaded, or the edit is out of its range.");
+        return -1;
+    }
+    if(ctx->parser.stats != NULL)
+        memset(ctx->parser.stats, 0, sizeof(MD_PARSE_STATS));
+
+    /* Build the new text in the spare buffer. */
+    new_size = old_size - removed_size + size;
+    MD_CHECK(md_parser_reserve_text(ctx, &doc->spare_text, &doc->spare_alloc, new_size));
+    if(off > 0)
+        memcpy(doc->spare_text, old_text, off * sizeof(CHAR));
+    if(size > 0)
+        memcpy(doc->spare_text + off, text, size * sizeof(CHAR));
+    if(off + removed_size < old_size)
+        memcpy(doc->spare_text + off + size, old_text + off + removed_size,
+               (old_size - off - removed_size) * sizeof(CHAR));
+
+    /* Find the segment where the edit starts. */
+    first = 0;
+    for(i = doc->n_segments; i > 1; ) {
+        int half = i / 2;
+        if(doc->segments[first + half].beg <= off)
+            first += half;
+        i -= half;
+    }
+    for(i = 0; i < first; i++) {
+        def_beg += doc->segments[i].n_ref_defs;
+        first_block += doc->segments[i].n_blocks;
+    }
+
+    /* Analyze the new text from there on until we get in sync with the old
+     * segments. */
+    md_arena_save(ctx, &arena_mark);
+    ctx->text = doc->spare_text;
+    ctx->size = new_size;
+    ctx->doc_ends_with_newline = (new_size > 0  &&  ISNEWLINE_(doc->spare_text[new_size-1]));
+    md_reset_analysis_state(ctx);
+    MD_CHECK(md_editdoc_analyze(ctx, doc, (first < doc->n_segments ? doc->segments[first].beg : 0),
+                first, off + size, removed_size, size, &sync));
+
+    def_end = def_beg;
+    for(i = first; i < sync; i++) {
+        def_end += doc->segments[i].n_ref_defs;
+        n_removed_blocks += doc->segments[i].n_blocks;
+    }
+    for(i = 0; i < doc->n_new_segments; i++)
+        n_added_blocks += doc->new_segments[i].n_blocks;
+
+    /* Only the copies of multi-line labels and titles, and the normalized
+     * labels could have been allocated since the mark. If the new ref. defs.
+     * need any such copy, nothing since the mark may be released, and the
+     * copies of the old ref. defs. become garbage too. The arena cannot free
+     * them individually, so once there is too much garbage, we re-parse the
+     * whole document to start with an empty arena again. */
+    for(i = old_n_ref_defs; i < ctx->n_ref_defs; i++) {
+        const MD_REF_DEF* new_def = &ctx->ref_defs[i];
+
+        if(new_def->label < doc->spare_text  ||  new_def->label > doc->spare_text + new_size  ||
+           new_def->title < doc->spare_text  ||  new_def->title > doc->spare_text + new_size)
+            may_restore_arena = FALSE;
+    }
+    if(!may_restore_arena)
+        arena_garbage += md_arena_size_since(ctx, &arena_mark);
+
+    if(arena_garbage <= MD_EDITDOC_MAX_ARENA_GARBAGE(new_size)  &&
+       md_editdoc_same_ref_defs(ctx, old_text, def_beg, def_end, old_n_ref_defs))
+    {
+        /* Replace the old ref. defs. with the new ones. They are equal so
+         * the hashtable still works; we only fix where they live. */
+        for(i = 0; i < def_end - def_beg; i++) {
+            MD_REF_DEF* new_def = &ctx->ref_defs[old_n_ref_defs + i];
+
+            new_def->norm_label = ctx->ref_defs[def_beg + i].norm_label;
+            ctx->ref_defs[def_beg + i] = *new_def;
+        }
+        ctx->n_ref_defs = old_n_ref_defs;
+        md_rebase_ref_defs(ctx, 0, def_beg, old_text, old_size, doc->spare_text, 0, 0);
+        md_rebase_ref_defs(ctx, def_end, ctx->n_ref_defs, old_text, old_size, doc->spare_text, removed_size, size);
+
+        if(may_restore_arena)
+            md_arena_restore(ctx, &arena_mark);
+        doc->arena_garbage = arena_garbage;
+        if(ctx->n_ref_defs_in_hashtable < ctx->n_ref_defs)
+            MD_CHECK(md_build_ref_def_hashtable(ctx));
+
+        MD_CHECK(md_process_blocks(ctx, ctx->n_block_bytes));
+
+        /* Replace the old segments with the new ones. */
+        if(doc->n_segments - (sync - first) + doc->n_new_segments > doc->alloc_segments) {
+            MD_SEGMENT* new_segments;
+            int alloc_segments = doc->alloc_segments + doc->alloc_segments / 2;
+
+            if(alloc_segments < doc->n_segments - (sync - first) + doc->n_new_segments)
+                alloc_segments = doc->n_segments - (sync - first) + doc->n_new_segments;
+            if(alloc_segments < 64)
+                alloc_segments = 64;
+            new_segments = (MD_SEGMENT*) md_realloc(ctx, doc->segments, alloc_segments * sizeof(MD_SEGMENT));
+            if(new_segments == NULL) {
+                MD_LOG("realloc() failed.");
+                ret = -1;
+                goto abort;
+            }
+            doc->segments = new_segments;
+            doc->alloc_segments = alloc_segments;
+        }
+        if(sync < doc->n_segments) {
+            memmove(doc->segments + first + doc->n_new_segments, doc->segments + sync,
+                    (doc->n_segments - sync) * sizeof(MD_SEGMENT));
+        }
+        if(doc->n_new_segments > 0)
+            memcpy(doc->segments + first, doc->new_segments, doc->n_new_segments * sizeof(MD_SEGMENT));
+        doc->n_segments += doc->n_new_segments - (sync - first);
+        for(i = first + doc->n_new_segments; i < doc->n_segments; i++)
+            doc->segments[i].beg = doc->segments[i].beg - removed_size + size;
+    } else {
+        /* The set of ref. defs. has changed. That may change any link in
+         * the document, so we have to start from scratch. (Or the arena
+         * holds too much garbage.) */
+        is_full = TRUE;
+        first_block = 0;
+        n_removed_blocks = 0;
+        for(i = 0; i < doc->n_segments; i++)
+            n_removed_blocks += doc->segments[i].n_blocks;
+
+        md_finish_ctx(ctx);
+        md_reset_ctx(ctx, doc->spare_text, new_size, userdata);
+        doc->arena_garbage = 0;
+        MD_CHECK(md_editdoc_process_all(ctx, doc));
+
+        n_added_blocks = 0;
+        for(i = 0; i < doc->n_segments; i++)
+            n_added_blocks += doc->segments[i].n_blocks;
+    }
+
+    doc->text = doc->spare_text;
+    doc->size = new_size;
+    doc->spare_text = old_text;
+    tmp_alloc = doc->alloc;
+    doc->alloc = doc->spare_alloc;
+    doc->spare_alloc = tmp_alloc;
+
+    if(result != NULL) {
+        result->first_block = first_block;
+        result->n_removed_blocks = n_removed_blocks;
+        result->n_added_blocks = n_added_blocks;
+        result->is_full = is_full;
+    }
+    return 0;
+
+abort:
+    md_parser_unload(pctx);
+    return ret;
+}
+
+void
+md_parser_reset(MD_PARSER_CTX* pctx)
+{
+    MD_CTX* ctx = &pctx->ctx;
+
+    if(pctx->stream.is_active  ||  pctx->doc.is_loaded) {
+        pctx->stream.is_active = FALSE;
+        pctx->doc.is_loaded = FALSE;
+        md_finish_ctx(ctx);
+    }
+
+    md_release_ctx_buffers(ctx);
+    md_parser_release_text_buffers(pctx);
+}
+
+void
+md_parser_destroy(MD_PARSER_CTX* pctx)
+{
+    if(pctx == NULL)
+        return;
+
+    md_parser_reset(pctx);
+    md_free(&pctx->ctx, pctx);
+}
+
+
+/***********************
+ ***  Document Tree  ***
+ ***********************/
+
+/* Attribute of a detail structure. Its string is referred by an offset the
+ * same way as the text of text nodes (see md_tree_string()); its substring
+ * types and offsets begin at the index substr of MD_TREE::substr_types and
+ * MD_TREE::substr_offsets. (MD_TREE_NO_SUBSTRS if the attribute is not set
+ * at all, e.g. the info string of an indented code block.) */
+#define MD_TREE_NO_SUBSTRS      ((SZ) -1)
+
+typedef struct MD_TREE_ATTR_tag MD_TREE_ATTR;
+struct MD_TREE_ATTR_tag {
+    OFF off;
+    SZ size;
+    SZ substr;
+};
+
+/* A tree built by md_parse_tree() occupies a single memory block: This
+ * header is followed by all the arrays. A tree loaded by md_tree_load() is
+ * just this header, and the arrays are in the blob. */
+struct MD_TREE_tag {
+    const MD_ALLOCATOR* allocator;
+    const CHAR* text;
+    SZ size;
+    SZ max_depth;
+
+    const MD_NODE* nodes;
+    const MD_TREE_ATTR* attrs;
+    const OFF* substr_offsets;
+    const MD_TEXTTYPE* substr_types;
+    const CHAR* strings;    /* Strings not present in the document (offsets >= size). */
+    SZ n_attrs;
+    SZ n_substrs;
+    SZ n_strings;
+};
+
+/* Where the details of the blocks and spans are stored:
+ *
+ *   MD_BLOCK_UL:           data = mark, size = is_tight
+ *   MD_BLOCK_OL:           data = mark_delimiter, off = start, size = is_tight
+ *   MD_BLOCK_LI:           data = task_mark, off = task_mark_offset, size = is_task
+ *   MD_BLOCK_H:            data = level
+ *   MD_BLOCK_CODE:         data = fence_char, off = index of 2 attributes (info, lang)
+ *   MD_BLOCK_TABLE:        data = head_row_count, off = col_count, size = body_row_count
+ *   MD_BLOCK_TH, _TD:      data = align
+ *   MD_SPAN_A, _A_SELF,
+ *   _A_CODELINK, _IMG:     off = index of 2 attributes (href/src, title)
+ *   MD_SPAN_WIKILINK:      off = index of 1 attribute (target)
+ */
+typedef union MD_TREE_DETAIL_tag MD_TREE_DETAIL;
+union MD_TREE_DETAIL_tag {
+    MD_BLOCK_UL_DETAIL ul;
+    MD_BLOCK_OL_DETAIL ol;
+    MD_BLOCK_LI_DETAIL li;
+    MD_BLOCK_H_DETAIL h;
+    MD_BLOCK_CODE_DETAIL code;
+    MD_BLOCK_TABLE_DETAIL table;
+    MD_BLOCK_TD_DETAIL td;
+    MD_SPAN_A_DETAIL a;
+    MD_SPAN_IMG_DETAIL img;
+    MD_SPAN_WIKILINK_DETAIL wikilink;
+};
+
+typedef struct MD_TREE_BUILD_tag MD_TREE_BUILD;
+struct MD_TREE_BUILD_tag {
+    MD_CTX* ctx;
+
+    MD_NODE* nodes;
+    SZ n_nodes;
+    SZ alloc_nodes;
+
+    MD_TREE_ATTR* attrs;
+    SZ n_attrs;
+    SZ alloc_attrs;
+
+    OFF* substr_offsets;
+    MD_TEXTTYPE* substr_types;
+    SZ n_substrs;
+    SZ alloc_substr_offsets;
+    SZ alloc_substr_types;
+
+    CHAR* strings;
+    SZ n_strings;
+    SZ alloc_strings;
+
+    /* Indexes of the blocks and spans entered but not left yet. */
+    SZ* open;
+    SZ n_open;
+    SZ alloc_open;
+    SZ max_depth;
+};
+
+/* Make sure the array has room for n items. Returns the (possibly moved)
+ * array, or NULL if it cannot grow (and then the old one stays valid). */
+static void*
+md_tree_reserve(MD_CTX* ctx, void* array, SZ* p_alloc, SZ n, size_t item_size)
+{
+    void* new_array;
+    SZ new_alloc;
+
+    if(n <= *p_alloc)
+        return array;
+
+    new_alloc = *p_alloc + *p_alloc / 2 + 64;
+    if(new_alloc < n)
+        new_alloc = n;
+    if(new_alloc < *p_alloc  ||  (size_t) new_alloc > ((size_t) -1) / item_size) {
+        MD_LOG("Tree too large.");
+        return NULL;
+    }
+
+    new_array = md_realloc(ctx, array, (size_t) new_alloc * item_size);
+    if(new_array == NULL) {
+        MD_LOG("realloc() failed.");
+        return NULL;
+    }
+    *p_alloc = new_alloc;
+    return new_array;
+}
+
+/* Get offset referring to the string: If it is in the document, it is just
+ * its offset there. Otherwise the string is copied into the strings of the
+ * tree and the offset is size of the document plus its offset there. */
+static int
+md_tree_string(MD_TREE_BUILD* build, const CHAR* str, SZ size, OFF* p_off)
+{
+    MD_CTX* ctx = build->ctx;
+    CHAR* strings;
+
+    if(str >= ctx->text  &&  str <= ctx->text + ctx->size  &&  size <= (SZ)(ctx->text + ctx->size - str)) {
+        *p_off = (OFF)(str - ctx->text);
+        return 0;
+    }
+
+    if(build->n_strings + size < build->n_strings  ||
+       ctx->size + build->n_strings + size < ctx->size)
+    {
+        MD_LOG("Tree too large.");
+        return -1;
+    }
+    strings = (CHAR*) md_tree_reserve(ctx, build->strings, &build->alloc_strings,
+                build->n_strings + size, sizeof(CHAR));
+    if(strings == NULL)
+        return -1;
+    build->strings = strings;
+
+    memcpy(build->strings + build->n_strings, str, size * sizeof(CHAR));
+    *p_off = ctx->size + build->n_strings;
+    build->n_strings += size;
+    return 0;
+}
+
+static int
+md_tree_add_attr(MD_TREE_BUILD* build, const MD_ATTRIBUTE* attr)
+{
+    MD_CTX* ctx = build->ctx;
+    MD_TREE_ATTR* a;
+    OFF* offsets;
+    MD_TEXTTYPE* types;
+    SZ n_substrs = 1;
+    SZ i;
+
+    a = (MD_TREE_ATTR*) md_tree_reserve(ctx, build->attrs, &build->alloc_attrs,
+                build->n_attrs + 1, sizeof(MD_TREE_ATTR));
+    if(a == NULL)
+        return -1;
+    build->attrs = a;
+    a = &build->attrs[build->n_attrs];
+
+    a->off = 0;
+    a->size = attr->size;
+    if(attr->size > 0  &&  md_tree_string(build, attr->text, attr->size, &a->off) != 0)
+        return -1;
+
+    if(attr->substr_offsets == NULL) {
+        a->substr = MD_TREE_NO_SUBSTRS;
+        build->n_attrs++;
+        return 0;
+    }
+
+    /* The substrings are never empty, except the only one of an empty
+     * attribute. */
+    while(attr->substr_offsets[n_substrs] < attr->size)
+        n_substrs++;
+
+    /* Both arrays have the same layout, including the terminating offset
+     * (so the type array has a dummy entry there). */
+    offsets = (OFF*) md_tree_reserve(ctx, build->substr_offsets, &build->alloc_substr_offsets,
+                build->n_substrs + n_substrs + 1, sizeof(OFF));
+    if(offsets == NULL)
+        return -1;
+    build->substr_offsets = offsets;
+    types = (MD_TEXTTYPE*) md_tree_reserve(ctx, build->substr_types, &build->alloc_substr_types,
+                build->n_substrs + n_substrs + 1, sizeof(MD_TEXTTYPE));
+    if(types == NULL)
+        return -1;
+    build->substr_types = types;
+
+    a->substr = build->n_substrs;
+    for(i = 0; i < n_substrs; i++) {
+        build->substr_types[build->n_substrs + i] = attr->substr_types[i];
+        build->substr_offsets[build->n_substrs + i] = attr->substr_offsets[i];
+    }
+    build->substr_types[build->n_substrs + n_substrs] = MD_TEXT_NORMAL;
+    build->substr_offsets[build->n_substrs + n_substrs] = attr->size;
+    build->n_substrs += n_substrs + 1;
+
+    build->n_attrs++;
+    return 0;
+}
+
+static int
+md_tree_push_node(MD_TREE_BUILD* build, MD_NODEKIND kind, int type)
+{
+    MD_CTX* ctx = build->ctx;
+    MD_NODE* nodes;
+    MD_NODE* node;
+
+    nodes = (MD_NODE*) md_tree_reserve(ctx, build->nodes, &build->alloc_nodes,
+                build->n_nodes + 1, sizeof(MD_NODE));
+    if(nodes == NULL)
+        return -1;
+    build->nodes = nodes;
+
+    node = &build->nodes[build->n_nodes++];
+    node->kind = (unsigned char) kind;
+    node->type = (unsigned char) type;
+    node->data = 0;
+    node->n_nodes = 1;
+    node->off = 0;
+    node->size = 0;
+    return 0;
+}
+
+/* Push new block or span node and keep it open until the leave callback. */
+static int
+md_tree_enter(MD_TREE_BUILD* build, MD_NODEKIND kind, int type)
+{
+    MD_CTX* ctx = build->ctx;
+    SZ* open;
+
+    open = (SZ*) md_tree_reserve(ctx, build->open, &build->alloc_open,
+                build->n_open + 1, sizeof(SZ));
+    if(open == NULL)
+        return -1;
+    build->open = open;
+
+    if(md_tree_push_node(build, kind, type) != 0)
+        return -1;
+    build->open[build->n_open++] = build->n_nodes - 1;
+    if(build->n_open > build->max_depth)
+        build->max_depth = build->n_open;
+    return 0;
+}
+
+static int
+md_tree_leave(MD_TREE_BUILD* build)
+{
+    MD_CTX* ctx = build->ctx;
+    SZ index;
+
+    MD_ASSERT(build->n_open > 0);
+    index = build->open[--build->n_open];
+    build->nodes[index].n_nodes = build->n_nodes - index;
+    return 0;
+}
+
+static int
+md_tree_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    MD_TREE_BUILD* build = (MD_TREE_BUILD*) userdata;
+    MD_NODE* node;
+    int ret = 0;
+
+    MD_CHECK(md_tree_enter(build, MD_NODE_BLOCK, type));
+    node = &build->nodes[build->n_nodes - 1];
+
+    switch(type) {
+        case MD_BLOCK_UL:
+        {
+            const MD_BLOCK_UL_DETAIL* det = (const MD_BLOCK_UL_DETAIL*) detail;
+            node->data = (unsigned short) det->mark;
+            node->size = (SZ) det->is_tight;
+            break;
+        }
+
+        case MD_BLOCK_OL:
+        {
+            const MD_BLOCK_OL_DETAIL* det = (const MD_BLOCK_OL_DETAIL*) detail;
+            node->data = (unsigned short) det->mark_delimiter;
+            node->off = det->start;
+            node->size = (SZ) det->is_tight;
+            break;
+        }
+
+        case MD_BLOCK_LI:
+        {
+            const MD_BLOCK_LI_DETAIL* det = (const MD_BLOCK_LI_DETAIL*) detail;
+            node->data = (unsigned short) det->task_mark;
+            node->off = det->task_mark_offset;
+            node->size = (SZ) det->is_task;
+            break;
+        }
+
+        case MD_BLOCK_H:
+            node->data = (unsigned short) ((const MD_BLOCK_H_DETAIL*) detail)->level;
+            break;
+
+        case MD_BLOCK_CODE:
+        {
+            const MD_BLOCK_CODE_DETAIL* det = (const MD_BLOCK_CODE_DETAIL*) detail;
+            node->data = (unsigned short) det->fence_char;
+            node->off = build->n_attrs;
+            MD_CHECK(md_tree_add_attr(build, &det->info));
+            MD_CHECK(md_tree_add_attr(build, &det->lang));
+            break;
+        }
+
+        case MD_BLOCK_TABLE:
+        {
+            const MD_BLOCK_TABLE_DETAIL* det = (const MD_BLOCK_TABLE_DETAIL*) detail;
+            node->data = (unsigned short) det->head_row_count;
+            node->off = det->col_count;
+            node->size = det->body_row_count;
+            break;
+        }
+
+        case MD_BLOCK_TH:
+        case MD_BLOCK_TD:
+            node->data = (unsigned short) ((const MD_BLOCK_TD_DETAIL*) detail)->align;
+            break;
+
+        default:
+            break;
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_tree_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    MD_UNUSED(type);
+    MD_UNUSED(detail);
+    return md_tree_leave((MD_TREE_BUILD*) userdata);
+}
+
+static int
+md_tree_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    MD_TREE_BUILD* build = (MD_TREE_BUILD*) userdata;
+    int ret = 0;
+
+    MD_CHECK(md_tree_enter(build, MD_NODE_SPAN, type));
+
+    switch(type) {
+        case MD_SPAN_A:
+        case MD_SPAN_A_SELF:
+        case MD_SPAN_A_CODELINK:
+        case MD_SPAN_IMG:
+        {
+            /* MD_SPAN_A_DETAIL and MD_SPAN_IMG_DETAIL are binary-compatible. */
+            const MD_SPAN_A_DETAIL* det = (const MD_SPAN_A_DETAIL*) detail;
+            build->nodes[build->n_nodes - 1].off = build->n_attrs;
+            MD_CHECK(md_tree_add_attr(build, &det->href));
+            MD_CHECK(md_tree_add_attr(build, &det->title));
+            break;
+        }
+
+        case MD_SPAN_WIKILINK:
+        {
+            const MD_SPAN_WIKILINK_DETAIL* det = (const MD_SPAN_WIKILINK_DETAIL*) detail;
+            build->nodes[build->n_nodes - 1].off = build->n_attrs;
+            MD_CHECK(md_tree_add_attr(build, &det->target));
+            break;
+        }
+
+        default:
+            break;
+    }
+
+abort:
+    return ret;
+}
+
+static int
+md_tree_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    MD_UNUSED(type);
+    MD_UNUSED(detail);
+    return md_tree_leave((MD_TREE_BUILD*) userdata);
+}
+
+static int
+md_tree_text_callback(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    MD_TREE_BUILD* build = (MD_TREE_BUILD*) userdata;
+    MD_NODE* node;
+    OFF off;
+    int ret = 0;
+
+    MD_CHECK(md_tree_string(build, text, size, &off));
+    MD_CHECK(md_tree_push_node(build, MD_NODE_TEXT, type));
+    node = &build->nodes[build->n_nodes - 1];
+    node->off = off;
+    node->size = size;
+
+abort:
+    return ret;
+}
+
+/* Move everything into a single memory block. */
+static int
+md_tree_finish(MD_TREE_BUILD* build, MD_TREE** p_tree)
+{
+    MD_CTX* ctx = build->ctx;
+    size_t nodes_size = MD_ARENA_ALIGN((size_t) build->n_nodes * sizeof(MD_NODE));
+    size_t attrs_size = MD_ARENA_ALIGN((size_t) build->n_attrs * sizeof(MD_TREE_ATTR));
+    size_t offsets_size = MD_ARENA_ALIGN((size_t) build->n_substrs * sizeof(OFF));
+    size_t types_size = MD_ARENA_ALIGN((size_t) build->n_substrs * sizeof(MD_TEXTTYPE));
+    size_t strings_size = (size_t) build->n_strings * sizeof(CHAR);
+    MD_TREE* tree;
+    char* ptr;
+
+    MD_ASSERT(build->n_open == 0);
+    MD_ASSERT(build->n_nodes > 0  &&  build->nodes[0].n_nodes == build->n_nodes);
+
+    tree = (MD_TREE*) md_malloc(ctx, MD_ARENA_ALIGN(sizeof(MD_TREE)) + nodes_size +
+                attrs_size + offsets_size + types_size + strings_size);
+    if(tree == NULL) {
+        MD_LOG("malloc() failed.");
+        return -1;
+    }
+
+    tree->allocator = ctx->parser.allocator;
+    tree->text = ctx->text;
+    tree->size = ctx->size;
+    tree->max_depth = build->max_depth;
+    tree->n_attrs = build->n_attrs;
+    tree->n_substrs = build->n_substrs;
+    tree->n_strings = build->n_strings;
+
+    ptr = (char*) tree + MD_ARENA_ALIGN(sizeof(MD_TREE));
+    tree->nodes = (MD_NODE*) ptr;
+    memcpy(ptr, build->nodes, (size_t) build->n_nodes * sizeof(MD_NODE));
+    ptr += nodes_size;
+    tree->attrs = (MD_TREE_ATTR*) ptr;
+    if(build->n_attrs > 0)
+        memcpy(ptr, build->attrs, (size_t) build->n_attrs * sizeof(MD_TREE_ATTR));
+    ptr += attrs_size;
+    tree->substr_offsets = (OFF*) ptr;
+    if(build->n_substrs > 0)
+        memcpy(ptr, build->substr_offsets, (size_t) build->n_substrs * sizeof(OFF));
+    ptr += offsets_size;
+    tree->substr_types = (MD_TEXTTYPE*) ptr;
+    if(build->n_substrs > 0)
+        memcpy(ptr, build->substr_types, (size_t) build->n_substrs * sizeof(MD_TEXTTYPE));
+    ptr += types_size;
+    tree->strings = (CHAR*) ptr;
+    if(build->n_strings > 0)
+        memcpy(ptr, build->strings, strings_size);
+
+    *p_tree = tree;
+    return 0;
+}
+
+static void
+md_tree_build_free(MD_TREE_BUILD* build)
+{
+    MD_CTX* ctx = build->ctx;
+
+    md_free(ctx, build->nodes);
+    md_free(ctx, build->attrs);
+    md_free(ctx, build->substr_offsets);
+    md_free(ctx, build->substr_types);
+    md_free(ctx, build->strings);
+    md_free(ctx, build->open);
+}
+
+/* Memory of the tree itself (and of anything needed for working with it
+ * after the parsing is done) comes from the allocator the tree remembers. */
+static void*
+md_tree_alloc(const MD_ALLOCATOR* allocator, size_t size)
+{
+    return (allocator != NULL ? allocator->alloc(size, allocator->allocator_data) : malloc(size));
+}
+
+static void
+md_tree_free(const MD_ALLOCATOR* allocator, void* ptr)
+{
+    if(allocator != NULL)
+        allocator->release(ptr, allocator->allocator_data);
+    else
+        free(ptr);
+}
+
+static const CHAR*
+md_tree_ptr(const MD_TREE* tree, OFF off)
+{
+    return (off < tree->size ? tree->text + off : tree->strings + (off - tree->size));
+}
+
+static void
+md_tree_get_attr(const MD_TREE* tree, SZ index, MD_ATTRIBUTE* attr)
+{
+    const MD_TREE_ATTR* a = &tree->attrs[index];
+
+    attr->text = (a->size > 0 ? md_tree_ptr(tree, a->off) : NULL);
+    attr->size = a->size;
+    if(a->substr != MD_TREE_NO_SUBSTRS) {
+        attr->substr_types = tree->substr_types + a->substr;
+        attr->substr_offsets = tree->substr_offsets + a->substr;
+    } else {
+        attr->substr_types = NULL;
+        attr->substr_offsets = NULL;
+    }
+}
+
+/* Fill the detail of the node. Returns size of the detail structure, or zero
+ * if the node type has none. */
+static size_t
+md_tree_get_detail(const MD_TREE* tree, const MD_NODE* node, MD_TREE_DETAIL* det)
+{
+    if(node->kind == MD_NODE_BLOCK) {
+        switch(node->type) {
+            case MD_BLOCK_UL:
+                det->ul.is_tight = (int) node->size;
+                det->ul.mark = (CHAR) node->data;
+                return sizeof(MD_BLOCK_UL_DETAIL);
+
+            case MD_BLOCK_OL:
+                det->ol.start = (unsigned) node->off;
+                det->ol.is_tight = (int) node->size;
+                det->ol.mark_delimiter = (CHAR) node->data;
+                return sizeof(MD_BLOCK_OL_DETAIL);
+
+            case MD_BLOCK_LI:
+                det->li.is_task = (int) node->size;
+                det->li.task_mark = (CHAR) node->data;
+                det->li.task_mark_offset = node->off;
+                return sizeof(MD_BLOCK_LI_DETAIL);
+
+            case MD_BLOCK_H:
+                det->h.level = node->data;
+                return sizeof(MD_BLOCK_H_DETAIL);
+
+            case MD_BLOCK_CODE:
+                md_tree_get_attr(tree, node->off, &det->code.info);
+                md_tree_get_attr(tree, node->off + 1, &det->code.lang);
+                det->code.fence_char = (CHAR) node->data;
+                return sizeof(MD_BLOCK_CODE_DETAIL);
+
+            case MD_BLOCK_TABLE:
+                det->table.col_count = (unsigned) node->off;
+                det->table.head_row_count = node->data;
+                det->table.body_row_count = (unsigned) node->size;
+                return sizeof(MD_BLOCK_TABLE_DETAIL);
+
+            case MD_BLOCK_TH:
+            case MD_BLOCK_TD:
+                det->td.align = (MD_ALIGN) node->data;
+                return sizeof(MD_BLOCK_TD_DETAIL);
+
+            default:
+                return 0;
+        }
+    }
+
+    if(node->kind == MD_NODE_SPAN) {
+        switch(node->type) {
+            case MD_SPAN_A:
+            case MD_SPAN_A_SELF:
+            case MD_SPAN_A_CODELINK:
+            case MD_SPAN_IMG:
+                md_tree_get_attr(tree, node->off, &det->a.href);
+                md_tree_get_attr(tree, node->off + 1, &det->a.title);
+                return sizeof(MD_SPAN_A_DETAIL);
+
+            case MD_SPAN_WIKILINK:
+                md_tree_get_attr(tree, node->off, &det->wikilink.target);
+                return sizeof(MD_SPAN_WIKILINK_DETAIL);
+
+            default:
+                return 0;
+        }
+    }
+
+    return 0;
+}
+
+static int
+md_tree_replay_node(const MD_TREE* tree, const MD_NODE* node, int enter,
+                    const MD_PARSER* parser, void* userdata)
+{
+    MD_TREE_DETAIL det;
+    void* detail;
+
+    if(node->kind == MD_NODE_TEXT) {
+        return parser->text((MD_TEXTTYPE) node->type, md_tree_ptr(tree, node->off),
+                            node->size, userdata);
+    }
+
+    detail = (md_tree_get_detail(tree, node, &det) > 0 ? (void*) &det : NULL);
+    if(node->kind == MD_NODE_BLOCK) {
+        if(enter)
+            return parser->enter_block((MD_BLOCKTYPE) node->type, detail, userdata);
+        else
+            return parser->leave_block((MD_BLOCKTYPE) node->type, detail, userdata);
+    } else {
+        if(enter)
+            return parser->enter_span((MD_SPANTYPE) node->type, detail, userdata);
+        else
+            return parser->leave_span((MD_SPANTYPE) node->type, detail, userdata);
+    }
+}
+
+int
+md_parse_tree(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, MD_TREE** p_tree)
+{
+    MD_CTX ctx;
+    MD_PARSER parser_copy;
+    MD_TREE_BUILD build;
+    int ret;
+
+    *p_tree = NULL;
+    if(md_copy_parser(&parser_copy, parser) != 0)
+        return -1;
+
+    parser_copy.enter_block = md_tree_enter_block;
+    parser_copy.leave_block = md_tree_leave_block;
+    parser_copy.enter_span = md_tree_enter_span;
+    parser_copy.leave_span = md_tree_leave_span;
+    parser_copy.text = md_tree_text_callback;
+    parser_copy.debug_log = NULL;
+
+    md_setup_ctx(&ctx, &parser_copy);
+    md_reset_ctx(&ctx, text, size, (void*) &build);
+    memset(&build, 0, sizeof(MD_TREE_BUILD));
+    build.ctx = &ctx;
+
+    ret = md_process_doc(&ctx);
+    if(ret == 0)
+        ret = md_tree_finish(&build, p_tree);
+
+    md_tree_build_free(&build);
+    md_finish_ctx(&ctx);
+    md_release_ctx_buffers(&ctx);
+    return ret;
+}
+
+const MD_NODE*
+md_tree_root(const MD_TREE* tree)
+{
+    return tree->nodes;
+}
+
+const MD_CHAR*
+md_tree_text(const MD_TREE* tree, const MD_NODE* node, MD_SIZE* p_size)
+{
+    if(node->kind != MD_NODE_TEXT)
+        return NULL;
+
+    *p_size = node->size;
+    return md_tree_ptr(tree, node->off);
+}
+
+int
+md_tree_detail(const MD_TREE* tree, const MD_NODE* node, void* detail)
+{
+    MD_TREE_DETAIL det;
+    size_t size;
+
+    size = md_tree_get_detail(tree, node, &det);
+    if(size == 0)
+        return -1;
+
+    memcpy(detail, &det, size);
+    return 0;
+}
+
+int
+md_tree_replay(const MD_TREE* tree, const MD_PARSER* parser, void* userdata)
+{
+    /* Indexes of the open blocks and spans. Most documents are shallow enough
+     * to do without any allocation. */
+    SZ local_open[32];
+    SZ* open = local_open;
+    SZ n_open = 0;
+    SZ n_nodes = tree->nodes[0].n_nodes;
+    SZ i;
+    int ret = 0;
+
+    if(tree->max_depth > SIZEOF_ARRAY(local_open)) {
+        open = (SZ*) md_tree_alloc(tree->allocator, (size_t) tree->max_depth * sizeof(SZ));
+        if(open == NULL)
+            return -1;
+    }
+
+    for(i = 0; i < n_nodes; i++) {
+        const MD_NODE* node = &tree->nodes[i];
+
+        ret = md_tree_replay_node(tree, node, TRUE, parser, userdata);
+        if(ret != 0)
+            goto abort;
+        if(node->kind != MD_NODE_TEXT)
+            open[n_open++] = i;
+
+        /* Leave all the nodes ending here. */
+        while(n_open > 0  &&  open[n_open-1] + tree->nodes[open[n_open-1]].n_nodes == i + 1) {
+            ret = md_tree_replay_node(tree, &tree->nodes[open[--n_open]], FALSE, parser, userdata);
+            if(ret != 0)
+                goto abort;
+        }
+    }
+
+abort:
+    if(open != local_open)
+        md_tree_free(tree->allocator, open);
+    return ret;
+}
+
+void
+md_tree_destroy(MD_TREE* tree)
+{
+    if(tree == NULL)
+        return;
+
+    md_tree_free(tree->allocator, tree);
+}
+
+
+/* Saved tree (see md_tree_save()) starts with this header, followed by the
+ * arrays of the tree, each of them aligned to 8 bytes: nodes, attrs,
+ * substr_offsets, substr_types, strings and (with MD_TREE_SAVE_TEXT) the
+ * document.
+ *
+ * The members up to flags are bytes, so md_tree_load() can check them
+ * before it knows the rest of the header has the same layout as its own. */
+#define MD_TREE_BLOB_MAGIC          "MD4CTREE"
+#define MD_TREE_BLOB_VERSION        1
+#define MD_TREE_BLOB_BYTE_ORDER     0x01020304U
+#define MD_TREE_BLOB_ALIGN(size)    (((size) + 7) & ~((size_t) 7))
+
+typedef struct MD_TREE_BLOB_tag MD_TREE_BLOB;
+struct MD_TREE_BLOB_tag {
+    char magic[8];
+    unsigned char version;
+    unsigned char char_size;
+    unsigned char off_size;
+    unsigned char texttype_size;
+    unsigned char node_size;
+    unsigned char attr_size;
+    unsigned char flags;
+    unsigned char reserved;
+    unsigned byte_order;
+    SZ size;
+    SZ max_depth;
+    SZ n_nodes;
+    SZ n_attrs;
+    SZ n_substrs;
+    SZ n_strings;
+};
+
+/* Sizes of the sections of the blob, in the order they are stored. */
+#define MD_TREE_BLOB_SECTIONS       7
+
+static void
+md_tree_blob_sections(const MD_TREE_BLOB* hdr, size_t* sections)
+{
+    sections[0] = MD_TREE_BLOB_ALIGN(sizeof(MD_TREE_BLOB));
+    sections[1] = MD_TREE_BLOB_ALIGN((size_t) hdr->n_nodes * sizeof(MD_NODE));
+    sections[2] = MD_TREE_BLOB_ALIGN((size_t) hdr->n_attrs * sizeof(MD_TREE_ATTR));
+    sections[3] = MD_TREE_BLOB_ALIGN((size_t) hdr->n_substrs * sizeof(OFF));
+    sections[4] = MD_TREE_BLOB_ALIGN((size_t) hdr->n_substrs * sizeof(MD_TEXTTYPE));
+    sections[5] = MD_TREE_BLOB_ALIGN((size_t) hdr->n_strings * sizeof(CHAR));
+    sections[6] = ((hdr->flags & MD_TREE_SAVE_TEXT) ? MD_TREE_BLOB_ALIGN((size_t) hdr->size * sizeof(CHAR)) : 0);
+}
+
+static void
+md_tree_blob_header(const MD_TREE* tree, unsigned flags, MD_TREE_BLOB* hdr)
+{
+    memset(hdr, 0, sizeof(MD_TREE_BLOB));
+    memcpy(hdr->magic, MD_TREE_BLOB_MAGIC, sizeof(hdr->magic));
+    hdr->version = MD_TREE_BLOB_VERSION;
+    hdr->char_size = sizeof(CHAR);
+    hdr->off_size = sizeof(OFF);
+    hdr->texttype_size = sizeof(MD_TEXTTYPE);
+    hdr->node_size = sizeof(MD_NODE);
+    hdr->attr_size = sizeof(MD_TREE_ATTR);
+    hdr->flags = (unsigned char) (flags & MD_TREE_SAVE_TEXT);
+    hdr->byte_order = MD_TREE_BLOB_BYTE_ORDER;
+    hdr->size = tree->size;
+    hdr->max_depth = tree->max_depth;
+    hdr->n_nodes = tree->nodes[0].n_nodes;
+    hdr->n_attrs = tree->n_attrs;
+    hdr->n_substrs = tree->n_substrs;
+    hdr->n_strings = tree->n_strings;
+}
+
+/* Copy the data into the blob, and zero the padding after it so the blob
+ * does not depend on what the buffer contained before. */
+static char*
+md_tree_blob_put(char* ptr, const void* data, size_t size, size_t section_size)
+{
+    if(size > 0)
+        memcpy(ptr, data, size);
+    memset(ptr + size, 0, section_size - size);
+    return ptr + section_size;
+}
+
+size_t
+md_tree_save_size(const MD_TREE* tree, unsigned flags)
+{
+    MD_TREE_BLOB hdr;
+    size_t sections[MD_TREE_BLOB_SECTIONS];
+    size_t blob_size = 0;
+    int i;
+
+    md_tree_blob_header(tree, flags, &hdr);
+    md_tree_blob_sections(&hdr, sections);
+    for(i = 0; i < MD_TREE_BLOB_SECTIONS; i++)
+        blob_size += sections[i];
+    return blob_size;
+}
+
+void
+md_tree_save(const MD_TREE* tree, unsigned flags, void* blob)
+{
+    MD_TREE_BLOB hdr;
+    size_t sections[MD_TREE_BLOB_SECTIONS];
+    char* ptr = (char*) blob;
+
+    md_tree_blob_header(tree, flags, &hdr);
+    md_tree_blob_sections(&hdr, sections);
+
+    ptr = md_tree_blob_put(ptr, &hdr, sizeof(MD_TREE_BLOB), sections[0]);
+    ptr = md_tree_blob_put(ptr, tree->nodes, (size_t) hdr.n_nodes * sizeof(MD_NODE), sections[1]);
+    ptr = md_tree_blob_put(ptr, tree->attrs, (size_t) hdr.n_attrs * sizeof(MD_TREE_ATTR), sections[2]);
+    ptr = md_tree_blob_put(ptr, tree->substr_offsets, (size_t) hdr.n_substrs * sizeof(OFF), sections[3]);
+    ptr = md_tree_blob_put(ptr, tree->substr_types, (size_t) hdr.n_substrs * sizeof(MD_TEXTTYPE), sections[4]);
+    ptr = md_tree_blob_put(ptr, tree->strings, (size_t) hdr.n_strings * sizeof(CHAR), sections[5]);
+    if(flags & MD_TREE_SAVE_TEXT)
+        md_tree_blob_put(ptr, tree->text, (size_t) hdr.size * sizeof(CHAR), sections[6]);
+}
+
+/* Check the text is either all in the document, or all in the strings. */
+static int
+md_tree_check_text(const MD_TREE* tree, OFF off, SZ size)
+{
+    if(off < tree->size)
+        return (size <= tree->size - off ? 0 : -1);
+    if(off - tree->size > tree->n_strings)
+        return -1;
+    return (size <= tree->n_strings - (off - tree->size) ? 0 : -1);
+}
+
+/* Check the attributes attrs[index] ... attrs[index + n - 1] refer only to
+ * the text and to the substrings the tree has. */
+static int
+md_tree_check_attrs(const MD_TREE* tree, SZ index, SZ n)
+{
+    SZ i, j;
+
+    if(index > tree->n_attrs  ||  n > tree->n_attrs - index)
+        return -1;
+
+    for(i = index; i < index + n; i++) {
+        const MD_TREE_ATTR* a = &tree->attrs[i];
+
+        if(a->size > 0  &&  md_tree_check_text(tree, a->off, a->size) != 0)
+            return -1;
+        if(a->substr == MD_TREE_NO_SUBSTRS)
+            continue;
+
+        /* The substrings are ascending offsets terminated with the size of
+         * the attribute. */
+        if(a->substr >= tree->n_substrs  ||  tree->substr_offsets[a->substr] != 0)
+            return -1;
+        for(j = a->substr; tree->substr_offsets[j] < a->size; j++) {
+            if(j + 1 >= tree->n_substrs  ||  tree->substr_offsets[j+1] <= tree->substr_offsets[j]  ||
+               tree->substr_types[j] > MD_TEXT_LATEXMATH)
+                return -1;
+        }
+        if(tree->substr_offsets[j] != a->size)
+            return -1;
+    }
+
+    return 0;
+}
+
+/* Check the details of a block node (see MD_TREE_DETAIL) have only values
+ * the parser can produce: Renderers use some of them as array indexes. */
+static int
+md_tree_check_block(const MD_TREE* tree, const MD_NODE* node)
+{
+    switch(node->type) {
+        case MD_BLOCK_UL:
+            return ((node->data == _T('-')  ||  node->data == _T('+')  ||  node->data == _T('*'))  &&
+                    node->size <= 1 ? 0 : -1);
+
+        case MD_BLOCK_OL:
+            return ((node->data == _T('.')  ||  node->data == _T(')'))  &&
+                    node->size <= 1 ? 0 : -1);
+
+        case MD_BLOCK_LI:
+            if(node->size == 0)
+                return (node->data == 0 ? 0 : -1);
+            return ((node->data == _T('x')  ||  node->data == _T('X')  ||  node->data == _T(' '))  &&
+                    node->size == 1  &&  node->off < tree->size ? 0 : -1);
+
+        case MD_BLOCK_H:
+            return (node->data >= 1  &&  node->data <= 6 ? 0 : -1);
+
+        case MD_BLOCK_CODE:
+            if(node->data != 0  &&  node->data != _T('`')  &&  node->data != _T('~'))
+                return -1;
+            return md_tree_check_attrs(tree, node->off, 2);
+
+        case MD_BLOCK_TH:
+        case MD_BLOCK_TD:
+            return (node->data <= MD_ALIGN_RIGHT ? 0 : -1);
+
+        default:
+            return 0;
+    }
+}
+
+/* Check the loaded tree is consistent, so neither md_tree_replay() nor an
+ * application walking the nodes may get out of the arrays. */
+static int
+md_tree_check(const MD_TREE* tree, SZ* open)
+{
+    SZ n_nodes = tree->nodes[0].n_nodes;
+    SZ n_open = 0;
+    SZ i;
+
+    if(tree->nodes[0].kind != MD_NODE_BLOCK  ||  tree->nodes[0].type != MD_BLOCK_DOC)
+        return -1;
+
+    for(i = 0; i < n_nodes; i++) {
+        const MD_NODE* node = &tree->nodes[i];
+        SZ end;
+
+        /* Every node has to fit into its parent. */
+        while(n_open > 0  &&  open[n_open-1] + tree->nodes[open[n_open-1]].n_nodes <= i)
+            n_open--;
+        if(i > 0  &&  n_open == 0)
+            return -1;
+        end = (n_open > 0 ? open[n_open-1] + tree->nodes[open[n_open-1]].n_nodes : n_nodes);
+        if(node->n_nodes == 0  ||  node->n_nodes > end - i)
+            return -1;
+
+        switch(node->kind) {
+            case MD_NODE_BLOCK:
+                if(node->type > MD_BLOCK_TD  ||  (node->type == MD_BLOCK_DOC  &&  i > 0))
+                    return -1;
+                if(md_tree_check_block(tree, node) != 0)
+                    return -1;
+                break;
+
+            case MD_NODE_SPAN:
+                switch(node->type) {
+                    case MD_SPAN_A:
+                    case MD_SPAN_A_SELF:
+                    case MD_SPAN_A_CODELINK:
+                    case MD_SPAN_IMG:
+                        if(md_tree_check_attrs(tree, node->off, 2) != 0)
+                            return -1;
+                        break;
+                    case MD_SPAN_WIKILINK:
+                        if(md_tree_check_attrs(tree, node->off, 1) != 0)
+                            return -1;
+                        break;
+                    default:
+                        if(node->type > MD_SPAN_U)
+                            return -1;
+                        break;
+                }
+                break;
+
+            case MD_NODE_TEXT:
+                if(node->type > MD_TEXT_LATEXMATH  ||  node->n_nodes != 1  ||
+                   md_tree_check_text(tree, node->off, node->size) != 0)
+                    return -1;
+                break;
+
+            default:
+                return -1;
+        }
+
+        if(node->kind != MD_NODE_TEXT) {
+            if(n_open >= tree->max_depth)
+                return -1;
+            open[n_open++] = i;
+        }
+    }
+
+    return 0;
+}
+
+int
+md_tree_load(const void* blob, size_t blob_size, const MD_CHAR* text, MD_SIZE size,
+             const MD_ALLOCATOR* allocator, MD_TREE** p_tree)
+{
+    const MD_TREE_BLOB* hdr = (const MD_TREE_BLOB*) blob;
+    size_t sections[MD_TREE_BLOB_SECTIONS];
+    size_t total = 0;
+    const char* ptr;
+    MD_TREE* tree;
+    SZ* open;
+    int i;
+    int ret;
+
+    *p_tree = NULL;
+
+    /* Check the blob comes from a compatible build. */
+    if(((size_t) blob) % 8 != 0  ||  blob_size < offsetof(MD_TREE_BLOB, byte_order))
+        return -1;
+    if(memcmp(hdr->magic, MD_TREE_BLOB_MAGIC, sizeof(hdr->magic)) != 0  ||
+       hdr->version != MD_TREE_BLOB_VERSION  ||
+       hdr->char_size != sizeof(CHAR)  ||  hdr->off_size != sizeof(OFF)  ||
+       hdr->texttype_size != sizeof(MD_TEXTTYPE)  ||  hdr->node_size != sizeof(MD_NODE)  ||
+       hdr->attr_size != sizeof(MD_TREE_ATTR)  ||  (hdr->flags & ~MD_TREE_SAVE_TEXT) != 0)
+        return -1;
+    if(blob_size < sizeof(MD_TREE_BLOB)  ||  hdr->byte_order != MD_TREE_BLOB_BYTE_ORDER)
+        return -1;
+
+    /* Check the sections fit into the blob (without overflowing size_t on
+     * the way). */
+    if(hdr->n_nodes == 0  ||  hdr->n_nodes > blob_size / sizeof(MD_NODE)  ||
+       hdr->n_attrs > blob_size / sizeof(MD_TREE_ATTR)  ||
+       hdr->n_substrs > blob_size / sizeof(OFF)  ||
+       hdr->n_strings > blob_size / sizeof(CHAR)  ||
+       ((hdr->flags & MD_TREE_SAVE_TEXT)  &&  hdr->size > blob_size / sizeof(CHAR))  ||
+       hdr->max_depth > hdr->n_nodes)
+        return -1;
+    md_tree_blob_sections(hdr, sections);
+    for(i = 0; i < MD_TREE_BLOB_SECTIONS; i++)
+        total += sections[i];
+    if(total != blob_size)
+        return -1;
+
+    if(!(hdr->flags & MD_TREE_SAVE_TEXT)  &&  (size != hdr->size  ||  (text == NULL  &&  size > 0)))
+        return -1;
+
+    tree = (MD_TREE*) md_tree_alloc(allocator, sizeof(MD_TREE));
+    if(tree == NULL)
+        return -1;
+
+    ptr = (const char*) blob + sections[0];
+    tree->allocator = allocator;
+    tree->size = hdr->size;
+    tree->max_depth = hdr->max_depth;
+    tree->n_attrs = hdr->n_attrs;
+    tree->n_substrs = hdr->n_substrs;
+    tree->n_strings = hdr->n_strings;
+    tree->nodes = (const MD_NODE*) ptr;
+    ptr += sections[1];
+    tree->attrs = (const MD_TREE_ATTR*) ptr;
+    ptr += sections[2];
+    tree->substr_offsets = (const OFF*) ptr;
+    ptr += sections[3];
+    tree->substr_types = (const MD_TEXTTYPE*) ptr;
+    ptr += sections[4];
+    tree->strings = (const CHAR*) ptr;
+    ptr += sections[5];
+    tree->text = ((hdr->flags & MD_TREE_SAVE_TEXT) ? (const CHAR*) ptr : text);
+
+    if(tree->nodes[0].n_nodes != hdr->n_nodes) {
+        md_tree_free(allocator, tree);
+        return -1;
+    }
+
+    open = (SZ*) md_tree_alloc(allocator, ((size_t) tree->max_depth + 1) * sizeof(SZ));
+    if(open == NULL) {
+        md_tree_free(allocator, tree);
+        return -1;
+    }
+    ret = md_tree_check(tree, open);
+    md_tree_free(allocator, open);
+    if(ret != 0) {
+        md_tree_free(allocator, tree);
+        return -1;
+    }
+
+    *p_tree = tree;
+    return 0;
 }
@@ -26,6 +26,8 @@
 #ifndef MD4C_H
 #define MD4C_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
     extern "C" {
 #endif
@@ -44,8 +46,20 @@
     typedef char            MD_CHAR;
 #endif
 
-typedef unsigned MD_SIZE;
-typedef unsigned MD_OFFSET;
+/* Sizes and offsets into the document. By default these are 32-bit, which
+ * limits the document size to 4 GiB. When md4c (and any code including this
+ * header) is built with MD4C_LARGE_DOCUMENTS, they are as wide as size_t.
+ *
+ * Note that even then the count of lines in a single block (e.g. paragraph
+ * or code block) and the size of a link title are limited to INT_MAX.
+ */
+#ifdef MD4C_LARGE_DOCUMENTS
+    typedef size_t          MD_SIZE;
+    typedef size_t          MD_OFFSET;
+#else
+    typedef unsigned        MD_SIZE;
+    typedef unsigned        MD_OFFSET;
+#endif
 
 
 /* Block represents a part of document hierarchy structure like a paragraph
@@ -326,6 +340,7 @@ typedef struct MD_SPAN_WIKILINK {
 #define MD_FLAG_UNDERLINE                   0x4000  /* Enable underline extension (and disables '_' for normal emphasis). */
 #define MD_FLAG_HEADERSELFLINKS             0x8000  /* Have ATX headers generate into a link to themselves. */
 #define MD_FLAG_CODELINKS                  0x10000  /* Code paths as links with []($code::path::here). */
+#define MD_FLAG_REFDEFSFIRST               0x20000  /* With md_parser_feed(), assume link reference definitions precede their uses. */
 
 #define MD_FLAG_PERMISSIVEAUTOLINKS         (MD_FLAG_PERMISSIVEEMAILAUTOLINKS | MD_FLAG_PERMISSIVEURLAUTOLINKS | MD_FLAG_PERMISSIVEWWWAUTOLINKS)
 #define MD_FLAG_NOHTML                      (MD_FLAG_NOHTMLBLOCKS | MD_FLAG_NOHTMLSPANS)
@@ -342,10 +357,62 @@ typedef struct MD_SPAN_WIKILINK {
 #define MD_DIALECT_COMMONMARK               0
 #define MD_DIALECT_GITHUB                   (MD_FLAG_PERMISSIVEAUTOLINKS | MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | MD_FLAG_TASKLISTS | MD_FLAG_HEADERSELFLINKS)
 
+/* Memory allocator.
+ *
+ * By default, MD4C uses malloc(), realloc() and free() from the standard C
+ * library. Application may provide its own allocator via MD_PARSER::allocator.
+ *
+ * The callbacks have the same semantics as their standard C library
+ * counterparts. The last argument, 'allocator_data', is just propagated from
+ * MD_ALLOCATOR::allocator_data.
+ */
+typedef struct MD_ALLOCATOR {
+    void* (*alloc)(size_t /*size*/, void* /*allocator_data*/);
+    void* (*resize)(void* /*ptr*/, size_t /*size*/, void* /*allocator_data*/);
+    void (*release)(void* /*ptr*/, void* /*allocator_data*/);
+
+    void* allocator_data;
+} MD_ALLOCATOR;
+
+/* Statistics about parsing of one document. See MD_PARSER::stats.
+ *
+ * The times are in seconds. Some of them nest: callback_time is also part of
+ * the time of the phase which has called the callbacks (mostly inline_time),
+ * and mark_collect_time with mark_analysis_time is spent on each leaf block
+ * before its inline_time. With parallel processing (md_parser_set_parallel()),
+ * the times of all the threads are summed.
+ */
+typedef struct MD_PARSE_STATS {
+    double line_analysis_time;      /* Analysis of the lines. */
+    double block_build_time;        /* Building blocks out of the lines. */
+    double ref_def_time;            /* Building the hashtable of link ref. defs. */
+    double mark_collect_time;       /* Collecting the inline marks. */
+    double mark_analysis_time;      /* Resolving the marks (links, emphasis, ...). */
+    double inline_time;             /* Emitting the spans and the text. */
+    double callback_time;           /* Inside the MD_PARSER callbacks. */
+
+    unsigned n_lines;
+    unsigned n_blocks;              /* Including the container blocks. */
+    unsigned n_marks;
+    unsigned n_rollbacks;           /* Of the mark analysis. */
+    unsigned n_ref_def_lookups;
+    unsigned n_allocs;              /* Heap allocations, including reallocations. */
+    unsigned n_arena_allocs;
+    unsigned n_callbacks;
+} MD_PARSE_STATS;
+
+/* Version of the MD_PARSER structure layout. See MD_PARSER::abi_version.
+ */
+#define MD_PARSER_ABI_VERSION               2
+
 /* Parser structure.
  */
 typedef struct MD_PARSER {
-    /* Reserved. Set to zero.
+    /* Version of the structure layout. Set either to zero, or to
+     * MD_PARSER_ABI_VERSION when using any members documented to require it.
+     *
+     * Zero means the structure ends with the member 'syntax', i.e. it is the
+     * same as in MD4C versions which did not have the versioning yet.
      */
     unsigned abi_version;
 
@@ -388,6 +455,26 @@ typedef struct MD_PARSER {
     /* Reserved. Set to NULL.
      */
     void (*syntax)(void);
+
+    /* Memory allocator. Optional (may be NULL).
+     *
+     * If NULL, the standard C library is used. The allocator has to outlive
+     * any parsing using it (including any MD_PARSER_CTX created for it).
+     *
+     * Requires abi_version >= 1.
+     */
+    const MD_ALLOCATOR* allocator;
+
+    /* Parsing statistics. Optional (may be NULL).
+     *
+     * The structure is zeroed whenever parsing of a document begins (or an
+     * edit with md_parser_edit()). If md4c is built with MD4C_ENABLE_STATS,
+     * it is then filled as the document is parsed. Otherwise it stays zeroed,
+     * and the parser does not spend any time on it.
+     *
+     * Requires abi_version >= 2.
+     */
+    MD_PARSE_STATS* stats;
 } MD_PARSER;
 
 
@@ -408,6 +495,263 @@ typedef MD_PARSER MD_RENDERER;
 int md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
 
 
+/* Reusable parser context.
+ *
+ * md_parse() sets up all its internal structures from scratch for every
+ * document and releases them when it is done. Applications parsing many
+ * documents with the same MD_PARSER may instead create a parser context once
+ * and then use it for all the documents: The context keeps its internal
+ * buffers (grown as needed by the largest document parsed so far) as well as
+ * all data derived from MD_PARSER::flags, so parsing of subsequent documents
+ * mostly avoids any memory (re)allocations.
+ *
+ * The context is not thread-safe. Use one context per thread.
+ */
+typedef struct MD_PARSER_CTX_tag MD_PARSER_CTX;
+
+/* Create a parser context. The MD_PARSER structure is copied into the
+ * context so it does not need to outlive this call.
+ *
+ * NULL is returned on failure.
+ */
+MD_PARSER_CTX* md_parser_create(const MD_PARSER* parser);
+
+/* Set the upper limit (in bytes) of memory the context may keep allocated
+ * between the documents. If parsing of a document makes the buffers grow
+ * beyond the limit, they are released when md_parser_parse() returns.
+ *
+ * Zero (the default) means no limit.
+ */
+void md_parser_set_retain_limit(MD_PARSER_CTX* ctx, size_t max_bytes);
+
+/* Same as md_parse() but it uses the given context.
+ */
+int md_parser_parse(MD_PARSER_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata);
+
+/* Streaming input.
+ *
+ * Instead of passing the whole document to md_parser_parse(), the application
+ * may pass it in arbitrary chunks to md_parser_feed() as they become available
+ * and then call md_parser_finish() at the end of the document.
+ *
+ * The callbacks are called as soon as possible: Whenever a top-level block
+ * (e.g. a paragraph, or a whole list) is known to be complete, it is reported
+ * during the md_parser_feed() call. The one exception is a block containing a
+ * link label which is not defined (yet) and which may still become a reference
+ * link (i.e. it is not followed by an inline link destination "(...)", nor it
+ * is a wiki link "[[...]]"): As a link reference definition can appear
+ * anywhere in the document, such block (and everything after it) is held back
+ * until the label gets defined, or until md_parser_finish().
+ * Applications which know their documents define all the labels before using
+ * them may use MD_FLAG_REFDEFSFIRST to avoid the holding back. (Any link to
+ * a label defined only later is then rendered as a normal text.)
+ *
+ * Without MD_FLAG_REFDEFSFIRST, the result is exactly the same as with
+ * md_parser_parse() and the whole document.
+ *
+ * The context keeps a copy of the whole document until md_parser_finish().
+ * The userdata are propagated to the callbacks called from the respective
+ * call. The return values have the same meaning as for md_parse(). If any
+ * call fails, the document is abandoned; a next md_parser_feed() then starts
+ * a new document.
+ */
+int md_parser_feed(MD_PARSER_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata);
+int md_parser_finish(MD_PARSER_CTX* ctx, void* userdata);
+
+/* Incremental re-parse (e.g. for live preview in an editor).
+ *
+ * md_parser_load() parses the document the same way as md_parser_parse(),
+ * but the context keeps a copy of it together with the positions of its
+ * top-level blocks.
+ *
+ * md_parser_edit() then replaces removed_size characters at the offset off
+ * with the given text (size characters), and re-parses only the part of the
+ * document around the edit: It starts at the nearest preceding boundary
+ * between top-level blocks and stops as soon as the parsing gets back in sync
+ * with the previous document. The callbacks are called only for the top-level
+ * blocks in that part (there is no MD_BLOCK_DOC), and *result tells the
+ * application which of the old top-level blocks they replace.
+ *
+ * If the edit changes the set of link reference definitions, any link in the
+ * document may change. In that case, all top-level blocks are re-parsed and
+ * reported, and MD_EDIT_RESULT::is_full is set. (Rarely, the whole document
+ * is also re-parsed to release memory which the previous edits of multi-line
+ * link reference definitions have left behind.)
+ *
+ * Any state kept by the callbacks across the blocks (e.g. counters of headers)
+ * is up to the application.
+ *
+ * The return values have the same meaning as for md_parse(). If any call
+ * fails, the document is unloaded and md_parser_edit() fails until the next
+ * md_parser_load(). Also md_parser_parse(), md_parser_feed() and
+ * md_parser_reset() unload the document.
+ */
+typedef struct MD_EDIT_RESULT {
+    unsigned first_block;       /* Index of the first replaced top-level block. */
+    unsigned n_removed_blocks;  /* Count of the replaced top-level blocks. */
+    unsigned n_added_blocks;    /* Count of the top-level blocks reported instead. */
+    int is_full;                /* Non-zero if the whole document has been re-parsed. */
+} MD_EDIT_RESULT;
+
+int md_parser_load(MD_PARSER_CTX* ctx, const MD_CHAR* text, MD_SIZE size, void* userdata);
+int md_parser_edit(MD_PARSER_CTX* ctx, MD_OFFSET off, MD_SIZE removed_size,
+                   const MD_CHAR* text, MD_SIZE size, MD_EDIT_RESULT* result, void* userdata);
+
+/* Parallel processing of large documents.
+ *
+ * Once the block structure of the document is known, the contents of the
+ * top-level blocks (inline spans, links etc.) can be processed independently
+ * of each other. With parallel processing enabled, md_parser_parse() splits
+ * the top-level blocks of a large document into consecutive ranges, and
+ * processes them on several threads at once.
+ *
+ * The application gets a chance to prepare a separate userdata for each range
+ * (e.g. a renderer with its own output buffer): begin_range() is called for
+ * all the ranges, in the order of the document, before the processing starts.
+ * The callbacks of MD_PARSER then get the userdata of the range they are
+ * called for, and they may be called from multiple threads at the same time.
+ * When all the ranges are processed, end_range() is called for each of them,
+ * again in the order of the document (e.g. to append the output of the range
+ * to the output of the document). Its param ret is the result of processing
+ * the range (zero on success) and it is called even if the processing has
+ * failed, so the application may release the range userdata.
+ *
+ * Both begin_range() and end_range() are called from the thread which has
+ * called md_parser_parse(), and so are the callbacks for MD_BLOCK_DOC.
+ * Non-zero return value of either of them aborts the parsing.
+ *
+ * Documents too small to be worth it are processed as usual, without any
+ * ranges.
+ */
+typedef struct MD_PARALLEL_CALLBACKS {
+    int (*begin_range)(unsigned /*index*/, void* /*userdata*/, void** /*p_range_userdata*/);
+    int (*end_range)(unsigned /*index*/, void* /*range_userdata*/, int /*ret*/, void* /*userdata*/);
+} MD_PARALLEL_CALLBACKS;
+
+/* Enable the parallel processing for md_parser_parse(), using up to n_threads
+ * threads (including the calling one). Zero or one (or NULL callbacks)
+ * disables it. Note MD_PARSER::allocator (if any) then has to be thread-safe.
+ *
+ * Returns -1 if md4c has been built without support for threads (and then
+ * the documents are still processed on the calling thread), 0 otherwise.
+ */
+int md_parser_set_parallel(MD_PARSER_CTX* ctx, unsigned n_threads, const MD_PARALLEL_CALLBACKS* callbacks);
+
+/* Release all the memory buffers kept by the context. The context stays
+ * valid and it may be used for parsing further documents. (Any unfinished
+ * streamed document is abandoned.)
+ */
+void md_parser_reset(MD_PARSER_CTX* ctx);
+
+/* Destroy the context.
+ */
+void md_parser_destroy(MD_PARSER_CTX* ctx);
+
+
+/* Document tree.
+ *
+ * md_parse_tree() parses the document like md_parse() but, instead of calling
+ * the callbacks, it records everything they would get in a compact tree. The
+ * application may then walk the tree as many times as it needs, and
+ * md_tree_replay() calls the callbacks of any MD_PARSER (e.g. of a renderer)
+ * from the tree, exactly as md_parse() would, without parsing again.
+ *
+ * Only the members flags, allocator and stats of the MD_PARSER are used by
+ * md_parse_tree(); the callbacks (including debug_log) are ignored. On
+ * success, the tree is returned via p_tree and 0 is returned; -1 on failure.
+ *
+ * All the nodes of the tree live in a single array, in pre-order: The first
+ * node is the MD_BLOCK_DOC, the first child of any node (if it has any)
+ * immediately follows it, and the next sibling follows the whole subtree of
+ * the node, i.e. it is at (node + node->n_nodes).
+ *
+ * The tree does not copy the text of the document, it refers to it by
+ * offsets. So the document must not be changed nor released as long as the
+ * tree is used. Neither may be the allocator (if any).
+ */
+typedef struct MD_TREE_tag MD_TREE;
+
+typedef enum MD_NODEKIND {
+    MD_NODE_BLOCK,
+    MD_NODE_SPAN,
+    MD_NODE_TEXT
+} MD_NODEKIND;
+
+typedef struct MD_NODE {
+    unsigned char kind;     /* MD_NODEKIND */
+    unsigned char type;     /* MD_BLOCKTYPE, MD_SPANTYPE or MD_TEXTTYPE (as per kind) */
+    unsigned short data;    /* Internal. */
+
+    /* Count of the nodes in the subtree, including this one. (For text, always 1.) */
+    MD_SIZE n_nodes;
+
+    /* For text, when off is less than the size of the document, the text is just
+     * the span of the document at this offset (so the application may also
+     * find where in the document it comes from). Otherwise, and for the other
+     * kinds of nodes, these are internal. Use md_tree_text() and
+     * md_tree_detail() to get the text and the details. */
+    MD_OFFSET off;
+    MD_SIZE size;
+} MD_NODE;
+
+int md_parse_tree(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, MD_TREE** p_tree);
+
+/* The root node (MD_BLOCK_DOC). */
+const MD_NODE* md_tree_root(const MD_TREE* tree);
+
+/* Get the text of a text node (NULL for other nodes). */
+const MD_CHAR* md_tree_text(const MD_TREE* tree, const MD_NODE* node, MD_SIZE* p_size);
+
+/* Fill the detail structure of the node (i.e. the structure documented for
+ * its type, e.g. MD_SPAN_A_DETAIL for MD_SPAN_A, which the callbacks get).
+ * Strings in the detail stay valid as long as the tree.
+ *
+ * Returns 0 on success, or -1 (and it does not touch *detail) if there is no
+ * detail structure for the node type.
+ */
+int md_tree_detail(const MD_TREE* tree, const MD_NODE* node, void* detail);
+
+/* Call the callbacks of the parser (with the userdata) for the whole tree.
+ * The leave callbacks get the same detail as the respective enter ones.
+ * The return values have the same meaning as for md_parse().
+ */
+int md_tree_replay(const MD_TREE* tree, const MD_PARSER* parser, void* userdata);
+
+void md_tree_destroy(MD_TREE* tree);
+
+/* Saving and loading the tree.
+ *
+ * md_tree_save() serializes the tree into a binary blob, and md_tree_load()
+ * turns such blob back into a tree (e.g. to render the document again with
+ * other renderer flags, without parsing it). The blob contains no pointers,
+ * so it may be stored in a file or a database. md_tree_load() does not copy
+ * it, the tree just refers to it, so it can be used directly from a mapped
+ * file. The blob must then outlive the tree, and it has to be aligned to at
+ * least 8 bytes (any memory from malloc() or mmap() is).
+ *
+ * By default, the blob refers to the text of the document only by offsets:
+ * The application keeps the document next to it, and passes it again to
+ * md_tree_load(). With MD_TREE_SAVE_TEXT, the blob includes a copy of the
+ * document, so it is self-contained (and md_tree_load() then ignores its
+ * params text and size).
+ *
+ * The format of the blob depends on the platform (byte order) and on the
+ * build of md4c (MD4C_USE_UTF16, MD4C_LARGE_DOCUMENTS), and it may change
+ * with md4c versions. md_tree_load() checks all that, as well as integrity
+ * of the blob, and fails (returns -1) if it cannot use it. Applications
+ * caching the blobs should then just parse the document again.
+ *
+ * md_tree_save_size() returns the size of the blob; md_tree_save() writes
+ * it into the buffer, which has to be that large.
+ */
+#define MD_TREE_SAVE_TEXT                   0x0001
+
+size_t md_tree_save_size(const MD_TREE* tree, unsigned flags);
+void md_tree_save(const MD_TREE* tree, unsigned flags, void* blob);
+int md_tree_load(const void* blob, size_t blob_size, const MD_CHAR* text, MD_SIZE size,
+                 const MD_ALLOCATOR* allocator, MD_TREE** p_tree);
+
+
 #ifdef __cplusplus
     }  /* extern "C" { */
 #endif
@@ -0,0 +1,341 @@
+/*
+ * MD4C: Markdown parser for C
+ * (http://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2020 Martin Mitas
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MD4C_SIMD_H
+#define MD4C_SIMD_H
+
+/* Searching for the first byte belonging to a set of bytes (e.g. the mark
+ * characters in md4c.c, or characters needing an escape in md4c-html.c).
+ *
+ * On x86 and x86-64, the search processes 16 (SSE2) or 32 (AVX2) bytes at a
+ * time. The best implementation is chosen at run time accordingly to CPU
+ * features. Everywhere else (or when built with MD4C_NO_SIMD), plain C is
+ * used.
+ *
+ * All the functions here are static, so this header is to be included only
+ * from the .c files which need it.
+ */
+
+#include <string.h>
+
+#if !defined MD4C_NO_SIMD
+    #if defined __x86_64__  ||  defined _M_X64  ||  (defined __i386__ && defined __SSE2__)
+        #define MD_SIMD_SSE2        1
+        #include <emmintrin.h>
+    #endif
+
+    #if defined MD_SIMD_SSE2  &&  ((defined __GNUC__ && __GNUC__ >= 5) || defined __clang__)
+        #define MD_SIMD_AVX2        1
+        #define MD_SIMD_AVX2_FUNC   __attribute__((target("avx2")))
+        #include <immintrin.h>
+    #elif defined MD_SIMD_SSE2  &&  defined _MSC_VER
+        #define MD_SIMD_AVX2        1
+        #define MD_SIMD_AVX2_FUNC
+        #include <immintrin.h>
+    #endif
+#endif
+
+#ifdef MD_SIMD_SSE2
+    #if defined __GNUC__
+        #define MD_SIMD_CTZ(x)      __builtin_ctz(x)
+    #elif defined _MSC_VER
+        #include <intrin.h>
+        static __inline unsigned md_simd_ctz_(unsigned x) { unsigned long i; _BitScanForward(&i, x); return i; }
+        #define MD_SIMD_CTZ(x)      md_simd_ctz_(x)
+    #endif
+#endif
+
+/* Max. count of distinct ASCII members for the SSE2 implementation, which
+ * compares the input against each member separately. */
+#define MD_SIMD_MAX_CHARS           24
+
+typedef struct MD_SIMD_CHARSET_tag MD_SIMD_CHARSET;
+struct MD_SIMD_CHARSET_tag {
+    /* Non-zero for all members of the set. This is used for the plain C
+     * implementation and for the tail of the input shorter than the vector. */
+    unsigned char map[256];
+
+    /* For the SSE2 implementation: List of all ASCII members. If there are
+     * too many of them, the SSE2 implementation is not used at all. */
+    unsigned char chars[MD_SIMD_MAX_CHARS];
+    unsigned n_chars;
+    int use_sse2;
+
+    /* For the AVX2 implementation: For each value of the low nibble, bitmask
+     * of those high nibbles which form an ASCII member of the set. */
+    unsigned char nibble_mask[16];
+
+    /* Non-zero if all bytes >= 0x80 are members. (If only some of them are,
+     * no vector implementation is used at all.) */
+    int high_bytes;
+    int use_avx2;
+};
+
+#ifdef MD_SIMD_SSE2
+
+/* Detected CPU capabilities: 0 == not yet detected; 1 == SSE2; 2 == AVX2.
+ * (We may race with another thread here but all of them store the same
+ * value anyway.) */
+static int md_simd_level_ = 0;
+
+static int
+md_simd_detect_level(void)
+{
+    int level = 1;
+
+#if defined MD_SIMD_AVX2  &&  defined _MSC_VER
+    int info[4];
+
+    __cpuid(info, 0);
+    if(info[0] >= 7) {
+        __cpuid(info, 1);
+        /* OSXSAVE and AVX, and the OS saves the YMM registers. */
+        if((info[2] & 0x18000000) == 0x18000000  &&  (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if(info[1] & 0x20)
+                level = 2;
+        }
+    }
+#elif defined MD_SIMD_AVX2
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+        level = 2;
+#endif
+
+    md_simd_level_ = level;
+    return level;
+}
+
+#define MD_SIMD_LEVEL()     (md_simd_level_ != 0 ? md_simd_level_ : md_simd_detect_level())
+
+/* Both implementations below expect size >= 16. Whenever the string is not a
+ * multiple of the vector size, the last vector is loaded so that it ends
+ * exactly at the end of the string (i.e. it overlaps with the previous one),
+ * and the bits for the already examined bytes are shifted out of the mask.
+ * This is cheaper than finishing the string byte by byte: Most strings we are
+ * given are lines of a text, i.e. rather short.
+ */
+
+static inline unsigned
+md_simd_mask_sse2(const MD_SIMD_CHARSET* set, const __m128i* chars, __m128i data)
+{
+    __m128i hit = (set->high_bytes ? _mm_cmplt_epi8(data, _mm_setzero_si128())
+                                   : _mm_setzero_si128());
+    unsigned i;
+
+    for(i = 0; i < set->n_chars; i++)
+        hit = _mm_or_si128(hit, _mm_cmpeq_epi8(data, chars[i]));
+
+    return (unsigned) _mm_movemask_epi8(hit);
+}
+
+static size_t
+md_simd_find_sse2(const MD_SIMD_CHARSET* set, const unsigned char* str, size_t size)
+{
+    __m128i chars[MD_SIMD_MAX_CHARS];
+    unsigned i;
+    unsigned mask;
+    size_t off = 0;
+
+    for(i = 0; i < set->n_chars; i++)
+        chars[i] = _mm_set1_epi8((char) set->chars[i]);
+
+    while(off + 16 <= size) {
+        mask = md_simd_mask_sse2(set, chars, _mm_loadu_si128((const __m128i*) (str + off)));
+        if(mask != 0)
+            return off + MD_SIMD_CTZ(mask);
+        off += 16;
+    }
+
+    if(off < size) {
+        mask = md_simd_mask_sse2(set, chars, _mm_loadu_si128((const __m128i*) (str + size - 16)));
+        mask >>= off - (size - 16);
+        if(mask != 0)
+            return off + MD_SIMD_CTZ(mask);
+    }
+
+    return size;
+}
+
+#ifdef MD_SIMD_AVX2
+
+/* Classify each byte by looking up its low nibble and its high nibble in two
+ * tables. The byte is a member if the results have a common bit. (Bytes >= 0x80
+ * are never matched this way, as (V)PSHUFB yields zero for such indexes, so
+ * they are handled separately.)
+ */
+MD_SIMD_AVX2_FUNC static inline unsigned
+md_simd_mask_avx2(const MD_SIMD_CHARSET* set, __m256i lo_table, __m256i hi_table, __m256i data)
+{
+    const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_shuffle_epi8(lo_table, _mm256_and_si256(data, low_nibble));
+    __m256i hi = _mm256_shuffle_epi8(hi_table,
+                _mm256_and_si256(_mm256_srli_epi16(data, 4), low_nibble));
+    __m256i miss = _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256());
+    unsigned mask = ~(unsigned) _mm256_movemask_epi8(miss);
+
+    if(set->high_bytes)
+        mask |= (unsigned) _mm256_movemask_epi8(data);
+    return mask;
+}
+
+MD_SIMD_AVX2_FUNC static inline unsigned
+md_simd_mask_avx2_128(const MD_SIMD_CHARSET* set, __m128i lo_table, __m128i hi_table, __m128i data)
+{
+    const __m128i low_nibble = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(data, low_nibble));
+    __m128i hi = _mm_shuffle_epi8(hi_table,
+                _mm_and_si128(_mm_srli_epi16(data, 4), low_nibble));
+    __m128i miss = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+    unsigned mask = ~(unsigned) _mm_movemask_epi8(miss) & 0xffff;
+
+    if(set->high_bytes)
+        mask |= (unsigned) _mm_movemask_epi8(data);
+    return mask;
+}
+
+MD_SIMD_AVX2_FUNC static size_t
+md_simd_find_avx2(const MD_SIMD_CHARSET* set, const unsigned char* str, size_t size)
+{
+    const __m128i lo_table = _mm_loadu_si128((const __m128i*) set->nibble_mask);
+    const __m128i hi_table = _mm_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, (char) 128, 0, 0, 0, 0, 0, 0, 0, 0);
+    unsigned mask;
+    size_t off = 0;
+
+    if(size >= 32) {
+        const __m256i lo_table2 = _mm256_broadcastsi128_si256(lo_table);
+        const __m256i hi_table2 = _mm256_broadcastsi128_si256(hi_table);
+
+        while(off + 32 <= size) {
+            mask = md_simd_mask_avx2(set, lo_table2, hi_table2,
+                        _mm256_loadu_si256((const __m256i*) (str + off)));
+            if(mask != 0)
+                return off + MD_SIMD_CTZ(mask);
+            off += 32;
+        }
+
+        if(off < size) {
+            mask = md_simd_mask_avx2(set, lo_table2, hi_table2,
+                        _mm256_loadu_si256((const __m256i*) (str + size - 32)));
+            mask >>= off - (size - 32);
+            if(mask != 0)
+                return off + MD_SIMD_CTZ(mask);
+        }
+
+        return size;
+    }
+
+    /* 16 <= size < 32: Same as above, just with 16-byte vectors. */
+    mask = md_simd_mask_avx2_128(set, lo_table, hi_table,
+                _mm_loadu_si128((const __m128i*) str));
+    if(mask != 0)
+        return MD_SIMD_CTZ(mask);
+    off = 16;
+
+    if(off < size) {
+        mask = md_simd_mask_avx2_128(set, lo_table, hi_table,
+                    _mm_loadu_si128((const __m128i*) (str + size - 16)));
+        mask >>= off - (size - 16);
+        if(mask != 0)
+            return off + MD_SIMD_CTZ(mask);
+    }
+
+    return size;
+}
+
+#endif  /* MD_SIMD_AVX2 */
+
+#endif  /* MD_SIMD_SSE2 */
+
+/* Initialize the set. The map[] has 256 elements; map[ch] != 0 for members.
+ */
+static inline void
+md_simd_charset_init(MD_SIMD_CHARSET* set, const char* map)
+{
+    unsigned ch;
+    unsigned n_high = 0;
+
+    memset(set, 0, sizeof(MD_SIMD_CHARSET));
+    for(ch = 0; ch < 256; ch++) {
+        if(!map[ch])
+            continue;
+
+        set->map[ch] = 1;
+        if(ch < 128) {
+            set->nibble_mask[ch & 0x0f] |= (unsigned char) (1U << (ch >> 4));
+            if(set->n_chars < MD_SIMD_MAX_CHARS)
+                set->chars[set->n_chars] = (unsigned char) ch;
+            set->n_chars++;
+        } else {
+            n_high++;
+        }
+    }
+
+    set->high_bytes = (n_high == 128);
+    set->use_avx2 = (n_high == 0  ||  n_high == 128);
+    set->use_sse2 = (set->use_avx2  &&  set->n_chars <= MD_SIMD_MAX_CHARS);
+    if(set->n_chars > MD_SIMD_MAX_CHARS)
+        set->n_chars = MD_SIMD_MAX_CHARS;
+
+#ifdef MD_SIMD_AVX2
+    /* Resolve the CPU level here, so that md_simd_find() does not have to
+     * touch the global (possibly from several threads at once). */
+    if(set->use_avx2  &&  MD_SIMD_LEVEL() < 2)
+        set->use_avx2 = 0;
+#endif
+}
+
+/* Find the first member of the set in the string. If there is none, size
+ * is returned.
+ */
+static inline size_t
+md_simd_find(const MD_SIMD_CHARSET* set, const unsigned char* str, size_t size)
+{
+    size_t off = 0;
+
+#ifdef MD_SIMD_SSE2
+    if(size >= 16) {
+    #ifdef MD_SIMD_AVX2
+        if(set->use_avx2)
+            return md_simd_find_avx2(set, str, size);
+    #endif
+        if(set->use_sse2)
+            return md_simd_find_sse2(set, str, size);
+    }
+#endif
+
+    /* Plain C implementation (also for short strings). */
+    while(off + 3 < size  &&  !set->map[str[off+0]]  &&  !set->map[str[off+1]]
+                          &&  !set->map[str[off+2]]  &&  !set->map[str[off+3]])
+        off += 4;
+    while(off < size  &&  !set->map[str[off]])
+        off++;
+
+    return off;
+}
+
+
+#endif  /* MD4C_SIMD_H */
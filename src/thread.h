@@ -0,0 +1,142 @@
+/*
+ * MD4C: Markdown parser for C
+ * (http://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2020 Martin Mitas
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+#ifndef MD4C_THREAD_H
+#define MD4C_THREAD_H
+
+/* Minimal wrapper of the threads (POSIX threads or Win32 threads).
+ *
+ * When built with MD4C_NO_THREADS (or on a platform we do not know), the
+ * macro MD_THREADS is not defined and nothing else is available.
+ *
+ * All the functions here are static inline, so this header is to be
+ * included only from the .c files which need it.
+ */
+
+#if !defined MD4C_NO_THREADS
+    #if defined _WIN32
+        #define MD_THREADS          1
+        #define MD_THREADS_WIN32    1
+        #ifndef WIN32_LEAN_AND_MEAN
+            #define WIN32_LEAN_AND_MEAN
+        #endif
+        #include <windows.h>
+    #elif defined __unix__  ||  defined __APPLE__
+        #define MD_THREADS          1
+        #define MD_THREADS_PTHREAD  1
+        #include <pthread.h>
+    #endif
+#endif
+
+#ifdef MD_THREADS
+
+/* Define a thread procedure like this:
+ *
+ *   MD_THREAD_PROC(my_proc, arg)
+ *   {
+ *       ...
+ *       MD_THREAD_PROC_RETURN;
+ *   }
+ */
+#ifdef MD_THREADS_WIN32
+    typedef HANDLE MD_THREAD;
+    typedef CRITICAL_SECTION MD_MUTEX;
+    typedef DWORD (WINAPI *MD_THREAD_PROC_TYPE)(void*);
+    #define MD_THREAD_PROC(name, arg)   static DWORD WINAPI name(void* arg)
+    #define MD_THREAD_PROC_RETURN       return 0
+#else
+    typedef pthread_t MD_THREAD;
+    typedef pthread_mutex_t MD_MUTEX;
+    typedef void* (*MD_THREAD_PROC_TYPE)(void*);
+    #define MD_THREAD_PROC(name, arg)   static void* name(void* arg)
+    #define MD_THREAD_PROC_RETURN       return NULL
+#endif
+
+/* Returns 0 on success, -1 on failure. */
+static inline int
+md_thread_create(MD_THREAD* thread, MD_THREAD_PROC_TYPE proc, void* arg)
+{
+#ifdef MD_THREADS_WIN32
+    *thread = CreateThread(NULL, 0, proc, arg, 0, NULL);
+    return (*thread != NULL ? 0 : -1);
+#else
+    return (pthread_create(thread, NULL, proc, arg) == 0 ? 0 : -1);
+#endif
+}
+
+static inline void
+md_thread_join(MD_THREAD thread)
+{
+#ifdef MD_THREADS_WIN32
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif
+}
+
+static inline void
+md_mutex_init(MD_MUTEX* mutex)
+{
+#ifdef MD_THREADS_WIN32
+    InitializeCriticalSection(mutex);
+#else
+    pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+static inline void
+md_mutex_fini(MD_MUTEX* mutex)
+{
+#ifdef MD_THREADS_WIN32
+    DeleteCriticalSection(mutex);
+#else
+    pthread_mutex_destroy(mutex);
+#endif
+}
+
+static inline void
+md_mutex_lock(MD_MUTEX* mutex)
+{
+#ifdef MD_THREADS_WIN32
+    EnterCriticalSection(mutex);
+#else
+    pthread_mutex_lock(mutex);
+#endif
+}
+
+static inline void
+md_mutex_unlock(MD_MUTEX* mutex)
+{
+#ifdef MD_THREADS_WIN32
+    LeaveCriticalSection(mutex);
+#else
+    pthread_mutex_unlock(mutex);
+#endif
+}
+
+#endif  /* MD_THREADS */
+
+#endif  /* MD4C_THREAD_H */
@@ -0,0 +1,1821 @@
+/*
+ * MD4C: Markdown parser for C
+ * (http://github.com/mity/md4c)
+ *
+ * Copyright (c) 2016-2020 Martin Mitas
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ * IN THE SOFTWARE.
+ */
+
+/* Tests of the parts of the API which md2html does not reach (or reaches only
+ * partially). The documents are the examples of the spec files in the test
+ * directory: Each test does something with them through the tested API and
+ * checks the result against md_parse() or md_html().
+ *
+ * Usage: api_tests GROUP TEST_DIR
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "md4c.h"
+#include "md4c-html.h"
+
+
+
+/*********************************
+ ***  Simple grow-able buffer  ***
+ *********************************/
+
+struct membuffer {
+    char* data;
+    size_t asize;
+    size_t size;
+};
+
+static void
+membuf_grow(struct membuffer* buf, size_t new_asize)
+{
+    buf->data = realloc(buf->data, new_asize);
+    if(buf->data == NULL) {
+        fprintf(stderr, "membuf_grow: realloc() failed.\n");
+        exit(1);
+    }
+    buf->asize = new_asize;
+}
+
+static void
+membuf_append(struct membuffer* buf, const char* data, size_t size)
+{
+    if(buf->asize < buf->size + size)
+        membuf_grow(buf, buf->size + buf->size / 2 + size + 64);
+    if(size > 0)
+        memcpy(buf->data + buf->size, data, size);
+    buf->size += size;
+}
+
+static void
+membuf_printf(struct membuffer* buf, const char* fmt, unsigned value)
+{
+    char tmp[32];
+
+    snprintf(tmp, sizeof(tmp), fmt, value);
+    membuf_append(buf, tmp, strlen(tmp));
+}
+
+static void
+membuf_fini(struct membuffer* buf)
+{
+    free(buf->data);
+    buf->data = NULL;
+    buf->asize = 0;
+    buf->size = 0;
+}
+
+static int
+membuf_equals(const struct membuffer* a, const struct membuffer* b)
+{
+    return (a->size == b->size  &&  (a->size == 0  ||  memcmp(a->data, b->data, a->size) == 0));
+}
+
+
+/*******************
+ ***  Documents  ***
+ *******************/
+
+struct doc {
+    char name[64];
+    char* text;
+    size_t size;
+    unsigned flags;         /* Parser flags. */
+};
+
+static struct doc* docs = NULL;
+static unsigned n_docs = 0;
+
+/* The spec files and the parser flags for them. */
+static const struct {
+    const char* file;
+    unsigned flags;
+} suites[] = {
+    { "spec.txt",                       0 },
+    { "coverage.txt",                   0 },
+    { "tables.txt",                     MD_FLAG_TABLES },
+    { "strikethrough.txt",              MD_FLAG_STRIKETHROUGH },
+    { "tasklists.txt",                  MD_FLAG_TASKLISTS },
+    { "latex-math.txt",                 MD_FLAG_LATEXMATHSPANS },
+    { "wiki-links.txt",                 MD_FLAG_WIKILINKS | MD_FLAG_TABLES },
+    { "underline.txt",                  MD_FLAG_UNDERLINE },
+    { "permissive-url-autolinks.txt",   MD_FLAG_PERMISSIVEURLAUTOLINKS },
+};
+
+static void
+add_doc(const char* file, unsigned example, const struct membuffer* text, unsigned flags)
+{
+    struct doc* doc;
+
+    docs = realloc(docs, (n_docs + 1) * sizeof(struct doc));
+    if(docs == NULL) {
+        fprintf(stderr, "add_doc: realloc() failed.\n");
+        exit(1);
+    }
+
+    doc = &docs[n_docs++];
+    snprintf(doc->name, sizeof(doc->name), "%s: example %u", file, example);
+    doc->text = malloc(text->size + 1);
+    if(doc->text == NULL) {
+        fprintf(stderr, "add_doc: malloc() failed.\n");
+        exit(1);
+    }
+    if(text->size > 0)
+        memcpy(doc->text, text->data, text->size);
+    doc->size = text->size;
+    doc->flags = flags;
+}
+
+/* Load the Markdown of all the examples in the spec file (the same way as
+ * get_tests() in spec_tests.py does). */
+static void
+load_suite(const char* dir, const char* file, unsigned flags)
+{
+    char path[1024];
+    char line[4096];
+    struct membuffer text = {0};
+    unsigned example = 0;
+    int state = 0;      /* 0 regular text, 1 markdown example, 2 html output */
+    FILE* f;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, file);
+    f = fopen(path, "rb");
+    if(f == NULL) {
+        fprintf(stderr, "Cannot open %s.\n", path);
+        exit(1);
+    }
+
+    while(fgets(line, sizeof(line), f) != NULL) {
+        if(strncmp(line, "````````````````````````````````", 32) == 0) {
+            if(strncmp(line + 32, " example", 8) == 0) {
+                state = 1;
+                text.size = 0;
+            } else if(state == 2) {
+                state = 0;
+                add_doc(file, ++example, &text, flags);
+            }
+        } else if(state == 1  &&  strcmp(line, ".\n") == 0) {
+            state = 2;
+        } else if(state == 1) {
+            const char* p = line;
+            const char* tab;
+
+            /* Tabs are written as the arrow in the spec files. */
+            while((tab = strstr(p, "\xe2\x86\x92")) != NULL) {
+                membuf_append(&text, p, (size_t)(tab - p));
+                membuf_append(&text, "\t", 1);
+                p = tab + 3;
+            }
+            membuf_append(&text, p, strlen(p));
+        }
+    }
+
+    fclose(f);
+    membuf_fini(&text);
+}
+
+
+/*****************
+ ***  Helpers  ***
+ *****************/
+
+static unsigned n_passed = 0;
+static unsigned n_failed = 0;
+
+static void
+check(int ok, const char* name, const char* what)
+{
+    if(ok) {
+        n_passed++;
+    } else {
+        n_failed++;
+        printf("%-35s [FAILED] %s\n", name, what);
+    }
+}
+
+/* Trace of the parser callbacks, so that two parses may be compared. */
+static int
+trace_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    membuf_printf((struct membuffer*) userdata, "[B%u", (unsigned) type);
+    return 0;
+}
+
+static int
+trace_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    membuf_printf((struct membuffer*) userdata, "B%u]", (unsigned) type);
+    return 0;
+}
+
+static int
+trace_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    membuf_printf((struct membuffer*) userdata, "[S%u", (unsigned) type);
+    return 0;
+}
+
+static int
+trace_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    (void) detail;
+    membuf_printf((struct membuffer*) userdata, "S%u]", (unsigned) type);
+    return 0;
+}
+
+static int
+trace_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    struct membuffer* buf = (struct membuffer*) userdata;
+
+    membuf_printf(buf, "(T%u:", (unsigned) type);
+    membuf_append(buf, text, size);
+    membuf_append(buf, ")", 1);
+    return 0;
+}
+
+/* The tests abort the parsing on purpose, and make allocations fail. So
+ * only failed assertions (of a debug build) are worth reporting. */
+static void
+trace_debug_log(const char* msg, void* userdata)
+{
+    (void) userdata;
+    if(strstr(msg, "Assertion") != NULL)
+        fprintf(stderr, "md4c: %s\n", msg);
+}
+
+static void
+init_trace_parser(MD_PARSER* parser, unsigned abi_version, unsigned flags)
+{
+    memset(parser, 0, sizeof(MD_PARSER));
+    parser->abi_version = abi_version;
+    parser->flags = flags;
+    parser->enter_block = trace_enter_block;
+    parser->leave_block = trace_leave_block;
+    parser->enter_span = trace_enter_span;
+    parser->leave_span = trace_leave_span;
+    parser->text = trace_text;
+    parser->debug_log = trace_debug_log;
+}
+
+static void
+trace_doc(const struct doc* doc, struct membuffer* trace)
+{
+    MD_PARSER parser;
+
+    init_trace_parser(&parser, 0, doc->flags);
+    trace->size = 0;
+    if(md_parse(doc->text, (MD_SIZE) doc->size, &parser, trace) != 0) {
+        fprintf(stderr, "%s: md_parse() failed.\n", doc->name);
+        exit(1);
+    }
+}
+
+/* Output of the HTML renderer into a membuffer. */
+static void
+process_output(const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    membuf_append((struct membuffer*) userdata, text, size);
+}
+
+static const MD_HTML_CALLBACKS html_callbacks = { process_output, NULL, NULL, NULL, NULL, NULL };
+
+/* The reference HTML of a document. */
+static void
+render_html(const char* text, size_t size, unsigned parser_flags, unsigned renderer_flags,
+            struct membuffer* out)
+{
+    out->size = 0;
+    if(md_html(text, (MD_SIZE) size, html_callbacks, out, parser_flags, renderer_flags) != 0) {
+        fprintf(stderr, "md_html() failed.\n");
+        exit(1);
+    }
+}
+
+static MD_HTML*
+create_renderer(MD_HTML_CALLBACKS callbacks, unsigned parser_flags, unsigned renderer_flags)
+{
+    MD_HTML* html;
+
+    html = md_html_create(callbacks, parser_flags, renderer_flags);
+    if(html == NULL) {
+        fprintf(stderr, "create_renderer: md_html_create() failed.\n");
+        exit(1);
+    }
+    return html;
+}
+
+/* Check the HTML which the tested API has rendered (returning ret) against
+ * md_html() with the given callbacks. */
+static void
+check_html(int ret, const struct membuffer* html, MD_HTML_CALLBACKS callbacks,
+           const char* text, size_t size, unsigned parser_flags, unsigned renderer_flags,
+           const char* name, const char* what)
+{
+    struct membuffer expected = { 0 };
+
+    if(ret == 0)
+        ret = md_html(text, (MD_SIZE) size, callbacks, &expected, parser_flags, renderer_flags);
+    check(ret == 0  &&  membuf_equals(html, &expected), name, what);
+    membuf_fini(&expected);
+}
+
+
+/************************
+ ***  Reused context  ***
+ ************************/
+
+/* One context parses all the documents with the same flags, in a different
+ * order than they come in the spec files (so that a big document is often
+ * followed by a small one). The callbacks have to be the same as with
+ * md_parse(). The buffers of the context may also be released after each
+ * document (by a small retain limit) or now and then (by md_parser_reset()),
+ * which must not change anything either. */
+static void
+test_reuse(void)
+{
+    struct membuffer expected = {0};
+    struct membuffer trace = {0};
+    MD_PARSER parser;
+    MD_PARSER_CTX* ctx;
+    unsigned i, j, k;
+    int ret;
+
+    for(j = 0; j < sizeof(suites) / sizeof(suites[0]); j++) {
+        init_trace_parser(&parser, 0, suites[j].flags);
+        ctx = md_parser_create(&parser);
+        if(ctx == NULL) {
+            fprintf(stderr, "test_reuse: md_parser_create() failed.\n");
+            exit(1);
+        }
+        if(j % 2 == 1)
+            md_parser_set_retain_limit(ctx, 1024);
+
+        for(k = 0; k < n_docs; k++) {
+            /* Every 7th document, wrapping around. */
+            i = (unsigned) ((k * 7ULL) % n_docs);
+            if(docs[i].flags != suites[j].flags)
+                continue;
+            if(k % 50 == 49)
+                md_parser_reset(ctx);
+
+            trace_doc(&docs[i], &expected);
+            trace.size = 0;
+            ret = md_parser_parse(ctx, docs[i].text, (MD_SIZE) docs[i].size, &trace);
+            check(ret == 0  &&  membuf_equals(&trace, &expected), docs[i].name,
+                  "md_parser_parse() differs from md_parse()");
+        }
+
+        md_parser_destroy(ctx);
+    }
+
+    membuf_fini(&expected);
+    membuf_fini(&trace);
+}
+
+
+/*******************
+ ***  Allocator  ***
+ *******************/
+
+/* Counting allocator. It can also be told to fail at its n-th call. */
+struct counting_allocator {
+    MD_ALLOCATOR allocator;
+    size_t n_live;          /* Blocks not released yet. */
+    size_t n_live_bytes;    /* Their total size. */
+    size_t n_calls;         /* Of alloc() and resize(). */
+    size_t fail_at;         /* Zero for never. */
+};
+
+/* Each block is preceded by its size. (The header keeps the alignment of
+ * malloc().) */
+#define COUNTING_HEADER_SIZE    16
+
+static void*
+counting_alloc(size_t size, void* allocator_data)
+{
+    struct counting_allocator* a = (struct counting_allocator*) allocator_data;
+    char* ptr;
+
+    if(++a->n_calls == a->fail_at)
+        return NULL;
+    ptr = malloc(COUNTING_HEADER_SIZE + size);
+    if(ptr == NULL)
+        return NULL;
+    *(size_t*) ptr = size;
+    a->n_live++;
+    a->n_live_bytes += size;
+    return ptr + COUNTING_HEADER_SIZE;
+}
+
+static void*
+counting_resize(void* ptr, size_t size, void* allocator_data)
+{
+    struct counting_allocator* a = (struct counting_allocator*) allocator_data;
+    char* block;
+    size_t old_size;
+
+    if(ptr == NULL)
+        return counting_alloc(size, allocator_data);
+
+    if(++a->n_calls == a->fail_at)
+        return NULL;
+    block = (char*) ptr - COUNTING_HEADER_SIZE;
+    old_size = *(size_t*) block;
+    block = realloc(block, COUNTING_HEADER_SIZE + size);
+    if(block == NULL)
+        return NULL;
+    *(size_t*) block = size;
+    a->n_live_bytes += size - old_size;
+    return block + COUNTING_HEADER_SIZE;
+}
+
+static void
+counting_release(void* ptr, void* allocator_data)
+{
+    struct counting_allocator* a = (struct counting_allocator*) allocator_data;
+    char* block;
+
+    if(ptr == NULL)
+        return;
+    block = (char*) ptr - COUNTING_HEADER_SIZE;
+    a->n_live--;
+    a->n_live_bytes -= *(size_t*) block;
+    free(block);
+}
+
+static void
+init_counting_allocator(struct counting_allocator* a, size_t fail_at)
+{
+    a->allocator.alloc = counting_alloc;
+    a->allocator.resize = counting_resize;
+    a->allocator.release = counting_release;
+    a->allocator.allocator_data = a;
+    a->n_live = 0;
+    a->n_live_bytes = 0;
+    a->n_calls = 0;
+    a->fail_at = fail_at;
+}
+
+/* Trace which makes the parsing abort after the given count of events. */
+struct aborting_trace {
+    struct membuffer trace;
+    unsigned n_events_left;
+};
+
+static int
+aborting_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct aborting_trace* t = (struct aborting_trace*) userdata;
+    return (t->n_events_left-- == 0 ? -42 : trace_enter_block(type, detail, &t->trace));
+}
+
+static int
+aborting_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct aborting_trace* t = (struct aborting_trace*) userdata;
+    return (t->n_events_left-- == 0 ? -42 : trace_leave_block(type, detail, &t->trace));
+}
+
+static int
+aborting_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct aborting_trace* t = (struct aborting_trace*) userdata;
+    return (t->n_events_left-- == 0 ? -42 : trace_enter_span(type, detail, &t->trace));
+}
+
+static int
+aborting_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct aborting_trace* t = (struct aborting_trace*) userdata;
+    return (t->n_events_left-- == 0 ? -42 : trace_leave_span(type, detail, &t->trace));
+}
+
+static int
+aborting_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    struct aborting_trace* t = (struct aborting_trace*) userdata;
+    return (t->n_events_left-- == 0 ? -42 : trace_text(type, text, size, &t->trace));
+}
+
+/* Parse each document with the counting allocator and check it gets the
+ * same callbacks as with the default one, and that every allocation is
+ * released, also when the parsing is aborted by a callback or fails for
+ * lack of memory. The allocator has to be ignored for abi_version 0. */
+static void
+test_allocator(void)
+{
+    struct membuffer expected = {0};
+    struct membuffer trace = {0};
+    struct aborting_trace aborting = { 0 };
+    struct counting_allocator a;
+    MD_PARSER parser;
+    MD_PARSER_CTX* ctx;
+    MD_TREE* tree;
+    size_t n_calls;
+    size_t fail_at;
+    unsigned abi_version;
+    unsigned n_events;
+    unsigned abort_at[3];
+    unsigned i, j;
+    int ret;
+
+    for(i = 0; i < n_docs; i++) {
+        const struct doc* doc = &docs[i];
+
+        trace_doc(doc, &expected);
+
+        for(abi_version = 0; abi_version <= MD_PARSER_ABI_VERSION; abi_version++) {
+            init_trace_parser(&parser, abi_version, doc->flags);
+            init_counting_allocator(&a, 0);
+            parser.allocator = &a.allocator;
+            trace.size = 0;
+            ret = md_parse(doc->text, (MD_SIZE) doc->size, &parser, &trace);
+            check(ret == 0  &&  membuf_equals(&trace, &expected), doc->name,
+                  "md_parse() with the allocator differs");
+            check(a.n_live == 0, doc->name, "md_parse() leaks");
+            if(abi_version == 0)
+                check(a.n_calls == 0, doc->name, "abi_version 0 uses the allocator");
+        }
+
+        /* Abort by a callback after the first event, in the middle of the
+         * document, and at its last event. (Note md4c continues when a
+         * callback returns a positive value.) */
+        init_trace_parser(&parser, MD_PARSER_ABI_VERSION, doc->flags);
+        parser.enter_block = aborting_enter_block;
+        parser.leave_block = aborting_leave_block;
+        parser.enter_span = aborting_enter_span;
+        parser.leave_span = aborting_leave_span;
+        parser.text = aborting_text;
+        parser.allocator = &a.allocator;
+        aborting.n_events_left = (unsigned) -1;
+        md_parse(doc->text, (MD_SIZE) doc->size, &parser, &aborting);
+        n_events = (unsigned) -1 - aborting.n_events_left;
+        abort_at[0] = 1;
+        abort_at[1] = n_events / 2;
+        abort_at[2] = n_events - 1;
+        for(j = 0; j < 3; j++) {
+            init_counting_allocator(&a, 0);
+            aborting.trace.size = 0;
+            aborting.n_events_left = abort_at[j];
+            ret = md_parse(doc->text, (MD_SIZE) doc->size, &parser, &aborting);
+            check(ret == -42, doc->name, "abort by a callback not propagated");
+            check(a.n_live == 0, doc->name, "md_parse() aborted by a callback leaks");
+        }
+
+        /* Fail each allocation in turn. */
+        init_trace_parser(&parser, MD_PARSER_ABI_VERSION, doc->flags);
+        init_counting_allocator(&a, 0);
+        parser.allocator = &a.allocator;
+        trace.size = 0;
+        md_parse(doc->text, (MD_SIZE) doc->size, &parser, &trace);
+        n_calls = a.n_calls;
+        for(fail_at = 1; fail_at <= n_calls; fail_at++) {
+            init_counting_allocator(&a, fail_at);
+            trace.size = 0;
+            ret = md_parse(doc->text, (MD_SIZE) doc->size, &parser, &trace);
+            check(ret == -1  ||  (ret == 0  &&  membuf_equals(&trace, &expected)), doc->name,
+                  "md_parse() without memory succeeds with other output");
+            check(a.n_live == 0, doc->name, "md_parse() without memory leaks");
+        }
+
+        /* The tree. */
+        init_counting_allocator(&a, 0);
+        if(md_parse_tree(doc->text, (MD_SIZE) doc->size, &parser, &tree) == 0) {
+            trace.size = 0;
+            ret = md_tree_replay(tree, &parser, &trace);
+            check(ret == 0  &&  membuf_equals(&trace, &expected), doc->name,
+                  "md_tree_replay() differs");
+            md_tree_destroy(tree);
+        } else {
+            check(0, doc->name, "md_parse_tree() failed");
+        }
+        check(a.n_live == 0, doc->name, "md_parse_tree() leaks");
+    }
+
+    /* One context for all the documents, with some of them abandoned. */
+    init_counting_allocator(&a, 0);
+    for(abi_version = 1; abi_version <= MD_PARSER_ABI_VERSION; abi_version++) {
+        init_trace_parser(&parser, abi_version, 0);
+        parser.allocator = &a.allocator;
+        ctx = md_parser_create(&parser);
+        check(ctx != NULL  &&  a.n_live > 0, "md_parser_create()", "context not allocated by the allocator");
+        if(ctx == NULL)
+            continue;
+        for(i = 0; i < n_docs; i++) {
+            if(docs[i].flags != 0)
+                continue;
+            trace_doc(&docs[i], &expected);
+            trace.size = 0;
+            if(i % 7 == 3) {
+                /* md_parser_feed() with no md_parser_finish(). */
+                md_parser_feed(ctx, docs[i].text, (MD_SIZE) docs[i].size / 2, &trace);
+                continue;
+            }
+            if(i % 7 == 5) {
+                /* Failing (if the buffers of the context have to grow). */
+                a.fail_at = a.n_calls + 1;
+                md_parser_parse(ctx, docs[i].text, (MD_SIZE) docs[i].size, &trace);
+                a.fail_at = 0;
+                continue;
+            }
+            ret = md_parser_parse(ctx, docs[i].text, (MD_SIZE) docs[i].size, &trace);
+            check(ret == 0  &&  membuf_equals(&trace, &expected), docs[i].name,
+                  "md_parser_parse() with the allocator differs");
+        }
+        md_parser_destroy(ctx);
+        check(a.n_live == 0, "md_parser_destroy()", "context leaks");
+    }
+
+    /* Unknown abi_version. */
+    init_trace_parser(&parser, MD_PARSER_ABI_VERSION + 1, 0);
+    check(md_parse("a", 1, &parser, &trace) == -1, "abi_version", "md_parse() accepts unknown version");
+    check(md_parser_create(&parser) == NULL, "abi_version", "md_parser_create() accepts unknown version");
+
+    membuf_fini(&expected);
+    membuf_fini(&trace);
+    membuf_fini(&aborting.trace);
+}
+
+
+/*****************************
+ ***  Incremental re-parse  ***
+ *****************************/
+
+/* Random edits of a document via md_html_load() and md_html_edit(). After
+ * each edit, the HTML of the re-rendered blocks, put in place of the old
+ * blocks it replaces, has to give the HTML md_html() renders for the whole
+ * new document.
+ *
+ * The HTML does not tell where its top-level blocks begin, so the check of
+ * the HTML only makes sure it fits between some beginning and some end of
+ * the old HTML. md_parser_load() and md_parser_edit() are run alongside
+ * with a trace split into the top-level blocks: There the replaced blocks
+ * are checked exactly, against the blocks of md_parse().
+ */
+
+static unsigned long long rng_state = 1;
+
+static unsigned
+rng(unsigned n)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return (unsigned) ((rng_state >> 11) % n);
+}
+
+struct block_trace {
+    struct membuffer* blocks;
+    unsigned n_blocks;
+    unsigned alloc_blocks;
+    int depth;
+};
+
+static void
+block_trace_clear(struct block_trace* t)
+{
+    unsigned i;
+
+    for(i = 0; i < t->n_blocks; i++)
+        membuf_fini(&t->blocks[i]);
+    t->n_blocks = 0;
+    t->depth = 0;
+}
+
+static struct membuffer*
+block_trace_push(struct block_trace* t)
+{
+    if(t->n_blocks >= t->alloc_blocks) {
+        t->alloc_blocks = t->alloc_blocks + t->alloc_blocks / 2 + 16;
+        t->blocks = realloc(t->blocks, t->alloc_blocks * sizeof(struct membuffer));
+        if(t->blocks == NULL) {
+            fprintf(stderr, "block_trace_push: realloc() failed.\n");
+            exit(1);
+        }
+    }
+    memset(&t->blocks[t->n_blocks], 0, sizeof(struct membuffer));
+    return &t->blocks[t->n_blocks++];
+}
+
+static int
+block_enter_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct block_trace* t = (struct block_trace*) userdata;
+
+    if(type == MD_BLOCK_DOC)
+        return 0;
+    if(t->depth++ == 0)
+        block_trace_push(t);
+    return trace_enter_block(type, detail, &t->blocks[t->n_blocks-1]);
+}
+
+static int
+block_leave_block(MD_BLOCKTYPE type, void* detail, void* userdata)
+{
+    struct block_trace* t = (struct block_trace*) userdata;
+
+    if(type == MD_BLOCK_DOC)
+        return 0;
+    t->depth--;
+    return trace_leave_block(type, detail, &t->blocks[t->n_blocks-1]);
+}
+
+static int
+block_enter_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct block_trace* t = (struct block_trace*) userdata;
+    return trace_enter_span(type, detail, &t->blocks[t->n_blocks-1]);
+}
+
+static int
+block_leave_span(MD_SPANTYPE type, void* detail, void* userdata)
+{
+    struct block_trace* t = (struct block_trace*) userdata;
+    return trace_leave_span(type, detail, &t->blocks[t->n_blocks-1]);
+}
+
+static int
+block_text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata)
+{
+    struct block_trace* t = (struct block_trace*) userdata;
+    return trace_text(type, text, size, &t->blocks[t->n_blocks-1]);
+}
+
+static void
+init_block_parser(MD_PARSER* parser, unsigned flags)
+{
+    init_trace_parser(parser, 0, flags);
+    parser->enter_block = block_enter_block;
+    parser->leave_block = block_leave_block;
+    parser->enter_span = block_enter_span;
+    parser->leave_span = block_leave_span;
+    parser->text = block_text;
+}
+
+struct edit_test {
+    char name[64];
+    unsigned flags;
+    MD_HTML* html;
+    MD_PARSER_CTX* ctx;
+    struct membuffer doc;
+    struct membuffer doc_html;      /* HTML of the document. */
+    struct block_trace doc_blocks;  /* Top-level blocks of the document. */
+    /* Scratch buffers. */
+    struct membuffer new_doc;
+    struct membuffer new_html;
+    struct membuffer edit_html;
+    struct block_trace new_blocks;
+    struct block_trace edit_blocks;
+};
+
+static void
+edit_test_load(struct edit_test* t, const char* text, size_t size)
+{
+    MD_PARSER parser;
+    int ret;
+
+    t->doc.size = 0;
+    membuf_append(&t->doc, text, size);
+
+    t->edit_html.size = 0;
+    ret = md_html_load(t->html, text, (MD_SIZE) size, &t->edit_html);
+    render_html(text, size, t->flags, 0, &t->doc_html);
+    check(ret == 0  &&  membuf_equals(&t->edit_html, &t->doc_html), t->name,
+          "md_html_load() differs from md_html()");
+
+    block_trace_clear(&t->edit_blocks);
+    ret = md_parser_load(t->ctx, text, (MD_SIZE) size, &t->edit_blocks);
+    block_trace_clear(&t->doc_blocks);
+    init_block_parser(&parser, t->flags);
+    md_parse(text, (MD_SIZE) size, &parser, &t->doc_blocks);
+    check(ret == 0  &&  t->edit_blocks.n_blocks == t->doc_blocks.n_blocks, t->name,
+          "md_parser_load() differs from md_parse()");
+}
+
+/* Does the HTML of the edit fit between a beginning and an end of the old
+ * HTML, giving the new HTML? */
+static int
+edit_html_fits(const struct membuffer* old_html, const struct membuffer* edit_html,
+               const struct membuffer* new_html)
+{
+    size_t n_prefix = 0, n_suffix = 0;
+    size_t p;
+
+    if(edit_html->size > new_html->size)
+        return 0;
+    while(n_prefix < old_html->size  &&  n_prefix < new_html->size  &&
+          old_html->data[n_prefix] == new_html->data[n_prefix])
+        n_prefix++;
+    while(n_suffix < old_html->size  &&  n_suffix < new_html->size  &&
+          old_html->data[old_html->size - n_suffix - 1] == new_html->data[new_html->size - n_suffix - 1])
+        n_suffix++;
+
+    for(p = 0; p + edit_html->size <= new_html->size; p++) {
+        size_t s = new_html->size - edit_html->size - p;
+
+        if(p > n_prefix)
+            break;
+        if(s > n_suffix  ||  p + s > old_html->size)
+            continue;
+        if(edit_html->size == 0  ||  memcmp(new_html->data + p, edit_html->data, edit_html->size) == 0)
+            return 1;
+    }
+    return 0;
+}
+
+static void
+edit_test_edit(struct edit_test* t, size_t off, size_t removed_size, const char* text, size_t size)
+{
+    MD_EDIT_RESULT result, parser_result;
+    MD_PARSER parser;
+    struct block_trace tmp;
+    unsigned i;
+    int ok;
+    int ret;
+
+    t->new_doc.size = 0;
+    membuf_append(&t->new_doc, t->doc.data, off);
+    membuf_append(&t->new_doc, text, size);
+    membuf_append(&t->new_doc, t->doc.data + off + removed_size, t->doc.size - off - removed_size);
+    render_html(t->new_doc.data, t->new_doc.size, t->flags, 0, &t->new_html);
+
+    /* The HTML. */
+    t->edit_html.size = 0;
+    ret = md_html_edit(t->html, (MD_OFFSET) off, (MD_SIZE) removed_size, text, (MD_SIZE) size,
+                       &result, &t->edit_html);
+    if(ret != 0) {
+        check(0, t->name, "md_html_edit() failed");
+        edit_test_load(t, t->new_doc.data, t->new_doc.size);
+        return;
+    }
+    if(result.is_full)
+        ok = membuf_equals(&t->edit_html, &t->new_html);
+    else
+        ok = edit_html_fits(&t->doc_html, &t->edit_html, &t->new_html);
+    check(ok, t->name, "md_html_edit() does not fit into the HTML of the document");
+
+    /* The top-level blocks. */
+    block_trace_clear(&t->edit_blocks);
+    ret = md_parser_edit(t->ctx, (MD_OFFSET) off, (MD_SIZE) removed_size, text, (MD_SIZE) size,
+                         &parser_result, &t->edit_blocks);
+    check(ret == 0  &&  memcmp(&result, &parser_result, sizeof(MD_EDIT_RESULT)) == 0, t->name,
+          "md_parser_edit() differs from md_html_edit()");
+    check(result.first_block + result.n_removed_blocks <= t->doc_blocks.n_blocks  &&
+          result.n_added_blocks == t->edit_blocks.n_blocks, t->name, "wrong MD_EDIT_RESULT");
+
+    block_trace_clear(&t->new_blocks);
+    init_block_parser(&parser, t->flags);
+    md_parse(t->new_doc.data, (MD_SIZE) t->new_doc.size, &parser, &t->new_blocks);
+
+    ok = (ret == 0  &&  t->doc_blocks.n_blocks - result.n_removed_blocks + result.n_added_blocks
+                                == t->new_blocks.n_blocks);
+    for(i = 0; ok  &&  i < t->new_blocks.n_blocks; i++) {
+        const struct membuffer* block;
+
+        if(i < result.first_block)
+            block = &t->doc_blocks.blocks[i];
+        else if(i < result.first_block + result.n_added_blocks)
+            block = &t->edit_blocks.blocks[i - result.first_block];
+        else
+            block = &t->doc_blocks.blocks[i - result.n_added_blocks + result.n_removed_blocks];
+        ok = membuf_equals(block, &t->new_blocks.blocks[i]);
+    }
+    check(ok, t->name, "md_parser_edit() blocks do not splice into the blocks of md_parse()");
+
+    /* Go on with the new document. */
+    t->doc.size = 0;
+    membuf_append(&t->doc, t->new_doc.data, t->new_doc.size);
+    t->doc_html.size = 0;
+    membuf_append(&t->doc_html, t->new_html.data, t->new_html.size);
+    tmp = t->doc_blocks;
+    t->doc_blocks = t->new_blocks;
+    t->new_blocks = tmp;
+}
+
+static void
+edit_test_init(struct edit_test* t, unsigned flags)
+{
+    MD_PARSER parser;
+
+    memset(t, 0, sizeof(struct edit_test));
+    t->flags = flags;
+    t->html = create_renderer(html_callbacks, flags, 0);
+    init_block_parser(&parser, flags);
+    t->ctx = md_parser_create(&parser);
+    if(t->ctx == NULL) {
+        fprintf(stderr, "edit_test_init: md_parser_create() failed.\n");
+        exit(1);
+    }
+}
+
+static void
+edit_test_fini(struct edit_test* t)
+{
+    md_html_destroy(t->html);
+    md_parser_destroy(t->ctx);
+    membuf_fini(&t->doc);
+    membuf_fini(&t->doc_html);
+    membuf_fini(&t->new_doc);
+    membuf_fini(&t->new_html);
+    membuf_fini(&t->edit_html);
+    block_trace_clear(&t->doc_blocks);
+    block_trace_clear(&t->new_blocks);
+    block_trace_clear(&t->edit_blocks);
+    free(t->doc_blocks.blocks);
+    free(t->new_blocks.blocks);
+    free(t->edit_blocks.blocks);
+}
+
+#define N_RANDOM_EDITS      5000
+
+/* A ref. def. with a multi-line label and title needs copies of them. When an
+ * edit re-parses it, the copies of the old one cannot be released on their
+ * own; they must not pile up over many edits. */
+#define N_GARBAGE_EDITS         20000
+#define MAX_GARBAGE_GROWTH      (1024 * 1024)
+
+static void
+test_edit_garbage(void)
+{
+    static const char text[] =
+        "[a label long enough to be noticed\n"
+        "when it leaks]: /url 'a title long enough to be noticed\n"
+        "when it leaks, too'\n"
+        "text\n";
+    struct counting_allocator a;
+    struct block_trace blocks = { 0 };
+    struct block_trace expected = { 0 };
+    MD_PARSER parser;
+    MD_PARSER_CTX* ctx;
+    MD_EDIT_RESULT result;
+    size_t n_loaded_bytes;
+    size_t n_max_bytes = 0;
+    unsigned i;
+    int ret;
+
+    init_counting_allocator(&a, 0);
+    init_block_parser(&parser, 0);
+    parser.abi_version = MD_PARSER_ABI_VERSION;
+    parser.allocator = &a.allocator;
+    ctx = md_parser_create(&parser);
+    if(ctx == NULL) {
+        fprintf(stderr, "test_edit_garbage: Cannot create the parser.\n");
+        exit(1);
+    }
+
+    ret = md_parser_load(ctx, text, (MD_SIZE) (sizeof(text) - 1), &blocks);
+    check(ret == 0, "edits of a multi-line ref. def.", "md_parser_load() failed");
+    n_loaded_bytes = a.n_live_bytes;
+
+    /* Append a character to the paragraph which follows the ref. def. (so
+     * they are in the same block), and remove it again. */
+    for(i = 0; i < N_GARBAGE_EDITS; i++) {
+        block_trace_clear(&blocks);
+        if(i % 2 == 0)
+            ret = md_parser_edit(ctx, sizeof(text) - 2, 0, "x", 1, &result, &blocks);
+        else
+            ret = md_parser_edit(ctx, sizeof(text) - 2, 1, "", 0, &result, &blocks);
+        if(ret != 0)
+            break;
+        if(a.n_live_bytes > n_max_bytes)
+            n_max_bytes = a.n_live_bytes;
+    }
+    check(ret == 0, "edits of a multi-line ref. def.", "md_parser_edit() failed");
+    check(n_max_bytes <= n_loaded_bytes + MAX_GARBAGE_GROWTH, "edits of a multi-line ref. def.",
+          "memory grows with the edits");
+
+    /* The document is back as loaded. */
+    md_parse(text, (MD_SIZE) (sizeof(text) - 1), &parser, &expected);
+    check(blocks.n_blocks == 1  &&  expected.n_blocks == 1  &&
+          membuf_equals(&blocks.blocks[0], &expected.blocks[0]),
+          "edits of a multi-line ref. def.", "md_parser_edit() differs from md_parse()");
+
+    md_parser_destroy(ctx);
+    check(a.n_live == 0, "edits of a multi-line ref. def.", "md_parser_destroy() leaks");
+    block_trace_clear(&blocks);
+    block_trace_clear(&expected);
+    free(blocks.blocks);
+    free(expected.blocks);
+}
+
+static void
+test_edit(void)
+{
+    static const char* const snippets[] = {
+        "\n", "\n\n", " ", "*", "_", "`", "[", "]", "(", ")", "#", ">", "-", "|",
+        "!", ":", "<", "    ", "1. ", "- ", "> ", "```\n", "---\n", "| a | b |\n|---|---|\n",
+        "[foo]: /url\n\n", "[bar]: /u \"t\"\n", "[foo]\n", "<div>\n", "$x$", "[[w]]",
+    };
+    static const unsigned flag_sets[] = {
+        0,
+        MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | MD_FLAG_TASKLISTS | MD_FLAG_PERMISSIVEAUTOLINKS,
+        MD_FLAG_WIKILINKS | MD_FLAG_LATEXMATHSPANS | MD_FLAG_UNDERLINE | MD_FLAG_NOINDENTEDCODEBLOCKS,
+    };
+    struct edit_test t;
+    unsigned i, j;
+
+    /* Growing an empty document, with a change of the ref. defs. (hence
+     * a full re-parse) in the middle. */
+    edit_test_init(&t, 0);
+    snprintf(t.name, sizeof(t.name), "edits of an empty document");
+    edit_test_load(&t, "", 0);
+    edit_test_edit(&t, 0, 0, "a\n", 2);
+    edit_test_edit(&t, 0, 0, "[x]: /u\n\n", 9);
+    edit_test_edit(&t, 0, 0, "[y]: /v\n\nb\n\nc\n\n", 15);
+    edit_test_edit(&t, 0, t.doc.size, "", 0);
+    edit_test_edit(&t, 0, 0, "# h\n\n- a\n- b\n", 13);
+    edit_test_fini(&t);
+
+    test_edit_garbage();
+
+    for(i = 0; i < sizeof(flag_sets) / sizeof(flag_sets[0]); i++) {
+        edit_test_init(&t, flag_sets[i]);
+        edit_test_load(&t, "", 0);
+
+        for(j = 0; j < N_RANDOM_EDITS; j++) {
+            const struct doc* doc = &docs[rng(n_docs)];
+            size_t off = (t.doc.size > 0 ? rng((unsigned) t.doc.size + 1) : 0);
+            size_t removed_size = 0;
+            const char* text = "";
+            size_t size = 0;
+            size_t beg;
+
+            snprintf(t.name, sizeof(t.name), "random edit %u (flags 0x%x)", j, flag_sets[i]);
+
+            switch(rng(8)) {
+                case 0:
+                case 1:     /* A whole example. */
+                    text = doc->text;
+                    size = doc->size;
+                    break;
+
+                case 2:     /* A piece of an example. */
+                    beg = (doc->size > 0 ? rng((unsigned) doc->size) : 0);
+                    text = doc->text + beg;
+                    size = (doc->size > beg ? rng((unsigned) (doc->size - beg)) + 1 : 0);
+                    break;
+
+                case 3:
+                case 4:     /* A bit of syntax. */
+                    text = snippets[rng(sizeof(snippets) / sizeof(snippets[0]))];
+                    size = strlen(text);
+                    break;
+
+                case 5:
+                case 6:     /* Removal. */
+                    removed_size = rng((unsigned) (t.doc.size - off < 64 ? t.doc.size - off : 64) + 1);
+                    break;
+
+                default:    /* Replacement. */
+                    removed_size = rng((unsigned) (t.doc.size - off < 16 ? t.doc.size - off : 16) + 1);
+                    text = snippets[rng(sizeof(snippets) / sizeof(snippets[0]))];
+                    size = strlen(text);
+                    break;
+            }
+
+            /* Keep the document small, but every now and then start over. */
+            if(t.doc.size > 4096  &&  size > removed_size) {
+                removed_size = t.doc.size - off;
+                if(removed_size > 1024)
+                    removed_size = 1024;
+                size = 0;
+            }
+            if(rng(500) == 0) {
+                edit_test_load(&t, doc->text, doc->size);
+                continue;
+            }
+
+            edit_test_edit(&t, off, removed_size, text, size);
+        }
+
+        edit_test_fini(&t);
+    }
+}
+
+
+/**********************
+ ***  Render cache  ***
+ **********************/
+
+/* Every document is rendered twice through one cache, each time with another
+ * renderer: The first time by a renderer of its own, then by one shared by
+ * all the documents with the same flags. Then again with changed flags, which
+ * has to miss what is cached for the old flags. (Some examples in the spec
+ * files are the same, so even the first pass has some hits.) */
+
+#define CACHE_SIZE          (64 * 1024 * 1024)
+#define SMALL_CACHE_SIZE    (16 * 1024)
+
+/* Render the document through the cache. */
+static void
+cache_render(MD_HTML* html, const struct doc* doc, unsigned parser_flags, unsigned renderer_flags,
+             const char* what)
+{
+    struct membuffer output = { 0 };
+    int ret;
+
+    ret = md_html_render(html, doc->text, (MD_SIZE) doc->size, &output);
+    check_html(ret, &output, html_callbacks, doc->text, doc->size, parser_flags, renderer_flags,
+               doc->name, what);
+    membuf_fini(&output);
+}
+
+static void
+test_cache(void)
+{
+    MD_HTML_CACHE* cache;
+    MD_HTML_CACHE_STATS stats, old_stats;
+    MD_HTML* shared[sizeof(suites) / sizeof(suites[0])];
+    size_t n_unique;
+    unsigned i, j;
+
+    cache = md_html_cache_create(CACHE_SIZE);
+    if(cache == NULL) {
+        fprintf(stderr, "test_cache: md_html_cache_create() failed.\n");
+        exit(1);
+    }
+    for(j = 0; j < sizeof(suites) / sizeof(suites[0]); j++) {
+        shared[j] = create_renderer(html_callbacks, suites[j].flags, 0);
+        md_html_set_cache(shared[j], cache);
+    }
+
+    /* The first pass: Each document either misses, or it hits its duplicate
+     * from the spec files. */
+    for(i = 0; i < n_docs; i++) {
+        MD_HTML* html = create_renderer(html_callbacks, docs[i].flags, 0);
+        md_html_set_cache(html, cache);
+        cache_render(html, &docs[i], docs[i].flags, 0, "first rendering differs from md_html()");
+        md_html_destroy(html);
+    }
+    md_html_cache_get_stats(cache, &stats);
+    n_unique = stats.n_misses;
+    check(stats.n_hits + stats.n_misses == n_docs  &&  stats.n_misses > 0, "cache: first pass",
+          "every rendering has to be either a hit or a miss");
+    check(stats.n_evictions == 0  &&  stats.n_entries == stats.n_misses  &&
+          stats.size > 0  &&  stats.size <= CACHE_SIZE, "cache: first pass",
+          "wrong number of entries or size");
+
+    /* The second pass: All hits, through the shared renderers. */
+    old_stats = stats;
+    for(i = 0; i < n_docs; i++) {
+        for(j = 0; suites[j].flags != docs[i].flags; j++)
+            ;
+        cache_render(shared[j], &docs[i], docs[i].flags, 0, "cached rendering differs from md_html()");
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(stats.n_hits == old_stats.n_hits + n_docs  &&  stats.n_misses == old_stats.n_misses  &&
+          stats.n_entries == old_stats.n_entries  &&  stats.size == old_stats.size,
+          "cache: second pass", "every rendering has to hit the cache");
+
+    /* The renderer flags, the parser flags, or MD_HTML_FLAG_NO_CACHE changed:
+     * All misses (or no use of the cache at all). */
+    old_stats = stats;
+    for(i = 0; i < n_docs; i++) {
+        MD_HTML* html = create_renderer(html_callbacks, docs[i].flags, MD_HTML_FLAG_XHTML);
+        md_html_set_cache(html, cache);
+        cache_render(html, &docs[i], docs[i].flags, MD_HTML_FLAG_XHTML,
+                     "rendering with other renderer flags differs from md_html()");
+        md_html_destroy(html);
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(stats.n_misses == old_stats.n_misses + n_unique  &&
+          stats.n_hits == old_stats.n_hits + (n_docs - n_unique)  &&
+          stats.n_entries == old_stats.n_entries + n_unique,
+          "cache: other renderer flags", "the entries of the old flags have to miss");
+
+    old_stats = stats;
+    for(i = 0; i < n_docs; i++) {
+        MD_HTML* html = create_renderer(html_callbacks, docs[i].flags ^ MD_FLAG_NOHTMLSPANS, 0);
+        md_html_set_cache(html, cache);
+        cache_render(html, &docs[i], docs[i].flags ^ MD_FLAG_NOHTMLSPANS, 0,
+                     "rendering with other parser flags differs from md_html()");
+        md_html_destroy(html);
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(stats.n_misses == old_stats.n_misses + n_unique  &&
+          stats.n_hits == old_stats.n_hits + (n_docs - n_unique)  &&
+          stats.n_entries == old_stats.n_entries + n_unique,
+          "cache: other parser flags", "the entries of the old flags have to miss");
+
+    old_stats = stats;
+    for(i = 0; i < n_docs; i++) {
+        MD_HTML* html = create_renderer(html_callbacks, docs[i].flags, MD_HTML_FLAG_NO_CACHE);
+        md_html_set_cache(html, cache);
+        cache_render(html, &docs[i], docs[i].flags, MD_HTML_FLAG_NO_CACHE,
+                     "rendering with MD_HTML_FLAG_NO_CACHE differs from md_html()");
+        md_html_destroy(html);
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(memcmp(&stats, &old_stats, sizeof(MD_HTML_CACHE_STATS)) == 0,
+          "cache: MD_HTML_FLAG_NO_CACHE", "the cache has been used");
+
+    for(j = 0; j < sizeof(suites) / sizeof(suites[0]); j++)
+        md_html_destroy(shared[j]);
+    md_html_cache_destroy(cache);
+
+    /* A small cache: The documents get evicted, and some are too big to be
+     * cached at all. */
+    cache = md_html_cache_create(SMALL_CACHE_SIZE);
+    if(cache == NULL) {
+        fprintf(stderr, "test_cache: md_html_cache_create() failed.\n");
+        exit(1);
+    }
+    for(j = 0; j < 2; j++) {
+        for(i = 0; i < n_docs; i++) {
+            MD_HTML* html = create_renderer(html_callbacks, docs[i].flags, 0);
+            md_html_set_cache(html, cache);
+            cache_render(html, &docs[i], docs[i].flags, 0, "rendering with a small cache differs from md_html()");
+            md_html_destroy(html);
+        }
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(stats.n_evictions > 0  &&  stats.size <= SMALL_CACHE_SIZE  &&
+          stats.n_hits + stats.n_misses <= 2 * n_docs, "cache: small cache",
+          "documents have to be evicted to fit");
+    md_html_cache_destroy(cache);
+}
+
+
+/*******************
+ ***  Link memo  ***
+ *******************/
+
+/* The wiki links (and code links) are resolved by callbacks which count their
+ * calls. With the link memo, the output has to be the same as without it,
+ * and the callbacks may be called only for the targets the memo misses. */
+
+#define LINK_MEMO_SIZE          (1024 * 1024)
+#define SMALL_LINK_MEMO_SIZE    256
+
+static unsigned n_resolved_links = 0;
+
+/* Render the URL in two pieces, to see the memo remembers both. */
+static int
+resolve_wiki_link(const MD_CHAR* target, MD_SIZE size, void* userdata, MD_HTML* html,
+                  int (*render)(MD_HTML*, const MD_CHAR*, MD_SIZE))
+{
+    int ret;
+
+    (void) userdata;
+
+    n_resolved_links++;
+    ret = render(html, "/wiki/", 6);
+    if(ret == 0)
+        ret = render(html, target, size);
+    return ret;
+}
+
+static int
+resolve_code_link(const MD_CHAR* target, MD_SIZE size, void* userdata, MD_HTML* html,
+                  int (*render)(MD_HTML*, const MD_CHAR*, MD_SIZE))
+{
+    int ret;
+
+    (void) userdata;
+
+    n_resolved_links++;
+    ret = render(html, "/code/", 6);
+    if(ret == 0)
+        ret = render(html, target, size);
+    return ret;
+}
+
+static const MD_HTML_CALLBACKS link_callbacks = {
+    process_output, NULL, NULL, resolve_code_link, resolve_wiki_link, NULL
+};
+
+#define LINK_FLAGS      (MD_FLAG_WIKILINKS | MD_FLAG_CODELINKS)
+
+static MD_HTML_LINK_MEMO*
+create_link_memo(size_t max_size)
+{
+    MD_HTML_LINK_MEMO* memo;
+
+    memo = md_html_link_memo_create(max_size);
+    if(memo == NULL) {
+        fprintf(stderr, "create_link_memo: md_html_link_memo_create() failed.\n");
+        exit(1);
+    }
+    return memo;
+}
+
+/* Render the document through the memo. Returns how many times the links
+ * have been resolved. */
+static unsigned
+memo_render(MD_HTML* html, const char* name, const char* text, size_t size, unsigned parser_flags,
+            const char* what)
+{
+    struct membuffer output = { 0 };
+    unsigned n;
+    int ret;
+
+    n_resolved_links = 0;
+    ret = md_html_render(html, text, (MD_SIZE) size, &output);
+    n = n_resolved_links;
+    check_html(ret, &output, link_callbacks, text, size, parser_flags, 0, name, what);
+
+    membuf_fini(&output);
+    return n;
+}
+
+static void
+test_memo(void)
+{
+    static const char repeated[] =
+        "[[a]] [[b]] [[a]] [[a|label]] [x]($a) [[b]] [y]($a) [[a&amp;b]] [[a&b]]\n";
+    MD_HTML_LINK_MEMO* memo;
+    MD_HTML_LINK_MEMO_STATS stats, old_stats;
+    MD_HTML* html;
+    MD_HTML* html2;
+    size_t n_links = 0;
+    size_t n_misses = 0;
+    unsigned i;
+
+    /* Targets repeating in one document. The code link target "a" is not the
+     * same as the wiki link target "a", while "a&amp;b" is "a&b". */
+    memo = create_link_memo(LINK_MEMO_SIZE);
+    html = create_renderer(link_callbacks, LINK_FLAGS, 0);
+    md_html_set_link_memo(html, memo);
+    n_misses = memo_render(html, "link memo: repeated targets", repeated, strlen(repeated),
+                           LINK_FLAGS, "rendering with the link memo differs from md_html()");
+    md_html_link_memo_get_stats(memo, &stats);
+    check(n_misses == 4  &&  stats.n_misses == 4  &&  stats.n_hits == 5  &&  stats.n_entries == 4,
+          "link memo: repeated targets", "wrong number of hits or misses");
+    md_html_destroy(html);
+    md_html_link_memo_destroy(memo);
+
+    /* All the documents, twice, through two renderers sharing the memo. */
+    memo = create_link_memo(LINK_MEMO_SIZE);
+    html = create_renderer(link_callbacks, LINK_FLAGS | MD_FLAG_TABLES, 0);
+    md_html_set_link_memo(html, memo);
+    html2 = create_renderer(link_callbacks, LINK_FLAGS | MD_FLAG_TABLES, 0);
+    md_html_set_link_memo(html2, memo);
+    n_misses = 0;
+    for(i = 0; i < n_docs; i++) {
+        n_misses += memo_render(html, docs[i].name, docs[i].text, docs[i].size, LINK_FLAGS | MD_FLAG_TABLES,
+                                "rendering with the link memo differs from md_html()");
+    }
+    md_html_link_memo_get_stats(memo, &stats);
+    n_links = stats.n_hits + stats.n_misses;
+    check(n_links > 0  &&  stats.n_misses == n_misses  &&  stats.n_entries == n_misses  &&
+          stats.size > 0  &&  stats.size <= LINK_MEMO_SIZE, "link memo: first pass",
+          "the links have to be resolved only when the memo misses");
+
+    old_stats = stats;
+    n_misses = 0;
+    for(i = 0; i < n_docs; i++) {
+        n_misses += memo_render(html2, docs[i].name, docs[i].text, docs[i].size, LINK_FLAGS | MD_FLAG_TABLES,
+                                "rendering from the link memo differs from md_html()");
+    }
+    md_html_link_memo_get_stats(memo, &stats);
+    check(n_misses == 0  &&  stats.n_misses == old_stats.n_misses  &&
+          stats.n_hits == old_stats.n_hits + n_links  &&  stats.n_entries == old_stats.n_entries,
+          "link memo: second pass", "all the links have to be found in the memo");
+    md_html_destroy(html);
+    md_html_destroy(html2);
+    md_html_link_memo_destroy(memo);
+
+    /* A memo which gets full: The links it cannot remember are always
+     * resolved by the callbacks. */
+    memo = create_link_memo(SMALL_LINK_MEMO_SIZE);
+    html = create_renderer(link_callbacks, LINK_FLAGS | MD_FLAG_TABLES, 0);
+    md_html_set_link_memo(html, memo);
+    n_misses = 0;
+    for(i = 0; i < 2 * n_docs; i++) {
+        const struct doc* doc = &docs[i % n_docs];
+        n_misses += memo_render(html, doc->name, doc->text, doc->size, LINK_FLAGS | MD_FLAG_TABLES,
+                                "rendering with a full link memo differs from md_html()");
+    }
+    md_html_link_memo_get_stats(memo, &stats);
+    check(stats.n_misses == n_misses  &&  stats.n_hits + stats.n_misses == 2 * n_links  &&
+          stats.n_entries < n_links / 2  &&  stats.size <= SMALL_LINK_MEMO_SIZE,
+          "link memo: small memo", "the memo has to stop growing when full");
+    md_html_destroy(html);
+    md_html_link_memo_destroy(memo);
+}
+
+
+/*******************************
+ ***  Scatter-gather output  ***
+ ******************************/
+
+/* The output passed to process_output_iov() has to be the same as the output
+ * of md_html(), with any flush threshold, and however the document gets
+ * rendered. */
+
+struct iov_output {
+    struct membuffer out;
+    unsigned n_calls;
+    int is_bad;             /* A call with no segments or an empty one. */
+};
+
+static void
+process_output_iov(const MD_HTML_IOV* iov, unsigned n_iov, void* userdata)
+{
+    struct iov_output* output = (struct iov_output*) userdata;
+    unsigned i;
+
+    output->n_calls++;
+    if(n_iov == 0)
+        output->is_bad = 1;
+    for(i = 0; i < n_iov; i++) {
+        if(iov[i].size == 0)
+            output->is_bad = 1;
+        membuf_append(&output->out, iov[i].data, iov[i].size);
+    }
+}
+
+#define N_FLUSH_THRESHOLDS      7
+/* MD_HTML_DEFAULT_FLUSH_THRESHOLD (untouched) and some other ones. */
+static const MD_SIZE flush_thresholds[N_FLUSH_THRESHOLDS] = {
+    MD_HTML_DEFAULT_FLUSH_THRESHOLD, 0, 1, 7, 64, 1000, 1024 * 1024
+};
+
+static const MD_HTML_CALLBACKS iov_callbacks = { NULL, NULL, NULL, NULL, NULL, process_output_iov };
+
+/* Check the output against md_html(). */
+static void
+iov_check(struct iov_output* output, int ret, const char* name, const char* text, size_t size,
+          unsigned parser_flags, const char* what)
+{
+    check_html(ret, &output->out, html_callbacks, text, size, parser_flags, 0, name, what);
+    check(!output->is_bad, name, "process_output_iov() got an empty batch or segment");
+}
+
+static void
+iov_output_reset(struct iov_output* output)
+{
+    output->out.size = 0;
+    output->n_calls = 0;
+    output->is_bad = 0;
+}
+
+static void
+test_iov(void)
+{
+    struct iov_output output = { 0 };
+    struct membuffer big = { 0 };
+    MD_HTML_CACHE* cache;
+    MD_HTML_CACHE_STATS stats;
+    MD_HTML* html;
+    unsigned i, t;
+    int ret;
+
+    for(t = 0; t < N_FLUSH_THRESHOLDS; t++) {
+        MD_SIZE threshold = flush_thresholds[t];
+
+        for(i = 0; i < n_docs; i++) {
+            const struct doc* doc = &docs[i];
+            MD_TREE* tree;
+            MD_PARSER parser;
+            size_t off;
+
+            /* md_html_render() */
+            html = create_renderer(iov_callbacks, doc->flags, 0);
+            check(md_html_set_flush_threshold(html, threshold) == 0, doc->name,
+                  "md_html_set_flush_threshold() failed");
+            iov_output_reset(&output);
+            ret = md_html_render(html, doc->text, (MD_SIZE) doc->size, &output);
+            iov_check(&output, ret, doc->name, doc->text, doc->size, doc->flags,
+                      "md_html_render() output differs from md_html()");
+            /* Only the end of the document flushes the output, unless the
+             * batch of segments gets full. */
+            if(threshold >= 1024 * 1024)
+                check(output.n_calls <= 1, doc->name, "output flushed before the end of the document");
+            md_html_destroy(html);
+
+            /* md_html_render() with self links, which hold the output of
+             * the headings back. */
+            html = create_renderer(iov_callbacks, doc->flags | MD_FLAG_HEADERSELFLINKS, 0);
+            check(md_html_set_flush_threshold(html, threshold) == 0, doc->name,
+                  "md_html_set_flush_threshold() failed");
+            iov_output_reset(&output);
+            ret = md_html_render(html, doc->text, (MD_SIZE) doc->size, &output);
+            iov_check(&output, ret, doc->name, doc->text, doc->size, doc->flags | MD_FLAG_HEADERSELFLINKS,
+                      "md_html_render() output with self links differs from md_html()");
+            md_html_destroy(html);
+
+            /* md_html_feed() in small chunks. */
+            html = create_renderer(iov_callbacks, doc->flags, 0);
+            check(md_html_set_flush_threshold(html, threshold) == 0, doc->name,
+                  "md_html_set_flush_threshold() failed");
+            iov_output_reset(&output);
+            ret = 0;
+            for(off = 0; ret == 0  &&  off < doc->size; off += 7)
+                ret = md_html_feed(html, doc->text + off, (MD_SIZE) (doc->size - off < 7 ? doc->size - off : 7), &output);
+            if(ret == 0)
+                ret = md_html_finish(html, &output);
+            iov_check(&output, ret, doc->name, doc->text, doc->size, doc->flags,
+                      "md_html_feed() output differs from md_html()");
+            md_html_destroy(html);
+
+            /* md_html_render_tree() */
+            memset(&parser, 0, sizeof(MD_PARSER));
+            parser.flags = doc->flags;
+            if(md_parse_tree(doc->text, (MD_SIZE) doc->size, &parser, &tree) != 0) {
+                fprintf(stderr, "%s: md_parse_tree() failed.\n", doc->name);
+                exit(1);
+            }
+            html = create_renderer(iov_callbacks, doc->flags, 0);
+            check(md_html_set_flush_threshold(html, threshold) == 0, doc->name,
+                  "md_html_set_flush_threshold() failed");
+            iov_output_reset(&output);
+            ret = md_html_render_tree(html, tree, &output);
+            iov_check(&output, ret, doc->name, doc->text, doc->size, doc->flags,
+                      "md_html_render_tree() output differs from md_html()");
+            md_html_destroy(html);
+            md_tree_destroy(tree);
+        }
+    }
+
+    /* A big document: Many batches of segments, the cache, and the parallel
+     * processing. */
+    while(big.size < 1024 * 1024) {
+        for(i = 0; i < n_docs; i++) {
+            if(docs[i].flags == 0) {
+                membuf_append(&big, docs[i].text, docs[i].size);
+                membuf_append(&big, "\n\n", 2);
+            }
+        }
+    }
+
+    cache = md_html_cache_create(64 * 1024 * 1024);
+    if(cache == NULL) {
+        fprintf(stderr, "test_iov: md_html_cache_create() failed.\n");
+        exit(1);
+    }
+    for(t = 0; t < N_FLUSH_THRESHOLDS; t++) {
+        html = create_renderer(iov_callbacks, 0, 0);
+        check(md_html_set_flush_threshold(html, flush_thresholds[t]) == 0, "big document",
+              "md_html_set_flush_threshold() failed");
+        iov_output_reset(&output);
+        ret = md_html_render(html, big.data, (MD_SIZE) big.size, &output);
+        iov_check(&output, ret, "big document", big.data, big.size, 0,
+                  "md_html_render() output differs from md_html()");
+
+        /* Only the very first rendering misses the cache. */
+        md_html_set_cache(html, cache);
+        for(i = 0; i < 2; i++) {
+            iov_output_reset(&output);
+            ret = md_html_render(html, big.data, (MD_SIZE) big.size, &output);
+            iov_check(&output, ret, "big document", big.data, big.size, 0,
+                      "md_html_render() output with the cache differs from md_html()");
+        }
+        md_html_set_cache(html, NULL);
+
+        if(md_html_set_threads(html, 4) == 0) {
+            iov_output_reset(&output);
+            ret = md_html_render(html, big.data, (MD_SIZE) big.size, &output);
+            iov_check(&output, ret, "big document", big.data, big.size, 0,
+                      "md_html_render() output on threads differs from md_html()");
+        }
+        md_html_destroy(html);
+    }
+    md_html_cache_get_stats(cache, &stats);
+    check(stats.n_misses == 1  &&  stats.n_hits == 2 * N_FLUSH_THRESHOLDS - 1, "big document",
+          "the cache has to be hit by all but the first rendering");
+    md_html_cache_destroy(cache);
+
+    membuf_fini(&big);
+    membuf_fini(&output.out);
+}
+
+
+/***************************
+ ***  Output into buffer  ***
+ ***************************/
+
+/* Each document is rendered into buffers of various sizes: Too small ones,
+ * one of the exact size, and a bigger one. *p_needed has to be always the
+ * size of the output of md_html(). If it fits, the buffer has to hold the
+ * output, otherwise some beginning of it. Nothing may be written past the
+ * beginning of the output, nor past the buffer. */
+
+#define CANARY              '\xff'
+#define CANARY_SIZE         16
+
+enum {
+    TO_BUFFER,              /* md_html_to_buffer() */
+    RENDER_TO_BUFFER,       /* md_html_render_to_buffer() */
+    RENDER_TREE_TO_BUFFER   /* md_html_render_tree_to_buffer() */
+};
+
+static const char* const to_buffer_names[] = {
+    "md_html_to_buffer()", "md_html_render_to_buffer()", "md_html_render_tree_to_buffer()"
+};
+
+static void
+buffer_render(int how, const struct doc* doc, unsigned parser_flags, unsigned renderer_flags,
+              MD_HTML* html, const MD_TREE* tree, const struct membuffer* expected,
+              MD_SIZE buffer_size, int null_buffer)
+{
+    struct membuffer output = { 0 };
+    char what[128];
+    char* buffer;
+    size_t alloc = (size_t) buffer_size + CANARY_SIZE;
+    MD_SIZE needed = (MD_SIZE) -1;
+    size_t n_written;
+    size_t i;
+    int ok;
+    int ret;
+
+    buffer = (char*) malloc(alloc);
+    if(buffer == NULL) {
+        fprintf(stderr, "buffer_render: malloc() failed.\n");
+        exit(1);
+    }
+    memset(buffer, CANARY, alloc);
+
+    switch(how) {
+        case TO_BUFFER:
+            ret = md_html_to_buffer(doc->text, (MD_SIZE) doc->size, (null_buffer ? NULL : buffer),
+                                    buffer_size, &needed, parser_flags, renderer_flags);
+            break;
+        case RENDER_TO_BUFFER:
+            ret = md_html_render_to_buffer(html, doc->text, (MD_SIZE) doc->size,
+                                           (null_buffer ? NULL : buffer), buffer_size, &needed, &output);
+            break;
+        default:
+            ret = md_html_render_tree_to_buffer(html, tree, (null_buffer ? NULL : buffer),
+                                                buffer_size, &needed, &output);
+            break;
+    }
+
+    /* Whatever has been written, it has to be a beginning of the output. */
+    n_written = 0;
+    while(n_written < buffer_size  &&  n_written < expected->size  &&
+          buffer[n_written] == expected->data[n_written])
+        n_written++;
+    ok = (ret == 0  &&  needed == expected->size  &&  output.size == 0);
+    for(i = n_written; ok  &&  i < alloc; i++)
+        ok = (buffer[i] == CANARY);
+    /* And if it fits, all of it. */
+    if(ok  &&  !null_buffer  &&  buffer_size >= expected->size)
+        ok = (n_written == expected->size);
+    if(ok  &&  (null_buffer  ||  buffer_size == 0))
+        ok = (n_written == 0);
+
+    snprintf(what, sizeof(what), "%s into a %s buffer of %u bytes", to_buffer_names[how],
+             (null_buffer ? "NULL" : "real"), (unsigned) buffer_size);
+    check(ok, doc->name, what);
+
+    free(buffer);
+    membuf_fini(&output);
+}
+
+static void
+test_buffer(void)
+{
+    struct membuffer expected = { 0 };
+    struct membuffer output = { 0 };
+    MD_HTML_CACHE* cache;
+    unsigned i, j;
+    int how;
+
+    cache = md_html_cache_create(64 * 1024 * 1024);
+    if(cache == NULL) {
+        fprintf(stderr, "test_buffer: md_html_cache_create() failed.\n");
+        exit(1);
+    }
+
+    for(i = 0; i < n_docs; i++) {
+        const struct doc* doc = &docs[i];
+        /* Self links hold the headings back, XHTML just changes the output. */
+        unsigned parser_flags = doc->flags | (i % 2 ? MD_FLAG_HEADERSELFLINKS : 0);
+        unsigned renderer_flags = (i % 3 ? 0 : MD_HTML_FLAG_XHTML);
+        MD_HTML* html;
+        MD_TREE* tree;
+        MD_PARSER parser;
+
+        render_html(doc->text, doc->size, parser_flags, renderer_flags, &expected);
+
+        html = create_renderer(html_callbacks, parser_flags, renderer_flags);
+        /* The cache must not get in the way, whether it is used or not. */
+        if(i % 4 == 0)
+            md_html_set_cache(html, cache);
+
+        memset(&parser, 0, sizeof(MD_PARSER));
+        parser.flags = parser_flags;
+        if(md_parse_tree(doc->text, (MD_SIZE) doc->size, &parser, &tree) != 0) {
+            fprintf(stderr, "%s: md_parse_tree() failed.\n", doc->name);
+            exit(1);
+        }
+
+        for(how = TO_BUFFER; how <= RENDER_TREE_TO_BUFFER; how++) {
+            MD_SIZE n = (MD_SIZE) expected.size;
+
+            /* Only counting. */
+            buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, 0, 1);
+            buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, n, 1);
+            buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, 0, 0);
+
+            /* Too small. */
+            if(n > 1)
+                buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, 1, 0);
+            if(n > 2)
+                buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, n / 2, 0);
+            if(n > 0)
+                buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, n - 1, 0);
+
+            /* Big enough. */
+            buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, n, 0);
+            buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, n + 100, 0);
+
+            /* Every size on the small documents. */
+            for(j = 2; n < 200  &&  j + 1 < n; j++) {
+                if(j != n / 2)
+                    buffer_render(how, doc, parser_flags, renderer_flags, html, tree, &expected, j, 0);
+            }
+        }
+
+        /* The renderer has to work as usual afterwards. */
+        output.size = 0;
+        check_html(md_html_render(html, doc->text, (MD_SIZE) doc->size, &output), &output,
+                   html_callbacks, doc->text, doc->size, parser_flags, renderer_flags, doc->name,
+                   "md_html_render() after rendering into buffers differs from md_html()");
+
+        md_tree_destroy(tree);
+        md_html_destroy(html);
+    }
+
+    md_html_cache_destroy(cache);
+    membuf_fini(&expected);
+    membuf_fini(&output);
+}
+
+
+/**********************
+ ***  Main program  ***
+ **********************/
+
+static const struct {
+    const char* name;
+    void (*func)(void);
+} groups[] = {
+    { "reuse",          test_reuse },
+    { "allocator",      test_allocator },
+    { "edit",           test_edit },
+    { "cache",          test_cache },
+    { "memo",           test_memo },
+    { "iov",            test_iov },
+    { "buffer",         test_buffer },
+};
+
+int
+main(int argc, char** argv)
+{
+    unsigned i;
+
+    if(argc != 3) {
+        fprintf(stderr, "Usage: api_tests GROUP TEST_DIR\n");
+        return 1;
+    }
+
+    for(i = 0; i < sizeof(suites) / sizeof(suites[0]); i++)
+        load_suite(argv[2], suites[i].file, suites[i].flags);
+
+    for(i = 0; i < sizeof(groups) / sizeof(groups[0]); i++) {
+        if(strcmp(argv[1], groups[i].name) == 0)
+            break;
+    }
+    if(i >= sizeof(groups) / sizeof(groups[0])) {
+        fprintf(stderr, "Unknown group: %s\n", argv[1]);
+        return 1;
+    }
+    groups[i].func();
+
+    for(i = 0; i < n_docs; i++)
+        free(docs[i].text);
+    free(docs);
+
+    printf("%u passed, %u failed\n", n_passed, n_failed);
+    return (n_failed == 0 ? 0 : 1);
+}
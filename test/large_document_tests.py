@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Renders a generated document larger than 4 GiB and checks the output.
+#
+# This needs md2html built with MD4C_LARGE_DOCUMENTS (cmake option of the same
+# name), some 5 GiB of free disk space for the temporary input file and a few
+# minutes. Therefore run-tests.sh runs it only when MD4C_LARGE_DOCUMENTS_TEST
+# is set in the environment.
+#
+# The document is made of many copies of a small chunk of paragraphs, followed
+# by a tail placed beyond the 4 GiB boundary. The tail uses a link reference
+# definition from the very beginning of the document, so also the reference
+# lookup works with offsets above 4 GiB. As all the parts render independently,
+# the expected output is the concatenation of the output of the parts rendered
+# on their own.
+
+import argparse
+import os
+import shlex
+import subprocess
+import sys
+import tempfile
+from timeit import default_timer as timer
+
+
+HEAD = b"[ref]: /ref-url \"Ref Title\"\n\n"
+
+CHUNK = (b"Lorem *ipsum* dolor sit amet, **consectetur** adipiscing elit, sed do\n"
+         b"eiusmod `tempor` incididunt ut [labore](/dest \"title\") et dolore magna\n"
+         b"aliqua. Ut enim ad minim veniam, quis nostrud &amp; exercitation ullamco.\n"
+         b"\n"
+         b"> Duis aute irure dolor in <https://example.com/reprehenderit> in voluptate\n"
+         b"> velit esse cillum dolore eu fugiat nulla pariatur.\n"
+         b"\n"
+         b"* Excepteur sint occaecat\n"
+         b"* cupidatat non proident, sunt in culpa qui officia\n"
+         b"\n")
+
+TAIL = (b"# Past the boundary\n"
+        b"\n"
+        b"Tail *emphasis*, **strong**, [ref] and [inline](/x 'y') and\n"
+        b"![image][REF] and <http://example.com>.\n"
+        b"\n"
+        b"    indented code\n"
+        b"\n"
+        b"```c\n"
+        b"fenced code\n"
+        b"```\n")
+
+
+def render(argv, data):
+    p = subprocess.run(argv, input=data, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    if p.returncode != 0:
+        sys.stderr.write(p.stderr.decode("utf-8", "replace"))
+        sys.exit(1)
+    return p.stdout
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Run large document test.')
+    parser.add_argument('-p', '--program', dest='program', nargs='?', default=None,
+            help='program to test')
+    parser.add_argument('--size', dest='size', type=int, default=4096 + 64,
+            help='minimal size of the document in MiB (default: 4160)')
+    parser.add_argument('--tmp-dir', dest='tmp_dir', nargs='?', default=None,
+            help='directory for the temporary input file')
+    args = parser.parse_args(sys.argv[1:])
+
+argv = shlex.split(args.program)
+head_html = render(argv, HEAD)
+chunk_html = render(argv, CHUNK)
+tail_html = render(argv, HEAD + TAIL)
+if head_html != b"" or b"/ref-url" not in tail_html:
+    print("Unexpected output of the document parts.")
+    sys.exit(1)
+
+n_chunks = (args.size * 1024 * 1024 - len(HEAD)) // len(CHUNK) + 1
+chunks_per_write = 4096
+
+f = tempfile.NamedTemporaryFile(suffix=".md", dir=args.tmp_dir, delete=False)
+try:
+    start = timer()
+    f.write(HEAD)
+    block = CHUNK * chunks_per_write
+    n = n_chunks
+    while n >= chunks_per_write:
+        f.write(block)
+        n -= chunks_per_write
+    f.write(CHUNK * n)
+    tail_off = f.tell()
+    f.write(TAIL)
+    f.close()
+    print("Generated {} bytes (tail at offset {}) in {:.1f} secs".format(
+            tail_off + len(TAIL), tail_off, timer() - start))
+
+    start = timer()
+    p = subprocess.Popen(argv + [f.name], stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+    block_html = chunk_html * chunks_per_write
+    n = n_chunks
+    failed_at = None
+    out_off = 0
+    while n > 0 and failed_at is None:
+        expected = block_html if n >= chunks_per_write else chunk_html * n
+        actual = p.stdout.read(len(expected))
+        if actual != expected:
+            failed_at = out_off
+        out_off += len(expected)
+        n -= len(expected) // len(chunk_html)
+    if failed_at is None:
+        actual = p.stdout.read()
+        if actual != tail_html:
+            print("Tail output mismatch:")
+            print(actual[:1024].decode("utf-8", "replace"))
+            failed_at = out_off
+    else:
+        p.stdout.read()
+    err = p.stderr.read().decode("utf-8", "replace")
+    rc = p.wait()
+    end = timer()
+finally:
+    os.unlink(f.name)
+
+if rc != 0:
+    if "too big" in err:
+        print("Skipped: the program is not built with MD4C_LARGE_DOCUMENTS.")
+        sys.exit(0)
+    print("large document [ERRORED (return code {})]".format(rc))
+    print(err)
+    sys.exit(1)
+if failed_at is not None:
+    print("large document [FAILED] (output mismatch near output offset {})".format(failed_at))
+    sys.exit(1)
+print("large document [PASSED] {:.3f} secs".format(end - start))
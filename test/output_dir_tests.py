@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Tests of the batch mode of md2html (--output-dir): Every input file gets its
+# own output file, and inputs which map to the same output file are reported
+# as failed instead of being written over each other.
+
+import argparse
+import os
+import shutil
+import sys
+import tempfile
+from subprocess import *
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Run output directory tests.')
+    parser.add_argument('-p', '--program', dest='program', nargs='?', default=None,
+            help='program to test')
+    args = parser.parse_args(sys.argv[1:])
+
+prog = args.program.split()
+# The program runs in a temporary directory.
+if os.path.exists(prog[0]):
+    prog[0] = os.path.abspath(prog[0])
+
+passed = 0
+failed = 0
+errored = 0
+
+# Input files (relative to the working directory "w") and their contents.
+files = {
+    "w/a.md": "# a\n",
+    "w/a.markdown": "# a.markdown\n",
+    "w/sub/b.md": "# b\n",
+    "x/c.md": "# x/c\n",
+    "y/c.md": "# y/c\n",
+}
+
+# Name, input files, expected output files (relative to the output directory)
+# with their contents, and the inputs expected to be reported as failed.
+cases = [
+    ("distinct outputs",
+        [ "a.md", "sub/b.md", "../x/c.md" ],
+        { "a.html": "<h1>a</h1>\n", "sub/b.html": "<h1>b</h1>\n", "c.html": "<h1>x/c</h1>\n" },
+        []),
+    ("same name, other extension",
+        [ "a.md", "a.markdown" ],
+        { "a.html": "<h1>a</h1>\n" },
+        [ "a.markdown" ]),
+    ("same name, other directory",
+        [ "../y/c.md", "../x/c.md" ],
+        { "c.html": "<h1>y/c</h1>\n" },
+        [ "../x/c.md" ]),
+    ("same path, other spelling",
+        [ "sub/b.md", "./sub//b.md", "sub/./b.md" ],
+        { "sub/b.html": "<h1>b</h1>\n" },
+        [ "./sub//b.md", "sub/./b.md" ]),
+]
+
+def list_outputs(out_dir):
+    outputs = {}
+    for root, dirs, names in os.walk(out_dir):
+        for name in names:
+            path = os.path.join(root, name)
+            with open(path, "r") as f:
+                outputs[os.path.relpath(path, out_dir).replace(os.sep, "/")] = f.read()
+    return outputs
+
+tmpdir = tempfile.mkdtemp()
+
+try:
+    for path, contents in files.items():
+        path = os.path.join(tmpdir, path)
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, "w") as f:
+            f.write(contents)
+
+    for name, inputs, expected, expected_failed in cases:
+        out_dir = os.path.join(tmpdir, "out")
+        p = Popen(prog + [ "--output-dir=" + out_dir, "-j", "4" ] + inputs,
+                  stdout=PIPE, stderr=PIPE, cwd=os.path.join(tmpdir, "w"))
+        [out, err] = p.communicate()
+        err = err.decode("utf-8", "replace")
+
+        if p.returncode < 0  or  "Sanitizer" in err  or  "runtime error" in err:
+            errored += 1
+            print('{:35} [ERRORED (return code {})]'.format(name, p.returncode))
+            print(err)
+        else:
+            actual = list_outputs(out_dir)
+            actual_failed = [ i for i in inputs if ("Cannot convert " + i + ":") in err ]
+            summary = "(%u failed)" % len(expected_failed)
+            if actual == expected  and  actual_failed == expected_failed  and  \
+               summary in err  and  (p.returncode == 0) == (len(expected_failed) == 0):
+                print('{:35} [PASSED]'.format(name))
+                passed += 1
+            else:
+                print('{:35} [FAILED]'.format(name))
+                print(repr(actual))
+                print(err)
+                failed += 1
+
+        shutil.rmtree(out_dir, ignore_errors=True)
+finally:
+    shutil.rmtree(tmpdir, ignore_errors=True)
+
+print("%d passed, %d failed, %d errored" % (passed, failed, errored))
+if (failed == 0 and errored == 0):
+    exit(0)
+else:
+    exit(1)
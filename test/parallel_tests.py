@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Tests of the parallel processing (md2html --threads=N): The output has to be
+# the same as with a single thread.
+#
+# Only the inputs of md_html_render() are processed in parallel, so the inputs
+# are passed as files. Unless md4c is built with a tiny
+# MD4C_PARALLEL_MIN_RANGE_SIZE, the spec examples are too small to be split,
+# so every suite is also converted as one big document made of all its
+# examples.
+
+import argparse
+import os
+import shutil
+import sys
+import tempfile
+from subprocess import *
+from spec_tests import get_tests
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Run parallel processing tests.')
+    parser.add_argument('-p', '--program', dest='program', nargs='?', default=None,
+            help='program to test')
+    parser.add_argument('-t', '--threads', dest='threads', type=int, default=4,
+            help='number of threads')
+    args = parser.parse_args(sys.argv[1:])
+
+prog = args.program.split()
+# The program runs in a temporary directory.
+if os.path.exists(prog[0]):
+    prog[0] = os.path.abspath(prog[0])
+threads = [ "--threads=%d" % args.threads ]
+test_dir = os.path.dirname(os.path.abspath(__file__))
+
+# Spec files and the flags to convert them with.
+suites = [
+    ("spec.txt", []),
+    ("coverage.txt", []),
+    ("tables.txt", [ "--ftables" ]),
+    ("strikethrough.txt", [ "--fstrikethrough" ]),
+    ("tasklists.txt", [ "--ftasklists" ]),
+    ("wiki-links.txt", [ "--fwiki-links", "--ftables" ]),
+    ("latex-math.txt", [ "--flatex-math" ]),
+    ("header-self-links.txt", [ "--fheader-self-links" ]),
+]
+
+# Size of the big document (several times the default minimal range size).
+BIG_DOC_SIZE = 1024 * 1024
+
+passed = 0
+failed = 0
+errored = 0
+
+def convert(argv):
+    p = Popen(prog + argv, stdout=PIPE, stderr=PIPE, cwd=tmpdir)
+    out, err = p.communicate()
+    return p.returncode, out, err
+
+def compare(name, expected, actual):
+    global passed, failed
+    if actual == expected:
+        passed += 1
+    else:
+        failed += 1
+        print("{:35} [FAILED]".format(name))
+        if len(expected) < 1000 and len(actual) < 1000:
+            print("Expected: " + repr(expected))
+            print("Got:      " + repr(actual))
+
+tmpdir = tempfile.mkdtemp()
+
+try:
+    for spec, flags in suites:
+        tests = get_tests(os.path.join(test_dir, spec))
+        # Every example alone.
+        for test in tests:
+            name = "%s: example %d" % (spec, test['example'])
+            with open(os.path.join(tmpdir, "example.md"), "wb") as f:
+                f.write(test['markdown'].encode("utf-8"))
+            ret1, expected, err = convert(flags + [ "example.md" ])
+            ret2, actual, err = convert(threads + flags + [ "example.md" ])
+            if ret1 != 0 or ret2 != 0:
+                errored += 1
+                print("{:35} [ERRORED (return code {})]".format(name, ret1 or ret2))
+            else:
+                compare(name, expected, actual)
+
+        # All the examples in one big document.
+        name = "%s: all examples" % spec
+        text = "\n\n".join(test['markdown'] for test in tests).encode("utf-8")
+        with open(os.path.join(tmpdir, "big.md"), "wb") as f:
+            for i in range(BIG_DOC_SIZE // len(text) + 1):
+                f.write(text)
+                f.write(b"\n\n")
+        ret1, expected, err = convert(flags + [ "big.md" ])
+        ret2, actual, err = convert(threads + flags + [ "big.md" ])
+        if ret1 != 0 or ret2 != 0:
+            errored += 1
+            print("{:35} [ERRORED (return code {})]".format(name, ret1 or ret2))
+        else:
+            compare(name, expected, actual)
+finally:
+    shutil.rmtree(tmpdir)
+
+print("%d passed, %d failed, %d errored" % (passed, failed, errored))
+if (failed == 0 and errored == 0):
+    exit(0)
+else:
+    exit(1)
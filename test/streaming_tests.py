@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Tests of the streaming input (md_html_feed()) via md2html reading the
+# standard input in small chunks (--chunk-size).
+
+import argparse
+import os
+import re
+import select
+import sys
+import tempfile
+import threading
+from subprocess import *
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Run streaming tests.')
+    parser.add_argument('-p', '--program', dest='program', nargs='?', default=None,
+            help='program to test')
+    args = parser.parse_args(sys.argv[1:])
+
+prog = args.program.split()
+
+# Input, size of the chunks, a regex the output must match, and whether
+# the case needs md2html to skip the BOM.
+chunked = {
+    "BOM in one chunk":
+            (b"\xef\xbb\xbf# Hi\n", 64,
+            re.compile(b"^<h1>Hi</h1>\n$"), True),
+    "BOM split after 1 byte":
+            (b"\xef\xbb\xbf# Hi\n", 1,
+            re.compile(b"^<h1>Hi</h1>\n$"), True),
+    "BOM split after 2 bytes":
+            (b"\xef\xbb\xbf# Hi\n", 2,
+            re.compile(b"^<h1>Hi</h1>\n$"), True),
+    "incomplete BOM":
+            (b"\xef\xbb# Hi\n", 1,
+            re.compile(b"^<p>\xef\xbb# Hi</p>\n$"), False),
+    "document shorter than BOM":
+            (b"\xef\xbb", 1,
+            re.compile(b"^<p>\xef\xbb</p>\n$"), False),
+    "BOM only":
+            (b"\xef\xbb\xbf", 1,
+            re.compile(b"^$"), True),
+}
+
+# md2html skips the BOM only when it is built for UTF-8 (i.e. not with
+# MD4C_USE_ASCII). Find out from a document which is not streamed.
+def skips_bom():
+    fd, path = tempfile.mkstemp(suffix=".md")
+    try:
+        with os.fdopen(fd, "wb") as f:
+            f.write(b"\xef\xbb\xbf# Hi\n")
+        out = Popen(prog + [path], stdout=PIPE, stderr=PIPE).communicate()[0]
+    finally:
+        os.remove(path)
+    return out == b"<h1>Hi</h1>\n"
+
+passed = 0
+failed = 0
+errored = 0
+
+has_bom_skip = skips_bom()
+
+for description in sorted(chunked):
+    (inp, chunk_size, regex, needs_bom_skip) = chunked[description]
+    if needs_bom_skip and not has_bom_skip:
+        print('{:35} [SKIPPED (no BOM skipping in this build)]'.format(description))
+        continue
+    p = Popen(prog + ["--chunk-size=%d" % chunk_size], stdout=PIPE, stdin=PIPE, stderr=PIPE)
+    [actual, err] = p.communicate(input=inp)
+    if p.returncode != 0:
+        errored += 1
+        print('{:35} [ERRORED (return code {})]'.format(description, p.returncode))
+        print(err)
+    elif regex.search(actual):
+        print('{:35} [PASSED]'.format(description))
+        passed += 1
+    else:
+        print('{:35} [FAILED]'.format(description))
+        print(repr(actual))
+        failed += 1
+
+# Blocks have to be rendered before the end of the input (i.e. before
+# md_html_finish()), unless they contain a label which may still become
+# a reference link. The first block contains only links which cannot.
+early = {
+    "inline link":
+            b"See [the docs](http://x.y/ \"title\") and ![img](/i.png).\n\n",
+    "wiki link":
+            b"See [[the docs]] and [[docs|the docs]].\n\n",
+    "task list":
+            b"- [x] done\n- [ ] todo\n\n",
+}
+
+early_flags = [ "--fwiki-links", "--ftasklists", "--chunk-size=4096" ]
+early_filler = b"Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n\n" * 4096
+
+def read_output(p, timeout):
+    r, w, x = select.select([p.stdout], [], [], timeout)
+    if not r:
+        return None
+    return os.read(p.stdout.fileno(), 64 * 1024)
+
+for description in sorted(early):
+    inp = early[description] + early_filler
+    expected = Popen(prog + early_flags, stdout=PIPE, stdin=PIPE).communicate(input=inp)[0]
+
+    # Keep the input open until some output arrives. (The writer runs in its
+    # own thread as md2html blocks when nobody reads its output.)
+    p = Popen(prog + early_flags, stdout=PIPE, stdin=PIPE, stderr=PIPE)
+    close_input = threading.Event()
+    def write_input():
+        try:
+            p.stdin.write(inp)
+            p.stdin.flush()
+            close_input.wait(30)
+            p.stdin.close()
+        except (BrokenPipeError, ValueError):
+            pass
+    writer = threading.Thread(target=write_input)
+    writer.start()
+
+    early_output = read_output(p, 10)
+    close_input.set()
+    actual = (early_output or b"") + p.stdout.read()
+    writer.join()
+    err = p.stderr.read()
+    p.wait()
+
+    if p.returncode != 0:
+        errored += 1
+        print('{:35} [ERRORED (return code {})]'.format(description, p.returncode))
+        print(err)
+    elif early_output and actual == expected:
+        print('{:35} [PASSED]'.format(description))
+        passed += 1
+    else:
+        print('{:35} [FAILED]'.format(description))
+        print("%d bytes before the end of the input" % len(early_output or b""))
+        failed += 1
+
+print("%d passed, %d failed, %d errored" % (passed, failed, errored))
+if (failed == 0 and errored == 0):
+    exit(0)
+else:
+    exit(1)
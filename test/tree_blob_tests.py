@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Tests of md_tree_save() and md_tree_load() via md2html --save-tree and
+# --load-tree: Saved trees have to render the same HTML as the document,
+# and corrupted blobs have to be rejected (or at least rendered without any
+# crash).
+
+import argparse
+import os
+import random
+import sys
+import tempfile
+from subprocess import *
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Run tree blob tests.')
+    parser.add_argument('-p', '--program', dest='program', nargs='?', default=None,
+            help='program to test')
+    args = parser.parse_args(sys.argv[1:])
+
+prog = args.program.split()
+
+documents = {
+    "blocks":
+        "Title\n=====\n\n## Sub *title*\n\n> quote\n\n- a\n- b\n\n"
+        "3) c\n4) d\n\n```c\ncode\n```\n\n    indented\n\n<div>html</div>\n\n---\n",
+    "spans":
+        "Text with *emph*, **strong**, `code`, [link](/url \"title\"), "
+        "![image](/img.png), <http://example.com> and &amp; &copy;.\n",
+    "extensions":
+        "| a | b | c |\n|:--|:-:|--:|\n| ~~x~~ | $y$ | [[z|w]] |\n\n"
+        "- [ ] todo\n- [x] done\n",
+}
+
+flags = [ "--github", "--flatex-math", "--fwiki-links", "--funderline" ]
+
+passed = 0
+failed = 0
+errored = 0
+
+def run(options, text=b""):
+    p = Popen(prog + flags + options, stdout=PIPE, stdin=PIPE, stderr=PIPE)
+    out, err = p.communicate(input=text)
+    return p.returncode, out, err
+
+def check(name, ok, info=""):
+    global passed, failed
+    if ok:
+        passed += 1
+    else:
+        failed += 1
+        print("{:35} [FAILED] {}".format(name, info))
+
+# A crash counts as an error rather than a failure.
+def check_no_crash(name, ret, err):
+    global passed, errored
+    if crashed(ret, err):
+        errored += 1
+        print("{:35} [ERRORED (return code {})]".format(name, ret))
+        print(err.decode("utf-8", "replace"))
+    else:
+        passed += 1
+
+def crashed(ret, err):
+    return ret < 0  or  b"Sanitizer" in err  or  b"runtime error" in err
+
+def rejected(ret, err):
+    return ret != 0  and  b"Cannot load the tree" in err  and  not crashed(ret, err)
+
+def save(text, path):
+    ret, out, err = run(["--save-tree=" + path], text)
+    if ret != 0:
+        raise Exception("md2html --save-tree failed: " + err.decode("utf-8", "replace"))
+    with open(path, "rb") as f:
+        return f.read(), out
+
+def load(blob, path):
+    with open(path, "wb") as f:
+        f.write(blob)
+    return run(["--load-tree=" + path])
+
+tmpdir = tempfile.mkdtemp()
+blob_path = os.path.join(tmpdir, "doc.blob")
+bad_path = os.path.join(tmpdir, "bad.blob")
+
+try:
+    # Round trip: The saved tree renders the same HTML as the document.
+    for name, doc in sorted(documents.items()):
+        text = doc.encode("utf-8")
+        ret, expected, err = run([], text)
+        blob, out = save(text, blob_path)
+        check(name + ": --save-tree", out == expected)
+        ret, out, err = load(blob, bad_path)
+        check(name + ": --load-tree", ret == 0  and  out == expected)
+
+    blob, out = save(documents["blocks"].encode("utf-8"), blob_path)
+
+    # Truncated blobs.
+    for size in range(0, len(blob)):
+        ret, out, err = load(blob[:size], bad_path)
+        check("truncated to %d bytes" % size, rejected(ret, err))
+
+    # Invalid details of the blocks. The two documents of each pair differ
+    # only in the detail (and the text of the document in the blob), so one
+    # of the differing bytes is the detail: With a value the parser never
+    # produces there, the blob has to be rejected.
+    pairs = [
+        ("heading level", "Hi\n==\n", "Hi\n--\n", [0, 7, 255]),
+        ("cell alignment", "|a|\n|:-|\n", "|a|\n|-:|\n", [4, 255]),
+        ("list mark", "- a\n", "* a\n", [ord('x'), 0]),
+        ("list delimiter", "1. a\n", "1) a\n", [ord(':'), 0]),
+        ("task mark", "- [x] a\n", "- [ ] a\n", [ord('y'), 0]),
+    ]
+    for name, doc_a, doc_b, bad_values in pairs:
+        blob_a, out = save(doc_a.encode("utf-8"), blob_path)
+        blob_b, out = save(doc_b.encode("utf-8"), blob_path)
+        diffs = [ i for i in range(len(blob_a)) if blob_a[i] != blob_b[i] ]
+        for value in bad_values:
+            n_rejected = 0
+            for i in diffs:
+                bad = bytearray(blob_a)
+                bad[i] = value
+                ret, out, err = load(bytes(bad), bad_path)
+                check_no_crash("%s %d at %d" % (name, value, i), ret, err)
+                if rejected(ret, err):
+                    n_rejected += 1
+            check("%s %d: rejected" % (name, value), len(diffs) > 0  and  n_rejected > 0)
+
+    # Random corruption of 1 to 4 bytes must never crash.
+    rnd = random.Random(4242)
+    for n in range(300):
+        bad = bytearray(blob)
+        for k in range(rnd.randint(1, 4)):
+            bad[rnd.randrange(len(bad))] = rnd.randrange(256)
+        ret, out, err = load(bytes(bad), bad_path)
+        check_no_crash("random corruption #%d" % n, ret, err)
+finally:
+    for path in (blob_path, bad_path):
+        if os.path.exists(path):
+            os.remove(path)
+    os.rmdir(tmpdir)
+
+print("%d passed, %d failed, %d errored" % (passed, failed, errored))
+if (failed == 0 and errored == 0):
+    exit(0)
+else:
+    exit(1)